@@ -1,662 +1,2215 @@
-// Copyright 2015-2016 Espressif Systems (Shanghai) PTE LTD
-//
-// Licensed under the Apache License, Version 2.0 (the "License");
-// you may not use this file except in compliance with the License.
-// You may obtain a copy of the License at
-//     http://www.apache.org/licenses/LICENSE-2.0
-//
-// Unless required by applicable law or agreed to in writing, software
-// distributed under the License is distributed on an "AS IS" BASIS,
-// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-// See the License for the specific language governing permissions and
-// limitations under the License.
-#include "esp_http_server.h"
-#include "esp_timer.h"
-#include "esp_camera.h"
-#include "img_converters.h"
-#include "camera_index.h"
-#include "Arduino.h"
-#include <Preferences.h>
-#include <time.h>
-#include <sys/time.h>
-#include "RTClib.h"
-
-#include "fb_gfx.h"
-
-typedef struct {
-        size_t size; //number of values used for filtering
-        size_t index; //current value index
-        size_t count; //value count
-        int sum;
-        int * values; //array to be filled with values
-} ra_filter_t;
-
-typedef struct {
-        httpd_req_t *req;
-        size_t len;
-} jpg_chunking_t;
-
-#define PART_BOUNDARY "123456789000000000000987654321"
-static const char* _STREAM_CONTENT_TYPE = "multipart/x-mixed-replace;boundary=" PART_BOUNDARY;
-static const char* _STREAM_BOUNDARY = "\r\n--" PART_BOUNDARY "\r\n";
-static const char* _STREAM_PART = "Content-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n";
-
-static ra_filter_t ra_filter;
-httpd_handle_t stream_httpd = NULL;
-httpd_handle_t camera_httpd = NULL;
-
-//static mtmn_config_t mtmn_config = {0};
-static int8_t detection_enabled = 0;
-static int8_t recognition_enabled = 0;
-static int8_t is_enrolling = 0;
-// static face_id_list id_list = {0};
-int8_t current_hour = 0;
-int8_t current_min = 0;
-
-extern Preferences preferences ;
-extern RTC_DS3231 rtc;
-
-static ra_filter_t * ra_filter_init(ra_filter_t * filter, size_t sample_size){
-    memset(filter, 0, sizeof(ra_filter_t));
-
-    filter->values = (int *)malloc(sample_size * sizeof(int));
-    if(!filter->values){
-        return NULL;
-    }
-    memset(filter->values, 0, sample_size * sizeof(int));
-
-    filter->size = sample_size;
-    return filter;
-}
-
-static int ra_filter_run(ra_filter_t * filter, int value){
-    if(!filter->values){
-        return value;
-    }
-    filter->sum -= filter->values[filter->index];
-    filter->values[filter->index] = value;
-    filter->sum += filter->values[filter->index];
-    filter->index++;
-    filter->index = filter->index % filter->size;
-    if (filter->count < filter->size) {
-        filter->count++;
-    }
-    return filter->sum / filter->count;
-}
-
-static size_t jpg_encode_stream(void * arg, size_t index, const void* data, size_t len){
-    jpg_chunking_t *j = (jpg_chunking_t *)arg;
-    if(!index){
-        j->len = 0;
-    }
-    if(httpd_resp_send_chunk(j->req, (const char *)data, len) != ESP_OK){
-        return 0;
-    }
-    j->len += len;
-    return len;
-}
-
-static esp_err_t capture_handler(httpd_req_t *req){
-    camera_fb_t * fb = NULL;
-    esp_err_t res = ESP_OK;
-    int64_t fr_start = esp_timer_get_time();
-
-    fb = esp_camera_fb_get();
-    if (!fb) {
-        Serial.println("Camera capture failed");
-        httpd_resp_send_500(req);
-        return ESP_FAIL;
-    }
-
-    httpd_resp_set_type(req, "image/jpeg");
-    httpd_resp_set_hdr(req, "Content-Disposition", "inline; filename=capture.jpg");
-    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-
-    size_t out_len, out_width, out_height;
-    uint8_t * out_buf;
-    bool s;
-    bool detected = false;
-    int face_id = 0;
-
-    size_t fb_len = 0;
-    if(fb->format == PIXFORMAT_JPEG){
-        fb_len = fb->len;
-        res = httpd_resp_send(req, (const char *)fb->buf, fb->len);
-    } else {
-        jpg_chunking_t jchunk = {req, 0};
-        res = frame2jpg_cb(fb, 80, jpg_encode_stream, &jchunk)?ESP_OK:ESP_FAIL;
-        httpd_resp_send_chunk(req, NULL, 0);
-        fb_len = jchunk.len;
-    }
-    esp_camera_fb_return(fb);
-    int64_t fr_end = esp_timer_get_time();
-    Serial.printf("JPG: %uB %ums\n", (uint32_t)(fb_len), (uint32_t)((fr_end - fr_start)/1000));
-    return res;
-}
-
-static esp_err_t stream_handler(httpd_req_t *req){
-    camera_fb_t * fb = NULL;
-    esp_err_t res = ESP_OK;
-    size_t _jpg_buf_len = 0;
-    uint8_t * _jpg_buf = NULL;
-    char * part_buf[64];
-    bool detected = false;
-    int face_id = 0;
-    int64_t fr_start = 0;
-    int64_t fr_ready = 0;
-    int64_t fr_face = 0;
-    int64_t fr_recognize = 0;
-    int64_t fr_encode = 0;
-
-    static int64_t last_frame = 0;
-    if(!last_frame) {
-        last_frame = esp_timer_get_time();
-    }
-
-    res = httpd_resp_set_type(req, _STREAM_CONTENT_TYPE);
-    if(res != ESP_OK){
-        return res;
-    }
-
-    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-
-    while(true){
-        detected = false;
-        face_id = 0;
-        fb = esp_camera_fb_get();
-        if (!fb) {
-            Serial.println("Camera capture failed");
-            res = ESP_FAIL;
-        } else {
-            fr_start = esp_timer_get_time();
-            fr_ready = fr_start;
-            fr_face = fr_start;
-            fr_encode = fr_start;
-            fr_recognize = fr_start;
-
-            if(fb->format != PIXFORMAT_JPEG){
-                bool jpeg_converted = frame2jpg(fb, 80, &_jpg_buf, &_jpg_buf_len);
-                esp_camera_fb_return(fb);
-                fb = NULL;
-                if(!jpeg_converted){
-                    Serial.println("JPEG compression failed");
-                    res = ESP_FAIL;
-                }
-            } else {
-                _jpg_buf_len = fb->len;
-                _jpg_buf = fb->buf;
-            }
-        }
-        if(res == ESP_OK){
-            size_t hlen = snprintf((char *)part_buf, 64, _STREAM_PART, _jpg_buf_len);
-            res = httpd_resp_send_chunk(req, (const char *)part_buf, hlen);
-        }
-        if(res == ESP_OK){
-            res = httpd_resp_send_chunk(req, (const char *)_jpg_buf, _jpg_buf_len);
-        }
-        if(res == ESP_OK){
-            res = httpd_resp_send_chunk(req, _STREAM_BOUNDARY, strlen(_STREAM_BOUNDARY));
-        }
-        if(fb){
-            esp_camera_fb_return(fb);
-            fb = NULL;
-            _jpg_buf = NULL;
-        } else if(_jpg_buf){
-            free(_jpg_buf);
-            _jpg_buf = NULL;
-        }
-        if(res != ESP_OK){
-            break;
-        }
-        int64_t fr_end = esp_timer_get_time();
-
-        int64_t ready_time = (fr_ready - fr_start)/1000;
-        int64_t face_time = (fr_face - fr_ready)/1000;
-        int64_t recognize_time = (fr_recognize - fr_face)/1000;
-        int64_t encode_time = (fr_encode - fr_recognize)/1000;
-        int64_t process_time = (fr_encode - fr_start)/1000;
-        
-        int64_t frame_time = fr_end - last_frame;
-        last_frame = fr_end;
-        frame_time /= 1000;
-        uint32_t avg_frame_time = ra_filter_run(&ra_filter, frame_time);
-        Serial.printf("MJPG: %uB %ums (%.1ffps), AVG: %ums (%.1ffps), %u+%u+%u+%u=%u %s%d\n",
-            (uint32_t)(_jpg_buf_len),
-            (uint32_t)frame_time, 1000.0 / (uint32_t)frame_time,
-            avg_frame_time, 1000.0 / avg_frame_time,
-            (uint32_t)ready_time, (uint32_t)face_time, (uint32_t)recognize_time, (uint32_t)encode_time, (uint32_t)process_time,
-            (detected)?"DETECTED ":"", face_id
-        );
-    }
-
-    last_frame = 0;
-    return res;
-}
-
-extern void initialize_camera(void);
-extern void update_image_settings(void); 
-
-static esp_err_t cmd_handler(httpd_req_t *req){
-    char*  buf;
-    size_t buf_len;
-    char variable[32] = {0,};
-    char value[32] = {0,};
-
-    buf_len = httpd_req_get_url_query_len(req) + 1;
-    if (buf_len > 1) {
-        buf = (char*)malloc(buf_len);
-        if(!buf){
-            httpd_resp_send_500(req);
-            return ESP_FAIL;
-        }
-        if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
-            if (httpd_query_key_value(buf, "var", variable, sizeof(variable)) == ESP_OK &&
-                httpd_query_key_value(buf, "val", value, sizeof(value)) == ESP_OK) {
-            } else {
-                free(buf);
-                httpd_resp_send_404(req);
-                return ESP_FAIL;
-            }
-        } else {
-            free(buf);
-            httpd_resp_send_404(req);
-            return ESP_FAIL;
-        }
-        free(buf);
-    } else {
-        httpd_resp_send_404(req);
-        return ESP_FAIL;
-    }
-
-    int val = atoi(value);
-    sensor_t * s = esp_camera_sensor_get();
-    int res = 0;
-    struct timeval tv_now ;
-    struct tm * timeinfo;
-    char buffer [80];
-    
-    gettimeofday(&tv_now, NULL);
-    timeinfo = localtime ((const time_t *)&tv_now);
-    strftime(buffer, 80, "%F-%X",timeinfo);
-    Serial.printf("cmd called @ %s with %s = %s\n", buffer, variable, value);
-    
-    if(!strcmp(variable, "current_time")) {
-      // Accepted format is 2022-06-12T22:30
-      int y,m,d,H,M,c;
-      struct tm tm;
-      DateTime now ;
-
-      Serial.printf("current time set to %s\n", value);
-      sscanf(value,"%d%c%d%c%d%c%d%c%d", &y,&c,&m,&c,&d,&c,&H,&c,&M);   
-      Serial.printf("y:%d m:%d d:%d H:%d M:%d\n", y,m,d,H,M);
-      now = DateTime(y,m-1,d,H,M,0) ; // convert from month base Jan@1 to base Jan@0
-            
-      tm.tm_year = y - 1900;
-      tm.tm_mon = m-1;
-      tm.tm_mday = d;
-      tm.tm_hour = H;
-      tm.tm_min = M; 
-      tm.tm_sec = 0;
-      time_t t = mktime(&tm);
-
-      struct timeval tv_now = { .tv_sec = t };
-
-      settimeofday(&tv_now, NULL);
-
-      esp_camera_deinit();
-      Serial.printf("writing time\n");
-      rtc.adjust(now);
-      initialize_camera();
-      update_image_settings();  
-    }
-    else if(!strcmp(variable, "start_time")) {
-      int y,m,d,H,M,c;
-      struct tm tm;
-      
-      sscanf(value,"%d%c%d%c%d%c%d%c%d", &y,&c,&m,&c,&d,&c,&H,&c,&M);   
-      tm.tm_year = y - 1900;
-      tm.tm_mon = m-1;
-      tm.tm_mday = d;
-      tm.tm_hour = H;
-      tm.tm_min = M; 
-      tm.tm_sec = 0;
-      time_t t = mktime(&tm);
-
-      preferences.putULong64("start_time", (uint64_t)t);
-      Serial.printf("picture time set to %ld\n", (unsigned long)t);
-    }
-    else if(!strcmp(variable, "frequency")) {//Currently this code doesn't take daylight savings time into account once deployed, feature to add in the future
-      Serial.printf("freq set to %s\n", value);
-      if (tolower(value[0]) == 'm' && tolower(value [1]) == 'o') { // Month
-          preferences.putChar("frequency", 'm'); // using m from strftime method
-      } else if (tolower(value[0]) == 'w' ) { // Week
-          preferences.putChar("frequency", 'w'); // using w from strftime method        
-      } else if (tolower(value[0]) == 'd' ) { // Day
-          preferences.putChar("frequency", 'd'); // using d from strftime method        
-      } else if (tolower(value[0]) == 'h' ) { // Hour
-          preferences.putChar("frequency", 'H'); // using H from strftime method        
-      } else if (tolower(value[0]) == 'm' && tolower(value[1]) == 'i') { // Minute
-          preferences.putChar("frequency", 'M'); // using M from strftime method        
-      } else { // Error
-        Serial.println("freq error");
-      }
-    }
-    else if(!strcmp(variable, "framesize")) {
-        if(s->pixformat == PIXFORMAT_JPEG) { 
-          res = s->set_framesize(s, (framesize_t)val);
-          preferences.putUInt("framesize", val);
-        }
-    }
-    else if(!strcmp(variable, "quality")) {
-      res = s->set_quality(s, val);
-      preferences.putUInt("quality", val);
-    }
-    else if(!strcmp(variable, "contrast")) { 
-      res = s->set_contrast(s, val); 
-      preferences.putUInt("contrast", val);
-    }
-    else if(!strcmp(variable, "brightness")) {
-      res = s->set_brightness(s, val);
-      preferences.putUInt("brightness", val);
-    }
-    else if(!strcmp(variable, "saturation")) { 
-      res = s->set_saturation(s, val);
-      preferences.putUInt("saturation", val);
-    }
-    else if(!strcmp(variable, "gainceiling")) {
-      res = s->set_gainceiling(s, (gainceiling_t)val);
-      preferences.putUInt("gainceiling", val);
-    }
-    else if(!strcmp(variable, "colorbar")) { 
-      res = s->set_colorbar(s, val);
-      preferences.putUInt("colorbar", val);
-    }
-    else if(!strcmp(variable, "awb")) { 
-      res = s->set_whitebal(s, val);
-      preferences.putUInt("awb", val);
-    }
-    else if(!strcmp(variable, "agc")) { 
-      res = s->set_gain_ctrl(s, val);
-      preferences.putUInt("agc", val);
-   }
-    else if(!strcmp(variable, "aec")) {
-      res = s->set_exposure_ctrl(s, val);
-      preferences.putUInt("aec", val);
-    }
-    else if(!strcmp(variable, "hmirror")) { 
-      res = s->set_hmirror(s, val);
-      preferences.putUInt("hmirror", val);
-    }
-    else if(!strcmp(variable, "vflip")) {
-      res = s->set_vflip(s, val);
-      preferences.putUInt("vflip", val);
-    }
-    else if(!strcmp(variable, "awb_gain")) {
-      res = s->set_awb_gain(s, val);
-      preferences.putUInt("awb_gain", val);
-    }
-    else if(!strcmp(variable, "agc_gain")) {
-      res = s->set_agc_gain(s, val);
-      preferences.putUInt("agc_gain", val);
-    }
-    else if(!strcmp(variable, "aec_value")) {
-      res = s->set_aec_value(s, val);
-      preferences.putUInt("aec_value", val);
-    }
-    else if(!strcmp(variable, "aec2")) {
-      res = s->set_aec2(s, val);
-      preferences.putUInt("aec2", val);
-    }
-    else if(!strcmp(variable, "dcw")) {
-      res = s->set_dcw(s, val);
-      preferences.putUInt("dcw", val);
-    }
-    else if(!strcmp(variable, "bpc")) {
-      res = s->set_bpc(s, val);
-      preferences.putUInt("bpc", val);
-    }
-    else if(!strcmp(variable, "wpc")) {
-      res = s->set_wpc(s, val);
-      preferences.putUInt("wpc", val);
-    }
-    else if(!strcmp(variable, "raw_gma")) {
-      res = s->set_raw_gma(s, val);
-      preferences.putUInt("raw_gma", val);
-    }
-    else if(!strcmp(variable, "lenc")) {
-      res = s->set_lenc(s, val);
-      preferences.putUInt("lenc", val);
-    }
-    else if(!strcmp(variable, "special_effect")) {
-      res = s->set_special_effect(s, val);
-      preferences.putUInt("special_effect", val);
-    }
-    else if(!strcmp(variable, "wb_mode")) {
-      res = s->set_wb_mode(s, val);
-      preferences.putUInt("wb_mode", val);
-    }
-    else if(!strcmp(variable, "ae_level")) {
-      res = s->set_ae_level(s, val);
-      preferences.putUInt("ae_level", val);
-    }
-    else if(!strcmp(variable, "face_detect")) {
-        detection_enabled = val;
-        if(!detection_enabled) {
-            recognition_enabled = 0;
-        }
-    }
-    else if(!strcmp(variable, "face_enroll")) {
-      is_enrolling = val;
-    }
-    else if(!strcmp(variable, "face_recognize")) {
-        recognition_enabled = val;
-        if(recognition_enabled){
-            detection_enabled = val;
-        }
-    }
-    else {
-        res = -1;
-    }
-
-    if(res){
-        return httpd_resp_send_500(req);
-    }
-
-    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-    return httpd_resp_send(req, NULL, 0);
-}
-
-static esp_err_t status_handler(httpd_req_t *req){
-    static char json_response[1024];
-
-    sensor_t * s = esp_camera_sensor_get();
-    char * p = json_response;
-    *p++ = '{';
-
-    p+=sprintf(p, "\"framesize\":%u,", s->status.framesize);
-    p+=sprintf(p, "\"quality\":%u,", s->status.quality);
-    p+=sprintf(p, "\"brightness\":%d,", s->status.brightness);
-    p+=sprintf(p, "\"contrast\":%d,", s->status.contrast);
-    p+=sprintf(p, "\"saturation\":%d,", s->status.saturation);
-    p+=sprintf(p, "\"sharpness\":%d,", s->status.sharpness);
-    p+=sprintf(p, "\"special_effect\":%u,", s->status.special_effect);
-    p+=sprintf(p, "\"wb_mode\":%u,", s->status.wb_mode);
-    p+=sprintf(p, "\"awb\":%u,", s->status.awb);
-    p+=sprintf(p, "\"awb_gain\":%u,", s->status.awb_gain);
-    p+=sprintf(p, "\"aec\":%u,", s->status.aec);
-    p+=sprintf(p, "\"aec2\":%u,", s->status.aec2);
-    p+=sprintf(p, "\"ae_level\":%d,", s->status.ae_level);
-    p+=sprintf(p, "\"aec_value\":%u,", s->status.aec_value);
-    p+=sprintf(p, "\"agc\":%u,", s->status.agc);
-    p+=sprintf(p, "\"agc_gain\":%u,", s->status.agc_gain);
-    p+=sprintf(p, "\"gainceiling\":%u,", s->status.gainceiling);
-    p+=sprintf(p, "\"bpc\":%u,", s->status.bpc);
-    p+=sprintf(p, "\"wpc\":%u,", s->status.wpc);
-    p+=sprintf(p, "\"raw_gma\":%u,", s->status.raw_gma);
-    p+=sprintf(p, "\"lenc\":%u,", s->status.lenc);
-    p+=sprintf(p, "\"vflip\":%u,", s->status.vflip);
-    p+=sprintf(p, "\"hmirror\":%u,", s->status.hmirror);
-    p+=sprintf(p, "\"dcw\":%u,", s->status.dcw);
-    p+=sprintf(p, "\"colorbar\":%u,", s->status.colorbar);
-    p+=sprintf(p, "\"face_detect\":%u,", detection_enabled);
-    p+=sprintf(p, "\"face_enroll\":%u,", is_enrolling);
-    p+=sprintf(p, "\"face_recognize\":%u", recognition_enabled);
-    p+=sprintf(p, "\"frequency\":%c", (char) preferences.getChar("frequency",'x'));
-    p+=sprintf(p, "\"start_time\":%lu", (unsigned long) preferences.getULong64("start_time",0));
-    p+=sprintf(p, "\"current_time\":%lu", (unsigned long) time(NULL));
-    
-    *p++ = '}';
-    *p++ = 0;
-    httpd_resp_set_type(req, "application/json");
-    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-    return httpd_resp_send(req, json_response, strlen(json_response));
-}
-
-static esp_err_t configure_handler(httpd_req_t *req){
-
-    esp_camera_deinit();
-  
-    httpd_resp_set_type(req, "text/html");
-    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
-
-    return httpd_resp_send(req, (const char *)index_config_html_gz, index_config_html_gz_len);
-}
-//copy this part----
-static esp_err_t eric_handler(httpd_req_t *req){
-
-    esp_camera_deinit();
-  
-    httpd_resp_set_type(req, "text/html");
-    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
-
-    return httpd_resp_send(req, (const char *)eric_config_html_gz, eric_config_html_gz_len);
-}
-//----------------
-
-//copied part----
-static esp_err_t help_handler(httpd_req_t *req){
-
-    esp_camera_deinit();
-  
-    httpd_resp_set_type(req, "text/html");
-    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
-
-    return httpd_resp_send(req, (const char *)help_config_html_gz, help_config_html_gz_len);
-}
-//----------------
-
-//copied part#2----
-static esp_err_t homepage_handler(httpd_req_t *req){
-
-    esp_camera_deinit();
-  
-    httpd_resp_set_type(req, "text/html");
-    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
-
-    return httpd_resp_send(req, (const char *)homepage_config_html_gz, homepage_config_html_gz_len);
-}
-//----------------
-extern void initialize_camera();
-extern void update_image_settings();  
-static esp_err_t index_handler(httpd_req_t *req){
-
-    initialize_camera();
-    update_image_settings();  
-  
-    httpd_resp_set_type(req, "text/html");
-    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
-    
-    sensor_t * s = esp_camera_sensor_get();
-    if (s->id.PID == OV3660_PID) {
-        return httpd_resp_send(req, (const char *)index_ov3660_html_gz, index_ov3660_html_gz_len);
-    }
-    return httpd_resp_send(req, (const char *)index_ov2640_html_gz, index_ov2640_html_gz_len);
-}
-
-
-void startCameraServer(){
-    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-
-    httpd_uri_t index_uri = {
-        .uri       = "/stream.html",
-        .method    = HTTP_GET,
-        .handler   = index_handler,
-        .user_ctx  = NULL
-    };
-
-    httpd_uri_t configure_uri = {
-        .uri       = "/configure",
-        .method    = HTTP_GET,
-        .handler   = configure_handler,
-        .user_ctx  = NULL
-    };
-
-    httpd_uri_t eric_uri = {
-        .uri       = "/settings.html",
-        .method    = HTTP_GET,
-        .handler   = eric_handler,
-        .user_ctx  = NULL
-    };
-
-    httpd_uri_t status_uri = {
-        .uri       = "/status",
-        .method    = HTTP_GET,
-        .handler   = status_handler,
-        .user_ctx  = NULL
-    };
-
-    httpd_uri_t cmd_uri = {
-        .uri       = "/control",
-        .method    = HTTP_GET,
-        .handler   = cmd_handler,
-        .user_ctx  = NULL
-    };
-
-    httpd_uri_t capture_uri = {
-        .uri       = "/capture",
-        .method    = HTTP_GET,
-        .handler   = capture_handler,
-        .user_ctx  = NULL
-    };
-
-   httpd_uri_t stream_uri = {
-        .uri       = "/stream",
-        .method    = HTTP_GET,
-        .handler   = stream_handler,
-        .user_ctx  = NULL
-    };
-
-    httpd_uri_t help_uri = {
-        .uri       = "/help.html",
-        .method    = HTTP_GET,
-        .handler   = help_handler,
-        .user_ctx  = NULL
-    };
-
-    httpd_uri_t homepage_uri = {
-        .uri       = "/",
-        .method    = HTTP_GET,
-        .handler   = homepage_handler,
-        .user_ctx  = NULL
-    };
-    ra_filter_init(&ra_filter, 20);
-        
-    Serial.printf("Starting web server on port: '%d'\n", config.server_port);
-    if (httpd_start(&camera_httpd, &config) == ESP_OK) {
-        httpd_register_uri_handler(camera_httpd, &index_uri);
-        httpd_register_uri_handler(camera_httpd, &cmd_uri);
-        httpd_register_uri_handler(camera_httpd, &status_uri);
-        httpd_register_uri_handler(camera_httpd, &capture_uri);
-        httpd_register_uri_handler(camera_httpd, &configure_uri);
-        httpd_register_uri_handler(camera_httpd, &eric_uri);
-        httpd_register_uri_handler(camera_httpd, &help_uri);
-        httpd_register_uri_handler(camera_httpd, &homepage_uri);
-    }
-
-    config.server_port += 1;
-    config.ctrl_port += 1;
-    Serial.printf("Starting stream server on port: '%d'\n", config.server_port);
-    if (httpd_start(&stream_httpd, &config) == ESP_OK) {
-        httpd_register_uri_handler(stream_httpd, &stream_uri);
-    }
-}
+// Copyright 2015-2016 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "esp_http_server.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_camera.h"
+#include "img_converters.h"
+#include "camera_index.h"
+#include "Arduino.h"
+#include <Preferences.h>
+#include <time.h>
+#include <sys/time.h>
+#include "RTClib.h"
+#include "phash.h"
+#include "schedule.h"
+#include "rtc_wake.h"
+#include "capture_timing.h"
+#include "boot_cache.h"
+#include "camera_settings.h"
+#include "camera_profile.h"
+#include "frame_arbiter.h"
+#include "buf_pool.h"
+#include "esp_heap_caps.h"
+#include "energy.h"
+#include "sd_writer.h"
+#include "catalog.h"
+#include "retention.h"
+#include "uplink.h"
+#include "exif.h"
+#include "http_workers.h"
+#include "ws_stream.h"
+#include "http_text.h"
+#include "tuner.h"
+#include "size_control.h"
+#include "metrics.h"
+#include "FS.h"
+#include "SD_MMC.h"
+
+#include "fb_gfx.h"
+
+typedef struct {
+        size_t size; //number of values used for filtering
+        size_t index; //current value index
+        size_t count; //value count
+        int sum;
+        int * values; //array to be filled with values
+} ra_filter_t;
+
+typedef struct {
+        httpd_req_t *req;
+        size_t len;
+} jpg_chunking_t;
+
+#define PART_BOUNDARY "123456789000000000000987654321"
+static const char* _STREAM_CONTENT_TYPE = "multipart/x-mixed-replace;boundary=" PART_BOUNDARY;
+static const char* _STREAM_BOUNDARY = "\r\n--" PART_BOUNDARY "\r\n";
+
+static ra_filter_t ra_filter;
+httpd_handle_t stream_httpd = NULL;
+httpd_handle_t camera_httpd = NULL;
+
+//static mtmn_config_t mtmn_config = {0};
+static int8_t detection_enabled = 0;
+static int8_t recognition_enabled = 0;
+static int8_t is_enrolling = 0;
+// static face_id_list id_list = {0};
+int8_t current_hour = 0;
+int8_t current_min = 0;
+
+extern Preferences preferences ;
+extern RTC_DS3231 rtc;
+
+static ra_filter_t * ra_filter_init(ra_filter_t * filter, size_t sample_size){
+    memset(filter, 0, sizeof(ra_filter_t));
+
+    filter->values = (int *)malloc(sample_size * sizeof(int));
+    if(!filter->values){
+        return NULL;
+    }
+    memset(filter->values, 0, sample_size * sizeof(int));
+
+    filter->size = sample_size;
+    return filter;
+}
+
+static int ra_filter_run(ra_filter_t * filter, int value){
+    if(!filter->values){
+        return value;
+    }
+    filter->sum -= filter->values[filter->index];
+    filter->values[filter->index] = value;
+    filter->sum += filter->values[filter->index];
+    filter->index++;
+    filter->index = filter->index % filter->size;
+    if (filter->count < filter->size) {
+        filter->count++;
+    }
+    return filter->sum / filter->count;
+}
+
+static size_t jpg_encode_stream(void * arg, size_t index, const void* data, size_t len){
+    jpg_chunking_t *j = (jpg_chunking_t *)arg;
+    if(!index){
+        j->len = 0;
+    }
+    if(httpd_resp_send_chunk(j->req, (const char *)data, len) != ESP_OK){
+        return 0;
+    }
+    j->len += len;
+    return len;
+}
+
+// the arbiter lets go of the driver first, frames still out go back before it is torn down
+static void camera_stop(void){
+    frame_arbiter_stop();
+    esp_camera_deinit();
+}
+
+/*
+ * Requests that stop and restart the camera run on the workers, several
+ * at once, so each takes the camera first and none tears it down under
+ * another. Streams and stills wait or fail while it is taken. The card
+ * goes with it: whoever mounts and unmounts it holds the camera too.
+ */
+static SemaphoreHandle_t camera_owner;
+
+static bool camera_try_claim(void){
+    return camera_owner && xSemaphoreTake(camera_owner, 0) == pdTRUE;
+}
+
+// the camera, or a 503 when another request has it rather than waiting out a sweep
+static bool camera_claim(httpd_req_t *req){
+    if (camera_try_claim()) {
+        return true;
+    }
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    httpd_resp_set_hdr(req, "Retry-After", "10");
+    httpd_resp_send(req, "camera busy", strlen("camera busy"));
+    return false;
+}
+
+static void camera_release(void){
+    xSemaphoreGive(camera_owner);
+}
+
+static bool camera_claimed(void){
+    return camera_owner && uxSemaphoreGetCount(camera_owner) == 0;
+}
+
+// leaving the stream page stops the camera, unless a benchmark has it
+static void camera_stop_unclaimed(void){
+    if (camera_try_claim()) {
+        camera_stop();
+        camera_release();
+    }
+}
+
+static esp_err_t capture_handler(httpd_req_t *req){
+    esp_err_t handed;
+    if (!http_on_worker(req, capture_handler, &handed)) {
+        return handed;
+    }
+    camera_fb_t * fb = NULL;
+    esp_err_t res = ESP_OK;
+    int64_t fr_start = esp_timer_get_time();
+
+    // at the capture profile, queued between two stream frames
+    fb = frame_arbiter_still(ARBITER_STILL_TIMEOUT_MS);
+    metrics_observe_us(MET_CAPTURE_LATENCY, esp_timer_get_time() - fr_start);
+    if (!fb) {
+        metrics_inc(MET_CAPTURE_FAILURES);
+        Serial.println("Camera capture failed");
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+
+    metrics_inc(MET_CAPTURES);
+
+    httpd_resp_set_type(req, "image/jpeg");
+    httpd_resp_set_hdr(req, "Content-Disposition", "inline; filename=capture.jpg");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+
+    size_t out_len, out_width, out_height;
+    uint8_t * out_buf;
+    bool s;
+    bool detected = false;
+    int face_id = 0;
+
+    size_t fb_len = 0;
+    if(fb->format == PIXFORMAT_JPEG){
+        fb_len = fb->len;
+        res = httpd_resp_send(req, (const char *)fb->buf, fb->len);
+    } else {
+        jpg_chunking_t jchunk = {req, 0};
+        res = frame2jpg_cb(fb, 80, jpg_encode_stream, &jchunk)?ESP_OK:ESP_FAIL;
+        httpd_resp_send_chunk(req, NULL, 0);
+        fb_len = jchunk.len;
+    }
+    frame_arbiter_release(fb);
+    int64_t fr_end = esp_timer_get_time();
+    Serial.printf("JPG: %uB %ums\n", (uint32_t)(fb_len), (uint32_t)((fr_end - fr_start)/1000));
+    return res;
+}
+
+static esp_err_t stream_handler(httpd_req_t *req){
+    esp_err_t handed;
+    if (!http_on_worker(req, stream_handler, &handed)) {
+        return handed;
+    }
+    camera_fb_t * fb = NULL;
+    esp_err_t res = ESP_OK;
+    size_t _jpg_buf_len = 0;
+    uint8_t * _jpg_buf = NULL;
+    char part_buf[STREAM_PART_MAX];
+    bool detected = false;
+    int face_id = 0;
+    int64_t fr_start = 0;
+    int64_t fr_ready = 0;
+    int64_t fr_face = 0;
+    int64_t fr_recognize = 0;
+    int64_t fr_encode = 0;
+
+    // one per stream, several can run at once on the workers
+    int64_t last_frame = esp_timer_get_time();
+    uint32_t seq = 0;
+
+    res = httpd_resp_set_type(req, _STREAM_CONTENT_TYPE);
+    if(res != ESP_OK){
+        return res;
+    }
+
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    metrics_gauge_add(MET_STREAMS, 1);
+
+    while(true){
+        detected = false;
+        face_id = 0;
+        uint32_t prev_seq = seq;
+        fb = frame_arbiter_frame(&seq, ARBITER_STREAM_TIMEOUT_MS);
+        if (!fb && frame_arbiter_running()) {
+            continue; // a still is being taken
+        }
+        if (!fb && camera_claimed()) {
+            vTaskDelay(pdMS_TO_TICKS(100)); // a benchmark has the camera, it puts the stream back after
+            continue;
+        }
+        if (fb && prev_seq && seq - prev_seq > 1) {
+            metrics_add(MET_STREAM_DROPPED, seq - prev_seq - 1); // newer frames came while this one was sent
+        }
+        if (!fb) {
+            Serial.println("Camera capture failed");
+            res = ESP_FAIL;
+        } else {
+            fr_start = esp_timer_get_time();
+            fr_ready = fr_start;
+            fr_face = fr_start;
+            fr_encode = fr_start;
+            fr_recognize = fr_start;
+
+            if(fb->format != PIXFORMAT_JPEG){
+                bool jpeg_converted = pool_frame2jpg(fb, 80, &_jpg_buf, &_jpg_buf_len);
+                frame_arbiter_release(fb);
+                fb = NULL;
+                if(!jpeg_converted){
+                    Serial.println("JPEG compression failed");
+                    res = ESP_FAIL;
+                }
+            } else {
+                _jpg_buf_len = fb->len;
+                _jpg_buf = fb->buf;
+            }
+        }
+        int64_t send_start = esp_timer_get_time();
+        size_t hlen = 0;
+        if(res == ESP_OK){
+            hlen = stream_part_header(part_buf, _jpg_buf_len);
+            res = httpd_resp_send_chunk(req, part_buf, hlen);
+        }
+        if(res == ESP_OK){
+            res = httpd_resp_send_chunk(req, (const char *)_jpg_buf, _jpg_buf_len);
+        }
+        if(res == ESP_OK){
+            res = httpd_resp_send_chunk(req, _STREAM_BOUNDARY, strlen(_STREAM_BOUNDARY));
+        }
+        if(res == ESP_OK){
+            metrics_observe_us(MET_STREAM_SEND_LATENCY, esp_timer_get_time() - send_start);
+            metrics_inc(MET_STREAM_FRAMES);
+            metrics_add(MET_STREAM_BYTES, hlen + _jpg_buf_len + strlen(_STREAM_BOUNDARY));
+        }
+        if(fb){
+            frame_arbiter_release(fb);
+            fb = NULL;
+            _jpg_buf = NULL;
+        } else if(_jpg_buf){
+            pool_free(_jpg_buf);
+            _jpg_buf = NULL;
+        }
+        if(res != ESP_OK){
+            break;
+        }
+        int64_t fr_end = esp_timer_get_time();
+
+        int64_t ready_time = (fr_ready - fr_start)/1000;
+        int64_t face_time = (fr_face - fr_ready)/1000;
+        int64_t recognize_time = (fr_recognize - fr_face)/1000;
+        int64_t encode_time = (fr_encode - fr_recognize)/1000;
+        int64_t process_time = (fr_encode - fr_start)/1000;
+        
+        int64_t frame_time = fr_end - last_frame;
+        last_frame = fr_end;
+        frame_time /= 1000;
+        uint32_t avg_frame_time = ra_filter_run(&ra_filter, frame_time);
+        Serial.printf("MJPG: %uB %ums (%.1ffps), AVG: %ums (%.1ffps), %u+%u+%u+%u=%u %s%d\n",
+            (uint32_t)(_jpg_buf_len),
+            (uint32_t)frame_time, 1000.0 / (uint32_t)frame_time,
+            avg_frame_time, 1000.0 / avg_frame_time,
+            (uint32_t)ready_time, (uint32_t)face_time, (uint32_t)recognize_time, (uint32_t)encode_time, (uint32_t)process_time,
+            (detected)?"DETECTED ":"", face_id
+        );
+    }
+
+    metrics_gauge_add(MET_STREAMS, -1);
+    return res;
+}
+
+extern int initialize_camera(void);
+extern void update_image_settings(void); 
+extern void apply_timezone(void);
+extern int64_t next_capture_time(int64_t now);
+extern void load_schedule(schedule_t * schedule);
+extern void station_id(char * out, size_t size);
+
+// solved per rule, this runs for every /status and WebSocket push
+static float captures_per_day(void){
+    schedule_t schedule;
+
+    load_schedule(&schedule);
+    return schedule_per_day(&schedule, time(NULL));
+}
+
+// the frame buffers were sized for UXGA with PSRAM and for SVGA without
+static bool profile_framesize_valid(int size){
+    return size >= 0 && size <= (psramFound() ? FRAMESIZE_UXGA : FRAMESIZE_SVGA);
+}
+
+/*
+ * Apply one setting from /control or the WebSocket. Returns 0, or -1 for
+ * an unknown variable or a value out of range.
+ */
+static int apply_control(const char * variable, const char * value){
+    int val = atoi(value);
+    sensor_t * s = esp_camera_sensor_get();
+    int res = 0;
+    struct timeval tv_now ;
+    struct tm * timeinfo;
+    char buffer [80];
+    
+    metrics_inc(MET_CONTROL_REQUESTS);
+    gettimeofday(&tv_now, NULL);
+    timeinfo = localtime ((const time_t *)&tv_now);
+    strftime(buffer, 80, "%F-%X",timeinfo);
+    Serial.printf("cmd called @ %s with %s = %s\n", buffer, variable, value);
+    
+    if(!strcmp(variable, "current_time")) {
+      // Accepted format is 2022-06-12T22:30
+      int y,m,d,H,M,c;
+      struct tm tm;
+      DateTime now ;
+
+      Serial.printf("current time set to %s\n", value);
+      // the DS3231 is written with the camera stopped, not while a benchmark has it
+      if (!camera_try_claim()) {
+        metrics_inc(MET_CONTROL_ERRORS);
+        return -1;
+      }
+      sscanf(value,"%d%c%d%c%d%c%d%c%d", &y,&c,&m,&c,&d,&c,&H,&c,&M);   
+      Serial.printf("y:%d m:%d d:%d H:%d M:%d\n", y,m,d,H,M);
+      tm.tm_year = y - 1900;
+      tm.tm_mon = m-1;
+      tm.tm_mday = d;
+      tm.tm_hour = H;
+      tm.tm_min = M; 
+      tm.tm_sec = 0;
+      tm.tm_isdst = -1;
+      time_t t = mktime(&tm); // browser local time, converted with the configured tz
+
+      now = epoch_to_rtc(t);
+
+      struct timeval tv_now = { .tv_sec = t };
+
+      settimeofday(&tv_now, NULL);
+
+      camera_stop();
+      Serial.printf("writing time\n");
+      rtc.adjust(now);
+      int fb_count = initialize_camera();
+      update_image_settings();
+      frame_arbiter_start(fb_count);
+      camera_release();
+    }
+    else if(!strcmp(variable, "start_time")) {
+      int y,m,d,H,M,c;
+      struct tm tm;
+      
+      sscanf(value,"%d%c%d%c%d%c%d%c%d", &y,&c,&m,&c,&d,&c,&H,&c,&M);   
+      tm.tm_year = y - 1900;
+      tm.tm_mon = m-1;
+      tm.tm_mday = d;
+      tm.tm_hour = H;
+      tm.tm_min = M; 
+      tm.tm_sec = 0;
+      tm.tm_isdst = -1;
+      time_t t = mktime(&tm);
+
+      preferences.putULong64("start_time", (uint64_t)t);
+      preferences.remove("schedule"); // back to the single start_time + frequency rule
+      Serial.printf("picture time set to %ld\n", (unsigned long)t);
+    }
+    else if(!strcmp(variable, "frequency")) {//Currently this code doesn't take daylight savings time into account once deployed, feature to add in the future
+      Serial.printf("freq set to %s\n", value);
+      preferences.remove("schedule"); // back to the single start_time + frequency rule
+      if (tolower(value[0]) == 'm' && tolower(value [1]) == 'o') { // Month
+          preferences.putChar("frequency", 'm'); // using m from strftime method
+      } else if (tolower(value[0]) == 'w' ) { // Week
+          preferences.putChar("frequency", 'w'); // using w from strftime method        
+      } else if (tolower(value[0]) == 'd' ) { // Day
+          preferences.putChar("frequency", 'd'); // using d from strftime method        
+      } else if (tolower(value[0]) == 'h' ) { // Hour
+          preferences.putChar("frequency", 'H'); // using H from strftime method        
+      } else if (tolower(value[0]) == 'm' && tolower(value[1]) == 'i') { // Minute
+          preferences.putChar("frequency", 'M'); // using M from strftime method        
+      } else { // Error
+        Serial.println("freq error");
+      }
+    }
+    // the capture profile, the sensor only changes to it for a capture
+    else if(!strcmp(variable, "framesize")) {
+        if(s->pixformat == PIXFORMAT_JPEG) { 
+          res = profile_framesize_valid(val) ? 0 : -1;
+          if (!res) {
+            preferences.putUInt("framesize", val);
+          }
+        }
+    }
+    else if(!strcmp(variable, "quality")) {
+      res = (val >= 4 && val <= 63) ? 0 : -1;
+      if (!res) {
+        preferences.putUInt("quality", val);
+      }
+    }
+    else if(!strcmp(variable, "preview_size")) {
+      res = profile_framesize_valid(val) ? 0 : -1;
+      if (!res) {
+        preferences.putUChar("preview_size", val);
+        frame_arbiter_preview_changed();
+      }
+    }
+    else if(!strcmp(variable, "preview_quality")) {
+      res = (val >= 4 && val <= 63) ? 0 : -1;
+      if (!res) {
+        preferences.putUChar("preview_quality", val);
+        frame_arbiter_preview_changed();
+      }
+    }
+    else if(!strcmp(variable, "contrast")) { 
+      res = s->set_contrast(s, val); 
+      preferences.putUInt("contrast", val);
+    }
+    else if(!strcmp(variable, "brightness")) {
+      res = s->set_brightness(s, val);
+      preferences.putUInt("brightness", val);
+    }
+    else if(!strcmp(variable, "saturation")) { 
+      res = s->set_saturation(s, val);
+      preferences.putUInt("saturation", val);
+    }
+    else if(!strcmp(variable, "gainceiling")) {
+      res = s->set_gainceiling(s, (gainceiling_t)val);
+      preferences.putUInt("gainceiling", val);
+    }
+    else if(!strcmp(variable, "colorbar")) { 
+      res = s->set_colorbar(s, val);
+      preferences.putUInt("colorbar", val);
+    }
+    else if(!strcmp(variable, "awb")) { 
+      res = s->set_whitebal(s, val);
+      preferences.putUInt("awb", val);
+    }
+    else if(!strcmp(variable, "agc")) { 
+      res = s->set_gain_ctrl(s, val);
+      preferences.putUInt("agc", val);
+   }
+    else if(!strcmp(variable, "aec")) {
+      res = s->set_exposure_ctrl(s, val);
+      preferences.putUInt("aec", val);
+    }
+    else if(!strcmp(variable, "hmirror")) { 
+      res = s->set_hmirror(s, val);
+      preferences.putUInt("hmirror", val);
+    }
+    else if(!strcmp(variable, "vflip")) {
+      res = s->set_vflip(s, val);
+      preferences.putUInt("vflip", val);
+    }
+    else if(!strcmp(variable, "awb_gain")) {
+      res = s->set_awb_gain(s, val);
+      preferences.putUInt("awb_gain", val);
+    }
+    else if(!strcmp(variable, "agc_gain")) {
+      res = s->set_agc_gain(s, val);
+      preferences.putUInt("agc_gain", val);
+    }
+    else if(!strcmp(variable, "aec_value")) {
+      res = s->set_aec_value(s, val);
+      preferences.putUInt("aec_value", val);
+    }
+    else if(!strcmp(variable, "aec2")) {
+      res = s->set_aec2(s, val);
+      preferences.putUInt("aec2", val);
+    }
+    else if(!strcmp(variable, "dcw")) {
+      res = s->set_dcw(s, val);
+      preferences.putUInt("dcw", val);
+    }
+    else if(!strcmp(variable, "bpc")) {
+      res = s->set_bpc(s, val);
+      preferences.putUInt("bpc", val);
+    }
+    else if(!strcmp(variable, "wpc")) {
+      res = s->set_wpc(s, val);
+      preferences.putUInt("wpc", val);
+    }
+    else if(!strcmp(variable, "raw_gma")) {
+      res = s->set_raw_gma(s, val);
+      preferences.putUInt("raw_gma", val);
+    }
+    else if(!strcmp(variable, "lenc")) {
+      res = s->set_lenc(s, val);
+      preferences.putUInt("lenc", val);
+    }
+    else if(!strcmp(variable, "special_effect")) {
+      res = s->set_special_effect(s, val);
+      preferences.putUInt("special_effect", val);
+    }
+    else if(!strcmp(variable, "wb_mode")) {
+      res = s->set_wb_mode(s, val);
+      preferences.putUInt("wb_mode", val);
+    }
+    else if(!strcmp(variable, "ae_level")) {
+      res = s->set_ae_level(s, val);
+      preferences.putUInt("ae_level", val);
+    }
+    else if(!strcmp(variable, "wake")) {
+      // timer or alarm, the DS3231 alarm needs INT/SQW wired to GPIO 13
+      if (tolower(value[0]) == WAKE_ALARM || tolower(value[0]) == WAKE_TIMER) {
+        preferences.putChar("wake", tolower(value[0]));
+      } else {
+        res = -1;
+      }
+    }
+    else if(!strcmp(variable, "dedup")) {
+      if (val < DEDUP_OFF || val > DEDUP_REFERENCE) {
+        res = -1;
+      } else {
+        preferences.putUChar("dedup", val);
+      }
+    }
+    else if(!strcmp(variable, "dedup_dist")) {
+      if (val < 0 || val > 64) {
+        res = -1;
+      } else {
+        preferences.putUChar("dedup_dist", val);
+      }
+    }
+    else if(!strcmp(variable, "station")) {
+      // written into every capture's EXIF, empty goes back to the one made from the MAC address
+      char station[EXIF_STATION_MAX];
+      strlcpy(station, value, sizeof(station));
+      url_decode(station);
+      // it goes into /status unescaped
+      if (strpbrk(station, "\"\\")) {
+        res = -1;
+      } else {
+        preferences.putString("station", station);
+      }
+    }
+    else if(!strcmp(variable, "bat_div")) {
+      // battery divider ratio, input over ADC voltage
+      float ratio = atof(value);
+      if (ratio < 1 || ratio > 20) {
+        res = -1;
+      } else {
+        preferences.putFloat("bat_div", ratio);
+        energy_model_changed();
+      }
+    }
+    else if(!strcmp(variable, "bat_reset")) {
+      energy_reset(); // new or recharged battery
+    }
+    else if(!strncmp(variable, "i_", 2) || !strcmp(variable, "bat_mah")) {
+      // current model: i_boot, i_cam, i_sd, i_wifi in mA, i_sleep in uA, bat_mah capacity
+      int key = -1;
+      for (int i = 0; i < PHASE_COUNT + 2; i++) {
+        if (!strcmp(variable, energy_model_keys[i])) {
+          key = i;
+        }
+      }
+      if (key < 0 || val < 0 || val > 65535) {
+        res = -1;
+      } else {
+        preferences.putUShort(energy_model_keys[key], val);
+        energy_model_changed();
+      }
+    }
+    else if(!strcmp(variable, "sd_bus")) {
+      // 1 or 4 data lines, alarm mode always uses 1
+      if (val != SD_BUS_1BIT && val != SD_BUS_4BIT) {
+        res = -1;
+      } else {
+        preferences.putUChar("sd_bus", val);
+      }
+    }
+    else if(!strcmp(variable, "sd_khz")) {
+      if (val < 400 || val > SDMMC_FREQ_HIGHSPEED) {
+        res = -1;
+      } else {
+        preferences.putUShort("sd_khz", val);
+      }
+    }
+    else if(!strcmp(variable, "ret_free_mb")) {
+      preferences.putUShort("ret_free_mb", constrain(val, 0, 65535));
+      retention_policy_changed();
+    }
+    else if(!strcmp(variable, "ret_gb")) {
+      preferences.putUShort("ret_gb", constrain(val, 0, 65535));
+      retention_policy_changed();
+    }
+    else if(!strcmp(variable, "ret_daily")) {
+      preferences.putUChar("ret_daily", val ? 1 : 0);
+      retention_policy_changed();
+    }
+    else if(!strcmp(variable, "ret_thin_days")) {
+      preferences.putUShort("ret_thin_days", constrain(val, 0, 65535));
+      retention_policy_changed();
+    }
+    else if(!strcmp(variable, "size_kb")) {
+      // 0 turns size control off, quality is the stored one again
+      preferences.putUShort("size_kb", constrain(val, 0, 65535));
+    }
+    else if(!strcmp(variable, "http_socks")) {
+      // takes effect the next time the access point starts
+      if (val < 2 || val > HTTP_MAX_SOCKETS - HTTP_STREAM_SOCKETS) {
+        res = -1;
+      } else {
+        preferences.putUChar("http_socks", val);
+      }
+    }
+    else if(!strcmp(variable, "fb_count")) {
+      // frame buffers for trail camera captures, 0 goes back to the default
+      if (val < 0 || val > CAM_MAX_FB_COUNT) {
+        res = -1;
+      } else {
+        preferences.putUChar("fb_count", val);
+      }
+    }
+    else if(!strcmp(variable, "face_detect")) {
+        detection_enabled = val;
+        if(!detection_enabled) {
+            recognition_enabled = 0;
+        }
+    }
+    else if(!strcmp(variable, "face_enroll")) {
+      is_enrolling = val;
+    }
+    else if(!strcmp(variable, "face_recognize")) {
+        recognition_enabled = val;
+        if(recognition_enabled){
+            detection_enabled = val;
+        }
+    }
+    else {
+        res = -1;
+    }
+
+    if(res == 0){
+        boot_cache_invalidate();
+    } else {
+        metrics_inc(MET_CONTROL_ERRORS);
+    }
+    return res;
+}
+
+static esp_err_t cmd_handler(httpd_req_t *req){
+    char*  buf;
+    size_t buf_len;
+    char variable[32] = {0,};
+    char value[32] = {0,};
+
+    buf_len = httpd_req_get_url_query_len(req) + 1;
+    if (buf_len > 1) {
+        buf = (char*)pool_alloc(buf_len);
+        if(!buf){
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
+            if (httpd_query_key_value(buf, "var", variable, sizeof(variable)) == ESP_OK &&
+                httpd_query_key_value(buf, "val", value, sizeof(value)) == ESP_OK) {
+            } else {
+                pool_free(buf);
+                httpd_resp_send_404(req);
+                return ESP_FAIL;
+            }
+        } else {
+            pool_free(buf);
+            httpd_resp_send_404(req);
+            return ESP_FAIL;
+        }
+        pool_free(buf);
+    } else {
+        httpd_resp_send_404(req);
+        return ESP_FAIL;
+    }
+
+    if(apply_control(variable, value)){
+        return httpd_resp_send_500(req);
+    }
+
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    return httpd_resp_send(req, NULL, 0);
+}
+
+#define STATUS_JSON_MAX 6144 // about 4 KB with every number at full width and the schedule at SCHED_TEXT_MAX
+
+// the /status object into STATUS_JSON_MAX bytes, also pushed over the WebSocket; returns its length
+static size_t status_json(char * json_response){
+    sensor_t * s = esp_camera_sensor_get();
+    text_out_t out;
+    text_out_init(&out, json_response, STATUS_JSON_MAX - 1); // with room for the closing brace
+    text_printf(&out, "{");
+
+    camera_profile_t capture, preview;
+    camera_profile_stats_t profile;
+    camera_profile_capture(&capture);
+    camera_profile_preview(&preview);
+    camera_profile_get_stats(&profile);
+    text_printf(&out, "\"framesize\":%u,", capture.framesize);
+    text_printf(&out, "\"quality\":%u,", capture.quality);
+    text_printf(&out, "\"preview_size\":%u,", preview.framesize);
+    text_printf(&out, "\"preview_quality\":%u,", preview.quality);
+    text_printf(&out, "\"profile_switches\":%u,", profile.switches);
+    text_printf(&out, "\"profile_switch_ms\":%u,", profile.last_ms);
+    text_printf(&out, "\"profile_switch_mean_ms\":%.0f,", profile.mean_ms);
+    text_printf(&out, "\"profile_discarded\":%u,", profile.last_discarded);
+    text_printf(&out, "\"profile_discarded_total\":%u,", profile.discarded);
+    pool_stats_t pool;
+    pool_get_stats(&pool);
+    text_printf(&out, "\"pool_used\":[%u,%u,%u],", pool.used[0], pool.used[1], pool.used[2]);
+    text_printf(&out, "\"pool_peak\":[%u,%u,%u],", pool.peak[0], pool.peak[1], pool.peak[2]);
+    text_printf(&out, "\"pool_failed\":[%u,%u,%u],", pool.failed[0], pool.failed[1], pool.failed[2]);
+    text_printf(&out, "\"pool_oversize\":%u,", pool.oversize);
+    // fragmentation shows as the largest block falling behind the free total
+    text_printf(&out, "\"heap_free\":%u,", (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    text_printf(&out, "\"heap_largest\":%u,", (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+    text_printf(&out, "\"heap_min_free\":%u,", (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL));
+    text_printf(&out, "\"psram_free\":%u,", (unsigned)heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    text_printf(&out, "\"psram_largest\":%u,", (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM));
+    frame_arbiter_stats_t arbiter;
+    frame_arbiter_get_stats(&arbiter);
+    text_printf(&out, "\"arbiter_frames\":%u,", arbiter.frames);
+    text_printf(&out, "\"arbiter_stills\":%u,", arbiter.stills);
+    text_printf(&out, "\"arbiter_still_failed\":%u,", arbiter.still_failed);
+    text_printf(&out, "\"arbiter_still_ms\":%u,", arbiter.still_ms);
+    text_printf(&out, "\"arbiter_buffer_waits\":%u,", arbiter.buffer_waits);
+    text_printf(&out, "\"arbiter_resync_dropped\":%u,", arbiter.resync_dropped);
+    // no sensor while the camera is stopped, by a settings page or between the steps of a sweep
+    if (s) {
+        text_printf(&out, "\"brightness\":%d,", s->status.brightness);
+        text_printf(&out, "\"contrast\":%d,", s->status.contrast);
+        text_printf(&out, "\"saturation\":%d,", s->status.saturation);
+        text_printf(&out, "\"sharpness\":%d,", s->status.sharpness);
+        text_printf(&out, "\"special_effect\":%u,", s->status.special_effect);
+        text_printf(&out, "\"wb_mode\":%u,", s->status.wb_mode);
+        text_printf(&out, "\"awb\":%u,", s->status.awb);
+        text_printf(&out, "\"awb_gain\":%u,", s->status.awb_gain);
+        text_printf(&out, "\"aec\":%u,", s->status.aec);
+        text_printf(&out, "\"aec2\":%u,", s->status.aec2);
+        text_printf(&out, "\"ae_level\":%d,", s->status.ae_level);
+        text_printf(&out, "\"aec_value\":%u,", s->status.aec_value);
+        text_printf(&out, "\"agc\":%u,", s->status.agc);
+        text_printf(&out, "\"agc_gain\":%u,", s->status.agc_gain);
+        text_printf(&out, "\"gainceiling\":%u,", s->status.gainceiling);
+        text_printf(&out, "\"bpc\":%u,", s->status.bpc);
+        text_printf(&out, "\"wpc\":%u,", s->status.wpc);
+        text_printf(&out, "\"raw_gma\":%u,", s->status.raw_gma);
+        text_printf(&out, "\"lenc\":%u,", s->status.lenc);
+        text_printf(&out, "\"vflip\":%u,", s->status.vflip);
+        text_printf(&out, "\"hmirror\":%u,", s->status.hmirror);
+        text_printf(&out, "\"dcw\":%u,", s->status.dcw);
+        text_printf(&out, "\"colorbar\":%u,", s->status.colorbar);
+    }
+    text_printf(&out, "\"face_detect\":%u,", detection_enabled);
+    text_printf(&out, "\"face_enroll\":%u,", is_enrolling);
+    text_printf(&out, "\"face_recognize\":%u,", recognition_enabled);
+    text_printf(&out, "\"frequency\":\"%c\",", (char) preferences.getChar("frequency",'x'));
+    text_printf(&out, "\"start_time\":%lu,", (unsigned long) preferences.getULong64("start_time",0));
+    text_printf(&out, "\"current_time\":%lu,", (unsigned long) time(NULL));
+    text_printf(&out, "\"tz\":\"%s\",", preferences.getString("tz", SCHED_DEFAULT_TZ).c_str());
+    char station[EXIF_STATION_MAX];
+    station_id(station, sizeof(station));
+    text_printf(&out, "\"station\":\"%s\",", station);
+    text_printf(&out, "\"schedule\":\"%s\",", preferences.getString("schedule", "").c_str());
+    text_printf(&out, "\"next_capture\":%lld,", (long long) next_capture_time(time(NULL)));
+    text_printf(&out, "\"wake\":\"%c\",", wake_source());
+    text_printf(&out, "\"drift_ppm\":%.0f,", rtc_drift_ppm());
+    text_printf(&out, "\"drift_samples\":%u,", preferences.getULong("drift_n", 0));
+    timing_stats_t timing;
+    timing_get_stats(&timing);
+    text_printf(&out, "\"jitter_samples\":%u,", timing.count);
+    text_printf(&out, "\"jitter_mean_ms\":%.1f,", timing.mean_ms);
+    text_printf(&out, "\"jitter_std_ms\":%.1f,", timing.std_ms);
+    text_printf(&out, "\"jitter_max_ms\":%.1f,", timing.max_ms);
+    text_printf(&out, "\"jitter_last_ms\":%.1f,", timing.last_ms);
+    text_printf(&out, "\"wake_lead_ms\":%.0f,", timing.lead_ms);
+    text_printf(&out, "\"boot_to_ready_ms\":%.0f,", timing.boot_to_ready_ms);
+    text_printf(&out, "\"wake_to_shutter_ms\":%.0f,", timing.shutter_ms[0]);
+    text_printf(&out, "\"warm_wake_to_shutter_ms\":%.0f,", timing.shutter_ms[1]);
+    text_printf(&out, "\"fb_count\":%u,", preferences.getUChar("fb_count", 0));
+    text_printf(&out, "\"sd_bus\":%u,", preferences.getUChar("sd_bus", SD_BUS_4BIT));
+    text_printf(&out, "\"sd_khz\":%u,", preferences.getUShort("sd_khz", BOARD_MAX_SDMMC_FREQ));
+    const catalog_summary_t * catalog = catalog_summary();
+    if (catalog) {
+        // only known once a wake or /catalog has had the card mounted
+        text_printf(&out, "\"catalog_records\":%u,", catalog->count - catalog->deleted);
+        text_printf(&out, "\"catalog_bytes\":%llu,", (unsigned long long)catalog->bytes);
+        text_printf(&out, "\"catalog_first\":%u,", catalog->first_time);
+        text_printf(&out, "\"catalog_last\":%u,", catalog->last_time);
+    }
+    http_worker_stats_t workers;
+    http_worker_get_stats(&workers);
+    text_printf(&out, "\"http_socks\":%u,", preferences.getUChar("http_socks", HTTP_DEFAULT_MAX_SOCKETS));
+    text_printf(&out, "\"http_workers_busy\":%u,", workers.busy);
+    text_printf(&out, "\"http_worker_served\":%u,", workers.served);
+    text_printf(&out, "\"http_worker_rejected\":%u,", workers.rejected);
+    ws_stream_stats_t ws_stream;
+    ws_stream_get_stats(&ws_stream);
+    text_printf(&out, "\"ws_stream_clients\":%u,", ws_stream.clients);
+    text_printf(&out, "\"ws_stream_sent\":%u,", ws_stream.sent);
+    text_printf(&out, "\"ws_stream_skipped\":%u,", ws_stream.skipped);
+    text_printf(&out, "\"ws_stream_rtt_ms\":%u,", ws_stream.rtt_ms);
+    text_printf(&out, "\"ws_stream_age_ms\":%u,", ws_stream.age_ms);
+    const retention_policy_t * retention = retention_policy();
+    retention_stats_t reclaimed;
+    retention_get_stats(&reclaimed);
+    text_printf(&out, "\"ret_free_mb\":%u,\"ret_gb\":%u,\"ret_daily\":%u,\"ret_thin_days\":%u,",
+               retention->free_mb, retention->keep_gb, retention->daily, retention->thin_days);
+    text_printf(&out, "\"card_free_mb\":%lld,", reclaimed.free_bytes < 0 ? -1LL : (long long)(reclaimed.free_bytes >> 20));
+    text_printf(&out, "\"retention_deleted\":%u,", reclaimed.deleted);
+    text_printf(&out, "\"retention_reclaimed_mb\":%llu,", (unsigned long long)(reclaimed.reclaimed >> 20));
+    text_printf(&out, "\"retention_stalled\":%u,", reclaimed.stalled);
+    text_printf(&out, "\"dedup\":%u,", preferences.getUChar("dedup", DEDUP_OFF));
+    text_printf(&out, "\"dedup_dist\":%u,", preferences.getUChar("dedup_dist", DEDUP_DEFAULT_DISTANCE));
+    // the weekly counters only roll over when a duplicate is accounted, so age them here
+    uint32_t week = time(NULL) / (60*60*24*7);
+    uint32_t dd_week = preferences.getULong("dd_week", 0);
+    uint64_t dd_saved = preferences.getULong64("dd_saved", 0);
+    uint64_t dd_last = preferences.getULong64("dd_last", 0);
+    if (dd_week != week) {
+        dd_last = (dd_week + 1 == week) ? dd_saved : 0;
+        dd_saved = 0;
+    }
+    text_printf(&out, "\"dedup_saved_week\":%llu,", dd_saved);
+    text_printf(&out, "\"dedup_saved_last_week\":%llu,", dd_last);
+    energy_report_t energy;
+    energy_get_report(&energy);
+    float per_day = captures_per_day();
+    text_printf(&out, "\"battery_v\":%.2f,", energy.battery_v);
+    text_printf(&out, "\"battery_pct\":%.0f,", energy.battery_pct);
+    text_printf(&out, "\"energy_used_mah\":%.1f,", energy.used_mah);
+    text_printf(&out, "\"energy_remaining_mah\":%.0f,", energy.remaining_mah);
+    text_printf(&out, "\"energy_per_capture_mah\":%.3f,", energy.capture_mah);
+    text_printf(&out, "\"energy_captures\":%u,", energy.captures);
+    text_printf(&out, "\"awake_s\":[%.0f,%.0f,%.0f,%.0f],", energy.phase_s[PHASE_BOOT], energy.phase_s[PHASE_CAMERA],
+               energy.phase_s[PHASE_SD], energy.phase_s[PHASE_WIFI]);
+    text_printf(&out, "\"sleep_hours\":%.1f,", energy.sleep_hours);
+    text_printf(&out, "\"captures_per_day\":%.1f,", per_day);
+    text_printf(&out, "\"days_remaining\":%.1f,", energy_days_remaining(&energy, per_day));
+    uplink_stats_t uplink;
+    uplink_get_stats(&uplink);
+    text_printf(&out, "\"uplink_next\":%lld,", uplink.next == SCHED_NONE ? -1LL : (long long)uplink.next);
+    text_printf(&out, "\"uplink_pending\":%u,", uplink.pending);
+    text_printf(&out, "\"uplink_kb_per_s\":%.1f,", uplink.kb_per_s);
+    text_printf(&out, "\"uplink_mah_per_mb\":%.2f,", uplink.mah_per_mb);
+    text_printf(&out, "\"uplink_error\":\"%s\",", uplink.error);
+    size_control_stats_t size;
+    size_control_get_stats(&size);
+    text_printf(&out, "\"size_kb\":%u,\"size_quality\":%u,\"size_samples\":%u,\"size_last_bytes\":%u,",
+               size.target / 1024, size.quality, size.samples, size.last_bytes);
+    text_printf(&out, "\"size_err_pct\":%.1f,\"size_abs_err_pct\":%.1f,\"size_std_pct\":%.1f,\"size_within_pct\":%.0f,",
+               size.mean_error_pct, size.mean_abs_error_pct, size.std_error_pct, size.within_pct);
+    const energy_model_t * model = energy_model();
+    text_printf(&out, "\"i_boot\":%u,\"i_cam\":%u,\"i_sd\":%u,\"i_wifi\":%u,\"i_sleep\":%u,\"bat_mah\":%u,\"bat_div\":%.2f",
+               model->phase_ma[PHASE_BOOT], model->phase_ma[PHASE_CAMERA], model->phase_ma[PHASE_SD],
+               model->phase_ma[PHASE_WIFI], model->sleep_ua, model->capacity_mah, model->divider);
+
+    // members that did not fit are left out, the object stays valid
+    if (out.full) {
+        Serial.println("status: text cut short");
+        if (out.p[-1] == ',') {
+            out.p--;
+        }
+    }
+    *out.p++ = '}';
+    *out.p = 0;
+    return out.p - json_response;
+}
+
+static esp_err_t status_handler(httpd_req_t *req){
+    char * json_response = (char *)pool_alloc(STATUS_JSON_MAX);
+    if (!json_response) {
+        return httpd_resp_send_500(req);
+    }
+    size_t len = status_json(json_response);
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    esp_err_t res = httpd_resp_send(req, json_response, len);
+    pool_free(json_response);
+    return res;
+}
+
+// Prometheus text, for scraping the station from a laptop during setup
+static esp_err_t metrics_handler(httpd_req_t *req){
+    static char text[METRICS_TEXT_MAX];
+    size_t len = metrics_render(text, sizeof(text));
+
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    return httpd_resp_send(req, text, len);
+}
+
+/*
+ * GET /schedule returns the capture rules. With ?rules=... and/or ?tz=...
+ * the rules (see schedule.h) and POSIX time zone are replaced first; an
+ * empty rules value goes back to the single start_time + frequency rule.
+ */
+static esp_err_t schedule_handler(httpd_req_t *req){
+    static char json_response[SCHED_TEXT_MAX + 160];
+    char rules[SCHED_TEXT_MAX] = {0,};
+    char tz[64] = {0,};
+    char * buf;
+    size_t buf_len;
+    schedule_t schedule;
+
+    buf_len = httpd_req_get_url_query_len(req) + 1;
+    if (buf_len > 1) {
+        buf = (char*)pool_alloc(buf_len);
+        if(!buf){
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
+            if (httpd_query_key_value(buf, "tz", tz, sizeof(tz)) == ESP_OK) {
+                url_decode(tz);
+                if (!tz[0] || strpbrk(tz, "\"\\")) {
+                    pool_free(buf);
+                    httpd_resp_send_500(req);
+                    return ESP_FAIL;
+                }
+                preferences.putString("tz", tz);
+                apply_timezone();
+                Serial.printf("tz set to %s\n", tz);
+            }
+            if (httpd_query_key_value(buf, "rules", rules, sizeof(rules)) == ESP_OK) {
+                url_decode(rules);
+                if (!rules[0]) {
+                    preferences.remove("schedule");
+                } else if (schedule_parse(&schedule, rules) == 0 &&
+                           schedule_format(&schedule, rules, sizeof(rules)) > 0) {
+                    preferences.putString("schedule", rules);
+                } else {
+                    pool_free(buf);
+                    Serial.printf("schedule rejected: %s\n", rules);
+                    httpd_resp_send_500(req);
+                    return ESP_FAIL;
+                }
+                Serial.printf("schedule set to %s\n", rules);
+            }
+            boot_cache_invalidate();
+        }
+        pool_free(buf);
+    }
+
+    snprintf(json_response, sizeof(json_response),
+             "{\"rules\":\"%s\",\"tz\":\"%s\",\"current_time\":%lu,\"next_capture\":%lld}",
+             preferences.getString("schedule", "").c_str(), preferences.getString("tz", SCHED_DEFAULT_TZ).c_str(),
+             (unsigned long) time(NULL), (long long) next_capture_time(time(NULL)));
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    return httpd_resp_send(req, json_response, strlen(json_response));
+}
+
+/*
+ * GET /uplink returns the uplink settings (not the password) and how the
+ * last session went. Any of ?ssid= ?pass= ?host= ?port= ?batch= ?rules=
+ * are stored first; rules are a schedule as in schedule.h, empty turns
+ * the uplink off.
+ */
+static esp_err_t uplink_handler(httpd_req_t *req){
+    // the query keys are these without "up_", with the longest value each takes
+    static const char * const text_keys[] = { "up_ssid", "up_pass", "up_host" };
+    static const size_t text_max[] = { sizeof(uplink_config_t::ssid), sizeof(uplink_config_t::pass),
+                                       sizeof(uplink_config_t::host) };
+    static char json_response[SCHED_TEXT_MAX + 640];
+    char value[SCHED_TEXT_MAX] = {0,};
+    char * buf;
+    size_t buf_len;
+    schedule_t schedule;
+
+    buf_len = httpd_req_get_url_query_len(req) + 1;
+    if (buf_len > 1) {
+        buf = (char*)pool_alloc(buf_len);
+        if(!buf){
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        bool ok = httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK;
+        for (int i = 0; ok && i < 3; i++) {
+            if (httpd_query_key_value(buf, text_keys[i] + 3, value, sizeof(value)) == ESP_OK) {
+                url_decode(value);
+                ok = strlen(value) < text_max[i] && !strpbrk(value, "\"\\");
+                if (ok) {
+                    preferences.putString(text_keys[i], value);
+                }
+            }
+        }
+        if (ok && httpd_query_key_value(buf, "port", value, sizeof(value)) == ESP_OK) {
+            int port = atoi(value);
+            ok = port > 0 && port < 65536;
+            if (ok) {
+                preferences.putUShort("up_port", port);
+            }
+        }
+        if (ok && httpd_query_key_value(buf, "batch", value, sizeof(value)) == ESP_OK) {
+            int batch = atoi(value);
+            ok = batch > 0 && batch < 65536;
+            if (ok) {
+                preferences.putUShort("up_batch", batch);
+            }
+        }
+        if (ok && httpd_query_key_value(buf, "rules", value, sizeof(value)) == ESP_OK) {
+            url_decode(value);
+            if (!value[0]) {
+                preferences.remove("up_sched");
+            } else if (schedule_parse(&schedule, value) == 0 &&
+                       schedule_format(&schedule, value, sizeof(value)) > 0) {
+                preferences.putString("up_sched", value);
+            } else {
+                Serial.printf("uplink schedule rejected: %s\n", value);
+                ok = false;
+            }
+        }
+        pool_free(buf);
+        uplink_config_changed();
+        boot_cache_invalidate();
+        if (!ok) {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+    }
+
+    const uplink_config_t * config = uplink_config();
+    uplink_stats_t stats;
+    uplink_get_stats(&stats);
+    if (!config->schedule.count || schedule_format(&config->schedule, value, sizeof(value)) < 0) {
+        value[0] = 0;
+    }
+    snprintf(json_response, sizeof(json_response),
+             "{\"ssid\":\"%s\",\"host\":\"%s\",\"port\":%u,\"batch\":%u,\"rules\":\"%s\",\"next_upload\":%lld,"
+             "\"sessions\":%u,\"pending\":%u,\"files\":%u,\"bytes\":%u,\"join_s\":%.1f,\"transfer_s\":%.1f,"
+             "\"kb_per_s\":%.1f,\"mah\":%.2f,\"mah_per_mb\":%.2f,\"error\":\"%s\",\"total_mb\":%.1f,\"total_mah\":%.1f}",
+             config->ssid, config->host, config->port, config->batch, value,
+             stats.next == SCHED_NONE ? -1LL : (long long)stats.next, stats.sessions, stats.pending, stats.files,
+             stats.bytes, stats.join_s, stats.transfer_s, stats.kb_per_s, stats.mah, stats.mah_per_mb, stats.error,
+             stats.total_bytes / 1048576.0, stats.total_mah);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    return httpd_resp_send(req, json_response, strlen(json_response));
+}
+
+extern esp_err_t start_camera(framesize_t frame_size, int quality, int fb_count);
+
+#define BENCH_INIT_JSON_MAX 1536
+#define BENCH_FILE "/bench.tmp"
+
+// the card and camera back to how they were after a sweep
+static void bench_finish(bool mounted, bool streaming){
+    if (mounted) {
+        SD_MMC.remove(BENCH_FILE);
+    }
+    SD_MMC.end();
+    rtc_bus_begin(); // the card had the I2C pins
+
+    camera_stop();
+    if (streaming) {
+        int fb_count = initialize_camera();
+        update_image_settings();
+        frame_arbiter_start(fb_count);
+    }
+}
+
+/*
+ * Time camera bring-up for each framesize: started directly at it, and
+ * the old way of starting at UXGA and switching down through QVGA.
+ * Each figure is the average of "runs" starts, first frame included.
+ */
+static esp_err_t bench_init_handler(httpd_req_t *req){
+    esp_err_t handed;
+    if (!http_on_worker(req, bench_init_handler, &handed)) {
+        return handed;
+    }
+    static const framesize_t sizes[] = { FRAMESIZE_QVGA, FRAMESIZE_VGA, FRAMESIZE_SVGA, FRAMESIZE_XGA,
+                                         FRAMESIZE_HD, FRAMESIZE_SXGA, FRAMESIZE_UXGA };
+    char value[8];
+    char * buf;
+    size_t buf_len;
+    int runs = 3;
+    int only = -1;
+    int fb_count = psramFound() ? 2 : 1;
+    uint16_t pid = 0;
+
+    buf_len = httpd_req_get_url_query_len(req) + 1;
+    if (buf_len > 1) {
+        buf = (char*)pool_alloc(buf_len);
+        if(!buf){
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
+            if (httpd_query_key_value(buf, "runs", value, sizeof(value)) == ESP_OK) {
+                runs = constrain(atoi(value), 1, 10);
+            }
+            if (httpd_query_key_value(buf, "framesize", value, sizeof(value)) == ESP_OK) {
+                only = atoi(value);
+            }
+        }
+        pool_free(buf);
+    }
+
+    char * json_response = (char *)pool_alloc(BENCH_INIT_JSON_MAX);
+    if (!json_response) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    if (!camera_claim(req)) {
+        pool_free(json_response);
+        return ESP_OK;
+    }
+    bool streaming = frame_arbiter_running();
+    char * p = json_response;
+    *p++ = '[';
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        framesize_t size = sizes[i];
+        int64_t elapsed[4] = {0,}; // direct init, direct frame, switched init, switched frame
+
+        if ((only >= 0 && size != only) || (!psramFound() && size > FRAMESIZE_SVGA)) {
+            continue;
+        }
+        for (int r = 0; r < runs; r++) {
+            for (int way = 0; way < 2; way++) {
+                camera_stop();
+                int64_t t0 = esp_timer_get_time();
+                if (start_camera(way ? FRAMESIZE_UXGA : size, 10, fb_count) != ESP_OK) {
+                    bench_finish(false, streaming);
+                    camera_release();
+                    pool_free(json_response);
+                    httpd_resp_send_500(req);
+                    return ESP_FAIL;
+                }
+                sensor_t * s = esp_camera_sensor_get();
+                pid = s->id.PID;
+                if (way) {
+                    s->set_framesize(s, FRAMESIZE_QVGA);
+                    s->set_framesize(s, size);
+                }
+                int64_t t1 = esp_timer_get_time();
+                camera_fb_t * fb = esp_camera_fb_get();
+                if (fb) {
+                    esp_camera_fb_return(fb);
+                }
+                int64_t t2 = esp_timer_get_time();
+                elapsed[way * 2] += t1 - t0;
+                elapsed[way * 2 + 1] += t2 - t1;
+            }
+        }
+        if (p != json_response + 1) {
+            *p++ = ',';
+        }
+        p+=sprintf(p, "{\"framesize\":%u,\"width\":%u,\"height\":%u,", size, resolution[size].width, resolution[size].height);
+        p+=sprintf(p, "\"direct_init_ms\":%.1f,\"direct_frame_ms\":%.1f,",
+                   elapsed[0] / 1000.0 / runs, elapsed[1] / 1000.0 / runs);
+        p+=sprintf(p, "\"switch_init_ms\":%.1f,\"switch_frame_ms\":%.1f}",
+                   elapsed[2] / 1000.0 / runs, elapsed[3] / 1000.0 / runs);
+    }
+    *p++ = ']';
+    *p++ = 0;
+    bench_finish(false, streaming);
+    camera_release();
+
+    // sensor name in front of the results
+    char head[64];
+    snprintf(head, sizeof(head), "{\"sensor\":\"%s\",\"runs\":%d,\"results\":",
+             pid == OV3660_PID ? "OV3660" : pid == OV2640_PID ? "OV2640" : pid == OV5640_PID ? "OV5640" : "unknown", runs);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_send_chunk(req, head, strlen(head));
+    httpd_resp_send_chunk(req, json_response, strlen(json_response));
+    pool_free(json_response);
+    httpd_resp_send_chunk(req, "}", 1);
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+#define SDBENCH_FILE "/sdbench.tmp"
+
+/*
+ * Write mb megabytes in chunk sized writes from PSRAM, as a frame buffer
+ * would be, either through fs::File or the SD writer. Returns MB/s and
+ * fills the write latency histogram, or returns -1 on failure.
+ */
+static float sdbench_run(bool writer, const uint8_t * src, size_t chunk, size_t total, uint32_t * histogram){
+    int64_t start = esp_timer_get_time();
+    size_t done = 0;
+
+    if (writer) {
+        sd_writer_t w;
+        if (sd_writer_open(&w, SDBENCH_FILE, total) != ESP_OK) {
+            return -1;
+        }
+        w.histogram = histogram;
+        while (done < total && sd_writer_write(&w, src, chunk) == ESP_OK) {
+            done += chunk;
+        }
+        if (sd_writer_close(&w) != ESP_OK) {
+            done = 0;
+        }
+    } else {
+        File file = SD_MMC.open(SDBENCH_FILE, FILE_WRITE);
+        if (!file) {
+            return -1;
+        }
+        while (done < total) {
+            int64_t t = esp_timer_get_time();
+            size_t n = file.write(src, chunk);
+            int64_t us = esp_timer_get_time() - t;
+            int bucket = 0;
+            while (bucket < SD_HIST_BUCKETS - 1 && us >= sd_hist_bounds_ms[bucket] * 1000LL) {
+                bucket++;
+            }
+            histogram[bucket]++;
+            if (n != chunk) {
+                break;
+            }
+            done += n;
+        }
+        file.close();
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+    SD_MMC.remove(SDBENCH_FILE);
+    if (done < total) {
+        return -1;
+    }
+    return total / (elapsed / 1e6) / (1024 * 1024);
+}
+
+/*
+ * Measure the installed card on each bus width and clock, with the old
+ * fs::File path and the SD writer. mb sets the amount written per run,
+ * chunk the size of each write in KB.
+ */
+static esp_err_t sdbench_handler(httpd_req_t *req){
+    esp_err_t handed;
+    if (!http_on_worker(req, sdbench_handler, &handed)) {
+        return handed;
+    }
+    static const struct { uint8_t bus; uint16_t khz; } configs[] = {
+        { SD_BUS_1BIT, SDMMC_FREQ_DEFAULT }, { SD_BUS_1BIT, SDMMC_FREQ_HIGHSPEED },
+        { SD_BUS_4BIT, SDMMC_FREQ_DEFAULT }, { SD_BUS_4BIT, SDMMC_FREQ_HIGHSPEED }
+    };
+    char value[8];
+    char line[256];
+    char * buf;
+    size_t buf_len;
+    int mb = 2;
+    int chunk_kb = 32;
+
+    buf_len = httpd_req_get_url_query_len(req) + 1;
+    if (buf_len > 1) {
+        buf = (char*)pool_alloc(buf_len);
+        if(!buf){
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
+            if (httpd_query_key_value(buf, "mb", value, sizeof(value)) == ESP_OK) {
+                mb = constrain(atoi(value), 1, 16);
+            }
+            if (httpd_query_key_value(buf, "chunk", value, sizeof(value)) == ESP_OK) {
+                chunk_kb = constrain(atoi(value), 1, 256);
+            }
+        }
+        pool_free(buf);
+    }
+
+    size_t chunk = chunk_kb * 1024;
+    size_t total = (size_t)mb * 1024 * 1024 / chunk * chunk;
+    uint8_t * src = (uint8_t *)pool_alloc(chunk);
+    if (!src) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    // remounting the card would pull it from under a sweep writing to it
+    if (!camera_claim(req)) {
+        pool_free(src);
+        return ESP_OK;
+    }
+    for (size_t i = 0; i < chunk; i++) {
+        src[i] = i * 31;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    snprintf(line, sizeof(line), "{\"bytes\":%u,\"chunk\":%u,\"hist_bounds_ms\":[1,2,5,10,20,50,100],\"results\":[",
+             (unsigned)total, (unsigned)chunk);
+    httpd_resp_send_chunk(req, line, strlen(line));
+
+    bool first = true;
+    for (size_t c = 0; c < sizeof(configs) / sizeof(configs[0]); c++) {
+        SD_MMC.end();
+        bool mounted = sd_mount_with(configs[c].bus, configs[c].khz) && SD_MMC.cardType() != CARD_NONE;
+        for (int writer = 0; writer < 2; writer++) {
+            uint32_t histogram[SD_HIST_BUCKETS] = {0,};
+            float rate = mounted ? sdbench_run(writer, src, chunk, total, histogram) : -1;
+            char * p = line;
+            p+=sprintf(p, "%s{\"bus\":%u,\"khz\":%u,\"method\":\"%s\",\"mb_s\":%.2f,\"hist\":[",
+                       first ? "" : ",", configs[c].bus, configs[c].khz, writer ? "writer" : "file", rate);
+            for (int b = 0; b < SD_HIST_BUCKETS; b++) {
+                p+=sprintf(p, "%s%u", b ? "," : "", histogram[b]);
+            }
+            p+=sprintf(p, "]}");
+            httpd_resp_send_chunk(req, line, p - line);
+            first = false;
+        }
+        if (mounted && c == 0) {
+            snprintf(line, sizeof(line), ",{\"cluster\":%u}", (unsigned)sd_cluster_size());
+            httpd_resp_send_chunk(req, line, strlen(line));
+        }
+    }
+    SD_MMC.end();
+    rtc_bus_begin(); // the card had the I2C pins
+    camera_release();
+    pool_free(src);
+
+    httpd_resp_send_chunk(req, "]}", 2);
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+#define BENCH_MAX_STEPS 8
+#define BENCH_WARMUP 2          // frames exposed before the settings took
+
+typedef struct {
+    esp_err_t err;
+    int frames;                 // taken back to back
+    int64_t init_us;
+    int64_t capture_us;         // all of them
+    int64_t capture_max_us;
+    int64_t stream_us;          // first to last
+    size_t bytes;
+    int sd_frames;
+    int64_t sd_us;
+    size_t sd_bytes;            // 0 when the card failed or was not used
+} bench_result_t;
+
+/*
+ * Start the camera at size, quality and fb_count, drop its first frames,
+ * then time frames back to back and, with the card mounted, as many
+ * again written to it the way captures are. stored first applies the
+ * stored sensor settings, as a trail camera wake does.
+ */
+static void bench_measure(framesize_t size, int quality, int fb_count, int frames, bool stored, bool sd, bench_result_t * r){
+    memset(r, 0, sizeof(*r));
+    camera_stop();
+    int64_t t0 = esp_timer_get_time();
+    r->err = start_camera(size, quality, fb_count);
+    r->init_us = esp_timer_get_time() - t0;
+    if (r->err != ESP_OK) {
+        return;
+    }
+    if (stored) {
+        camera_profile_t profile = { size, (uint8_t)quality };
+        update_image_settings();
+        camera_profile_apply(esp_camera_sensor_get(), &profile);
+    }
+    for (int f = 0; f < BENCH_WARMUP; f++) {
+        camera_fb_t * fb = esp_camera_fb_get();
+        if (fb) {
+            esp_camera_fb_return(fb);
+        }
+    }
+    int64_t start = esp_timer_get_time();
+    for (; r->frames < frames; r->frames++) {
+        int64_t t = esp_timer_get_time();
+        camera_fb_t * fb = esp_camera_fb_get();
+        int64_t us = esp_timer_get_time() - t;
+        if (!fb) {
+            break;
+        }
+        r->capture_us += us;
+        r->capture_max_us = max(r->capture_max_us, us);
+        r->bytes += fb->len;
+        esp_camera_fb_return(fb);
+    }
+    r->stream_us = esp_timer_get_time() - start;
+    for (int f = 0; sd && f < frames; f++) {
+        camera_fb_t * fb = esp_camera_fb_get();
+        if (!fb) {
+            break;
+        }
+        sd_writer_t w;
+        int64_t t = esp_timer_get_time();
+        esp_err_t res = sd_writer_open(&w, BENCH_FILE, fb->len);
+        if (res == ESP_OK) {
+            res = sd_writer_write(&w, fb->buf, fb->len);
+            if (sd_writer_close(&w) != ESP_OK) {
+                res = ESP_FAIL;
+            }
+        }
+        r->sd_us += esp_timer_get_time() - t;
+        r->sd_bytes += fb->len;
+        r->sd_frames++;
+        esp_camera_fb_return(fb);
+        if (res != ESP_OK) {
+            r->sd_bytes = 0;
+            break;
+        }
+    }
+}
+
+/*
+ * Sweep framesize x quality x fb_count to choose deployment settings
+ * and to compare firmware builds. Each combination starts the camera
+ * afresh and drops its first frames. It then takes "frames" frames back
+ * to back for the capture latency, JPEG size and the frame rate a stream
+ * gets. Another "frames" are written to the card the way captures are,
+ * for SD MB/s. sizes, quality and fb take comma separated lists.
+ */
+static esp_err_t bench_handler(httpd_req_t *req){
+    esp_err_t handed;
+    if (!http_on_worker(req, bench_handler, &handed)) {
+        return handed;
+    }
+    int sizes[BENCH_MAX_STEPS] = { FRAMESIZE_QVGA, FRAMESIZE_VGA, FRAMESIZE_SVGA, FRAMESIZE_XGA, FRAMESIZE_UXGA };
+    int qualities[BENCH_MAX_STEPS] = { 10, 20, 30 };
+    int fb_counts[BENCH_MAX_STEPS] = { 1, 2 };
+    int size_count = 5;
+    int quality_count = 3;
+    int fb_steps = psramFound() ? 2 : 1;
+    int frames = 10;
+    char value[48];
+    char line[384];
+    char * buf;
+    size_t buf_len;
+
+    buf_len = httpd_req_get_url_query_len(req) + 1;
+    if (buf_len > 1) {
+        buf = (char*)pool_alloc(buf_len);
+        if(!buf){
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
+            if (httpd_query_key_value(buf, "sizes", value, sizeof(value)) == ESP_OK) {
+                url_decode(value);
+                size_count = parse_int_list(value, sizes, BENCH_MAX_STEPS);
+            }
+            if (httpd_query_key_value(buf, "quality", value, sizeof(value)) == ESP_OK) {
+                url_decode(value);
+                quality_count = parse_int_list(value, qualities, BENCH_MAX_STEPS);
+            }
+            if (httpd_query_key_value(buf, "fb", value, sizeof(value)) == ESP_OK) {
+                url_decode(value);
+                fb_steps = parse_int_list(value, fb_counts, BENCH_MAX_STEPS);
+            }
+            if (httpd_query_key_value(buf, "frames", value, sizeof(value)) == ESP_OK) {
+                frames = constrain(atoi(value), 1, 30);
+            }
+        }
+        pool_free(buf);
+    }
+
+    if (!camera_claim(req)) {
+        return ESP_OK;
+    }
+    bool streaming = frame_arbiter_running();
+    bool mounted = sd_mount() && SD_MMC.cardType() != CARD_NONE;
+    bool first = true;
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    for (int i = 0; i < size_count; i++) {
+        for (int j = 0; j < quality_count; j++) {
+            for (int k = 0; k < fb_steps; k++) {
+                framesize_t size = (framesize_t)sizes[i];
+                int quality = qualities[j];
+                int fb_count = fb_counts[k];
+                if (!profile_framesize_valid(size) || quality < 4 || quality > 63 ||
+                    fb_count < 1 || fb_count > CAM_MAX_FB_COUNT) {
+                    continue;
+                }
+                bench_result_t r;
+                bench_measure(size, quality, fb_count, frames, false, mounted, &r);
+
+                char * p = line;
+                if (first) {
+                    // the sensor is only known once the camera has started
+                    sensor_t * s = esp_camera_sensor_get();
+                    uint16_t pid = s ? s->id.PID : 0;
+                    p+=sprintf(p, "{\"sensor\":\"%s\",\"build\":\"%s %s\",\"sdk\":\"%s\",\"psram\":%u,\"frames\":%d,\"results\":[",
+                               pid == OV3660_PID ? "OV3660" : pid == OV2640_PID ? "OV2640" : pid == OV5640_PID ? "OV5640" : "unknown",
+                               __DATE__, __TIME__, ESP.getSdkVersion(), psramFound(), frames);
+                } else {
+                    *p++ = ',';
+                }
+                p+=sprintf(p, "{\"framesize\":%u,\"width\":%u,\"height\":%u,\"quality\":%d,\"fb_count\":%d,",
+                           size, resolution[size].width, resolution[size].height, quality, fb_count);
+                if (r.frames) {
+                    p+=sprintf(p, "\"init_ms\":%.1f,\"capture_ms\":%.1f,\"capture_max_ms\":%.1f,\"jpeg_bytes\":%u,\"fps\":%.1f,\"sd_mb_s\":%.2f}",
+                               r.init_us / 1000.0, r.capture_us / 1000.0 / r.frames, r.capture_max_us / 1000.0,
+                               (unsigned)(r.bytes / r.frames), r.frames / (r.stream_us / 1e6),
+                               r.sd_bytes ? r.sd_bytes / (r.sd_us / 1e6) / (1024 * 1024) : -1.0);
+                } else {
+                    p+=sprintf(p, "\"error\":\"%s\"}", r.err == ESP_OK ? "no frame" : "camera start failed");
+                }
+                httpd_resp_send_chunk(req, line, p - line);
+                first = false;
+            }
+        }
+    }
+    bench_finish(mounted, streaming);
+    camera_release();
+
+    httpd_resp_send_chunk(req, first ? "{\"results\":[]}" : "]}", first ? 14 : 2);
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+// trail camera wakes start the camera with the stored buffer count
+static bool tune_measure(int framesize, int quality, tune_sample_t * sample){
+    int fb_count = preferences.getUChar("fb_count", 0);
+    bench_result_t r;
+
+    if (!psramFound()) {
+        fb_count = 1;
+    } else if (!fb_count) {
+        fb_count = 2;
+    }
+    bench_measure((framesize_t)framesize, quality, fb_count, TUNE_FRAMES, true, true, &r);
+    if (!r.frames || !r.sd_bytes) {
+        return false;
+    }
+    sample->init_ms = r.init_us / 1000;
+    sample->capture_ms = r.capture_us / 1000 / r.frames;
+    sample->write_ms = r.sd_us / 1000 / r.sd_frames;
+    sample->bytes = r.bytes / r.frames;
+    return true;
+}
+
+static size_t tune_json(char * out, const tune_result_t * t){
+    char * p = out;
+    p+=sprintf(p, "{\"target\":\"%s\",\"limit\":%.1f,\"met\":%s,\"framesize\":%u,\"width\":%u,\"height\":%u,\"quality\":%u,",
+               t->target == TUNE_WAKE_MS ? "wake_ms" : t->target == TUNE_MB_DAY ? "mb_day" : "days", t->limit,
+               t->met ? "true" : "false", t->framesize, resolution[t->framesize].width, resolution[t->framesize].height, t->quality);
+    p+=sprintf(p, "\"jpeg_bytes\":%u,\"wake_ms\":%u,\"mb_day\":%.1f,\"days\":%.0f,\"measured\":%u,\"time\":%u}",
+               t->bytes, t->wake_ms, t->mb_day, t->days, t->measured, t->time);
+    return p - out;
+}
+
+/*
+ * GET /tune returns the last tuning. With wake_ms=N, mb_day=N or days=N
+ * the tuner (tuner.h) first measures the current scene and stores the
+ * best framesize and quality that keep within that budget.
+ */
+static esp_err_t tune_handler(httpd_req_t *req){
+    esp_err_t handed;
+    if (!http_on_worker(req, tune_handler, &handed)) {
+        return handed;
+    }
+    static const struct { const char * key; char target; } targets[] = {
+        { "wake_ms", TUNE_WAKE_MS }, { "mb_day", TUNE_MB_DAY }, { "days", TUNE_DAYS }
+    };
+    char json_response[512];
+    char value[16];
+    char * buf;
+    size_t buf_len;
+    char target = 0;
+    float limit = 0;
+
+    buf_len = httpd_req_get_url_query_len(req) + 1;
+    if (buf_len > 1) {
+        buf = (char*)pool_alloc(buf_len);
+        if(!buf){
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
+            for (size_t i = 0; i < sizeof(targets) / sizeof(targets[0]); i++) {
+                if (httpd_query_key_value(buf, targets[i].key, value, sizeof(value)) == ESP_OK) {
+                    target = targets[i].target;
+                    limit = atof(value);
+                }
+            }
+        }
+        pool_free(buf);
+    }
+
+    tune_result_t result;
+    if (target) {
+        if (limit <= 0) {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        if (!camera_claim(req)) {
+            return ESP_OK;
+        }
+        energy_report_t energy;
+        energy_get_report(&energy);
+        tune_model_t model;
+        model.boot_ms = energy.captures ? energy.phase_s[PHASE_BOOT] * 1000 / energy.captures : TUNE_DEFAULT_BOOT_MS;
+        model.wakes_per_day = captures_per_day();
+
+        bool streaming = frame_arbiter_running();
+        bool mounted = sd_mount() && SD_MMC.cardType() != CARD_NONE;
+        model.free_bytes = mounted ? sd_free_bytes() : -1;
+        bool ran = mounted && (target != TUNE_DAYS || model.free_bytes >= 0) &&
+                   tune_run(target, limit, &model, psramFound() ? FRAMESIZE_UXGA : FRAMESIZE_SVGA, tune_measure, &result);
+        bench_finish(mounted, streaming);
+        camera_release();
+        if (!ran) {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+    } else if (!tune_last(&result)) {
+        httpd_resp_send_404(req);
+        return ESP_FAIL;
+    }
+
+    size_t len = tune_json(json_response, &result);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    return httpd_resp_send(req, json_response, len);
+}
+
+#define CATALOG_PAGE_DEFAULT 50
+#define CATALOG_PAGE_MAX 500
+
+/*
+ * GET /catalog lists captures between from and to (epoch seconds) from
+ * the on-card catalog, limit at a time starting offset records in.
+ * deleted=1 includes captures removed from the card, rebuild=1 first
+ * starts a new catalog from the files in the root directory.
+ */
+static esp_err_t catalog_handler(httpd_req_t *req){
+    esp_err_t handed;
+    if (!http_on_worker(req, catalog_handler, &handed)) {
+        return handed;
+    }
+    char value[16];
+    char out[1024];
+    char * buf;
+    size_t buf_len;
+    uint32_t from = 0;
+    uint32_t to = UINT32_MAX;
+    uint32_t offset = 0;
+    int limit = CATALOG_PAGE_DEFAULT;
+    bool deleted = false;
+    bool rebuild = false;
+
+    buf_len = httpd_req_get_url_query_len(req) + 1;
+    if (buf_len > 1) {
+        buf = (char*)pool_alloc(buf_len);
+        if(!buf){
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
+            if (httpd_query_key_value(buf, "from", value, sizeof(value)) == ESP_OK) {
+                from = strtoul(value, NULL, 10);
+            }
+            if (httpd_query_key_value(buf, "to", value, sizeof(value)) == ESP_OK) {
+                to = strtoul(value, NULL, 10);
+            }
+            if (httpd_query_key_value(buf, "offset", value, sizeof(value)) == ESP_OK) {
+                offset = strtoul(value, NULL, 10);
+            }
+            if (httpd_query_key_value(buf, "limit", value, sizeof(value)) == ESP_OK) {
+                limit = constrain(atoi(value), 0, CATALOG_PAGE_MAX);
+            }
+            if (httpd_query_key_value(buf, "deleted", value, sizeof(value)) == ESP_OK) {
+                deleted = atoi(value);
+            }
+            if (httpd_query_key_value(buf, "rebuild", value, sizeof(value)) == ESP_OK) {
+                rebuild = atoi(value);
+            }
+        }
+        pool_free(buf);
+    }
+
+    // the card is unmounted at the end, which would pull it from under a sweep or another /catalog
+    if (!camera_claim(req)) {
+        return ESP_OK;
+    }
+    if (!sd_mount() || !catalog_begin()) {
+        SD_MMC.end();
+        rtc_bus_begin();
+        camera_release();
+        httpd_resp_send_404(req);
+        return ESP_FAIL;
+    }
+    if (rebuild && catalog_rebuild() < 0) {
+        catalog_end();
+        SD_MMC.end();
+        rtc_bus_begin();
+        camera_release();
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+
+    const catalog_summary_t * summary = catalog_summary();
+    uint32_t first = catalog_find(from);
+    // a sorted catalog gives the count in the range from two searches
+    int64_t in_range = -1;
+    if (summary->sorted) {
+        in_range = (to == UINT32_MAX ? summary->count : catalog_find(to + 1)) - first;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    char * p = out;
+    p+=sprintf(p, "{\"records\":%u,\"bytes\":%llu,\"first\":%u,\"last\":%u,", summary->count - summary->deleted,
+               (unsigned long long)summary->bytes, summary->first_time, summary->last_time);
+    p+=sprintf(p, "\"stored\":%u,\"references\":%u,\"dropped\":%u,\"deleted\":%u,\"sorted\":%s,\"in_range\":%lld,\"captures\":[",
+               summary->outcomes[PHASH_STORED], summary->outcomes[PHASH_REFERENCE], summary->outcomes[PHASH_DROPPED],
+               summary->deleted, summary->sorted ? "true" : "false", (long long)in_range);
+
+    catalog_record_t record;
+    int listed = 0;
+    for (uint32_t i = first; i < summary->count && listed < limit; i++) {
+        if (!catalog_read(i, &record)) {
+            break;
+        }
+        if (record.time > to) {
+            if (summary->sorted) {
+                break;
+            }
+            continue;
+        }
+        if (record.time < from || ((record.flags & CATALOG_DELETED) && !deleted)) {
+            continue;
+        }
+        if (offset) {
+            offset--;
+            continue;
+        }
+        if (p - out > (int)sizeof(out) - 160) {
+            httpd_resp_send_chunk(req, out, p - out);
+            p = out;
+        }
+        p+=sprintf(p, "%s{\"time\":%u,\"name\":\"%s\",\"size\":%u,\"settings\":\"%08x\",\"score\":%u,\"flags\":%u}",
+                   listed ? "," : "", record.time, record.name, record.size, record.settings, record.score, record.flags);
+        listed++;
+    }
+    p+=sprintf(p, "]}");
+    httpd_resp_send_chunk(req, out, p - out);
+
+    catalog_end();
+    SD_MMC.end();
+    rtc_bus_begin(); // the card had the I2C pins
+    camera_release();
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+#if CONFIG_HTTPD_WS_SUPPORT
+/*
+ * WebSocket on /ws for the settings pages. A setting is sent as
+ * {"id":N,"var":"quality","val":"10"} and answered with
+ * {"ack":N,"ok":true}, over the one connection instead of a new request
+ * each. Once a second the members of /status that changed are pushed as
+ * {"status":{...}}; a client that just connected gets all of them.
+ * Messages without an id are keepalives and get no answer.
+ */
+#define WS_MESSAGE_MAX 256
+#define WS_TELEMETRY_MS 1000
+#define WS_MAX_CLIENTS 4
+
+static int ws_new_fds[WS_MAX_CLIENTS] = { -1, -1, -1, -1 };  // still to get the full status
+static char * ws_status;        // the status last pushed, empty when nobody was listening
+static char * ws_status_next;
+static char * ws_out;
+
+static void ws_send_text(int fd, const char * text, size_t len){
+    httpd_ws_frame_t frame;
+
+    memset(&frame, 0, sizeof(frame));
+    frame.type = HTTPD_WS_TYPE_TEXT;
+    frame.payload = (uint8_t *)text;
+    frame.len = len;
+    httpd_ws_send_frame_async(camera_httpd, fd, &frame);
+}
+
+static bool ws_take_new(int fd){
+    for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+        if (ws_new_fds[i] == fd) {
+            ws_new_fds[i] = -1;
+            return true;
+        }
+    }
+    return false;
+}
+
+// a client that went away before its first push leaves its fd here, the slot would stay taken
+static void ws_forget_closed(const int * ws_fds, int clients){
+    for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+        bool open = false;
+        for (int c = 0; c < clients && !open; c++) {
+            open = ws_new_fds[i] == ws_fds[c];
+        }
+        if (!open) {
+            ws_new_fds[i] = -1;
+        }
+    }
+}
+
+// queued onto the server task by ws_telemetry_task, like every handler it runs there
+static void ws_push(void * arg){
+    int fds[HTTP_MAX_SOCKETS];
+    int ws_fds[HTTP_MAX_SOCKETS];
+    size_t count = HTTP_MAX_SOCKETS;
+    int clients = 0;
+
+    if (httpd_get_client_list(camera_httpd, &count, fds) != ESP_OK) {
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (httpd_ws_get_fd_info(camera_httpd, fds[i]) == HTTPD_WS_CLIENT_WEBSOCKET) {
+            ws_fds[clients++] = fds[i];
+        }
+    }
+    ws_forget_closed(ws_fds, clients);
+    if (!clients) {
+        ws_status[0] = 0;
+        return;
+    }
+
+    status_json(ws_status_next);
+    size_t len = status_diff(NULL, ws_status_next, ws_out);
+    for (int i = 0; i < clients; i++) {
+        if (ws_take_new(ws_fds[i]) || !ws_status[0]) {
+            ws_send_text(ws_fds[i], ws_out, len);
+            ws_fds[i] = -1;
+        }
+    }
+    if (ws_status[0] && (len = status_diff(ws_status, ws_status_next, ws_out))) {
+        for (int i = 0; i < clients; i++) {
+            if (ws_fds[i] >= 0) {
+                ws_send_text(ws_fds[i], ws_out, len);
+            }
+        }
+    }
+    char * swap = ws_status;
+    ws_status = ws_status_next;
+    ws_status_next = swap;
+}
+
+static void ws_telemetry_task(void * arg){
+    while (true) {
+        vTaskDelay(pdMS_TO_TICKS(WS_TELEMETRY_MS));
+        httpd_queue_work(camera_httpd, ws_push, NULL);
+    }
+}
+
+static esp_err_t ws_handler(httpd_req_t *req){
+    char message[WS_MESSAGE_MAX + 1];
+    char id[12];
+    char variable[32];
+    char value[32];
+    char reply[48];
+    httpd_ws_frame_t frame;
+
+    if (req->method == HTTP_GET) {
+        // the handshake is done, the next push sends this client everything
+        int fd = httpd_req_to_sockfd(req);
+        for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+            if (ws_new_fds[i] < 0) {
+                ws_new_fds[i] = fd;
+                break;
+            }
+        }
+        return ESP_OK;
+    }
+
+    memset(&frame, 0, sizeof(frame));
+    frame.payload = (uint8_t *)message;
+    esp_err_t err = httpd_ws_recv_frame(req, &frame, WS_MESSAGE_MAX);
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (frame.type != HTTPD_WS_TYPE_TEXT) {
+        return ESP_OK;
+    }
+    message[frame.len] = 0;
+    if (!json_member(message, "id", id, sizeof(id))) {
+        return ESP_OK;
+    }
+
+    int res = 0;
+    if (json_member(message, "var", variable, sizeof(variable))) {
+        if (!json_member(message, "val", value, sizeof(value))) {
+            value[0] = 0;
+        }
+        res = apply_control(variable, value);
+    }
+    frame.type = HTTPD_WS_TYPE_TEXT;
+    frame.payload = (uint8_t *)reply;
+    frame.len = snprintf(reply, sizeof(reply), "{\"ack\":%ld,\"ok\":%s}", atol(id), res ? "false" : "true");
+    return httpd_ws_send_frame(req, &frame);
+}
+
+static void ws_start(void){
+    size_t size = STATUS_JSON_MAX + 16;
+
+    ws_status = (char *)(psramFound() ? ps_malloc(3 * size) : malloc(3 * size));
+    if (!ws_status) {
+        return;
+    }
+    ws_status_next = ws_status + size;
+    ws_out = ws_status_next + size;
+    ws_status[0] = 0;
+    xTaskCreate(ws_telemetry_task, "ws_telemetry", 2048, NULL, 1, NULL);
+}
+#endif
+
+static esp_err_t configure_handler(httpd_req_t *req){
+
+    camera_stop_unclaimed();
+  
+    httpd_resp_set_type(req, "text/html");
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+
+    return httpd_resp_send(req, (const char *)index_config_html_gz, index_config_html_gz_len);
+}
+//copy this part----
+static esp_err_t eric_handler(httpd_req_t *req){
+
+    camera_stop_unclaimed();
+  
+    httpd_resp_set_type(req, "text/html");
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+
+    return httpd_resp_send(req, (const char *)eric_config_html_gz, eric_config_html_gz_len);
+}
+//----------------
+
+//copied part----
+static esp_err_t help_handler(httpd_req_t *req){
+
+    camera_stop_unclaimed();
+  
+    httpd_resp_set_type(req, "text/html");
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+
+    return httpd_resp_send(req, (const char *)help_config_html_gz, help_config_html_gz_len);
+}
+//----------------
+
+//copied part#2----
+static esp_err_t homepage_handler(httpd_req_t *req){
+
+    camera_stop_unclaimed();
+  
+    httpd_resp_set_type(req, "text/html");
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+
+    return httpd_resp_send(req, (const char *)homepage_config_html_gz, homepage_config_html_gz_len);
+}
+//----------------
+extern int initialize_camera();
+extern void update_image_settings();  
+static esp_err_t index_handler(httpd_req_t *req){
+
+    // another client may be streaming, the camera is only started when it is not
+    if (!frame_arbiter_running() && camera_try_claim()) {
+        int fb_count = initialize_camera();
+        update_image_settings();  
+        frame_arbiter_start(fb_count);
+        camera_release();
+    }
+  
+    httpd_resp_set_type(req, "text/html");
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    
+    // a sweep may have the camera stopped, the OV2640 page is the default then as well
+    sensor_t * s = esp_camera_sensor_get();
+    if (s && s->id.PID == OV3660_PID) {
+        return httpd_resp_send(req, (const char *)index_ov3660_html_gz, index_ov3660_html_gz_len);
+    }
+    return httpd_resp_send(req, (const char *)index_ov2640_html_gz, index_ov2640_html_gz_len);
+}
+
+
+void startCameraServer(){
+    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+    config.max_uri_handlers = 20; // the default of 8 is already used up by port 80
+    // an idle browser connection is closed to make room rather than refusing a new one
+    config.lru_purge_enable = true;
+    config.max_open_sockets = constrain(preferences.getUChar("http_socks", HTTP_DEFAULT_MAX_SOCKETS),
+                                        2, HTTP_MAX_SOCKETS - HTTP_STREAM_SOCKETS);
+
+    httpd_uri_t index_uri = {
+        .uri       = "/stream.html",
+        .method    = HTTP_GET,
+        .handler   = index_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t configure_uri = {
+        .uri       = "/configure",
+        .method    = HTTP_GET,
+        .handler   = configure_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t eric_uri = {
+        .uri       = "/settings.html",
+        .method    = HTTP_GET,
+        .handler   = eric_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t status_uri = {
+        .uri       = "/status",
+        .method    = HTTP_GET,
+        .handler   = status_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t metrics_uri = {
+        .uri       = "/metrics",
+        .method    = HTTP_GET,
+        .handler   = metrics_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t schedule_uri = {
+        .uri       = "/schedule",
+        .method    = HTTP_GET,
+        .handler   = schedule_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t uplink_uri = {
+        .uri       = "/uplink",
+        .method    = HTTP_GET,
+        .handler   = uplink_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t cmd_uri = {
+        .uri       = "/control",
+        .method    = HTTP_GET,
+        .handler   = cmd_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t bench_init_uri = {
+        .uri       = "/bench_init",
+        .method    = HTTP_GET,
+        .handler   = bench_init_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t sdbench_uri = {
+        .uri       = "/sdbench",
+        .method    = HTTP_GET,
+        .handler   = sdbench_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t bench_uri = {
+        .uri       = "/bench",
+        .method    = HTTP_GET,
+        .handler   = bench_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t tune_uri = {
+        .uri       = "/tune",
+        .method    = HTTP_GET,
+        .handler   = tune_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t catalog_uri = {
+        .uri       = "/catalog",
+        .method    = HTTP_GET,
+        .handler   = catalog_handler,
+        .user_ctx  = NULL
+    };
+
+#if CONFIG_HTTPD_WS_SUPPORT
+    httpd_uri_t ws_uri = {
+        .uri       = "/ws",
+        .method    = HTTP_GET,
+        .handler   = ws_handler,
+        .user_ctx  = NULL,
+        .is_websocket = true
+    };
+#endif
+
+    httpd_uri_t capture_uri = {
+        .uri       = "/capture",
+        .method    = HTTP_GET,
+        .handler   = capture_handler,
+        .user_ctx  = NULL
+    };
+
+   httpd_uri_t stream_uri = {
+        .uri       = "/stream",
+        .method    = HTTP_GET,
+        .handler   = stream_handler,
+        .user_ctx  = NULL
+    };
+
+#if CONFIG_HTTPD_WS_SUPPORT
+    httpd_uri_t ws_stream_uri = {
+        .uri       = "/ws/stream",
+        .method    = HTTP_GET,
+        .handler   = ws_stream_handler,
+        .user_ctx  = NULL,
+        .is_websocket = true
+    };
+#endif
+
+    httpd_uri_t help_uri = {
+        .uri       = "/help.html",
+        .method    = HTTP_GET,
+        .handler   = help_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t homepage_uri = {
+        .uri       = "/",
+        .method    = HTTP_GET,
+        .handler   = homepage_handler,
+        .user_ctx  = NULL
+    };
+    ra_filter_init(&ra_filter, 20);
+    pool_begin();
+    camera_owner = xSemaphoreCreateMutex();
+    http_workers_start();
+        
+    Serial.printf("Starting web server on port: '%d'\n", config.server_port);
+    if (httpd_start(&camera_httpd, &config) == ESP_OK) {
+        httpd_register_uri_handler(camera_httpd, &index_uri);
+        httpd_register_uri_handler(camera_httpd, &cmd_uri);
+        httpd_register_uri_handler(camera_httpd, &status_uri);
+        httpd_register_uri_handler(camera_httpd, &metrics_uri);
+        httpd_register_uri_handler(camera_httpd, &schedule_uri);
+        httpd_register_uri_handler(camera_httpd, &uplink_uri);
+        httpd_register_uri_handler(camera_httpd, &capture_uri);
+        httpd_register_uri_handler(camera_httpd, &configure_uri);
+        httpd_register_uri_handler(camera_httpd, &eric_uri);
+        httpd_register_uri_handler(camera_httpd, &help_uri);
+        httpd_register_uri_handler(camera_httpd, &homepage_uri);
+        httpd_register_uri_handler(camera_httpd, &bench_init_uri);
+        httpd_register_uri_handler(camera_httpd, &sdbench_uri);
+        httpd_register_uri_handler(camera_httpd, &bench_uri);
+        httpd_register_uri_handler(camera_httpd, &tune_uri);
+        httpd_register_uri_handler(camera_httpd, &catalog_uri);
+#if CONFIG_HTTPD_WS_SUPPORT
+        httpd_register_uri_handler(camera_httpd, &ws_uri);
+        ws_start();
+#endif
+    }
+
+    config.server_port += 1;
+    config.ctrl_port += 1;
+    config.max_open_sockets = HTTP_STREAM_SOCKETS;
+    Serial.printf("Starting stream server on port: '%d'\n", config.server_port);
+    if (httpd_start(&stream_httpd, &config) == ESP_OK) {
+        httpd_register_uri_handler(stream_httpd, &stream_uri);
+#if CONFIG_HTTPD_WS_SUPPORT
+        httpd_register_uri_handler(stream_httpd, &ws_stream_uri);
+#endif
+    }
+}
@@ -0,0 +1,93 @@
+#include <Arduino.h>
+#include <Preferences.h>
+#include <SD_MMC.h>
+#include <sys/time.h>
+#include "rom/crc.h"
+#include "boot_cache.h"
+#include "capture_timing.h"
+#include "phash.h"
+#include "rtc_wake.h"
+#include "sd_writer.h"
+
+#define BOOT_CACHE_MAGIC 0x57524d43  // "WRMC"
+
+extern Preferences preferences;
+extern void load_schedule(schedule_t * schedule);
+extern void station_id(char * out, size_t size);
+
+RTC_DATA_ATTR boot_cache_t boot_cache;
+
+static int8_t cache_state = -1;  // -1 not checked yet, 0 invalid, 1 valid
+static bool warm_clock;          // the clock was carried over the sleep this wake
+
+static uint32_t boot_cache_crc(void){
+  return crc32_le(0, (const uint8_t *)&boot_cache, offsetof(boot_cache_t, crc));
+}
+
+bool boot_cache_valid(void){
+  if (cache_state < 0) {
+    cache_state = boot_cache.magic == BOOT_CACHE_MAGIC && boot_cache.crc == boot_cache_crc();
+  }
+  return cache_state;
+}
+
+void boot_cache_invalidate(void){
+  boot_cache.magic = 0;
+  cache_state = 0;
+}
+
+/*
+ * The timer sleeps (1 + ppm) times longer than the clock thinks, the
+ * clock counts the same RC oscillator ticks, so it is behind by as much.
+ */
+bool boot_cache_restore_clock(void){
+  if (!boot_cache_valid() || boot_cache.drift_samples == 0 ||
+      boot_cache.warm_wakes >= BOOT_CACHE_RESYNC || boot_cache.sleep_us == 0) {
+    return false;
+  }
+
+  int64_t now = epoch_us();
+  int64_t slept = now - boot_cache.sleep_us;
+  if (slept < 0) {
+    return false;
+  }
+  now += (int64_t)(slept * (boot_cache.drift_ppm / 1e6));
+
+  struct timeval tv = { .tv_sec = (time_t)(now / 1000000LL), .tv_usec = (suseconds_t)(now % 1000000LL) };
+  settimeofday(&tv, NULL);
+  warm_clock = true;
+  return true;
+}
+
+/*
+ * With the cache invalid the accessors below all read NVS, which is
+ * what fills it.
+ */
+void boot_cache_save(void){
+  if (!boot_cache_valid()) {
+    memset(&boot_cache, 0, sizeof(boot_cache));
+    camera_settings_load(&boot_cache.camera);
+    load_schedule(&boot_cache.schedule);
+    preferences.getString("tz", boot_cache.tz, sizeof(boot_cache.tz));
+    if (!boot_cache.tz[0]) {
+      strlcpy(boot_cache.tz, SCHED_DEFAULT_TZ, sizeof(boot_cache.tz));
+    }
+    station_id(boot_cache.station, sizeof(boot_cache.station));
+    boot_cache.wake = wake_source();
+    boot_cache.dedup = preferences.getUChar("dedup", DEDUP_OFF);
+    boot_cache.dedup_dist = preferences.getUChar("dedup_dist", DEDUP_DEFAULT_DISTANCE);
+    boot_cache.drift_ppm = rtc_drift_ppm();
+    boot_cache.drift_samples = rtc_drift_samples();
+    energy_model_load(&boot_cache.energy);
+    boot_cache.sd_bus = preferences.getUChar("sd_bus", SD_BUS_4BIT);
+    boot_cache.sd_khz = preferences.getUShort("sd_khz", BOARD_MAX_SDMMC_FREQ);
+    retention_policy_load(&boot_cache.retention);
+    uplink_config_load(&boot_cache.uplink);
+    boot_cache.size_kb = preferences.getUShort("size_kb", 0);
+    boot_cache.magic = BOOT_CACHE_MAGIC;
+  }
+  boot_cache.warm_wakes = warm_clock ? boot_cache.warm_wakes + 1 : 0;
+  boot_cache.sleep_us = epoch_us();
+  boot_cache.crc = boot_cache_crc();
+  cache_state = 1;
+}
@@ -0,0 +1,60 @@
+/*
+ * Warm boot cache. Everything a trail camera wake reads from NVS is kept
+ * decoded in RTC memory, guarded by a checksum, so timer wakes can go
+ * straight to the camera. The ESP32 clock is also carried across the
+ * sleep and corrected for the measured drift instead of being read back
+ * from the DS3231 every wake.
+ */
+#ifndef _BOOT_CACHE_H_
+#define _BOOT_CACHE_H_
+
+#include <stdint.h>
+#include "camera_settings.h"
+#include "exif.h"
+#include "energy.h"
+#include "retention.h"
+#include "schedule.h"
+#include "uplink.h"
+
+#define BOOT_CACHE_RESYNC 24  // warm wakes between reads of the DS3231
+
+typedef struct {
+  uint32_t magic;
+  camera_settings_t camera;
+  schedule_t schedule;
+  char tz[64];
+  char station[EXIF_STATION_MAX];
+  char wake;               // WAKE_TIMER or WAKE_ALARM
+  uint8_t dedup;
+  uint8_t dedup_dist;
+  float drift_ppm;
+  uint32_t drift_samples;
+  energy_model_t energy;
+  uint8_t sd_bus;          // SD_BUS_1BIT or SD_BUS_4BIT
+  uint16_t sd_khz;
+  retention_policy_t retention;
+  uplink_config_t uplink;
+  uint16_t size_kb;        // JPEG size target, 0 for off
+  int64_t sleep_us;        // epoch time the station went to sleep, microseconds
+  uint32_t warm_wakes;     // wakes since the clock was last read from the DS3231
+  uint32_t crc;            // crc32 of everything above
+} boot_cache_t;
+
+extern boot_cache_t boot_cache;
+
+// true when the cache holds the settings, checked once early in setup()
+bool boot_cache_valid(void);
+
+// a setting changed, the next wake reads NVS again
+void boot_cache_invalidate(void);
+
+/*
+ * On a timer wake with a valid cache, advance the clock by the drift over
+ * the sleep. Returns false when the DS3231 has to be read instead.
+ */
+bool boot_cache_restore_clock(void);
+
+// called just before deep sleep, refills the cache from NVS when needed
+void boot_cache_save(void);
+
+#endif
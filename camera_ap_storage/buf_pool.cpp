@@ -0,0 +1,121 @@
+#include <Arduino.h>
+#include "img_converters.h"
+#include "buf_pool.h"
+
+static const uint32_t class_size[POOL_CLASSES] = POOL_CLASS_SIZES;
+static const uint8_t class_count[POOL_CLASSES] = POOL_CLASS_COUNTS;
+
+static uint8_t * region[POOL_CLASSES];     // class_count buffers of class_size each
+static uint32_t free_mask[POOL_CLASSES];   // bit per free buffer
+static pool_stats_t stats;
+static portMUX_TYPE pool_mux = portMUX_INITIALIZER_UNLOCKED;
+
+bool pool_begin(void){
+  size_t total = 0;
+
+  if (stats.ready) {
+    return true;
+  }
+  for (int c = 0; c < POOL_CLASSES; c++) {
+    stats.size[c] = class_size[c];
+    total += class_size[c] * class_count[c];
+  }
+  if (!psramFound()) {
+    return false;
+  }
+  // one block, the classes are laid out in it one after the other
+  uint8_t * block = (uint8_t *)ps_malloc(total);
+  if (!block) {
+    Serial.printf("pool: no %u bytes of PSRAM\n", (unsigned)total);
+    return false;
+  }
+  for (int c = 0; c < POOL_CLASSES; c++) {
+    region[c] = block;
+    block += class_size[c] * class_count[c];
+    free_mask[c] = class_count[c] < 32 ? (1UL << class_count[c]) - 1 : UINT32_MAX;
+  }
+  stats.ready = true;
+  return true;
+}
+
+void * pool_alloc(size_t size){
+  int c = 0;
+
+  while (c < POOL_CLASSES && size > class_size[c]) {
+    c++;
+  }
+  portENTER_CRITICAL(&pool_mux);
+  if (c == POOL_CLASSES) {
+    stats.oversize++;
+  } else if (stats.ready && free_mask[c]) {
+    int i = __builtin_ctz(free_mask[c]);
+    free_mask[c] &= ~(1UL << i);
+    if (++stats.used[c] > stats.peak[c]) {
+      stats.peak[c] = stats.used[c];
+    }
+    portEXIT_CRITICAL(&pool_mux);
+    return region[c] + i * class_size[c];
+  } else if (stats.ready) {
+    stats.failed[c]++;
+  }
+  portEXIT_CRITICAL(&pool_mux);
+  return psramFound() ? ps_malloc(size) : malloc(size);
+}
+
+void pool_free(void * p){
+  uint8_t * b = (uint8_t *)p;
+
+  if (!p) {
+    return;
+  }
+  for (int c = 0; c < POOL_CLASSES; c++) {
+    if (stats.ready && b >= region[c] && b < region[c] + class_size[c] * class_count[c]) {
+      int i = (b - region[c]) / class_size[c];
+      portENTER_CRITICAL(&pool_mux);
+      free_mask[c] |= 1UL << i;
+      stats.used[c]--;
+      portEXIT_CRITICAL(&pool_mux);
+      return;
+    }
+  }
+  free(p);
+}
+
+typedef struct {
+  uint8_t * buf;
+  size_t cap;
+  size_t len;
+} jpg_out_t;
+
+static size_t jpg_to_buffer(void * arg, size_t index, const void * data, size_t len){
+  jpg_out_t * out = (jpg_out_t *)arg;
+
+  if (out->len + len > out->cap) {
+    return 0;  // stops the encoder
+  }
+  memcpy(out->buf + out->len, data, len);
+  out->len += len;
+  return len;
+}
+
+bool pool_frame2jpg(camera_fb_t * fb, uint8_t quality, uint8_t ** out, size_t * len){
+  // the encoder gives no size up front, so a buffer of the largest class
+  jpg_out_t jpg = { (uint8_t *)pool_alloc(class_size[POOL_CLASSES - 1]), class_size[POOL_CLASSES - 1], 0 };
+
+  if (!jpg.buf) {
+    return false;
+  }
+  if (!frame2jpg_cb(fb, quality, jpg_to_buffer, &jpg)) {
+    pool_free(jpg.buf);
+    return false;
+  }
+  *out = jpg.buf;
+  *len = jpg.len;
+  return true;
+}
+
+void pool_get_stats(pool_stats_t * s){
+  portENTER_CRITICAL(&pool_mux);
+  *s = stats;
+  portEXIT_CRITICAL(&pool_mux);
+}
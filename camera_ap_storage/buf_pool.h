@@ -0,0 +1,46 @@
+/*
+ * Fixed-size buffer pool in PSRAM for what the web servers allocate per
+ * request or per frame: query strings, frames converted to JPEG and file
+ * I/O chunks. The pool is carved out once when the servers start, so
+ * hours of streaming do not fragment the heap. A request the pool cannot
+ * serve (too big, every buffer of its size in use, no PSRAM) falls back
+ * to the heap and is counted.
+ */
+#ifndef _BUF_POOL_H_
+#define _BUF_POOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_camera.h"
+
+#define POOL_CLASSES 3
+// buffer sizes and counts per class, 640 KB in all
+#define POOL_CLASS_SIZES { 512, 16384, 256 * 1024 }
+#define POOL_CLASS_COUNTS { 16, 8, 2 }
+
+typedef struct {
+  uint32_t size[POOL_CLASSES];
+  uint8_t used[POOL_CLASSES];
+  uint8_t peak[POOL_CLASSES];      // high-water mark of used
+  uint32_t failed[POOL_CLASSES];   // class full, served from the heap instead
+  uint32_t oversize;               // bigger than the largest class, from the heap
+  bool ready;                      // the pool was allocated
+} pool_stats_t;
+
+// allocate the pool, once; without PSRAM everything comes from the heap
+bool pool_begin(void);
+
+void * pool_alloc(size_t size);
+// any pointer from pool_alloc, whether it came from the pool or the heap
+void pool_free(void * p);
+
+/*
+ * A frame in another pixel format as a JPEG in a pooled buffer. Free
+ * *out with pool_free(). Returns false when it does not fit or the
+ * encoder failed.
+ */
+bool pool_frame2jpg(camera_fb_t * fb, uint8_t quality, uint8_t ** out, size_t * len);
+
+void pool_get_stats(pool_stats_t * stats);
+
+#endif
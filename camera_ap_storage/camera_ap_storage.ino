@@ -1,491 +1,771 @@
-#include <WiFi.h>
-#include "FS.h"
-#include "SD_MMC.h"
-#include "esp_camera.h"
-#include "esp_sleep.h"
-#include <EEPROM.h>            // read and write from flash memory
-#include <Preferences.h>
-#include "RTClib.h"
-#include <Wire.h>
-#include "soc/soc.h"
-#include "soc/rtc_cntl_reg.h"
-
-#define CAMERA_MODEL_AI_THINKER
-#include "camera_pins.h"
-
-#define S_TO_uS_FACTOR 1000000  //Conversion factor for micro seconds to seconds
-#define TIME_TO_SLEEP  10 // set time for sleep and wakeup
-#define TIME_TO_WAIT 4 // set time to wait for button press
-
-// define number of bytes to set aside in persistant memory
-#define EEPROM_SIZE 4
-#define BUTTON 0
-#define LED 4
-
-#define AP_MODE 1
-#define TRAILCAMERA_MODE 2
-
-#define I2C_SDA 14
-#define I2C_SCL 15
-
-int pictureNumber = 0;
-int sleep_time = TIME_TO_SLEEP  ;
-
-const char* ssid = "Frontier TrailCam Access Point";
-const char* password = "123456789"; //<--Placeholder password, change to whatever you desire :)
-RTC_DS3231 rtc;
-Preferences preferences ;
-
-void startCameraServer();
-
-/*
- * This function takes a picture and stores in a file
- */
-static esp_err_t save_camera_image(fs::FS &fs, const char * path) {
-    // Variable definitions for camera frame buffer
-    camera_fb_t * fb = NULL;
-    int64_t fr_start = esp_timer_get_time();
-
-    // Get the contents of the camera frame buffer
-    fb = esp_camera_fb_get();
-    if (!fb) {
-      Serial.println("Camera capture failed");
-      return ESP_FAIL;
-    }
-
-    // Save image to file
-    size_t fb_len = 0;
-    fb_len = fb->len;
-    File file = fs.open(path, FILE_WRITE);
-    if(file){
-      file.write(fb->buf, fb->len); // payload (image), payload length
-      file.close();
-    } else {
-      Serial.println("File save failed");
-      return ESP_FAIL;      
-    }
-
-    // Release the camera frame buffer
-    esp_camera_fb_return(fb);
-    int64_t fr_end = esp_timer_get_time();
-    Serial.printf("JPG: %uB %ums\n", (uint32_t)(fb_len), (uint32_t)((fr_end - fr_start)/1000));
-
-    pinMode(LED, OUTPUT);
-    digitalWrite(LED,0);
-
-    return ESP_OK;
-}
-
-//Function that prints the reason by which ESP32 has been awaken from sleep
-void print_wakeup_reason(esp_sleep_wakeup_cause_t wakeup_reason){
-
-  switch(wakeup_reason)
-  {
-    case ESP_SLEEP_WAKEUP_EXT0: 
-      Serial.println("Wakeup caused by external signal using RTC_IO"); 
-      break;
-    case ESP_SLEEP_WAKEUP_EXT1: 
-      Serial.println("Wakeup caused by external signal using RTC_CNTL"); 
-      break;
-    case ESP_SLEEP_WAKEUP_TIMER: 
-      Serial.println("Wakeup caused by ESP_SLEEP_WAKEUP_TIMER"); 
-      break;
-    case ESP_SLEEP_WAKEUP_TOUCHPAD: 
-      Serial.println("Wakeup caused by ESP_SLEEP_WAKEUP_TOUCHPAD"); 
-      break;
-    case ESP_SLEEP_WAKEUP_ULP: 
-      Serial.println("Wakeup caused by ESP_SLEEP_WAKEUP_ULP"); 
-      break;
-    default : Serial.println("Wakeup was not caused by deep sleep"); break;
-  }
-}
-
-// initialize the camera
-void initialize_camera(void){
-  // Initial camera configuration
-  camera_config_t config;
-  config.ledc_channel = LEDC_CHANNEL_0;
-  config.ledc_timer = LEDC_TIMER_0;
-  config.pin_d0 = Y2_GPIO_NUM;
-  config.pin_d1 = Y3_GPIO_NUM;
-  config.pin_d2 = Y4_GPIO_NUM;
-  config.pin_d3 = Y5_GPIO_NUM;
-  config.pin_d4 = Y6_GPIO_NUM;
-  config.pin_d5 = Y7_GPIO_NUM;
-  config.pin_d6 = Y8_GPIO_NUM;
-  config.pin_d7 = Y9_GPIO_NUM;
-  config.pin_xclk = XCLK_GPIO_NUM;
-  config.pin_pclk = PCLK_GPIO_NUM;
-  config.pin_vsync = VSYNC_GPIO_NUM;
-  config.pin_href = HREF_GPIO_NUM;
-  config.pin_sscb_sda = SIOD_GPIO_NUM;
-  config.pin_sscb_scl = SIOC_GPIO_NUM;
-  config.pin_pwdn = PWDN_GPIO_NUM;
-  config.pin_reset = RESET_GPIO_NUM;
-  config.xclk_freq_hz = 20000000;
-  config.pixel_format = PIXFORMAT_JPEG; // This is very important for saving the frame buffer as a JPeg
-
-  //init with high specs to pre-allocate larger buffers
-  if(psramFound()){
-    config.frame_size = FRAMESIZE_UXGA;
-    config.jpeg_quality = 10;
-    config.fb_count = 2;
-  } else {
-    config.frame_size = FRAMESIZE_SVGA;
-    config.jpeg_quality = 12;
-    config.fb_count = 1;
-  }
-
-  // camera init
-  esp_err_t err = esp_camera_init(&config);
-  if (err != ESP_OK) {
-    Serial.printf("Camera init failed with error 0x%x", err);
-    return;
-  }
-  Serial.println("Camera initialized!");  
-}
-
-void initialize_sd_card(void){
-  if(!SD_MMC.begin()){
-    Serial.println("Card Mount Failed");
-    return;
-  }
-  uint8_t cardType = SD_MMC.cardType();
-  if(cardType == CARD_NONE){
-    Serial.println("No SD_MMC card attached");
-    return;
-  }
-  Serial.println("SD Card Initialized");  
-}
-
-unsigned long calculateSleepTime(void){
-
-  unsigned long start_time ;
-  unsigned long current_time;  
-  long timeDiff, sleep_time ;
-  long incrementTime = 0;
-  char frequency;
-
-  frequency = preferences.getChar("frequency");
-  
-  switch(frequency){
-    case 'M': // minute
-      incrementTime = 60;
-      break;
-    case 'H': // hour
-      incrementTime = 60*60;
-      break;
-    case 'd': // day
-      incrementTime = 60*60*24;
-      break;
-    case 'w': // week
-      incrementTime = 60*60*24*7;
-      break;
-    case 'm': // month
-      incrementTime = 60*60*24*7*30;
-      break;
-    default:
-      Serial.printf("calcuateSleepOnBoot %c not recognized", frequency);  
-      break;
-  }
-
-  current_time = (unsigned long) time(NULL);
-  start_time = (unsigned long) preferences.getULong64("start_time",0) ;
-  timeDiff = start_time-current_time ;
-
-  if(timeDiff<0) {
-    sleep_time = incrementTime - (-timeDiff % incrementTime);
-  } else {
-    sleep_time = timeDiff ;
-  }
-  
-  return (unsigned long)sleep_time ;
-}
-
-void trail_camera(void){
-
-  unsigned long time_to_sleep ;
-  int i ;
-    
-  while (1) {
-    // initialize preferences
-    struct timeval tv_now ;
-    struct tm * timeinfo;
-    char filename [80];
-
-    time_to_sleep = calculateSleepTime();
-  
-    Serial.printf("sleep time: %lu\n", time_to_sleep);
-    esp_sleep_enable_timer_wakeup(time_to_sleep*S_TO_uS_FACTOR);
-    
-    // capture 5 photos
-    for (i=0;i<5;i++) {
-      if(SD_MMC.begin()){
-        uint8_t cardType = SD_MMC.cardType();
-        
-        if(cardType != CARD_NONE){
-          Serial.println("SD Card good to go");  
-          
-          gettimeofday(&tv_now, NULL);
-          timeinfo = localtime ((const time_t *)&tv_now);
-          //strftime(filename, 80, "/img_%Y%m%d_%H%M%S.jpg",timeinfo);
-          strftime(filename, 80, "/img_%d-%m-%Y_%H-%M-%S.jpg",timeinfo);//changed order of time in image address
-
-          // Call function to capture the image and save it as a file
-          if(save_camera_image(SD_MMC, filename) != ESP_OK ) {
-            Serial.printf("Captured %s failure\n", filename);
-            delay(1000); // wait for 1 second
-          } else{
-            Serial.printf("Captured %s success\n", filename);           
-          }
-        } else {
-          Serial.println("Card Mount Failed");       
-        }
-        // wait a second!
-        delay(1000);
-        SD_MMC.end();
-      } else {
-        Serial.println("No SD card");  
-      }
-    }
-    
-    Serial.println("ESP32 going to sleep for " + String(time_to_sleep) + " Seconds");
-    //Go to sleep now
-    preferences.end();
-    esp_deep_sleep_start();
-  }
-  
-}
-
-void update_image_settings(void) {
-
-  int res = 0;
-  int val ;
-
-  sensor_t * s = esp_camera_sensor_get();
-  //initial sensors are flipped vertically and colors are a bit saturated
-  if (s->id.PID == OV3660_PID) {
-    s->set_vflip(s, 1);//flip it back
-    s->set_brightness(s, 1);//up the blightness just a bit
-    s->set_saturation(s, -2);//lower the saturation
-  }
-  //drop down frame size for higher initial frame rate
-  s->set_framesize(s, FRAMESIZE_QVGA);
-
-#if defined(CAMERA_MODEL_M5STACK_WIDE)
-  s->set_vflip(s, 1);
-  s->set_hmirror(s, 1);
-#endif
-
-  if (preferences.isKey("framesize")) {
-    val = preferences.getUInt("framesize");
-    s->set_framesize(s, (framesize_t)val);
-    Serial.printf("framesize to %d\n",val);
-    
-  }
-  if(preferences.isKey("quality")) {
-    val = preferences.getUInt("quality");
-    res = s->set_quality(s, val);
-    Serial.printf("quality to %d\n",val);
-  }
-  
-  if(preferences.isKey("contrast")) {
-    val = preferences.getUInt("contrast");
-    res = s->set_contrast(s, val);
-    Serial.printf("contrast to %d\n",val);
-  }
-  if(preferences.isKey("brightness")) {
-    val = preferences.getUInt("brightness");
-    res = s->set_brightness(s, val);
-    Serial.printf("brightness to %d\n",val);
-  }
-  if(preferences.isKey("saturation")) {
-    val = preferences.getUInt("saturation");
-    res = s->set_saturation(s, val);
-    Serial.printf("saturation to %d\n",val);
-  }
-  if(preferences.isKey("gainceiling")) {
-    val = preferences.getUInt("gainceiling");
-    res = s->set_gainceiling(s, (gainceiling_t)val);
-    Serial.printf("gainceiling to %d\n",val);
-  }
-  if(preferences.isKey("colorbar")) {
-    val = preferences.getUInt("colorbar");
-    res = s->set_colorbar(s, val);
-     Serial.printf("colorbar to %d\n",val);
- }
-  if(preferences.isKey("awb")) {
-    val = preferences.getUInt("awb");
-    res = s->set_whitebal(s, val);
-  }
-  if(preferences.isKey("agc")) {
-    val = preferences.getUInt("agc");
-    res = s->set_gain_ctrl(s, val);
-    Serial.printf("agc to %d\n",val);
-  }
-  if(preferences.isKey("aec")) {
-    val = preferences.getUInt("aec");
-    res = s->set_exposure_ctrl(s, val);
-  }
-  if(preferences.isKey("hmirror")) {
-    val = preferences.getUInt("hmirror");
-    res = s->set_hmirror(s, val);
-  }
-  if(preferences.isKey("vflip")) {
-    val = preferences.getUInt("vflip");
-    res = s->set_vflip(s, val);
-  }
-  if(preferences.isKey("awb_gain")) {
-    val = preferences.getUInt("awb_gain");
-    res = s->set_awb_gain(s, val);
-  }
-  if(preferences.isKey("agc_gain")) {
-    val = preferences.getUInt("agc_gain");
-    res = s->set_agc_gain(s, val);
-  }
-  if(preferences.isKey("aec_value")) {
-    val = preferences.getUInt("aec_value");
-    res = s->set_aec_value(s, val);
-  }
-  if(preferences.isKey("aec2")) {
-    val = preferences.getUInt("aec2");
-    res = s->set_aec2(s, val);
-  }
-  if(preferences.isKey("dcw")) {
-    val = preferences.getUInt("dcw");
-    res = s->set_dcw(s, val);
-  }
-  if(preferences.isKey("bpc")) {
-    val = preferences.getUInt("bpc");
-    res = s->set_bpc(s, val);
-  }
-  if(preferences.isKey("wpc")) {
-    val = preferences.getUInt("wpc");
-    res = s->set_wpc(s, val);
-  }
-  if(preferences.isKey("raw_gma")) {
-    val = preferences.getUInt("raw_gma");
-    res = s->set_raw_gma(s, val);
-  }
-  if(preferences.isKey("lenc")) {
-    val = preferences.getUInt("lenc");
-    res = s->set_lenc(s, val);
-  }
-  if(preferences.isKey("special_effect")) {
-    val = preferences.getUInt("special_effect");
-    res = s->set_special_effect(s, val);
-  }
-  if(preferences.isKey("wb_mode")) {
-    val = preferences.getUInt("wb_mode");
-    res = s->set_wb_mode(s, val);
-  }
-  if(preferences.isKey("ae_level")) {
-    val = preferences.getUInt("ae_level");
-    res = s->set_ae_level(s, val);
-  }
-}
-
-void run_ap(void) {
-  WiFi.softAP(ssid, password);
-  IPAddress IP = WiFi.softAPIP();
-  Serial.print("AP IP address: ");
-  Serial.println(IP);
-
-  startCameraServer();
-
-  Serial.print("Camera Ready! Use 'http://");
-  Serial.print(WiFi.localIP());
-  Serial.println("' to connect");  
-}
-
-void set_time_from_rtc(void){
-  DateTime now;
-  struct tm tm;
-
-  Wire.begin(I2C_SDA, I2C_SCL);
-  rtc.begin();
-  now = rtc.now();
-  
-  tm.tm_year = now.year() - 1900;
-  tm.tm_mon = now.month(); 
-  tm.tm_mday = now.day();
-  tm.tm_hour = now.hour();
-  tm.tm_min = now.minute(); 
-  tm.tm_sec = now.second();
-  time_t t = mktime(&tm);
-
-  Serial.printf("Setting time from RTC: %s\n", asctime(&tm));
-
-  struct timeval tv_now = { .tv_sec = t };
-
-  settimeofday(&tv_now, NULL);
-}
-
-void setup() {
-  camera_config_t config;
-  unsigned long t ;
-  int buttonState ;
-  int state = TRAILCAMERA_MODE ;
-  esp_sleep_wakeup_cause_t wakeup_reason;
-  
-  Serial.begin(115200);
-  Serial.setDebugOutput(true);
-  Serial.println();
-
-  preferences.begin("my−app", false);
-
-  /* TODO - fix power supply 
-   * STF - disable brown out detection 
-   */
-  WRITE_PERI_REG(RTC_CNTL_BROWN_OUT_REG, 0);
-
-  set_time_from_rtc();
-  /*
-   * Check whether the wakeup was not from the deep sleep timer. If not then check if user 
-   * is reconfiguring the sytem by pushing the config button
-   */
-  wakeup_reason = esp_sleep_get_wakeup_cause();
-  print_wakeup_reason(wakeup_reason);
-  
-  if(wakeup_reason != ESP_SLEEP_WAKEUP_TIMER) {
-    Serial.println("Enabling user to switch to AP by pushing the config button");
-    pinMode(BUTTON, INPUT_PULLUP);
-    t = millis() ;
-    while (1) {
-      buttonState = digitalRead(BUTTON);
-      if (((millis()-t) / 1000) > TIME_TO_WAIT) {
-        state = TRAILCAMERA_MODE ;
-        Serial.println("timeout - trailcamera mode");
-        break ;
-      }
-      if (buttonState == 0) {
-        state = AP_MODE ;
-        Serial.println("run AP");
-        break ;
-      }
-    }
-    delay(2000); // avoid crash to allow button to be released
-  } else {
-    Serial.println("run Trailcamera");
-    state = TRAILCAMERA_MODE;
-  }
-
-  switch(state){
-    case TRAILCAMERA_MODE:
-      initialize_camera();
-      update_image_settings();     
-      trail_camera();
-      break;
-    case AP_MODE:
-      run_ap();
-      break;
-    default:
-      Serial.println("Error in device state");
-      break;        
-  }
-}
-
-void loop() {
-  // put your main code here, to run repeatedly:
-  delay(10000);
-}
+#include <WiFi.h>
+#include "FS.h"
+#include "SD_MMC.h"
+#include "esp_camera.h"
+#include "esp_sleep.h"
+#include <EEPROM.h>            // read and write from flash memory
+#include <Preferences.h>
+#include "RTClib.h"
+#include <Wire.h>
+#include "soc/soc.h"
+#include "soc/rtc_cntl_reg.h"
+#include "exif.h"
+#include "jpeg_dc.h"
+#include "phash.h"
+#include "schedule.h"
+#include "rtc_wake.h"
+#include "capture_timing.h"
+#include "camera_settings.h"
+#include "boot_cache.h"
+#include "energy.h"
+#include "sd_writer.h"
+#include "catalog.h"
+#include "retention.h"
+#include "uplink.h"
+#include "size_control.h"
+#include "metrics.h"
+
+#define CAMERA_MODEL_AI_THINKER
+#include "camera_pins.h"
+
+#define S_TO_uS_FACTOR 1000000  //Conversion factor for micro seconds to seconds
+#define TIME_TO_SLEEP  10 // set time for sleep and wakeup
+#define TIME_TO_WAIT 4 // set time to wait for button press
+
+// define number of bytes to set aside in persistant memory
+#define EEPROM_SIZE 4
+#define BUTTON 0
+#define LED 4
+
+#define AP_MODE 1
+#define TRAILCAMERA_MODE 2
+
+#define SECONDS_PER_WEEK (60*60*24*7)
+#define DEFAULT_FRAMESIZE FRAMESIZE_QVGA // when none is stored
+
+int pictureNumber = 0;
+int sleep_time = TIME_TO_SLEEP  ;
+
+const char* ssid = "Frontier TrailCam Access Point";
+const char* password = "123456789"; //<--Placeholder password, change to whatever you desire :)
+RTC_DS3231 rtc;
+Preferences preferences ;
+
+// hashes of the last few stored captures, survives deep sleep
+RTC_DATA_ATTR phash_history_t phash_history;
+// settings the sensor was last set up with, recorded in the catalog
+static uint32_t settings_hash;
+
+void startCameraServer();
+void update_image_settings(void);
+
+// the 1/8 scale luma plane of the last frame looked at, shared by everything that wants one
+static uint8_t * scene_plane;
+static jpeg_dc_t scene;
+
+/*
+ * The luma plane of a JPEG frame, from its DC coefficients alone. The
+ * plane is allocated once for the largest frame and overwritten by the
+ * next call. NULL when the frame could not be parsed.
+ */
+static const uint8_t * scene_luma(camera_fb_t * fb) {
+  if (!scene_plane) {
+    scene_plane = (uint8_t *)(psramFound() ? ps_malloc(JPEG_DC_PLANE_MAX) : malloc(JPEG_DC_PLANE_MAX));
+    if (!scene_plane) {
+      return NULL;
+    }
+  }
+  int err = jpeg_dc_luma(fb->buf, fb->len, scene_plane, JPEG_DC_PLANE_MAX, &scene);
+  if (err != JPEG_DC_OK) {
+    Serial.printf("scene: %s JPEG\n", jpeg_dc_error(err));
+    return NULL;
+  }
+  return scene_plane;
+}
+
+static bool luma_hash(camera_fb_t * fb, uint64_t * hash) {
+  const uint8_t * luma = scene_luma(fb);
+
+  if (!luma) {
+    return false;
+  }
+  *hash = phash_compute(luma, scene.width, scene.height, scene.width);
+  return true;
+}
+
+/*
+ * After a cold boot the RTC history is empty, so seed it from the
+ * tail of the on-card index.
+ */
+static void dedup_seed_history(fs::FS &fs) {
+  phash_entry_t entry;
+
+  if (phash_history_valid(&phash_history)) {
+    return;
+  }
+  phash_history_reset(&phash_history);
+
+  File file = fs.open(PHASH_INDEX_FILE, FILE_READ);
+  if (!file) {
+    return;
+  }
+  size_t records = file.size() / sizeof(phash_entry_t);
+  size_t first = records > PHASH_HISTORY ? records - PHASH_HISTORY : 0;
+  file.seek(first * sizeof(phash_entry_t));
+  while (file.read((uint8_t *)&entry, sizeof(entry)) == sizeof(entry)) {
+    if (entry.flags == PHASH_STORED) {
+      phash_history_push(&phash_history, &entry);
+    }
+  }
+  file.close();
+  Serial.printf("dedup history seeded with %d hashes\n", phash_history.count);
+}
+
+/*
+ * Keep a running count of bytes not written because of duplicates,
+ * bucketed by week so it can be reported in /status.
+ */
+static void dedup_account(uint32_t now, uint32_t saved) {
+  uint32_t week = now / SECONDS_PER_WEEK;
+  uint32_t stored_week = preferences.getULong("dd_week", 0);
+  uint64_t week_saved = preferences.getULong64("dd_saved", 0);
+
+  if (stored_week != week) {
+    preferences.putULong64("dd_last", (stored_week + 1 == week) ? week_saved : 0);
+    preferences.putULong("dd_week", week);
+    week_saved = 0;
+  }
+  preferences.putULong64("dd_saved", week_saved + saved);
+}
+
+// the "station" preference, or one made from the MAC address
+void station_id(char * out, size_t size) {
+  if (boot_cache_valid()) {
+    strlcpy(out, boot_cache.station, size);
+    return;
+  }
+  if (!preferences.getString("station", out, size) || !out[0]) {
+    uint64_t mac = ESP.getEfuseMac();
+    snprintf(out, size, "TrailCam-%02X%02X%02X", (uint8_t)(mac >> 24), (uint8_t)(mac >> 32), (uint8_t)(mac >> 40));
+  }
+}
+
+/*
+ * The EXIF segment of a capture taken at time_us: time, station, battery
+ * and every sensor setting as it was. Returns its length, 0 when the
+ * frame is not a JPEG that can take one.
+ */
+static size_t capture_exif(camera_fb_t * fb, int64_t time_us, uint8_t * out, size_t size) {
+  char station[EXIF_STATION_MAX];
+  char comment[EXIF_COMMENT_MAX];
+  energy_report_t energy;
+  sensor_t * s = esp_camera_sensor_get();
+  exif_info_t info;
+
+  if (fb->len < 4 || fb->buf[0] != 0xff || fb->buf[1] != 0xd8 || !s) {
+    return 0;
+  }
+  station_id(station, sizeof(station));
+  energy_get_report(&energy);
+  int n = snprintf(comment, sizeof(comment), "battery_v=%.2f settings=%08lx",
+                   energy.battery_v, (unsigned long)settings_hash);
+  for (int i = 0; i < CAM_SETTING_COUNT && n < (int)sizeof(comment); i++) {
+    n += snprintf(comment + n, sizeof(comment) - n, " %s=%d", camera_setting_keys[i], camera_setting_current(s, i));
+  }
+
+  info.time = (time_t)(time_us / 1000000);
+  info.millis = (time_us / 1000) % 1000;
+  info.utc_offset_min = exif_utc_offset(info.time);
+  info.width = fb->width;
+  info.height = fb->height;
+  info.model = s->id.PID == OV3660_PID ? "OV3660" : s->id.PID == OV2640_PID ? "OV2640" :
+               s->id.PID == OV5640_PID ? "OV5640" : "unknown";
+  info.station = station;
+  info.comment = comment;
+  return exif_build(out, size, &info);
+}
+
+/*
+ * This function takes a picture and stores in a file. When shutter_us is
+ * given it receives the epoch time in microseconds the frame was returned.
+ */
+static esp_err_t save_camera_image(fs::FS &fs, const char * path, int64_t * shutter_us) {
+    // Variable definitions for camera frame buffer
+    camera_fb_t * fb = NULL;
+    int64_t fr_start = esp_timer_get_time();
+
+    // Get the contents of the camera frame buffer
+    fb = esp_camera_fb_get();
+    metrics_observe_us(MET_CAPTURE_LATENCY, esp_timer_get_time() - fr_start);
+    if (!fb) {
+      metrics_inc(MET_CAPTURE_FAILURES);
+      Serial.println("Camera capture failed");
+      return ESP_FAIL;
+    }
+    metrics_inc(MET_CAPTURES);
+    int64_t taken_us = epoch_us();
+    if (shutter_us) {
+      *shutter_us = taken_us;
+    }
+
+    // set the next photo's quality now, it takes a frame or two to apply
+    sensor_t * s = esp_camera_sensor_get();
+    int next_quality = size_control_record(s->status.framesize, fb->len);
+    if (next_quality > 0 && next_quality != s->status.quality) {
+      s->set_quality(s, next_quality);
+    }
+
+    // Check the capture against the most recent stored ones
+    size_t fb_len = 0;
+    fb_len = fb->len;
+    uint8_t dedup = boot_cache_valid() ? boot_cache.dedup : preferences.getUChar("dedup", DEDUP_OFF);
+    int distance = 0;
+    bool hashed = false;
+    phash_entry_t entry = {0};
+    const phash_entry_t * match = NULL;
+
+    entry.time = (uint32_t)time(NULL);
+    entry.size = fb_len;
+    entry.flags = PHASH_STORED;
+    strlcpy(entry.name, path, sizeof(entry.name));
+    if (dedup != DEDUP_OFF) {
+      dedup_seed_history(fs);
+      hashed = luma_hash(fb, &entry.hash);
+      if (hashed) {
+        int max_distance = boot_cache_valid() ? boot_cache.dedup_dist :
+                           preferences.getUChar("dedup_dist", DEDUP_DEFAULT_DISTANCE);
+        match = phash_history_match(&phash_history, entry.hash, max_distance, &distance);
+      }
+      if (match) {
+        Serial.printf("%s duplicates %s (distance %d)\n", path, match->name, distance);
+        entry.flags = (dedup == DEDUP_DROP) ? PHASH_DROPPED : PHASH_REFERENCE;
+        strlcpy(entry.name, match->name, sizeof(entry.name));
+      }
+    }
+
+    catalog_record_t record = {0};
+    strlcpy(record.name, path, sizeof(record.name));
+    bool referenced = false;
+
+    // Save image to file, or a reference to the image it duplicates
+    size_t exif_len = 0;
+    if (entry.flags == PHASH_STORED) {
+      // the EXIF segment goes in after the SOI marker, the frame is written from where it is
+      static uint8_t exif[EXIF_MAX];
+      exif_len = capture_exif(fb, taken_us, exif, sizeof(exif));
+      sd_chunk_t chunks[3] = { { fb->buf, 2 }, { exif, exif_len }, { fb->buf + 2, fb->len - 2 } };
+      if (!exif_len) {
+        chunks[0].len = fb->len;
+      }
+
+      // preallocated to the file size, written in cluster aligned blocks
+      sd_writer_t writer;
+      esp_err_t err = sd_writer_open(&writer, path, fb->len + exif_len);
+      if (err == ESP_OK) {
+        err = sd_writer_writev(&writer, chunks, exif_len ? 3 : 1);
+        if (sd_writer_close(&writer) != ESP_OK) {
+          err = ESP_FAIL;
+        }
+      }
+      if (err != ESP_OK) {
+        Serial.println("File save failed");
+        esp_camera_fb_return(fb);
+        return ESP_FAIL;      
+      }
+    } else if (entry.flags == PHASH_REFERENCE) {
+      char ref_path[40];
+      strlcpy(ref_path, path, sizeof(ref_path));
+      char * ext = strrchr(ref_path, '.');
+      if (ext) {
+        strcpy(ext, ".ref");
+      }
+      strlcpy(record.name, ref_path, sizeof(record.name));
+      File file = fs.open(ref_path, FILE_WRITE);
+      if(file){
+        file.println(entry.name);
+        file.close();
+        referenced = true;
+        dedup_account(entry.time, fb_len - (strlen(entry.name) + 2));
+      }
+    } else {
+      dedup_account(entry.time, fb_len);
+    }
+
+    record.time = entry.time;
+    record.size = entry.flags == PHASH_STORED ? fb_len + exif_len :
+                  entry.flags == PHASH_REFERENCE ? strlen(entry.name) + 2 : 0;
+    record.settings = settings_hash;
+    uint32_t score = (uint64_t)fb_len * 800 / (fb->width * fb->height); // bits per 100 pixels
+    record.score = min(score, (uint32_t)UINT16_MAX);
+    record.flags = entry.flags;
+    if (!catalog_append(&record)) {
+      Serial.println("Catalog append failed");
+    } else if (referenced) {
+      // retention keeps the original while references name it
+      catalog_add_ref(catalog_find_name(entry.name), 1);
+    }
+
+    if (hashed) {
+      if (entry.flags == PHASH_STORED) {
+        phash_history_push(&phash_history, &entry);
+      }
+      File index = fs.open(PHASH_INDEX_FILE, FILE_APPEND);
+      if (index) {
+        index.write((const uint8_t *)&entry, sizeof(entry));
+        index.close();
+      }
+    }
+
+    // Release the camera frame buffer
+    esp_camera_fb_return(fb);
+    int64_t fr_end = esp_timer_get_time();
+    Serial.printf("JPG: %uB %ums\n", (uint32_t)(fb_len), (uint32_t)((fr_end - fr_start)/1000));
+
+    pinMode(LED, OUTPUT);
+    digitalWrite(LED,0);
+
+    return ESP_OK;
+}
+
+//Function that prints the reason by which ESP32 has been awaken from sleep
+void print_wakeup_reason(esp_sleep_wakeup_cause_t wakeup_reason){
+
+  switch(wakeup_reason)
+  {
+    case ESP_SLEEP_WAKEUP_EXT0: 
+      Serial.println("Wakeup caused by external signal using RTC_IO"); 
+      break;
+    case ESP_SLEEP_WAKEUP_EXT1: 
+      Serial.println("Wakeup caused by external signal using RTC_CNTL"); 
+      break;
+    case ESP_SLEEP_WAKEUP_TIMER: 
+      Serial.println("Wakeup caused by ESP_SLEEP_WAKEUP_TIMER"); 
+      break;
+    case ESP_SLEEP_WAKEUP_TOUCHPAD: 
+      Serial.println("Wakeup caused by ESP_SLEEP_WAKEUP_TOUCHPAD"); 
+      break;
+    case ESP_SLEEP_WAKEUP_ULP: 
+      Serial.println("Wakeup caused by ESP_SLEEP_WAKEUP_ULP"); 
+      break;
+    default : Serial.println("Wakeup was not caused by deep sleep"); break;
+  }
+}
+
+/*
+ * Stored sensor settings, from the warm boot cache when it is valid and
+ * otherwise decoded from NVS into scratch.
+ */
+static const camera_settings_t * stored_camera_settings(camera_settings_t * scratch){
+  if (boot_cache_valid()) {
+    return &boot_cache.camera;
+  }
+  camera_settings_load(scratch);
+  return scratch;
+}
+
+/*
+ * Start the camera at the given framesize, quality and number of frame
+ * buffers. The buffers are sized for the framesize, it cannot grow later.
+ */
+esp_err_t start_camera(framesize_t frame_size, int quality, int fb_count){
+  // Initial camera configuration
+  camera_config_t config;
+  config.ledc_channel = LEDC_CHANNEL_0;
+  config.ledc_timer = LEDC_TIMER_0;
+  config.pin_d0 = Y2_GPIO_NUM;
+  config.pin_d1 = Y3_GPIO_NUM;
+  config.pin_d2 = Y4_GPIO_NUM;
+  config.pin_d3 = Y5_GPIO_NUM;
+  config.pin_d4 = Y6_GPIO_NUM;
+  config.pin_d5 = Y7_GPIO_NUM;
+  config.pin_d6 = Y8_GPIO_NUM;
+  config.pin_d7 = Y9_GPIO_NUM;
+  config.pin_xclk = XCLK_GPIO_NUM;
+  config.pin_pclk = PCLK_GPIO_NUM;
+  config.pin_vsync = VSYNC_GPIO_NUM;
+  config.pin_href = HREF_GPIO_NUM;
+  config.pin_sscb_sda = SIOD_GPIO_NUM;
+  config.pin_sscb_scl = SIOC_GPIO_NUM;
+  config.pin_pwdn = PWDN_GPIO_NUM;
+  config.pin_reset = RESET_GPIO_NUM;
+  config.xclk_freq_hz = 20000000;
+  config.pixel_format = PIXFORMAT_JPEG; // This is very important for saving the frame buffer as a JPeg
+  config.frame_size = frame_size;
+  config.jpeg_quality = quality;
+  config.fb_count = fb_count;
+  config.fb_location = psramFound() ? CAMERA_FB_IN_PSRAM : CAMERA_FB_IN_DRAM;
+  // with several buffers hand out the newest frame, not one queued before it was asked for
+  config.grab_mode = fb_count > 1 ? CAMERA_GRAB_LATEST : CAMERA_GRAB_WHEN_EMPTY;
+
+  // camera init
+  esp_err_t err = esp_camera_init(&config);
+  if (err != ESP_OK) {
+    Serial.printf("Camera init failed with error 0x%x", err);
+    return err;
+  }
+  Serial.println("Camera initialized!");  
+  return ESP_OK;
+}
+
+// initialize the camera, returns the number of frame buffers or 0 when it failed
+int initialize_camera(void){
+  //init with high specs to pre-allocate larger buffers, the stream page can change the framesize
+  if(psramFound()){
+    return start_camera(FRAMESIZE_UXGA, 10, 2) == ESP_OK ? 2 : 0;
+  }
+  return start_camera(FRAMESIZE_SVGA, 12, 1) == ESP_OK ? 1 : 0;
+}
+
+/*
+ * Trail camera wakes never change the framesize, so start the sensor at the
+ * stored framesize and quality with the stored number of buffers, instead of
+ * at UXGA and switching down. update_image_settings() then only writes what
+ * still differs.
+ */
+void initialize_camera_direct(void){
+  camera_settings_t scratch;
+  const camera_settings_t * stored = stored_camera_settings(&scratch);
+  framesize_t frame_size = DEFAULT_FRAMESIZE;
+  int quality = psramFound() ? 10 : 12;
+  int fb_count = psramFound() ? 2 : 1;
+
+  if (stored->present & (1UL << CAM_FRAMESIZE)) {
+    frame_size = (framesize_t)stored->value[CAM_FRAMESIZE];
+  }
+  if (stored->present & (1UL << CAM_QUALITY)) {
+    quality = stored->value[CAM_QUALITY];
+  }
+  if (stored->fb_count) {
+    fb_count = stored->fb_count;
+  }
+  quality = size_control_quality(quality);
+  if (!psramFound()) {
+    // DRAM only holds one SVGA frame
+    if (frame_size > FRAMESIZE_SVGA) {
+      frame_size = FRAMESIZE_SVGA;
+    }
+    fb_count = 1;
+  }
+  start_camera(frame_size, quality, fb_count);
+}
+
+void initialize_sd_card(void){
+  if(!SD_MMC.begin()){
+    Serial.println("Card Mount Failed");
+    return;
+  }
+  uint8_t cardType = SD_MMC.cardType();
+  if(cardType == CARD_NONE){
+    Serial.println("No SD_MMC card attached");
+    return;
+  }
+  Serial.println("SD Card Initialized");  
+}
+
+/*
+ * Local time rules follow the "tz" preference. The DS3231 always holds UTC,
+ * which with the default zone is the same as the local time it used to hold.
+ */
+void apply_timezone(void){
+  if (boot_cache_valid()) {
+    setenv("TZ", boot_cache.tz, 1);
+  } else {
+    setenv("TZ", preferences.getString("tz", SCHED_DEFAULT_TZ).c_str(), 1);
+  }
+  tzset();
+}
+
+/*
+ * The schedule rules, or the single rule equivalent to the older
+ * start_time and frequency settings when no rules have been saved.
+ */
+void load_schedule(schedule_t * schedule){
+  char text[SCHED_TEXT_MAX];
+
+  if (boot_cache_valid()) {
+    *schedule = boot_cache.schedule;
+    return;
+  }
+  if (preferences.isKey("schedule") &&
+      preferences.getString("schedule", text, sizeof(text)) > 0 &&
+      schedule_parse(schedule, text) == 0) {
+    return;
+  }
+  schedule_from_legacy(schedule, preferences.getChar("frequency"), preferences.getULong64("start_time", 0));
+}
+
+int64_t next_capture_time(int64_t now){
+  schedule_t schedule;
+
+  load_schedule(&schedule);
+  return schedule_next(&schedule, now);
+}
+
+void trail_camera(void){
+
+  int64_t next ;
+  int64_t shutter_us = 0 ;
+  bool captured ;
+  int i ;
+    
+  while (1) {
+    // initialize preferences
+    struct timeval tv_now ;
+    struct tm * timeinfo;
+    char filename [80];
+
+    // wakes ahead of a capture, and idle wakes with nothing scheduled, only go back to sleep
+    captured = timing_capture_due();
+    if (captured) {
+      energy_phase(PHASE_CAMERA);
+      initialize_camera_direct();
+      update_image_settings();
+
+      // capture WAKE_PHOTOS photos
+      for (i=0;i<WAKE_PHOTOS;i++) {
+        energy_phase(PHASE_SD);
+        if(sd_mount()){ // stored bus width and clock, 1-bit in alarm mode
+          uint8_t cardType = SD_MMC.cardType();
+          
+          if(cardType != CARD_NONE){
+            Serial.println("SD Card good to go");  
+            if (i == 0) {
+              timing_wait_for_target(); // the first photo is the scheduled one
+            }
+            
+            gettimeofday(&tv_now, NULL);
+            timeinfo = localtime ((const time_t *)&tv_now);
+            //strftime(filename, 80, "/img_%Y%m%d_%H%M%S.jpg",timeinfo);
+            strftime(filename, 80, "/img_%d-%m-%Y_%H-%M-%S.jpg",timeinfo);//changed order of time in image address
+
+            // Call function to capture the image and save it as a file
+            if(save_camera_image(SD_MMC, filename, i == 0 ? &shutter_us : NULL) != ESP_OK ) {
+              Serial.printf("Captured %s failure\n", filename);
+              delay(1000); // wait for 1 second
+            } else{
+              Serial.printf("Captured %s success\n", filename);           
+            }
+            if (i == 0 && shutter_us) {
+              timing_record_shutter(shutter_us);
+            }
+          } else {
+            Serial.println("Card Mount Failed");       
+          }
+          // wait a second! retention works on the card during the first wait
+          unsigned long wait_start = millis();
+          if (i == 0) {
+            retention_run(RETENTION_BUDGET_MS);
+          }
+          long wait_left = WAKE_PHOTO_SPACING_MS - (long)(millis() - wait_start);
+          if (wait_left > 0) {
+            delay(wait_left);
+          }
+          catalog_end();
+          SD_MMC.end();
+        } else {
+          Serial.println("No SD card");  
+        }
+        energy_phase(PHASE_CAMERA);
+      }
+    }
+
+    // the next capture is worked out last, so time spent awake does not push it back
+    next = next_capture_time(time(NULL));
+    if (next == SCHED_NONE) {
+      Serial.println("no capture scheduled");
+    }
+    // an upload session stops a minute before that capture
+    if (uplink_due()) {
+      uplink_run(next == SCHED_NONE ? SCHED_NONE : next - 60);
+    }
+    int64_t wake_us = timing_arm_next(next, uplink_next(time(NULL)));
+    Serial.printf("ESP32 going to sleep for %lld ms\n", (long long)((wake_us - epoch_us()) / 1000));
+    energy_end_wake(captured);
+    boot_cache_save();
+    //Go to sleep now
+    preferences.end();
+    esp_deep_sleep_start();
+  }
+  
+}
+
+void update_image_settings(void) {
+
+  camera_settings_t scratch;
+  camera_settings_t settings = {0};
+  const camera_settings_t * stored = stored_camera_settings(&scratch);
+
+  sensor_t * s = esp_camera_sensor_get();
+  if (!s) {
+    return;
+  }
+  //drop down frame size for higher initial frame rate
+  camera_settings_set(&settings, CAM_FRAMESIZE, DEFAULT_FRAMESIZE);
+  //initial sensors are flipped vertically and colors are a bit saturated
+  if (s->id.PID == OV3660_PID) {
+    camera_settings_set(&settings, CAM_VFLIP, 1);//flip it back
+    camera_settings_set(&settings, CAM_BRIGHTNESS, 1);//up the blightness just a bit
+    camera_settings_set(&settings, CAM_SATURATION, -2);//lower the saturation
+  }
+
+#if defined(CAMERA_MODEL_M5STACK_WIDE)
+  camera_settings_set(&settings, CAM_VFLIP, 1);
+  camera_settings_set(&settings, CAM_HMIRROR, 1);
+#endif
+
+  // stored settings override the defaults, then everything is written in one pass
+  for (int i = 0; i < CAM_SETTING_COUNT; i++) {
+    if (stored->present & (1UL << i)) {
+      camera_settings_set(&settings, i, stored->value[i]);
+    }
+  }
+  // with a size target the quality is size control's
+  if (size_control_target()) {
+    int quality = (settings.present & (1UL << CAM_QUALITY)) ? settings.value[CAM_QUALITY] : (psramFound() ? 10 : 12);
+    camera_settings_set(&settings, CAM_QUALITY, size_control_quality(quality));
+  }
+  camera_settings_apply(s, &settings);
+  settings_hash = camera_settings_hash(&settings);
+}
+
+void run_ap(void) {
+  energy_phase(PHASE_WIFI);
+  WiFi.softAP(ssid, password);
+  IPAddress IP = WiFi.softAPIP();
+  Serial.print("AP IP address: ");
+  Serial.println(IP);
+
+  startCameraServer();
+
+  Serial.print("Camera Ready! Use 'http://");
+  Serial.print(WiFi.localIP());
+  Serial.println("' to connect");  
+}
+
+void set_time_from_rtc(void){
+  DateTime now;
+
+  Wire.begin(I2C_SDA, I2C_SCL);
+  rtc.begin();
+  now = rtc.now();
+
+  /*
+   * Older firmware wrote months to the DS3231 as 0-11, it counts 1-12.
+   * The first boot without "rtc_month" moves such a clock on a month, on
+   * a station older firmware has set up; a new one was never written that
+   * way. The DS3231 rolls such a December over to month 12, which was the
+   * next January, and takes the month length from the wrong month, so the
+   * date goes through the epoch to come out valid.
+   */
+  if (!preferences.getUChar("rtc_month", 0)) {
+    if (preferences.isKey("frequency") || preferences.isKey("framesize")) {
+      int year = now.year() + (now.month() == 12);
+      int month = now.month() % 12 + 1;
+      now = epoch_to_rtc(rtc_to_epoch(DateTime(year, month, now.day(), now.hour(), now.minute(), now.second())));
+      rtc.adjust(now);
+      Serial.printf("RTC month moved on to %d\n", now.month());
+    }
+    preferences.putUChar("rtc_month", 1);
+  }
+  time_t t = rtc_to_epoch(now);
+  struct tm tm;
+  gmtime_r(&t, &tm);
+
+  Serial.printf("Setting time from RTC: %s\n", asctime(&tm));
+
+  /*
+   * The clock keeps running through deep sleep with microsecond resolution.
+   * Keep it when it agrees with the DS3231 second, the sub-second part
+   * is what the capture timing works with.
+   */
+  struct timeval tv_now;
+
+  gettimeofday(&tv_now, NULL);
+  if (tv_now.tv_sec == t) {
+    return;
+  }
+  tv_now.tv_sec = t;
+  tv_now.tv_usec = 0;
+  settimeofday(&tv_now, NULL);
+}
+
+void setup() {
+  camera_config_t config;
+  unsigned long t ;
+  int buttonState ;
+  int state = TRAILCAMERA_MODE ;
+  esp_sleep_wakeup_cause_t wakeup_reason;
+  
+  Serial.begin(115200);
+  Serial.setDebugOutput(true);
+  Serial.println();
+
+  preferences.begin("my−app", false);
+
+  /* TODO - fix power supply 
+   * STF - disable brown out detection 
+   */
+  WRITE_PERI_REG(RTC_CNTL_BROWN_OUT_REG, 0);
+
+  /*
+   * On timer wakes the warm boot cache carries the clock over the sleep, the
+   * DS3231 is only read every so often and at the end of calibration sleeps
+   */
+  wakeup_reason = esp_sleep_get_wakeup_cause();
+  if (wakeup_reason != ESP_SLEEP_WAKEUP_TIMER || rtc_drift_pending() || !boot_cache_restore_clock()) {
+    set_time_from_rtc(); // before apply_timezone(), the RTC fields are read as UTC
+  }
+  apply_timezone();
+  energy_begin_wake(); // the battery is sampled before the SD card or Wi-Fi take over
+  /*
+   * Check whether the wakeup was not from the deep sleep timer or the DS3231 alarm. If not then check if user 
+   * is reconfiguring the sytem by pushing the config button
+   */
+  print_wakeup_reason(wakeup_reason);
+  if (wakeup_reason == ESP_SLEEP_WAKEUP_TIMER) {
+    rtc_drift_measure();
+  }
+  
+  if(wakeup_reason != ESP_SLEEP_WAKEUP_TIMER &&
+     !(wakeup_reason == ESP_SLEEP_WAKEUP_EXT0 && rtc_alarm_fired())) {
+    Serial.println("Enabling user to switch to AP by pushing the config button");
+    pinMode(BUTTON, INPUT_PULLUP);
+    t = millis() ;
+    while (1) {
+      buttonState = digitalRead(BUTTON);
+      if (((millis()-t) / 1000) > TIME_TO_WAIT) {
+        state = TRAILCAMERA_MODE ;
+        Serial.println("timeout - trailcamera mode");
+        break ;
+      }
+      if (buttonState == 0) {
+        state = AP_MODE ;
+        Serial.println("run AP");
+        break ;
+      }
+    }
+    delay(2000); // avoid crash to allow button to be released
+  } else {
+    Serial.println("run Trailcamera");
+    state = TRAILCAMERA_MODE;
+  }
+
+  switch(state){
+    case TRAILCAMERA_MODE:
+      timing_begin_wake(boot_cache_valid());
+      trail_camera();
+      break;
+    case AP_MODE:
+      run_ap();
+      break;
+    default:
+      Serial.println("Error in device state");
+      break;        
+  }
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+  energy_tick();
+  delay(10000);
+}
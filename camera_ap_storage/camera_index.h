@@ -1,779 +1,981 @@
-//Note: More modern camera SOC assemblies may use the OV5640 sensor instead of OV2640. You may need to change this file accordingly.
-//File: index_ov2640.html.gz, Size: 4316
-#define index_ov2640_html_gz_len 18847//4316
-const uint8_t index_ov2640_html_gz[] = {
-0x1f,0x8b,0x08,0x08,0x50,0x49,0x26,0x63,0x00,0xff,0x69,0x6e,0x64,0x65,0x78,0x2e,0x68,0x74,0x6d,0x6c
-,0x2e,0x67,0x7a,0x00,0xdd,0x5c,0x7b,0x73,0xda,0x4a,0xb2,0xff,0x3f,0x9f,0x62,0xac,0x9c,0x0d,0xd2,0xae
-,0xc0,0x80,0x1d,0xdb,0x11,0x06,0x5f,0x1b,0x3b,0x39,0x5b,0x95,0xe4,0x9c,0x3d,0xce,0xbd,0xbb,0x55,0x5b
-,0x5b,0x89,0x90,0x46,0xa0,0x58,0x48,0x1c,0x3d,0x78,0x84,0xe5,0x73,0xde,0xaf,0xb3,0xbf,0x79,0x48,0x48
-,0x3c,0x6c,0x03,0x09,0x6c,0x1d,0xa8,0x02,0x69,0xd4,0xd3,0xd3,0xdd,0xbf,0xee,0x9e,0x87,0x34,0xba,0x3c
-,0xb2,0x03,0x2b,0x9e,0x0c,0x28,0xe9,0xc5,0x7d,0xaf,0xf5,0xe2,0x52,0xfc,0x11,0x7c,0x2e,0x7b,0xd4,0xb4
-,0xc5,0x21,0x3f,0xed,0xd3,0xd8,0x24,0x56,0xcf,0x0c,0x23,0x1a,0x37,0x95,0x24,0x76,0xca,0x17,0xca,0xe2
-,0x65,0xdf,0xec,0xd3,0xa6,0x32,0x74,0xe9,0x68,0x10,0x84,0xb1,0x42,0xac,0xc0,0x8f,0xa9,0x0f,0xf2,0x91
-,0x6b,0xc7,0xbd,0xa6,0x4d,0x87,0xae,0x45,0xcb,0xfc,0x44,0x77,0x7d,0x37,0x76,0x4d,0xaf,0x1c,0x59,0xa6
-,0x47,0x9b,0x35,0x9d,0x24,0x11,0x0d,0xf9,0x99,0xd9,0x41,0xc1,0x84,0x46,0x79,0xf6,0xb1,0x1b,0x7b,0xb4
-,0x75,0x1f,0x87,0xd4,0xec,0x97,0xdb,0x68,0x26,0x34,0xc9,0x7d,0x6c,0xc6,0x6e,0xe0,0x5f,0x1e,0x8b,0x8b
-,0x73,0xe2,0x28,0x9e,0xb0,0xf3,0x4e,0x60,0x4f,0xa6,0x0e,0x44,0x28,0x3b,0x66,0xdf,0xf5,0x26,0xc6,0x75
-,0x88,0x06,0xf5,0x9f,0xa9,0x37,0xa4,0xb1,0x6b,0x99,0x7a,0x64,0xfa,0x51,0x19,0xad,0xba,0x4e,0xa3,0x63
-,0x5a,0x0f,0xdd,0x30,0x48,0x7c,0xdb,0x78,0xe9,0x98,0xce,0xb9,0x73,0xde,0xb0,0x02,0x2f,0x08,0x8d,0x97
-,0x27,0xf4,0x82,0x9e,0xd6,0x1a,0x9c,0x4f,0xe4,0x7e,0xa3,0x46,0xed,0x6c,0x30,0x9e,0xf5,0xea,0x82,0xb3
-,0x28,0xb9,0x40,0x49,0x44,0x2d,0x26,0x4d,0xa5,0x6f,0xba,0xfe,0xd4,0x76,0xa3,0x81,0x67,0x4e,0x0c,0xc7
-,0xa3,0xe3,0xd9,0xcb,0x3e,0xf5,0x13,0xbd,0x70,0x9d,0x95,0x97,0x6d,0x37,0x14,0x65,0x06,0x9a,0x4a,0xfa
-,0xbe,0x20,0xcc,0xea,0xfa,0x81,0x4f,0x1b,0x9c,0x70,0x14,0x9a,0x03,0x9c,0xb2,0xbf,0x46,0xdf,0xf5,0x85
-,0x01,0x8d,0x93,0xd3,0xea,0x60,0x5c,0x10,0xfc,0xe4,0x8c,0x7d,0x1b,0x03,0xd3,0xb6,0x5d,0xbf,0x6b,0x40
-,0xaa,0x46,0x27,0x08,0x6d,0x98,0x35,0x34,0x6d,0x37,0x89,0x8c,0x53,0x94,0xf4,0xcd,0xb0,0x0b,0x1e,0x71
-,0x30,0x30,0xca,0x35,0xc6,0x41,0x16,0x84,0x6e,0xb7,0x17,0x1b,0xac,0x64,0xf6,0x52,0xe2,0x56,0x50,0x23
-,0x27,0x0a,0x17,0xc4,0xf4,0xdc,0xae,0x5f,0x76,0x63,0xda,0x8f,0x8c,0x08,0xb8,0xc4,0x56,0x6f,0xe6,0xb8
-,0xdd,0x24,0xa4,0xd3,0x54,0x80,0xaa,0xe4,0x8d,0x83,0xf2,0x88,0x76,0x1e,0xdc,0xb8,0x2c,0x1b,0xeb,0x50
-,0x27,0x08,0x69,0x46,0x50,0xee,0x78,0x81,0xf5,0x50,0x8e,0x62,0x33,0x8c,0x97,0x89,0x4d,0x27,0xa6,0xe1
-,0x22,0x2d,0x85,0xc2,0x4b,0x94,0x29,0x03,0x79,0xea,0xfa,0x9e,0xeb,0xd3,0x75,0x6c,0x05,0x87,0x22,0x29
-,0x2f,0x93,0x6a,0x10,0xb7,0xdf,0xcd,0x2c,0xc0,0x1b,0x6d,0x08,0xc3,0xd7,0xaa,0xd5,0x3f,0x35,0x7a,0x94
-,0xdb,0xcb,0x4c,0xe2,0xe0,0x71,0x23,0x33,0xdf,0xf8,0x9f,0x3e,0xb5,0x5d,0x93,0xa8,0x73,0xf0,0xc8,0x45
-,0x15,0x96,0xd6,0x88,0xe9,0xdb,0x44,0x0d,0x42,0x17,0xd6,0xe6,0xce,0x6c,0x78,0x28,0x41,0x10,0x0c,0xa8
-,0x36,0x7d,0x0a,0x06,0xe9,0x11,0xeb,0x81,0x58,0xa1,0x41,0xdf,0x44,0xe5,0xb9,0x16,0xec,0x54,0x6a,0x82
-,0xc0,0xb3,0x54,0x14,0x0e,0x7b,0xa4,0x4c,0x98,0x6b,0x69,0x52,0x5d,0xae,0x62,0x4e,0xdd,0x3f,0x0a,0xca
-,0x69,0xc4,0xbe,0xec,0x24,0x71,0x1c,0xf8,0xd1,0x13,0x66,0xfe,0x9a,0x44,0xb1,0xeb,0x4c,0xca,0x12,0x14
-,0x23,0x1a,0x98,0xc8,0x65,0x1d,0x1a,0x8f,0x28,0x45,0xe8,0xfa,0xe6,0x10,0x70,0x77,0xbb,0x1e,0x9d,0x5a
-,0x49,0x18,0x21,0x73,0x0c,0x02,0x17,0x94,0x61,0xa3,0x00,0x40,0x9e,0xb0,0x6c,0x75,0xa6,0x41,0x12,0x33
-,0x91,0x20,0x62,0x00,0x7e,0x6e,0x3c,0xc1,0x91,0x30,0x7b,0x35,0xb5,0x79,0x75,0xa1,0x8e,0x61,0xf5,0xa8
-,0xf5,0x40,0xed,0xbf,0x14,0xd3,0x05,0x4f,0x35,0x15,0xd7,0x1f,0x24,0x71,0x99,0x25,0x84,0xc1,0x13,0xfa
-,0x70,0x4b,0xc8,0x26,0xea,0xf5,0xcc,0x67,0x8d,0xd7,0x83,0x31,0xa9,0x16,0x18,0xb5,0x90,0x91,0xa9,0x97
-,0xb1,0x93,0x46,0x14,0xfe,0x24,0x9d,0x20,0x97,0x3d,0x72,0x19,0xea,0xf4,0xfc,0x4f,0x05,0x46,0x84,0x1f
-,0xeb,0x85,0xa2,0x88,0x7a,0x80,0x41,0x24,0x44,0x94,0x8c,0x8c,0xda,0xac,0x12,0x9a,0x7e,0x97,0x02,0xc0
-,0xb1,0x9e,0x1e,0xe6,0x52,0xea,0xaa,0xe6,0x8d,0x2a,0x81,0xd8,0x33,0x01,0xe4,0x92,0xc7,0xa7,0x6a,0xe5
-,0xa8,0x6b,0x4c,0x61,0x11,0xb6,0x30,0x74,0xc1,0x14,0x2c,0x6b,0x2e,0x20,0x28,0x7b,0x02,0xc7,0x29,0xf6
-,0x13,0xa7,0xed,0xeb,0xb7,0xaf,0xab,0x0b,0xd1,0xcf,0xda,0x29,0xf6,0x15,0x8d,0x0c,0x63,0x29,0xa0,0xd1
-,0x0b,0x86,0x34,0x9c,0xe6,0x59,0xd5,0xcf,0xce,0x2f,0xea,0x6f,0xd2,0xeb,0x26,0xfc,0x72,0x48,0x0b,0x04
-,0x4e,0xbd,0x66,0xd5,0x6b,0x92,0xa0,0x02,0x0d,0x59,0x27,0x69,0xa7,0xae,0x66,0x53,0xc7,0x4c,0xbc,0xb8
-,0x20,0x9d,0x59,0x65,0xdf,0x19,0xb7,0xf5,0x3f,0x59,0x17,0xdf,0xe4,0xb6,0xfc,0xd7,0x34,0x0d,0x10,0x73
-,0x30,0xa0,0x26,0xca,0x2c,0x2a,0xba,0x9a,0xe5,0xe4,0xc6,0xdd,0x62,0x45,0x07,0xb3,0x60,0x9e,0x34,0xfc
-,0x97,0xdb,0x32,0x9c,0xc0,0x4a,0xa2,0xb9,0x93,0xaf,0xa0,0x30,0x52,0x71,0x22,0xcf,0xe5,0x66,0x4c,0x7c
-,0x9f,0xe9,0x56,0x8e,0x43,0x34,0x3c,0x5d,0x21,0xd4,0x32,0x3e,0x79,0x11,0xef,0xde,0xb2,0xef,0x02,0x28
-,0x29,0x48,0x40,0x3e,0x0a,0xd0,0x0e,0x91,0x64,0xcf,0x90,0x27,0xee,0x25,0xfd,0xce,0x54,0x56,0xaf,0x21
-,0x36,0x04,0x83,0xb0,0xdb,0x31,0xd5,0xaa,0x5e,0xd5,0x4f,0xf0,0xa3,0x15,0x0c,0x26,0x44,0x16,0xb6,0x2b
-,0xba,0xc6,0x52,0x7f,0x2d,0x86,0x16,0x0b,0xda,0xac,0xc3,0xa7,0xd0,0x71,0xd7,0x2a,0xcc,0xe1,0xd7,0x18
-,0xfc,0x29,0xa3,0x2e,0xdb,0x6b,0xa5,0x21,0xfa,0xc1,0x37,0x88,0xce,0xe2,0xef,0x60,0x58,0xe4,0x44,0xf8
-,0x81,0x38,0x38,0xce,0x49,0xf5,0xe4,0x74,0x41,0x93,0xd5,0xf2,0x44,0x5b,0xda,0xa2,0x4a,0xb2,0x44,0x21
-,0xb2,0x09,0xd8,0xf8,0xe8,0x42,0x42,0x74,0x25,0x32,0xbf,0xe4,0x4a,0xd6,0xb5,0xed,0xb8,0x9e,0x57,0xf6
-,0x82,0xd1,0x42,0xf6,0x28,0xd8,0x79,0xd1,0xae,0x8b,0xe6,0x7f,0x94,0x77,0x02,0x9f,0xfb,0x01,0xbc,0xf7
-,0x0e,0x5e,0x0e,0x94,0x47,0x82,0xe4,0x29,0x8b,0x3e,0xa3,0xea,0xb2,0xc1,0x44,0x8e,0x9c,0x55,0xa2,0x91
-,0x8b,0x91,0xd8,0x42,0x67,0x34,0x08,0x22,0xcc,0x7a,0x90,0xe2,0x43,0xea,0x61,0xbc,0x37,0xa4,0xcb,0xdd
-,0xf0,0x42,0xe7,0x91,0xbb,0x94,0xf2,0x14,0xdd,0xe8,0xf3,0x86,0x0e,0x15,0x91,0x01,0xa4,0xbf,0x72,0xe3
-,0x15,0x92,0x7b,0xc1,0xb6,0xbc,0x68,0xad,0x0f,0x4b,0xc7,0xed,0x86,0x74,0x92,0xb2,0xd5,0xe5,0xbf,0x21
-,0x46,0x7a,0xab,0xfb,0x68,0xee,0xd7,0x42,0xeb,0xca,0x69,0x94,0x56,0x4d,0xab,0x2c,0x5b,0x24,0x1d,0x60
-,0x29,0xca,0x12,0xf4,0x59,0xb0,0x71,0xd3,0xc8,0x18,0x64,0x87,0x1e,0x75,0x62,0x3e,0xf0,0x66,0xd9,0xf1
-,0xa4,0xe0,0x21,0x52,0x6c,0xd6,0x7b,0x0b,0x3c,0xb3,0xf1,0x53,0x6a,0x9b,0x65,0x5a,0x91,0x98,0x57,0x93
-,0xa7,0x82,0xa7,0x29,0x96,0xab,0x87,0x92,0xbe,0x08,0x60,0x28,0x41,0xff,0xa1,0xd6,0x21,0x94,0x26,0x34
-,0x5f,0x79,0x09,0x63,0x4f,0x3e,0xec,0x59,0x0a,0x89,0xb4,0x8b,0xcd,0x79,0x01,0x53,0x2b,0x8f,0xd9,0x1c
-,0xf7,0xa5,0x91,0x07,0x46,0x5b,0x7d,0x13,0xc9,0x92,0x99,0x10,0xd3,0x4c,0xe8,0xb6,0x6c,0xde,0xf9,0xf0
-,0xac,0x76,0xc6,0x26,0x7b,0x15,0xcb,0x0b,0xa2,0x1c,0x0e,0x66,0x07,0x92,0x24,0x31,0x6d,0x88,0x21,0x1d
-,0x1b,0xcf,0x30,0xa3,0xb2,0xff,0x15,0x61,0x97,0xc3,0x20,0x0f,0x4d,0x51,0x32,0xa4,0x49,0xe6,0x58,0xf3
-,0x51,0x54,0x4c,0xc7,0xe8,0xdf,0xd8,0xbc,0xc5,0xb0,0x00,0x35,0xdc,0x2c,0x1f,0x06,0x6c,0x3a,0xbd,0x98
-,0x8c,0x2b,0x3d,0xd7,0xb6,0xe9,0x7c,0x6c,0xc7,0x7a,0xc4,0x19,0x9f,0xf1,0x1f,0xff,0xf9,0xa3,0x39,0xec
-,0x98,0x21,0x61,0xb3,0x7e,0x8c,0xee,0xd8,0xb2,0x40,0x18,0xff,0xf9,0xf8,0x45,0x05,0x62,0x63,0xe0,0x4c
-,0xa6,0x20,0x5b,0x82,0x18,0x86,0x16,0x9d,0x2f,0x2e,0xb2,0xd1,0x98,0x83,0x1c,0x60,0x10,0xd1,0x48,0xe3
-,0xc5,0x2c,0xab,0x6c,0xf2,0xea,0xb8,0x6a,0xc6,0x06,0x61,0x5e,0xc6,0x2a,0xa4,0x2c,0x9c,0x3a,0xfb,0xb2
-,0x92,0x9c,0x42,0x44,0x6a,0x84,0xd2,0x74,0xbc,0x49,0x18,0x86,0x84,0x1b,0x26,0xa5,0xb5,0xa9,0x15,0x84
-,0x62,0xc6,0x47,0x78,0xef,0xce,0x5a,0xc9,0x30,0x27,0xb5,0x73,0x46,0x9b,0x13,0x43,0x8c,0x19,0xd7,0xea
-,0x72,0x72,0x61,0xc2,0x69,0xf2,0x15,0x2a,0x62,0x10,0xb9,0xae,0x86,0x18,0x70,0xe6,0x94,0x19,0xf5,0x30
-,0x83,0x64,0x1c,0x96,0xec,0x79,0xe7,0xdb,0xb0,0xe6,0x0b,0x89,0x40,0x19,0x8e,0x8b,0x79,0x47,0xcc,0xf8
-,0x12,0x32,0x74,0x23,0xb7,0xe3,0x7a,0x2c,0xf9,0x64,0xc6,0x63,0xe5,0x29,0x4c,0x52,0x37,0xb0,0xe5,0x0b
-,0x33,0xc7,0x72,0x65,0x46,0x9c,0xcc,0x17,0x98,0x2e,0xd9,0x52,0x8d,0x3c,0xb4,0xdd,0x21,0xb1,0x3c,0x33
-,0x8a,0x9a,0x8a,0xd0,0x45,0x2e,0x03,0x5d,0x62,0xf5,0x49,0x14,0x0b,0xcd,0x14,0xd2,0x0b,0xa9,0xd3,0x54
-,0x8e,0x95,0xd6,0xab,0x97,0x17,0x6f,0xce,0xea,0x3f,0x07,0x7d,0x7a,0x79,0x6c,0x66,0xd4,0xf2,0x32,0x9b
-,0x12,0x9b,0xfd,0x0a,0x5b,0xd8,0x52,0xe4,0x02,0xd2,0x2a,0x2a,0x1a,0xc7,0x50,0x36,0x4a,0xe9,0x10,0xf4
-,0x76,0xe2,0xad,0xe2,0xd7,0xa3,0xde,0x40,0x52,0x61,0x25,0x69,0x30,0xa7,0x38,0x86,0xe4,0xa9,0x3a,0x61
-,0x7e,0x35,0x4a,0x4c,0x33,0x53,0xe9,0xd9,0xfa,0x4f,0x6e,0x65,0x2b,0xd3,0xd9,0xb5,0x9b,0x8a,0x17,0x74
-,0x83,0x85,0x6b,0xfc,0x3a,0x9f,0x80,0xc1,0x3f,0xc2,0xa6,0x52,0x98,0x0a,0x2a,0xbc,0xd6,0xbc,0x88,0x99
-,0xe2,0xcd,0xf9,0xf9,0x59,0xe3,0x95,0xdf,0x89,0x06,0xf2,0xf7,0x13,0xbf,0x84,0x89,0x96,0xd0,0xf0,0xf2
-,0x98,0x73,0x5b,0xd1,0x4a,0x5e,0xea,0x05,0x8d,0x96,0x24,0x95,0x49,0x7a,0x95,0xb0,0x29,0x49,0x84,0x6c
-,0x09,0x3f,0x5a,0x41,0xc2,0x3e,0x2b,0x0b,0x2f,0x79,0xc6,0x25,0xbc,0xc3,0x55,0x78,0xde,0xed,0x04,0xe3
-,0x45,0x25,0xb9,0xde,0x32,0x29,0x4b,0x2a,0x6a,0xaf,0x69,0xe5,0x92,0xc5,0x02,0xab,0xce,0xa6,0xca,0xa0
-,0x59,0x49,0x54,0x84,0x89,0x51,0xcb,0x15,0x81,0x35,0x4c,0xe7,0x06,0xe3,0x64,0xbc,0x46,0x97,0x22,0x74
-,0x63,0x8c,0x08,0x18,0x04,0xb5,0xfa,0x45,0xfd,0xf4,0x82,0x7c,0x32,0x1f,0x28,0xf9,0xb5,0x17,0xc4,0xc1
-,0xe5,0xb1,0x20,0x7d,0x3e,0x3f,0xa9,0xaa,0x70,0x5e,0xc9,0xf3,0xa4,0x7a,0x21,0x92,0x1b,0x79,0x0f,0xff
-,0x17,0x97,0x9e,0xc9,0x39,0x17,0x54,0xc5,0x30,0x56,0x5a,0xf9,0x56,0x1d,0x2c,0x69,0x7c,0xa6,0x7e,0x18
-,0x40,0x8f,0x94,0x3e,0x9d,0x6b,0x2a,0x2c,0xa8,0xf9,0x51,0xae,0xac,0x75,0xc7,0x89,0xc9,0x5b,0x54,0xcc
-,0x44,0x61,0xad,0xad,0x97,0x07,0x49,0x40,0x58,0x7a,0x3d,0xc9,0xfa,0xba,0x39,0x3d,0x72,0x8b,0x08,0xc2
-,0x43,0x9c,0x10,0xcb,0xc2,0x2c,0x7d,0xca,0xc2,0x27,0x4c,0x92,0x8b,0xa9,0xac,0xa6,0xd2,0xfa,0x8d,0xf2
-,0xde,0x8f,0x2f,0x2b,0xaf,0x89,0x93,0x05,0xaf,0x61,0xfd,0x78,0xb1,0xfd,0xb9,0xe9,0xc4,0xb4,0xbc,0xcc
-,0x12,0x56,0xb0,0x18,0xf4,0x2b,0xd9,0x05,0x03,0xee,0x83,0x43,0xd3,0x4b,0x10,0x01,0xb5,0xaa,0xd2,0xfa
-,0xdf,0x7f,0xbc,0xbb,0x56,0xd1,0x53,0x57,0xc7,0xb5,0x7a,0xb5,0xaa,0x5d,0x1e,0x0b,0x92,0x8d,0x79,0xbd
-,0x51,0xe4,0x52,0x0b,0xc3,0x2f,0x3d,0x42,0xa2,0xe3,0xec,0xeb,0x17,0x60,0x5f,0xad,0x9f,0x6e,0xcf,0x1e
-,0xf7,0x02,0x38,0x27,0x30,0x19,0x9f,0x9f,0x5d,0x6c,0xcf,0xe8,0x1c,0x32,0xfd,0x1f,0x38,0x61,0x7d,0x74
-,0x0c,0xad,0xb7,0x67,0x74,0xa6,0xb4,0x18,0x9f,0xb3,0xd3,0xea,0xf8,0xf4,0x62,0x07,0x3e,0xaf,0x95,0x56
-,0xfb,0xaf,0x6f,0xd5,0x53,0xc8,0x53,0x7f,0x73,0xb6,0x3d,0x9f,0x53,0xa5,0xf5,0x37,0x26,0xd0,0x49,0x1d
-,0x8c,0x4e,0x77,0x10,0xe8,0x04,0x1d,0x0f,0xe7,0x04,0x2e,0xe3,0xda,0xf9,0x0e,0x22,0xc1,0xbd,0xfe,0xc6
-,0x39,0xc1,0xbf,0x98,0x7b,0x3d,0x93,0x13,0x8b,0x60,0xe6,0x3f,0x8f,0xc5,0xf8,0xe3,0x29,0xe0,0xb1,0x30
-,0xfe,0x3d,0xc1,0x38,0x2a,0x9e,0x6c,0x1c,0xc4,0xb2,0x1e,0x54,0x12,0x07,0xcf,0x8b,0xdf,0x9c,0x24,0xd9
-,0x52,0x23,0xec,0x8b,0x71,0xe8,0x13,0x3a,0x2c,0x75,0x57,0xbc,0x7a,0x41,0x05,0x85,0x80,0x19,0x8f,0x62
-,0x82,0xb5,0x4c,0x78,0xe4,0x89,0x92,0x8b,0xec,0xad,0x92,0xc4,0x0a,0x79,0xcd,0xb1,0xd2,0x7a,0x1f,0x8c
-,0x9e,0x32,0xf9,0x0e,0x88,0x74,0xf8,0x4c,0xc0,0xa7,0x51,0xb4,0x31,0x28,0xf3,0xaa,0x4a,0xeb,0x26,0x3b
-,0xde,0x05,0x9a,0x72,0x7d,0x07,0x60,0x72,0xe2,0x08,0x6c,0xca,0x75,0x89,0x0d,0xfe,0xb3,0xa0,0xf8,0x9e
-,0xc8,0x3c,0x25,0xed,0x2e,0xb8,0xb0,0x31,0x58,0x68,0x46,0x69,0xd9,0xf3,0x51,0x49,0x2b,0x22,0xb3,0xc9
-,0xa3,0x83,0x21,0x92,0x89,0xf2,0x07,0xc0,0x23,0x32,0xe3,0x44,0xcc,0xe9,0x36,0x46,0x64,0x5e,0x15,0xdd
-,0x5f,0x76,0x7c,0x30,0x54,0x72,0xe2,0xfc,0x11,0x70,0x19,0x50,0x0b,0x37,0xfe,0x3f,0x53,0xc7,0x41,0xaf
-,0xb5,0x39,0x36,0x85,0xea,0xc0,0x47,0x9c,0x93,0x3b,0x7e,0xbe,0xf1,0x30,0x71,0x81,0xdd,0xf7,0x1a,0x2b
-,0x02,0x8e,0x55,0xe3,0xbb,0x8f,0x41,0x26,0xe7,0x96,0x83,0x84,0x1a,0x98,0xd0,0x2e,0x5f,0x3b,0xda,0x9a
-,0x47,0x5d,0x69,0xbd,0x0b,0xcd,0x09,0x7f,0xd4,0x63,0x97,0x71,0xcf,0x6f,0xd4,0x26,0x9f,0xb0,0x20,0xb4
-,0xcb,0x20,0xec,0x5d,0x88,0xfb,0xb5,0xbb,0x71,0xc1,0x90,0xf0,0x06,0x07,0xbb,0x31,0xc1,0xf8,0xf4,0x9e
-,0x0e,0x5c,0xf3,0xbf,0x61,0xcc,0x65,0x8e,0x3a,0x1b,0x87,0x05,0xea,0x28,0xad,0xeb,0xbf,0xdf,0x6c,0x9c
-,0xa4,0xc4,0x22,0xf6,0x73,0x3c,0x5c,0x64,0x27,0x29,0xa0,0xb2,0xb4,0x2c,0xb0,0x3a,0x72,0x9e,0xbb,0x34
-,0xb0,0x42,0xaf,0x54,0x40,0xbe,0xce,0xab,0xe4,0xd4,0x7c,0x9e,0x8e,0x3f,0x2e,0x83,0x41,0x88,0xcf,0x5d
-,0xac,0x1b,0x6d,0x03,0x12,0xaf,0xc8,0x91,0x22,0xef,0x70,0xb4,0x2f,0xb8,0x44,0xb3,0x07,0xc3,0x4c,0x6a
-,0x7d,0x68,0xe0,0x20,0x48,0x3f,0xb0,0x37,0x5f,0x91,0x90,0xf5,0x94,0x16,0x50,0xfb,0x80,0x83,0x8d,0x7b
-,0x99,0x94,0xc1,0x0f,0xee,0x5e,0xae,0xf1,0x3c,0xd0,0x2e,0x3d,0xcb,0x3d,0x6e,0x4c,0x63,0xa6,0xb6,0x7d
-,0xb7,0xd2,0xf6,0x82,0xc4,0xde,0x9e,0x03,0xfa,0x94,0x5f,0x1c,0x07,0x0f,0x25,0xee,0xd2,0xa3,0x88,0x85
-,0xe7,0xff,0x82,0x2c,0x4e,0xad,0xcd,0x13,0x04,0xb5,0x80,0xe2,0x5d,0x9b,0xdc,0xdf,0x7d,0xbc,0xff,0xe5
-,0xb7,0xfd,0x64,0x07,0xb4,0x79,0xa0,0xc4,0xc0,0xb4,0x3d,0x78,0x32,0xa7,0x56,0x7d,0x1b,0x9c,0xe0,0xed
-,0x0c,0xa8,0xdb,0xfb,0x5f,0xf7,0x85,0x12,0x06,0xfb,0x87,0x82,0x09,0xca,0x1e,0x1e,0xa7,0xcf,0x1e,0x1d
-,0x52,0x6f,0x0b,0xac,0x44,0x45,0x86,0x17,0x79,0xcf,0x8e,0x0e,0x36,0x91,0xcb,0x44,0xf9,0x03,0x4c,0xe3
-,0xe0,0x15,0x9f,0xb9,0xd0,0xdb,0x04,0x8f,0xa8,0x89,0xfb,0x15,0x63,0xdc,0xe8,0xc6,0xd3,0xab,0xbb,0x20
-,0x52,0xdd,0x09,0x90,0x54,0x14,0x81,0x48,0xba,0x36,0xc8,0x16,0xf7,0x33,0x4c,0xea,0xd5,0xd3,0xef,0x8a
-,0x0a,0x63,0xfe,0x23,0x81,0xe9,0x6e,0xd1,0xef,0x74,0x59,0xbf,0xf3,0xae,0xbd,0x9f,0x54,0x86,0xc6,0x0e
-,0x94,0xc9,0x98,0x9a,0x87,0x4b,0x64,0xf2,0x9e,0x7c,0x06,0xd3,0x96,0x93,0x08,0x59,0x11,0x73,0xe7,0x6d
-,0x26,0x10,0xb9,0xc8,0xa9,0x8d,0x77,0x09,0x9d,0x54,0x8c,0x62,0xe4,0x9c,0xcc,0xe3,0xe6,0xf5,0x77,0x8d
-,0x9a,0x93,0x27,0xa5,0xdd,0x25,0x68,0x98,0x26,0x16,0xc5,0xa3,0x13,0x78,0x78,0x7a,0x53,0x40,0x72,0x75
-,0x05,0x26,0xa4,0x2d,0xce,0x76,0xc1,0xa6,0xbe,0x0b,0x36,0x79,0x89,0x8a,0xf0,0x9c,0xfd,0xa0,0x9e,0x06
-,0xf7,0x2c,0x7f,0x24,0x3c,0x9d,0xc1,0xe6,0x39,0x0d,0x75,0xb0,0x30,0xf4,0xeb,0x7e,0x72,0x1a,0x6b,0xec
-,0x99,0x39,0x6d,0xa7,0x0c,0xc6,0x95,0x3a,0xf8,0x34,0x7a,0x0b,0x34,0x50,0x07,0xd3,0xe7,0x3d,0xa1,0xc1
-,0x1a,0x3b,0x4c,0x0f,0xc3,0xd5,0x3c,0x34,0x3e,0xa1,0x39,0xfa,0xdc,0xed,0x9b,0x1b,0x63,0x24,0xeb,0x61
-,0x61,0xd7,0x1c,0x91,0x77,0x1f,0xae,0xf7,0x82,0x55,0xda,0xe8,0x61,0xf0,0xca,0x54,0x3e,0x34,0x66,0x1e
-,0xf5,0x37,0x0f,0x2a,0x56,0x09,0xb7,0x9b,0xa9,0x1f,0x91,0x76,0x10,0xca,0xed,0x8b,0x7b,0x41,0x8d,0xb7
-,0x7c,0x18,0xc8,0x84,0xd2,0x87,0xc6,0xab,0xd7,0x77,0xc3,0x30,0x08,0x37,0x86,0x4c,0xd6,0xc3,0x32,0x55
-,0xf9,0x03,0x3f,0xda,0x0b,0x5c,0x69,0xab,0x87,0x41,0x2c,0xd3,0xf9,0xd0,0xa0,0x0d,0x1d,0xcf,0x1d,0x6c
-,0x0c,0x19,0xaf,0x85,0xc7,0x97,0xca,0x6f,0xf1,0xbf,0x17,0xb8,0x44,0x8b,0x87,0x01,0x4b,0x6a,0x7b,0x68
-,0xa8,0x6c,0x6b,0xb4,0x31,0x50,0xa8,0xa3,0xb4,0x6e,0xdb,0x7f,0x27,0xea,0x6d,0x30,0xc2,0x26,0x87,0x6f
-,0x94,0xdc,0x7d,0xc4,0x53,0x54,0x7b,0x40,0x8c,0x35,0x7d,0x18,0xbc,0xb8,0xd2,0x87,0x46,0x8b,0x3f,0xb5
-,0x8e,0xa7,0x8b,0xb7,0x78,0xf6,0x45,0x54,0x64,0xcf,0xbe,0xe0,0x88,0xdc,0x98,0xfb,0x49,0x88,0x59,0xbb
-,0xfb,0x18,0xb4,0xcf,0x95,0xdc,0x33,0x4e,0x8b,0x0f,0x17,0x6f,0xf9,0x24,0x2f,0x7b,0x0c,0xd9,0xa6,0xf1
-,0x36,0x4f,0x6b,0xe4,0xea,0x2a,0x2d,0xf6,0x58,0x32,0xb9,0xe5,0x27,0xfb,0x1a,0xa7,0xe4,0xdb,0xdf,0x07
-,0xd4,0x05,0x7d,0x0f,0x1d,0x95,0x5c,0x18,0x8c,0x0a,0x83,0xae,0xbf,0xd5,0x73,0xd8,0x85,0xea,0x12,0xbe
-,0xdf,0xc4,0xf9,0x7e,0x01,0x9c,0x0b,0xb1,0x37,0x0c,0x73,0x7a,0xef,0x09,0xc6,0x35,0x5b,0x26,0x8e,0xb1
-,0x67,0x62,0xc5,0xb6,0x8e,0xd5,0xfc,0x2e,0xc5,0xcb,0x20,0xd6,0xb0,0xca,0xb6,0x82,0x88,0xf7,0xb6,0x64
-,0xdb,0xd2,0x32,0x2b,0x2e,0x6c,0x57,0x4b,0xd7,0x2b,0x9f,0xe7,0x7e,0x7c,0xe3,0x9a,0xec,0x0e,0xd8,0x61
-,0xb6,0x5b,0xe2,0xff,0x9f,0x52,0x1e,0xef,0xc5,0xc8,0xc9,0x85,0x5b,0xdb,0xa1,0xd5,0x54,0xd6,0x6d,0x21
-,0x59,0xa3,0xf8,0xf1,0x2a,0xcd,0x17,0x88,0x73,0x7b,0x1d,0x5e,0x5c,0x46,0x56,0xe8,0x0e,0x70,0xeb,0x17
-,0x6f,0xdc,0x49,0x58,0x76,0xac,0x60,0x77,0xd8,0xdd,0x10,0x07,0xef,0xdd,0x08,0x7b,0x69,0x68,0xa8,0x96
-,0x6e,0x7f,0xf9,0xc0,0x9e,0xc8,0x64,0x65,0x81,0x69,0x53,0xbb,0xa4,0x3b,0x89,0xcf,0x19,0xa8,0xda,0x34
-,0x3d,0x24,0x1d,0xf5,0x46,0x9b,0x7a,0x34,0x26,0xed,0x86,0x70,0x70,0xf5,0xa6,0xc2,0xbc,0x54,0x9b,0x5a
-,0x66,0x44,0x4b,0xa9,0xab,0x96,0x8c,0x76,0xf3,0xa6,0x22,0xbb,0xfc,0xab,0x1a,0xdb,0x2f,0x08,0x6d,0x1f
-,0x1a,0x9c,0x88,0xaf,0xa4,0x95,0xf0,0xd2,0x0f,0x1c,0x8b,0x7b,0xd2,0x65,0xec,0xd4,0x12,0x55,0xf8,0x7a
-,0x5d,0x9e,0x58,0xec,0xeb,0x48,0xa9,0x93,0x4e,0xdf,0x8d,0x19,0x65,0xa9,0x56,0x92,0x54,0x32,0x18,0xb0
-,0xc9,0x10,0xcf,0x0d,0xfa,0x8d,0x19,0x00,0x8d,0x62,0x72,0xdb,0xfc,0xf2,0xd3,0xd4,0x9a,0x1d,0xf3,0x67
-,0x3c,0x03,0xef,0x6a,0x68,0x86,0xcd,0x9f,0xa6,0x37,0x15,0xd7,0x9e,0xbd,0x42,0x1b,0x38,0x6e,0xcf,0xbe
-,0x34,0x1c,0xf6,0xc2,0x12,0xf5,0x56,0xab,0xc4,0x3d,0xea,0xab,0x77,0xcd,0xd6,0x94,0xd5,0x0e,0x3c,0x5a
-,0xc1,0x6e,0x28,0xf5,0x4b,0x48,0x7f,0x4f,0xb0,0xd7,0x85,0xc4,0x01,0xf9,0x69,0x7a,0x3b,0x23,0x0e,0xde
-,0x1b,0x14,0x61,0x73,0x96,0x8e,0xfd,0x69,0x78,0x4a,0x31,0x32,0x50,0x7c,0x57,0x11,0xc7,0xb3,0x2f,0xda
-,0x4c,0x9b,0xa1,0x19,0x62,0x35,0x33,0x2b,0x63,0x0f,0x2a,0x7f,0x92,0xb1,0x82,0xb7,0xac,0x60,0xff,0x3c
-,0xdb,0x5e,0x0a,0x76,0xb4,0x79,0x83,0x96,0x60,0x1e,0xe6,0x4a,0x0c,0x00,0x86,0x86,0x5a,0x12,0xfe,0x57
-,0xd2,0x66,0xba,0xb3,0x44,0x10,0xd2,0x3e,0xf6,0xe0,0xe5,0x69,0xba,0xab,0x99,0xa4,0xbb,0x63,0x4a,0x9a
-,0x7e,0x93,0xbd,0xaa,0xa1,0x79,0x54,0x9d,0xe9,0xbd,0xb5,0x4c,0xd7,0xd4,0xa9,0xcd,0x74,0xb7,0xa9,0xde
-,0xe8,0x6d,0xfd,0x56,0x43,0xcd,0xdb,0xe6,0x91,0xea,0x27,0x9e,0x77,0xd4,0xbc,0xd5,0xfe,0xfd,0xef,0x5b
-,0x6c,0x7b,0x8d,0xc9,0x5d,0x63,0x8e,0x78,0xb3,0x09,0xf8,0x98,0x2b,0x5c,0xc1,0x90,0x19,0xf6,0x7a,0xbb
-,0x79,0x74,0xd4,0x06,0xdf,0x74,0x1c,0xd8,0xd6,0x0c,0x7e,0x9d,0x03,0x8d,0x72,0xb1,0x40,0xdb,0xd6,0xf4
-,0xdb,0x57,0xaf,0xee,0x8e,0x9a,0xcd,0xf6,0x15,0x73,0x31,0xe3,0x08,0xa7,0x6a,0x09,0x77,0xac,0x04,0x5f
-,0xd7,0xbe,0x6a,0x5f,0x51,0x75,0xa8,0x19,0x0e,0xfb,0x29,0x61,0x3d,0x3e,0x77,0x41,0x75,0xd4,0x58,0xd3
-,0xa9,0x1a,0x69,0x60,0x4e,0xd9,0xb1,0xc3,0x8f,0x4b,0xe9,0xc3,0x38,0x39,0x5a,0x47,0x1d,0x6b,0x06,0x65
-,0x3f,0xa5,0x62,0xea,0x4b,0x69,0xd0,0x6e,0xfb,0xaa,0xa7,0xfa,0x9a,0xd1,0xc5,0x8f,0xa6,0xcd,0x1a,0x19
-,0x9c,0xf0,0x86,0x70,0x72,0xcf,0x3d,0x36,0x08,0xaf,0x3d,0x4f,0x2d,0x89,0x0d,0xac,0x25,0xad,0x82,0x5c
-,0x7a,0x67,0xb2,0x68,0xe0,0x36,0x0e,0x7c,0xcb,0x73,0xad,0x87,0xa6,0xca,0x0c,0x47,0x11,0x22,0x62,0x6b
-,0xfd,0x47,0x3c,0x15,0xa3,0xcd,0x66,0x10,0x8f,0xfb,0x9d,0xf0,0x50,0xe1,0x3e,0x5f,0xa4,0x0f,0x66,0x31
-,0x87,0x30,0x13,0x1e,0x4d,0x6e,0x2a,0x5f,0x23,0x16,0x84,0xb3,0x15,0x24,0x8f,0x89,0x56,0xec,0x25,0x72
-,0x32,0xb6,0x21,0x94,0xab,0x02,0x94,0x7f,0xb6,0xa1,0xef,0xbf,0xf4,0xa3,0x1a,0x73,0x5d,0x4d,0x7a,0xe7
-,0xd7,0xb9,0xfb,0x62,0x63,0xd9,0x9d,0x18,0x4d,0xdd,0x4c,0xfe,0x0a,0xe7,0x12,0x29,0x0b,0x6e,0xf2,0xf0
-,0x14,0xcd,0x3c,0xad,0x82,0xda,0x5b,0x4f,0x9d,0x6d,0x5d,0x03,0x59,0x7f,0x3d,0x59,0x61,0x47,0x1a,0x48
-,0xfd,0xf5,0xa4,0xb9,0x6d,0x64,0x20,0x0c,0xd6,0x13,0xe6,0xd3,0x36,0x28,0x07,0x02,0xac,0x91,0xeb,0xdb
-,0xc1,0x08,0x31,0x1d,0x0c,0x54,0x88,0x84,0xd7,0xc5,0x40,0x87,0x9f,0x3f,0x7d,0x78,0xdf,0x2c,0xad,0xdd
-,0x07,0x57,0x9a,0xe9,0xbf,0x8b,0xda,0x5f,0x2b,0x2c,0x9b,0x33,0x5c,0xff,0x52,0x32,0x2e,0x6a,0x25,0x86
-,0x2e,0xa3,0xf8,0x02,0x87,0x7c,0x58,0x60,0x77,0x8f,0x26,0xc0,0x4a,0x30,0x68,0x78,0x45,0x9f,0x61,0x8d
-,0xcf,0x99,0x21,0x8d,0x99,0x03,0xf8,0x02,0xbd,0xfa,0x6c,0x75,0x90,0xba,0x6e,0xb1,0x99,0xbb,0x82,0x57
-,0xe9,0xc0,0x27,0x04,0xe7,0x99,0x1e,0x2c,0xd7,0xa7,0xfc,0x42,0xbf,0x78,0x41,0x60,0x7c,0x53,0x6c,0x1e
-,0x9e,0x9f,0x13,0xad,0x71,0x73,0x85,0xea,0xc6,0xef,0xe0,0xae,0x23,0x73,0xe5,0x6b,0x77,0x10,0x11,0x33
-,0x7d,0x2b,0xa7,0xcb,0x02,0xa3,0xc7,0xb2,0x3f,0x67,0xc7,0x02,0x3d,0x73,0xbb,0x70,0x3d,0x52,0x2c,0xd8
-,0x35,0x3d,0x7a,0x94,0x20,0x77,0x77,0x11,0xb4,0xf1,0x23,0x1e,0xb7,0x78,0xef,0xab,0xa4,0x35,0xc2,0xa2
-,0x5c,0x50,0x33,0xd4,0xf4,0x30,0xeb,0xbe,0xd6,0xa4,0x97,0x99,0x94,0x3c,0x79,0x44,0x30,0xe4,0x2f,0x4d
-,0x1f,0x3e,0x4a,0x90,0x7f,0xae,0x00,0xb2,0x24,0x4b,0xb2,0x24,0x9a,0x9e,0x64,0xb2,0x64,0x39,0x30,0x6d
-,0x7d,0xf4,0x08,0xf3,0x34,0xfb,0x69,0xfa,0x78,0x3d,0x55,0xe1,0x31,0x41,0x08,0x30,0x5a,0x12,0x60,0xa4
-,0xe9,0xa3,0x4c,0x80,0x2c,0x7f,0xa6,0x02,0x4c,0x9e,0x88,0x45,0x31,0x3f,0x80,0x0c,0xdf,0x9e,0x20,0x9c
-,0x67,0x62,0x4d,0xbf,0x7e,0x84,0x36,0xdd,0xea,0x08,0x59,0xaf,0x97,0x64,0xbd,0xd6,0xf4,0xd7,0x97,0xd7
-,0xa2,0x57,0x41,0x26,0x77,0xd5,0x09,0x4b,0x6f,0xba,0xab,0x7e,0x63,0xff,0x70,0xde,0xc9,0x42,0x15,0x99
-,0x64,0xb3,0x4a,0x57,0x2a,0x9e,0x13,0x0f,0x63,0xb5,0xf4,0xab,0x47,0x31,0xe4,0x90,0x4f,0x1e,0x12,0x6c
-,0xc3,0x23,0x98,0xb1,0xf3,0xb7,0x75,0x90,0x30,0xdb,0xa8,0x49,0xc4,0x0b,0x19,0x08,0x65,0xaf,0xb8,0x61
-,0x1b,0xd6,0xe3,0x9e,0x1b,0x11,0x87,0xb2,0x3d,0x0c,0xf4,0x88,0x61,0x1f,0xe0,0xc5,0x0a,0x52,0x0a,0xcd
-,0x60,0x67,0x6a,0x47,0x9d,0x68,0xfa,0xd1,0x24,0xb5,0x28,0xa4,0x64,0x1d,0x4d,0x26,0x22,0x64,0xfc,0x76
-,0x10,0x19,0x45,0xf3,0xa9,0x8c,0xdf,0x00,0xd8,0x3c,0x02,0x58,0x7f,0x08,0x09,0xa1,0x46,0x15,0x24,0xbc
-,0x63,0x44,0x3f,0x86,0xcd,0xf5,0xb9,0xd1,0xa6,0x1c,0x62,0x8a,0x33,0xb1,0xa9,0x1e,0xfb,0xec,0xf9,0x3b
-,0x1d,0xff,0x03,0xef,0xe2,0xc8,0x6b,0xeb,0x51,0x00,0x00
-};
-
-//File: index_ov3660.html.gz, Size: 4408
-#define index_ov3660_html_gz_len 4408
-const uint8_t index_ov3660_html_gz[] = {
- 0x1F, 0x8B, 0x08, 0x08, 0x28, 0x5C, 0xAE, 0x5C, 0x00, 0x03, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x5F,
- 0x6F, 0x76, 0x33, 0x36, 0x36, 0x30, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x00, 0xE5, 0x5D, 0xEB, 0x92,
- 0xD3, 0xC6, 0x12, 0xFE, 0xCF, 0x53, 0x08, 0x41, 0x58, 0x6F, 0x65, 0xED, 0xF5, 0x6D, 0xCD, 0xE2,
- 0xD8, 0xE6, 0xC0, 0xB2, 0x84, 0x54, 0x01, 0x49, 0x20, 0x21, 0xA9, 0x4A, 0xA5, 0x60, 0x2C, 0x8D,
- 0xED, 0x09, 0xB2, 0xE4, 0x48, 0x23, 0x7B, 0x37, 0xD4, 0x3E, 0xC7, 0x79, 0xA0, 0xF3, 0x62, 0xA7,
- 0xE7, 0x22, 0x69, 0x24, 0x8F, 0x2E, 0xB6, 0x59, 0x9B, 0xC3, 0x31, 0x55, 0x20, 0x5B, 0xD3, 0x3D,
- 0xDD, 0xFD, 0xF5, 0x6D, 0x46, 0x17, 0x06, 0x77, 0x6D, 0xCF, 0xA2, 0xD7, 0x0B, 0x6C, 0xCC, 0xE8,
- 0xDC, 0x19, 0xDD, 0x19, 0x88, 0x7F, 0x0C, 0xF8, 0x0C, 0x66, 0x18, 0xD9, 0xE2, 0x90, 0x7F, 0x9D,
- 0x63, 0x8A, 0x0C, 0x6B, 0x86, 0xFC, 0x00, 0xD3, 0xA1, 0x19, 0xD2, 0x49, 0xFD, 0xDC, 0xCC, 0x9E,
- 0x76, 0xD1, 0x1C, 0x0F, 0xCD, 0x25, 0xC1, 0xAB, 0x85, 0xE7, 0x53, 0xD3, 0xB0, 0x3C, 0x97, 0x62,
- 0x17, 0x86, 0xAF, 0x88, 0x4D, 0x67, 0x43, 0x1B, 0x2F, 0x89, 0x85, 0xEB, 0xFC, 0xCB, 0x09, 0x71,
- 0x09, 0x25, 0xC8, 0xA9, 0x07, 0x16, 0x72, 0xF0, 0xB0, 0xA5, 0xF2, 0xA2, 0x84, 0x3A, 0x78, 0x74,
- 0xF9, 0xF6, 0xA7, 0x4E, 0xDB, 0xF8, 0xF1, 0x5D, 0xA7, 0xD7, 0x6B, 0x0E, 0x4E, 0xC5, 0x6F, 0xC9,
- 0x98, 0x80, 0x5E, 0xAB, 0xDF, 0xD9, 0x67, 0xEC, 0xD9, 0xD7, 0xC6, 0xA7, 0xD4, 0x4F, 0xEC, 0x33,
- 0x01, 0x21, 0xEA, 0x13, 0x34, 0x27, 0xCE, 0x75, 0xDF, 0x78, 0xE2, 0xC3, 0x9C, 0x27, 0x2F, 0xB0,
- 0xB3, 0xC4, 0x94, 0x58, 0xE8, 0x24, 0x40, 0x6E, 0x50, 0x0F, 0xB0, 0x4F, 0x26, 0xDF, 0xAD, 0x11,
- 0x8E, 0x91, 0xF5, 0x71, 0xEA, 0x7B, 0xA1, 0x6B, 0xF7, 0x8D, 0x7B, 0xAD, 0x73, 0xF6, 0x67, 0x7D,
- 0x90, 0xE5, 0x39, 0x9E, 0x0F, 0xE7, 0x2F, 0x9F, 0xB3, 0x3F, 0xEB, 0xE7, 0xF9, 0xEC, 0x01, 0xF9,
- 0x07, 0xF7, 0x8D, 0x56, 0x6F, 0x71, 0x95, 0x3A, 0x7F, 0x73, 0x27, 0xF5, 0x75, 0xD6, 0xCE, 0x93,
- 0x5E, 0xD2, 0x9F, 0x17, 0xD3, 0x07, 0xD8, 0xA2, 0xC4, 0x73, 0x1B, 0x73, 0x44, 0x5C, 0x0D, 0x27,
- 0x9B, 0x04, 0x0B, 0x07, 0x81, 0x0D, 0x26, 0x0E, 0x2E, 0xE4, 0x73, 0x6F, 0x8E, 0xDD, 0xF0, 0xA4,
- 0x84, 0x1B, 0x63, 0x52, 0xB7, 0x89, 0x2F, 0x46, 0xF5, 0x99, 0x1D, 0xC2, 0xB9, 0x5B, 0xCA, 0xB6,
- 0x48, 0x2E, 0xD7, 0x73, 0xB1, 0xC6, 0x80, 0x6C, 0xA2, 0x95, 0x8F, 0x16, 0x6C, 0x00, 0xFB, 0x77,
- 0x7D, 0xC8, 0x9C, 0xB8, 0xC2, 0xA9, 0xFA, 0x46, 0xA7, 0xDB, 0x5C, 0x5C, 0x95, 0x40, 0xD9, 0xE9,
- 0xB1, 0x3F, 0xEB, 0x83, 0x16, 0xC8, 0xB6, 0x89, 0x3B, 0xED, 0x1B, 0xE7, 0x5A, 0x16, 0x9E, 0x6F,
- 0x63, 0xBF, 0xEE, 0x23, 0x9B, 0x84, 0x41, 0xDF, 0xE8, 0xEA, 0xC6, 0xCC, 0x91, 0x3F, 0x05, 0x59,
- 0xA8, 0x07, 0xC2, 0xD6, 0x5B, 0x5A, 0x49, 0xE4, 0x10, 0x9F, 0x4C, 0x67, 0x14, 0x20, 0x5D, 0x1B,
- 0x93, 0x35, 0x9A, 0x0C, 0xA1, 0x32, 0x3C, 0x0B, 0xED, 0xA6, 0xB7, 0x1A, 0x72, 0xC8, 0xD4, 0xAD,
- 0x13, 0x8A, 0xE7, 0xA0, 0x4E, 0x40, 0x7D, 0x4C, 0xAD, 0x59, 0x91, 0x28, 0x13, 0x32, 0x0D, 0x7D,
- 0xAC, 0x11, 0x24, 0xB6, 0x5B, 0x81, 0xC2, 0x70, 0x72, 0xFD, 0x54, 0x7D, 0x85, 0xC7, 0x1F, 0x09,
- 0xAD, 0x4B, 0x9B, 0x8C, 0xF1, 0xC4, 0xF3, 0xB1, 0x76, 0x64, 0x34, 0xC2, 0xF1, 0xAC, 0x8F, 0xF5,
- 0x80, 0x22, 0x9F, 0x56, 0x61, 0x88, 0x26, 0x14, 0xFB, 0xE5, 0xFC, 0x30, 0xF3, 0x8A, 0x72, 0x6E,
- 0xF9, 0xD3, 0xCA, 0x01, 0xC4, 0x75, 0x88, 0x8B, 0xAB, 0x8B, 0x97, 0x37, 0x6F, 0x9A, 0x9D, 0x18,
- 0x55, 0x01, 0x18, 0x32, 0x9F, 0x16, 0x79, 0x09, 0xD7, 0x75, 0x7D, 0x32, 0x19, 0x37, 0xAD, 0x66,
- 0xF3, 0x9B, 0xF5, 0x93, 0x33, 0x2C, 0xDC, 0x14, 0x85, 0xD4, 0xDB, 0x3D, 0x22, 0xD6, 0xC2, 0x2A,
- 0xA3, 0xC7, 0xBF, 0xE6, 0xD8, 0x26, 0xC8, 0xA8, 0x29, 0xE1, 0x7C, 0xDE, 0x04, 0x9F, 0x3A, 0x36,
- 0x90, 0x6B, 0x1B, 0x35, 0xCF, 0x27, 0x10, 0x08, 0x88, 0xA7, 0x1B, 0x07, 0x7E, 0x81, 0xC2, 0xB1,
- 0xC0, 0xC7, 0x1A, 0x95, 0x0B, 0x62, 0x46, 0xB5, 0x88, 0x3E, 0x6C, 0xD8, 0xA7, 0x42, 0xCA, 0x61,
- 0x9F, 0xD2, 0x00, 0xD2, 0xE8, 0xC8, 0xD9, 0x17, 0xE1, 0xA5, 0x4A, 0x98, 0x87, 0x19, 0xFB, 0xCC,
- 0xD1, 0x55, 0xBD, 0x10, 0xBB, 0x68, 0x50, 0x84, 0x21, 0x94, 0x59, 0xAB, 0x06, 0x43, 0x97, 0x33,
- 0xA3, 0x6E, 0xB0, 0x2C, 0x79, 0xAC, 0xA7, 0x91, 0x4C, 0xF5, 0x90, 0xB3, 0x8F, 0xEA, 0x14, 0x1B,
- 0xA8, 0xAB, 0x57, 0x35, 0xC9, 0x1D, 0xE2, 0x8F, 0xCE, 0x87, 0x84, 0x26, 0xB9, 0x59, 0x84, 0x7D,
- 0xAA, 0x67, 0x92, 0x84, 0x59, 0x69, 0x36, 0xD1, 0x30, 0xCE, 0xCF, 0x28, 0x6B, 0x7C, 0xF3, 0xA2,
- 0x5B, 0xC3, 0xB5, 0x58, 0x84, 0xAA, 0xD9, 0x45, 0xC3, 0xB8, 0x48, 0x86, 0xD2, 0x2C, 0xC3, 0x3E,
- 0x37, 0x15, 0xFA, 0x8D, 0x7B, 0xE3, 0x90, 0x52, 0xCF, 0x0D, 0x76, 0x2A, 0x51, 0x79, 0x71, 0xF6,
- 0x57, 0x18, 0x50, 0x32, 0xB9, 0xAE, 0xCB, 0x90, 0x86, 0x38, 0x5B, 0x20, 0x68, 0x21, 0xC7, 0x98,
- 0xAE, 0x30, 0x2E, 0x6E, 0x37, 0x5C, 0xB4, 0x84, 0xBC, 0x33, 0x9D, 0x3A, 0x3A, 0xDF, 0xB3, 0x42,
- 0x3F, 0x60, 0x7D, 0xDB, 0xC2, 0x23, 0xC0, 0xD8, 0x5F, 0x9F, 0x38, 0x1D, 0x83, 0x15, 0x27, 0xAA,
- 0x5B, 0x63, 0xCD, 0x5C, 0x5E, 0x48, 0x99, 0x8D, 0xB5, 0x48, 0x78, 0xA0, 0x0E, 0xA1, 0xD7, 0xDA,
- 0x73, 0x32, 0x12, 0x35, 0x67, 0xA2, 0x10, 0x2C, 0x2C, 0x0B, 0x69, 0xB9, 0xFA, 0xD6, 0x0C, 0x5B,
- 0x1F, 0xB1, 0xFD, 0x6D, 0x69, 0x1B, 0x56, 0xD6, 0x1E, 0x36, 0x88, 0xBB, 0x08, 0x69, 0x9D, 0xB5,
- 0x53, 0x8B, 0x5B, 0xC1, 0x9C, 0x3B, 0x64, 0xA4, 0x62, 0xBB, 0x5D, 0xD4, 0x54, 0x9C, 0x2D, 0xAE,
- 0x8A, 0x8D, 0xA0, 0x0A, 0x3B, 0x72, 0xD0, 0x18, 0x3B, 0x45, 0x22, 0xCB, 0x60, 0xC8, 0x49, 0xBB,
- 0x32, 0x57, 0xE5, 0xF7, 0x6E, 0x5C, 0xB2, 0xA4, 0x78, 0x75, 0x1F, 0x7E, 0x53, 0xD9, 0x8E, 0xFC,
- 0xF8, 0x24, 0xF5, 0x53, 0x80, 0x1D, 0x08, 0xB0, 0xBC, 0xD6, 0x1B, 0xC6, 0xAC, 0x40, 0x86, 0xC2,
- 0x09, 0x7C, 0xE4, 0x4E, 0x31, 0xE4, 0x82, 0xAB, 0x93, 0xE8, 0xB0, 0x78, 0x61, 0x50, 0x49, 0x7D,
- 0x96, 0xAA, 0xCF, 0x8A, 0x17, 0x22, 0x22, 0x21, 0x6C, 0xD1, 0x8C, 0x28, 0xB0, 0x16, 0xCE, 0xDF,
- 0xD2, 0x3A, 0x85, 0xE8, 0x47, 0xB4, 0x01, 0x93, 0x76, 0x29, 0x6D, 0x7F, 0x5F, 0x9A, 0x11, 0xA2,
- 0x95, 0xDE, 0x64, 0x52, 0xB6, 0x56, 0x9C, 0x4C, 0x3A, 0xCD, 0x4E, 0xB7, 0xB4, 0x61, 0xD2, 0x6A,
- 0x99, 0x59, 0x2F, 0x6A, 0x32, 0x46, 0x9C, 0x4D, 0xCA, 0x21, 0xE8, 0xCF, 0xBC, 0x25, 0xF6, 0x35,
- 0x40, 0x64, 0xC4, 0xED, 0x3E, 0xEA, 0xDA, 0x15, 0xB8, 0x21, 0xC8, 0xF7, 0x4B, 0x5D, 0x36, 0x4D,
- 0xB3, 0x6B, 0xB7, 0xAC, 0x76, 0xA1, 0x63, 0x0A, 0x76, 0x0D, 0xF0, 0x06, 0x34, 0x76, 0xB0, 0x5D,
- 0x90, 0x9E, 0x6D, 0x3C, 0x41, 0xA1, 0x43, 0x4B, 0xEC, 0x8D, 0x9A, 0xEC, 0x4F, 0xD1, 0x8C, 0x3C,
- 0xAE, 0xFE, 0x60, 0x1B, 0x1D, 0x43, 0x1E, 0x09, 0x7F, 0x6A, 0xE6, 0x8C, 0x6A, 0x27, 0x5A, 0x2C,
- 0x30, 0x82, 0x51, 0x16, 0xCE, 0x5B, 0x92, 0x56, 0xEA, 0x99, 0xF5, 0x89, 0xAB, 0xD2, 0x42, 0xB4,
- 0xD4, 0x15, 0xE3, 0x6E, 0x68, 0x23, 0x9D, 0xFB, 0x13, 0xCF, 0x0A, 0x75, 0x65, 0xBA, 0x9A, 0x4B,
- 0xAD, 0xF3, 0xEB, 0x47, 0x26, 0x0B, 0x1C, 0xC2, 0x1D, 0x3B, 0x74, 0x5D, 0x86, 0x68, 0x9D, 0xFA,
- 0xA0, 0xA6, 0x66, 0xA2, 0x6A, 0x86, 0xDB, 0x2A, 0x3A, 0x53, 0x86, 0xCD, 0xDB, 0x8C, 0xC9, 0x04,
- 0xA0, 0x26, 0x51, 0xC4, 0x39, 0xC4, 0x08, 0x3C, 0x50, 0x2A, 0x62, 0xB5, 0x9B, 0x5D, 0xE8, 0x2C,
- 0x9C, 0xEB, 0x1A, 0x83, 0x68, 0xB2, 0x16, 0x54, 0x31, 0x31, 0x9D, 0x3F, 0x1D, 0xA3, 0x5A, 0xF3,
- 0xA4, 0x79, 0xD2, 0x81, 0xBF, 0x34, 0x0D, 0x7A, 0xB1, 0x73, 0x49, 0xF3, 0xE6, 0x78, 0x5E, 0x26,
- 0xF9, 0x94, 0xEF, 0x93, 0xE4, 0xA5, 0xB1, 0x52, 0x2C, 0xAA, 0x47, 0x52, 0x7A, 0xC3, 0xA4, 0xD5,
- 0x28, 0x29, 0x2C, 0x39, 0x2E, 0xBD, 0xB9, 0x23, 0x6A, 0xBC, 0x65, 0x53, 0x88, 0xE7, 0xDE, 0x3F,
- 0x75, 0x51, 0x55, 0xFF, 0xEF, 0xBD, 0x5D, 0x31, 0xC5, 0x57, 0xED, 0xE9, 0x1B, 0xDB, 0x25, 0x38,
- 0xB4, 0x6F, 0x34, 0xF3, 0x51, 0xAF, 0xCB, 0x7E, 0x06, 0x24, 0x74, 0x61, 0x51, 0xE5, 0xC3, 0xEA,
- 0x2A, 0xB7, 0xE7, 0x51, 0xC6, 0x6C, 0x61, 0x83, 0x09, 0x71, 0x9C, 0xBA, 0xE3, 0xAD, 0xCA, 0x3B,
- 0x91, 0x62, 0x4F, 0x5E, 0xF3, 0xD3, 0x72, 0x97, 0xDF, 0x56, 0xDA, 0x10, 0x32, 0xD7, 0xFF, 0x84,
- 0xB4, 0x5F, 0x77, 0xC0, 0x15, 0x86, 0xC6, 0x76, 0x85, 0x62, 0x0B, 0x7F, 0xDC, 0x6D, 0xA2, 0x4A,
- 0xAE, 0x24, 0x3A, 0xC1, 0xC2, 0xC5, 0x5C, 0xB0, 0x22, 0xD4, 0x9A, 0x6D, 0xB1, 0xA8, 0x5A, 0x78,
- 0x01, 0x11, 0xD7, 0x68, 0x7C, 0xEC, 0x20, 0xD6, 0xC1, 0x6F, 0xB5, 0xE4, 0x2E, 0x5D, 0x98, 0xA8,
- 0xE4, 0x55, 0x34, 0xE1, 0xA6, 0xFB, 0x72, 0xB6, 0x4B, 0x1A, 0xA2, 0x77, 0xC8, 0xCF, 0xD5, 0x7A,
- 0xB7, 0x2E, 0x69, 0xF7, 0xD3, 0x91, 0xA1, 0x1F, 0xB4, 0x41, 0x46, 0x8F, 0x92, 0xF6, 0xD4, 0xC7,
- 0xD7, 0x15, 0x94, 0x39, 0x91, 0xFF, 0xF6, 0xC5, 0x86, 0xE8, 0xF6, 0x6B, 0x7F, 0x5E, 0x00, 0xA4,
- 0x17, 0x35, 0xBA, 0x41, 0x85, 0xA9, 0xF3, 0xA7, 0xAC, 0xE2, 0x8F, 0xF1, 0x76, 0x9F, 0x69, 0x56,
- 0x48, 0x37, 0x05, 0x25, 0x54, 0xEF, 0xAA, 0x51, 0xF5, 0xD5, 0x9E, 0x74, 0xF0, 0x84, 0xE6, 0x5C,
- 0xCD, 0xE0, 0x7D, 0x6A, 0xA7, 0x38, 0xBB, 0xD5, 0x95, 0x7D, 0x82, 0xD2, 0xCC, 0x11, 0xEF, 0xCA,
- 0xE5, 0x7B, 0x9F, 0x96, 0x33, 0xCB, 0x9E, 0x1B, 0x33, 0xCF, 0x87, 0x24, 0x6A, 0x9F, 0x39, 0xCC,
- 0x30, 0x66, 0x2E, 0x4B, 0x3E, 0xC0, 0x83, 0x7F, 0xAF, 0xB5, 0x7B, 0xDA, 0x8B, 0x05, 0x05, 0x83,
- 0x8B, 0x44, 0xCB, 0xDD, 0xD6, 0x5A, 0x2F, 0x59, 0xB9, 0x0B, 0x64, 0x35, 0x17, 0x69, 0x81, 0x2A,
- 0x8E, 0xCA, 0xA2, 0x0C, 0xB3, 0xBE, 0x47, 0x53, 0xE8, 0xEC, 0x64, 0x8E, 0xA0, 0xED, 0x65, 0xEE,
- 0x8A, 0x80, 0xA3, 0x0E, 0xBF, 0x2A, 0xEE, 0xAE, 0x6C, 0x1A, 0xB6, 0x7A, 0xCD, 0x92, 0x29, 0x2D,
- 0xC7, 0x0B, 0x8A, 0xE3, 0x0A, 0x8D, 0xC1, 0x7E, 0x21, 0xD5, 0x4C, 0x24, 0xB7, 0x2E, 0xB5, 0x3B,
- 0x4F, 0xDC, 0xB9, 0xB5, 0x67, 0x2A, 0x95, 0xEE, 0xC2, 0x98, 0x2A, 0x0E, 0xC7, 0x8C, 0xCD, 0x5B,
- 0x4D, 0x6D, 0xA6, 0x2D, 0xDC, 0x7F, 0xA3, 0xF8, 0x0A, 0xD6, 0x9B, 0xEC, 0x82, 0x5C, 0xDF, 0xB0,
- 0xB0, 0x3E, 0x8D, 0xA6, 0x8A, 0x5C, 0xAB, 0xCA, 0x26, 0x60, 0x21, 0x0E, 0x33, 0x62, 0xDB, 0xB8,
- 0x70, 0x97, 0x93, 0xAD, 0x79, 0x2B, 0x36, 0x0F, 0x4C, 0x7E, 0xDD, 0xA6, 0xD4, 0xAD, 0x04, 0x45,
- 0xE1, 0x75, 0xFA, 0xD6, 0x6D, 0x47, 0x8C, 0x2C, 0x34, 0x79, 0x7B, 0xC4, 0xE9, 0x56, 0xA4, 0x50,
- 0x54, 0x6D, 0x70, 0xC7, 0xDB, 0xC4, 0xCC, 0x64, 0x60, 0x07, 0x36, 0x6A, 0x3D, 0x9B, 0x2B, 0x52,
- 0x0D, 0x4E, 0x95, 0x7B, 0x89, 0x06, 0xA7, 0xC9, 0x6D, 0x4F, 0x03, 0x76, 0x43, 0x91, 0x7A, 0xCB,
- 0x91, 0xB8, 0xDE, 0x65, 0x58, 0x0E, 0x0A, 0x82, 0xA1, 0xC9, 0x6E, 0x8C, 0x31, 0xD3, 0x77, 0x20,
- 0x0D, 0x6C, 0xB2, 0x34, 0x88, 0x3D, 0x34, 0x1D, 0x6F, 0xEA, 0x65, 0xCE, 0xF1, 0xF3, 0xE2, 0x0A,
- 0x04, 0x24, 0xCD, 0xA1, 0x99, 0xBA, 0x3A, 0x63, 0x72, 0xAA, 0xE4, 0x27, 0x73, 0xF4, 0xE0, 0xDE,
- 0xA3, 0x87, 0x0F, 0x7B, 0xDF, 0x3D, 0x70, 0xC7, 0xC1, 0x42, 0xFE, 0xFD, 0x8B, 0xB8, 0x98, 0x25,
- 0xEE, 0x88, 0x82, 0x3C, 0x4A, 0x29, 0xE8, 0x19, 0x0C, 0x4E, 0x39, 0xD3, 0x8C, 0x20, 0xA7, 0x20,
- 0x49, 0x8E, 0x6C, 0xB2, 0xB6, 0xEA, 0xC4, 0x8B, 0x86, 0x04, 0x50, 0x2E, 0xC6, 0xC8, 0xD7, 0x0C,
- 0xE1, 0xC3, 0x44, 0xE7, 0xC6, 0xFD, 0xD6, 0xE4, 0x35, 0x66, 0xEC, 0x5D, 0x65, 0x35, 0xE0, 0x4A,
- 0xC9, 0x02, 0x24, 0x47, 0x61, 0x3B, 0x8F, 0x21, 0x90, 0x71, 0x72, 0x76, 0x69, 0x2A, 0x67, 0x4C,
- 0x2C, 0x9F, 0xB4, 0xBE, 0x72, 0xA5, 0x44, 0x4C, 0x3D, 0xF1, 0xD1, 0x1C, 0x33, 0xF7, 0x97, 0x3F,
- 0xE6, 0xB3, 0xC9, 0x22, 0x11, 0x53, 0x9A, 0xA3, 0x37, 0x98, 0x67, 0x4E, 0x40, 0x59, 0x6B, 0xD6,
- 0x35, 0x2E, 0xB2, 0x98, 0xA5, 0xE6, 0x37, 0x23, 0x11, 0xE5, 0xE6, 0x75, 0x1D, 0x71, 0xB7, 0x29,
- 0x11, 0x88, 0xB3, 0xF3, 0x16, 0xDC, 0xC1, 0x96, 0xC8, 0x09, 0xC1, 0xB4, 0xAD, 0x96, 0x39, 0xFA,
- 0xF9, 0xF7, 0xEF, 0x9F, 0xD4, 0xDA, 0xCD, 0xEE, 0xF9, 0x55, 0xEB, 0xAC, 0xD7, 0x3D, 0x1E, 0x9C,
- 0x8A, 0x21, 0x9B, 0xF3, 0x6A, 0x9A, 0xA3, 0x5F, 0x19, 0x2F, 0xA8, 0x2F, 0xCD, 0xAB, 0x56, 0xBB,
- 0xD9, 0xDC, 0x9E, 0xD7, 0x23, 0x73, 0xF4, 0x96, 0xB3, 0x6A, 0x9F, 0x03, 0xAB, 0x66, 0x7B, 0x07,
- 0xB1, 0xCE, 0xCD, 0x11, 0xE7, 0x04, 0x4C, 0xAE, 0x1E, 0xF6, 0xCE, 0xB7, 0x67, 0xF4, 0x10, 0x64,
- 0x7A, 0x07, 0x9C, 0xCE, 0x41, 0xBB, 0xDE, 0x2E, 0xCA, 0xF5, 0xCC, 0x11, 0xE3, 0xD3, 0xEB, 0x36,
- 0xAF, 0xBA, 0xE7, 0x3B, 0xF0, 0x39, 0x33, 0x65, 0xA7, 0xC3, 0xDC, 0x3F, 0x3A, 0x32, 0x47, 0x17,
- 0x3F, 0x3C, 0xAF, 0x75, 0x41, 0xC6, 0xF6, 0xA3, 0xDE, 0xF6, 0xBC, 0xBB, 0xE0, 0x17, 0x4C, 0xC8,
- 0x4E, 0x1B, 0x18, 0x75, 0x77, 0x10, 0xB2, 0x63, 0x8E, 0x5E, 0x70, 0x4E, 0xC0, 0xE5, 0xAA, 0xF5,
- 0x70, 0x07, 0x91, 0xC0, 0xBD, 0x7E, 0xE6, 0x9C, 0xC0, 0xBF, 0x98, 0x7B, 0x55, 0xE4, 0x04, 0xB9,
- 0x97, 0x9B, 0xA6, 0x20, 0xE6, 0xD7, 0x33, 0x59, 0xEA, 0x74, 0x51, 0x4A, 0xF8, 0x3B, 0x84, 0x8E,
- 0x80, 0x5E, 0x6F, 0x9C, 0x10, 0x24, 0x1D, 0xA8, 0x24, 0x0E, 0xAA, 0xE5, 0x02, 0x45, 0x92, 0xF8,
- 0x6A, 0xAB, 0x39, 0xEA, 0x96, 0x28, 0xC0, 0x49, 0xD5, 0x84, 0xCA, 0x69, 0x53, 0xF2, 0x9B, 0xAC,
- 0x3F, 0x64, 0xA8, 0xB3, 0xFB, 0x79, 0xC0, 0x43, 0x3B, 0xA6, 0x12, 0xD5, 0x5B, 0x25, 0x1B, 0x8D,
- 0xAC, 0xE8, 0xCA, 0x1C, 0xF5, 0x3A, 0x65, 0xD6, 0xDE, 0x01, 0x8C, 0x31, 0xEF, 0x3D, 0x5D, 0x1C,
- 0x04, 0x1B, 0xE3, 0x91, 0x90, 0x9A, 0xA3, 0xA7, 0xF1, 0xF1, 0x2E, 0xA8, 0xD4, 0xCB, 0x34, 0xE5,
- 0xB4, 0x39, 0xB0, 0x28, 0xE2, 0x08, 0x64, 0xEA, 0x1D, 0x09, 0x4D, 0x82, 0xCC, 0xE7, 0x05, 0xE6,
- 0x36, 0x71, 0x61, 0xED, 0x80, 0x8F, 0x02, 0xBA, 0x31, 0x2A, 0x11, 0x21, 0x24, 0x35, 0x79, 0x74,
- 0x30, 0x44, 0x62, 0x51, 0xBE, 0x02, 0x3C, 0x02, 0x44, 0x43, 0x9F, 0xDF, 0xE5, 0xB8, 0x31, 0x22,
- 0x09, 0x29, 0x54, 0xC3, 0xF8, 0x78, 0x27, 0x54, 0x76, 0x49, 0x5F, 0x8A, 0x38, 0x12, 0x97, 0x28,
- 0x85, 0x75, 0x6F, 0x09, 0x97, 0x32, 0x69, 0x77, 0xC2, 0x65, 0x86, 0xFC, 0xC5, 0x56, 0xE9, 0x2B,
- 0xA6, 0x04, 0x54, 0xA2, 0xC3, 0x83, 0x85, 0x4A, 0x22, 0xCC, 0x57, 0x10, 0x2B, 0xB0, 0xFE, 0xF6,
- 0x48, 0xB0, 0x79, 0xC7, 0x2F, 0xE9, 0xCC, 0xD1, 0x33, 0x5C, 0x7F, 0xCD, 0x8E, 0x76, 0x81, 0xE3,
- 0x49, 0x48, 0xBD, 0x1D, 0x00, 0x89, 0x64, 0x11, 0x70, 0x34, 0x25, 0x1A, 0xE7, 0xB7, 0x84, 0xC6,
- 0xF9, 0x2D, 0xA2, 0x81, 0xF0, 0x7B, 0x07, 0x2F, 0xB1, 0xB3, 0x31, 0x1C, 0x11, 0xA1, 0x39, 0xBA,
- 0xBC, 0x5A, 0x78, 0x01, 0xBB, 0x5B, 0xF8, 0x25, 0xFB, 0xBE, 0x53, 0x90, 0x9C, 0xED, 0x80, 0x49,
- 0x2C, 0x90, 0x8C, 0x91, 0x33, 0x89, 0xCA, 0xD9, 0x2D, 0xA1, 0x52, 0x26, 0xEB, 0x2E, 0xA8, 0x4C,
- 0x11, 0x71, 0x2D, 0x4C, 0x1C, 0x76, 0xE7, 0xE2, 0xA6, 0xC0, 0x28, 0xB4, 0xE6, 0xE8, 0xFB, 0xE4,
- 0xCB, 0x2E, 0xC0, 0x34, 0x77, 0xC0, 0x45, 0x95, 0x27, 0x1D, 0x2F, 0x67, 0xB0, 0x58, 0xBE, 0x25,
- 0x6C, 0x5A, 0xAD, 0xDB, 0xAC, 0x2A, 0x0B, 0x6C, 0x11, 0xE4, 0xBC, 0xC7, 0x93, 0x09, 0x2C, 0x83,
- 0x36, 0x2F, 0x2D, 0x29, 0x72, 0xA8, 0x2F, 0xE2, 0xBB, 0x71, 0xC9, 0xBF, 0x6F, 0xBC, 0x87, 0x91,
- 0x61, 0xF7, 0xB9, 0x36, 0x32, 0x9A, 0xFA, 0xB5, 0xF0, 0x6B, 0x2F, 0x96, 0x73, 0xDB, 0x5D, 0x0D,
- 0x60, 0x82, 0xA7, 0x7C, 0x53, 0x7D, 0x6B, 0x1E, 0x6D, 0xF0, 0x6C, 0x1F, 0x5D, 0xF3, 0xC7, 0x10,
- 0x77, 0x59, 0x48, 0xBF, 0xC1, 0xB6, 0xF1, 0x0B, 0x71, 0xB7, 0x57, 0xA6, 0xCB, 0x04, 0xC1, 0xD8,
- 0xDD, 0x8D, 0xCB, 0x19, 0x2C, 0x91, 0xE0, 0x60, 0x37, 0x26, 0x3D, 0xF0, 0x24, 0xBC, 0x20, 0xE8,
- 0x4B, 0x58, 0xC4, 0xA3, 0xD5, 0x78, 0xF3, 0x82, 0xB2, 0x1A, 0x43, 0x5D, 0xFE, 0xED, 0xA9, 0x71,
- 0xC9, 0x6F, 0x03, 0xDB, 0x38, 0x5D, 0x89, 0x2B, 0xD4, 0x55, 0x1C, 0x5D, 0x24, 0x2A, 0x29, 0xA7,
- 0xB9, 0xB6, 0x27, 0xAA, 0x0F, 0xA0, 0xAA, 0xFB, 0xA2, 0x1A, 0xF5, 0x22, 0x01, 0xF9, 0x05, 0x3D,
- 0x53, 0xD1, 0xB6, 0x9A, 0x8E, 0xB7, 0xD8, 0x8A, 0x59, 0xAB, 0xCD, 0xDB, 0x30, 0x6B, 0x05, 0x30,
- 0xD9, 0x4B, 0x76, 0x87, 0xA0, 0x6D, 0x00, 0x5E, 0x7B, 0x01, 0x8A, 0xCD, 0x7A, 0x18, 0xA0, 0xB8,
- 0xBE, 0x87, 0x06, 0x0A, 0xBC, 0xE5, 0x3D, 0xAB, 0xA3, 0xDB, 0x04, 0x15, 0x27, 0x34, 0x47, 0xAF,
- 0x90, 0x1B, 0x42, 0x91, 0xD9, 0x17, 0x60, 0xF1, 0xC4, 0x07, 0x0B, 0x2F, 0xA9, 0xF7, 0xA1, 0xA1,
- 0x03, 0x41, 0xE6, 0x9E, 0xBD, 0xF9, 0x72, 0x47, 0xD2, 0x89, 0x94, 0xF8, 0x0A, 0x8E, 0x36, 0x6E,
- 0x0C, 0x22, 0x0E, 0xB7, 0xDC, 0x11, 0x88, 0xA5, 0xD4, 0xF6, 0xCD, 0xC0, 0xDB, 0xD0, 0x75, 0xAF,
- 0x77, 0xE9, 0x04, 0x2E, 0x1C, 0x2F, 0xB4, 0xB7, 0xE7, 0x00, 0x6D, 0xC0, 0x8F, 0x93, 0x09, 0xB1,
- 0xB6, 0x6F, 0x24, 0xA0, 0x09, 0x78, 0xE1, 0xCD, 0x2B, 0xD2, 0xDF, 0x72, 0xE1, 0xC5, 0xD6, 0x16,
- 0x2B, 0x39, 0x0B, 0x50, 0xBC, 0xBC, 0xD8, 0x6B, 0xE1, 0x85, 0x39, 0x0F, 0x94, 0x19, 0x98, 0xB6,
- 0x87, 0x4E, 0x0A, 0x20, 0xC4, 0x7B, 0xEE, 0x3C, 0xDB, 0x80, 0x25, 0x28, 0xE3, 0x8C, 0x1E, 0x2D,
- 0xBF, 0x0F, 0xB5, 0xBE, 0x4B, 0x24, 0x4A, 0xAF, 0xEE, 0x5A, 0x67, 0x9D, 0x5E, 0xBC, 0xBC, 0xEB,
- 0xB4, 0x3F, 0xEF, 0x02, 0x8F, 0x31, 0xBF, 0x5D, 0x7C, 0xDA, 0xDB, 0x40, 0x03, 0xD9, 0xE8, 0x35,
- 0xBB, 0xCE, 0xB0, 0x41, 0xC2, 0xDE, 0x3D, 0x90, 0xDA, 0x87, 0x8B, 0xA4, 0xF6, 0x17, 0x10, 0x4A,
- 0xD3, 0x2D, 0x32, 0xDE, 0x94, 0x65, 0xBC, 0xEF, 0x2F, 0xF6, 0x83, 0xD0, 0xF4, 0x60, 0xA9, 0x6E,
- 0x7A, 0xD0, 0x54, 0x67, 0x88, 0x9B, 0xAD, 0x62, 0x98, 0xB6, 0xEC, 0x60, 0x25, 0xA1, 0xD8, 0xCB,
- 0xDA, 0x25, 0xC9, 0xB5, 0xAE, 0x76, 0xC9, 0x72, 0x91, 0x18, 0xE9, 0x24, 0xD7, 0x4B, 0xAE, 0x8A,
- 0x9C, 0x7D, 0xDE, 0xCB, 0xBA, 0xDD, 0x32, 0x69, 0x77, 0x09, 0x1A, 0x1F, 0xAD, 0xDE, 0x4F, 0xE7,
- 0x68, 0x63, 0x30, 0x24, 0x1D, 0x60, 0xF1, 0xEA, 0xC9, 0x3E, 0xDB, 0x85, 0x68, 0xDE, 0xC3, 0xC4,
- 0x51, 0xAC, 0xF5, 0xA1, 0x73, 0x9D, 0x83, 0xDD, 0xCD, 0x93, 0x1D, 0x23, 0x32, 0x47, 0x2F, 0xB1,
- 0x1B, 0x18, 0x17, 0x9E, 0x2F, 0xDF, 0xFD, 0xB4, 0x17, 0xD4, 0xF8, 0xCC, 0x87, 0x81, 0x4C, 0x28,
- 0x7D, 0x68, 0xBC, 0x66, 0x73, 0xE2, 0xFB, 0x9E, 0xBF, 0x31, 0x64, 0x92, 0x0E, 0x96, 0x15, 0xF5,
- 0x57, 0xFC, 0x68, 0x2F, 0x70, 0x45, 0xB3, 0x1E, 0x06, 0xB1, 0x58, 0xE7, 0x43, 0x83, 0xB6, 0x9C,
- 0x38, 0x64, 0xB1, 0x31, 0x64, 0x9C, 0xCA, 0x1C, 0xBD, 0xAB, 0x3F, 0x87, 0x7F, 0xF7, 0x02, 0x97,
- 0x98, 0xF1, 0x30, 0x60, 0x49, 0x6D, 0x0F, 0x0D, 0xD5, 0x78, 0xB1, 0x79, 0x3A, 0x04, 0x1A, 0x73,
- 0xF4, 0xF4, 0xA7, 0xFD, 0xF4, 0x7E, 0x6C, 0xB2, 0x8A, 0x08, 0xED, 0x84, 0x07, 0x57, 0xEA, 0xD0,
- 0x68, 0xAC, 0xB6, 0x40, 0x63, 0xC5, 0x04, 0xFF, 0x6D, 0x4F, 0x68, 0xAC, 0xAA, 0xA3, 0xF1, 0x99,
- 0xE3, 0x65, 0xF5, 0x25, 0xE0, 0xC3, 0x9F, 0xC5, 0x18, 0xA3, 0xCD, 0xCB, 0x51, 0x44, 0xC8, 0x6E,
- 0x1A, 0x83, 0x23, 0xE3, 0x29, 0xDA, 0x4F, 0x41, 0x8A, 0xE7, 0xDD, 0x47, 0x08, 0x25, 0x4A, 0x1E,
- 0x1A, 0xA7, 0x09, 0xB2, 0xF0, 0x7B, 0x1B, 0xD3, 0x6D, 0xAE, 0x2D, 0x2B, 0xB4, 0xE6, 0xE8, 0x39,
- 0x7C, 0x31, 0x9E, 0xF1, 0x2F, 0xFB, 0x6A, 0xF9, 0xD4, 0xF9, 0xF7, 0x81, 0x5A, 0x4A, 0xDF, 0x2F,
- 0x02, 0x38, 0x68, 0xB0, 0xBD, 0xA9, 0xBB, 0xD5, 0x23, 0x0D, 0x29, 0x72, 0x09, 0xDF, 0x1B, 0xF1,
- 0x7D, 0xBF, 0x00, 0x26, 0x42, 0xEC, 0x0D, 0x43, 0x45, 0xEF, 0x7D, 0xC0, 0x18, 0x3D, 0x16, 0xC4,
- 0x8B, 0xB4, 0x78, 0x15, 0x5E, 0x19, 0x52, 0xF2, 0xE1, 0x27, 0x7E, 0x4B, 0x0B, 0xA6, 0xF5, 0x80,
- 0x12, 0xC7, 0x81, 0x85, 0x30, 0xA6, 0xC6, 0x5B, 0x76, 0x38, 0x38, 0x15, 0x03, 0xAA, 0x73, 0x91,
- 0xCF, 0xDC, 0xB0, 0x97, 0x50, 0xA2, 0xB9, 0x39, 0x7A, 0xCB, 0x5E, 0x12, 0x08, 0xBC, 0xD8, 0xB7,
- 0xCD, 0x99, 0x71, 0x23, 0x62, 0xD7, 0xF7, 0x40, 0xA8, 0x18, 0x24, 0xF9, 0xAE, 0x26, 0xD3, 0x88,
- 0x8E, 0x94, 0xDF, 0x46, 0x97, 0x7C, 0xB0, 0xC1, 0xBC, 0xAC, 0x7C, 0x3A, 0x76, 0xD5, 0xC2, 0xCA,
- 0xBF, 0xB8, 0x31, 0x38, 0x75, 0x91, 0xC6, 0xDC, 0x39, 0x28, 0x0C, 0xC4, 0xDB, 0x25, 0x73, 0x58,
- 0xC5, 0xCF, 0x33, 0x71, 0x4B, 0x24, 0x8F, 0x69, 0xC6, 0x6A, 0x65, 0x1F, 0xDF, 0x94, 0xDB, 0x4C,
- 0xD5, 0x82, 0x96, 0x3F, 0x88, 0x29, 0xEB, 0x21, 0x3B, 0x8C, 0xCD, 0xFF, 0x9F, 0x7F, 0x97, 0xF9,
- 0x0C, 0x7B, 0xF7, 0x67, 0x22, 0x98, 0x69, 0x04, 0xBE, 0x35, 0x34, 0xF3, 0x9E, 0x8E, 0xCA, 0xD1,
- 0xFC, 0x54, 0xA7, 0x7A, 0x66, 0xB0, 0xC6, 0xD6, 0x83, 0xC0, 0xF2, 0xC9, 0x82, 0x8E, 0xEE, 0xD8,
- 0x9E, 0x15, 0xCE, 0xB1, 0x4B, 0x1B, 0xC8, 0xB6, 0x2F, 0x97, 0x70, 0xF0, 0x92, 0x04, 0x14, 0x83,
- 0x15, 0x6A, 0x47, 0xCF, 0x7E, 0x7C, 0x75, 0x21, 0x9E, 0x12, 0x7B, 0xE9, 0x21, 0x1B, 0xDB, 0x47,
- 0x27, 0xC6, 0x24, 0x74, 0x85, 0x9B, 0xD7, 0x30, 0x1B, 0x2B, 0xDE, 0xBB, 0xBA, 0x44, 0xBE, 0x31,
- 0x46, 0x01, 0x7E, 0xE1, 0x05, 0xD4, 0x18, 0x1A, 0x31, 0x47, 0xC7, 0xB3, 0xF8, 0x7D, 0xBF, 0x0D,
- 0xCF, 0x27, 0x53, 0xE2, 0xCA, 0x91, 0x42, 0xD9, 0x5F, 0x7D, 0x07, 0x86, 0xC6, 0x54, 0xDF, 0x1A,
- 0x47, 0xFD, 0xF3, 0xD6, 0x11, 0x7B, 0x1C, 0x0F, 0x60, 0x80, 0x1F, 0x00, 0x02, 0x0C, 0x03, 0x20,
- 0xC0, 0x87, 0x23, 0xF9, 0x78, 0x20, 0x76, 0x1A, 0xDC, 0xE4, 0x4C, 0x40, 0x26, 0x6D, 0xED, 0x48,
- 0xE0, 0x74, 0xC4, 0x1E, 0x34, 0xBE, 0x89, 0x29, 0x83, 0x99, 0xB7, 0x2A, 0xA2, 0xF4, 0xF1, 0xDC,
- 0x5B, 0xE2, 0x0C, 0x71, 0x4C, 0x2D, 0xBD, 0xB9, 0x74, 0xEA, 0xC8, 0xEB, 0x8F, 0x8E, 0xA3, 0x01,
- 0xF1, 0x7B, 0xCC, 0x86, 0x06, 0xF5, 0x43, 0x9C, 0x66, 0x8B, 0xDD, 0x32, 0xAE, 0x91, 0x58, 0x85,
- 0x8C, 0x27, 0xC8, 0x09, 0x32, 0x9C, 0xC3, 0x85, 0x8D, 0x28, 0x7E, 0xC7, 0x76, 0x0C, 0x61, 0x40,
- 0x0D, 0x3B, 0x27, 0x62, 0xFB, 0xF0, 0x44, 0x9E, 0x79, 0x03, 0x7C, 0x29, 0x3E, 0x4E, 0x66, 0x55,
- 0x7F, 0x06, 0x8A, 0xF4, 0xD7, 0xA1, 0xE1, 0x86, 0x10, 0xC2, 0x8F, 0xB9, 0x0A, 0x46, 0x3F, 0x75,
- 0x96, 0x53, 0x3B, 0x90, 0x9D, 0xE4, 0x3B, 0xDB, 0xF9, 0x9C, 0xFC, 0x47, 0x32, 0x61, 0x13, 0x37,
- 0xF8, 0x1B, 0xE4, 0x87, 0xC0, 0xE3, 0x28, 0xCA, 0xEE, 0x47, 0xC9, 0x8B, 0x79, 0x55, 0x22, 0x6E,
- 0x87, 0x86, 0xEC, 0x83, 0xE5, 0xF9, 0xA5, 0x3C, 0x71, 0xF7, 0xEE, 0x32, 0xE6, 0x6B, 0x28, 0xC3,
- 0xE0, 0x54, 0x72, 0xE2, 0x06, 0x4E, 0x28, 0x4F, 0x3F, 0xAF, 0xF3, 0xCE, 0xF0, 0x88, 0x98, 0x2B,
- 0x1C, 0xEE, 0xC4, 0x92, 0xA7, 0x2C, 0xF0, 0xE0, 0x41, 0x9A, 0xDB, 0xDD, 0xA1, 0xA4, 0x4A, 0x34,
- 0x11, 0xE3, 0x21, 0x32, 0x20, 0xF2, 0x40, 0x6D, 0xF9, 0x4C, 0xBC, 0x14, 0x89, 0x4C, 0x6A, 0x77,
- 0x53, 0x86, 0x8F, 0x65, 0x9C, 0x30, 0x13, 0x11, 0x9B, 0x1B, 0x88, 0x5F, 0x33, 0x3C, 0x4E, 0x9E,
- 0x7A, 0x15, 0xF2, 0x3D, 0xE6, 0x5E, 0x5F, 0xC3, 0xF2, 0xF2, 0xDB, 0x31, 0xD8, 0x9F, 0x39, 0x73,
- 0xF2, 0x83, 0x1C, 0x9F, 0x4C, 0xA5, 0x72, 0x9C, 0xA6, 0x38, 0x32, 0xC5, 0x32, 0x72, 0xB3, 0x0F,
- 0x9F, 0x00, 0x86, 0xB2, 0x9D, 0xEF, 0xE4, 0xF9, 0xFC, 0x8C, 0x39, 0xD9, 0x87, 0x4F, 0xBC, 0x3E,
- 0xB0, 0x50, 0x82, 0xE8, 0x0E, 0x09, 0x8D, 0x62, 0x9C, 0xDD, 0x6A, 0xCC, 0x54, 0xE2, 0x22, 0xC0,
- 0x61, 0x11, 0xAB, 0x4C, 0x01, 0xD7, 0x30, 0x14, 0x01, 0x55, 0x13, 0xF5, 0xE9, 0x29, 0xAF, 0x35,
- 0x8C, 0xB9, 0x8C, 0x95, 0xF4, 0xEF, 0x77, 0x54, 0xE1, 0x6F, 0xA2, 0xF0, 0x89, 0x53, 0x99, 0x8A,
- 0x27, 0xF3, 0xE3, 0xC8, 0x62, 0xCC, 0xD5, 0x13, 0x87, 0x91, 0xAF, 0x2B, 0x89, 0xFC, 0x3C, 0x31,
- 0xAB, 0x05, 0x39, 0x4C, 0xF1, 0xF8, 0x7E, 0x46, 0x54, 0xD5, 0xD5, 0x41, 0xEE, 0x96, 0xA1, 0xBE,
- 0x80, 0x64, 0x0C, 0xA9, 0xF0, 0x63, 0x8A, 0x0F, 0xDF, 0xB0, 0x8F, 0x99, 0x88, 0xDF, 0xC4, 0xE5,
- 0xFD, 0xBA, 0xE7, 0x62, 0x3D, 0x77, 0xD5, 0xD9, 0x75, 0x3C, 0x45, 0x29, 0xCE, 0x32, 0x0D, 0xC7,
- 0x73, 0x42, 0x35, 0x0C, 0x8F, 0x20, 0x0D, 0xEB, 0x78, 0xC9, 0x06, 0x2D, 0x21, 0xF0, 0x31, 0x0D,
- 0x7D, 0x57, 0x8D, 0x26, 0x91, 0x91, 0xFE, 0x0E, 0xB1, 0x7F, 0x0D, 0x8C, 0x3E, 0xDC, 0xFF, 0x14,
- 0xE5, 0xF7, 0x9B, 0x53, 0xFE, 0x6C, 0x8E, 0xE7, 0x3C, 0x86, 0x0A, 0x30, 0xBC, 0xFF, 0x89, 0x43,
- 0x7D, 0xF3, 0x00, 0xA6, 0x84, 0x2F, 0x7C, 0xE2, 0x9B, 0x0F, 0x82, 0xC5, 0x84, 0xBD, 0x3E, 0xBB,
- 0xC6, 0x59, 0x44, 0xB8, 0x35, 0xE8, 0x0C, 0xBB, 0x35, 0x1F, 0x07, 0x0B, 0x60, 0x8F, 0x93, 0x44,
- 0x16, 0xCD, 0xE8, 0x39, 0x18, 0x4A, 0xCD, 0xB4, 0xF6, 0xC1, 0xC7, 0x40, 0x07, 0x02, 0x50, 0xCF,
- 0xB8, 0xFF, 0x89, 0xB3, 0xB8, 0x31, 0x26, 0x10, 0xCD, 0xC1, 0x0C, 0xDB, 0x27, 0x50, 0x77, 0x10,
- 0x65, 0x4F, 0xA6, 0xDF, 0xFF, 0x14, 0xB1, 0x6A, 0x88, 0x9F, 0x6E, 0x3E, 0xC4, 0x1E, 0x12, 0x17,
- 0x83, 0xA8, 0x86, 0xF1, 0x13, 0x0D, 0xCE, 0xEB, 0x2D, 0x47, 0xC1, 0xF3, 0x9F, 0x38, 0x4E, 0xED,
- 0x48, 0xBC, 0x7E, 0x41, 0xE6, 0xE8, 0x06, 0x34, 0x9D, 0x97, 0x08, 0xC4, 0x56, 0x93, 0x3B, 0xCF,
- 0x3B, 0x9E, 0x6B, 0x39, 0xC4, 0xFA, 0xC8, 0x12, 0xF3, 0x71, 0x5A, 0x70, 0x11, 0xE9, 0x4E, 0x43,
- 0xBC, 0x4E, 0xEB, 0xB5, 0x67, 0xE3, 0x8C, 0x9B, 0x1E, 0x33, 0x31, 0x4E, 0x4F, 0xC1, 0xCA, 0xC8,
- 0x8E, 0x52, 0x92, 0xC0, 0x88, 0xBD, 0x77, 0x45, 0x98, 0x29, 0x65, 0x61, 0xA1, 0x8C, 0xD4, 0x45,
- 0xD8, 0x2C, 0xA9, 0xD6, 0x91, 0xCA, 0x89, 0xDB, 0x0A, 0xF4, 0x8C, 0xD8, 0x16, 0x7F, 0x05, 0x9E,
- 0x5B, 0x3B, 0xBE, 0x13, 0x9B, 0x61, 0x9D, 0x07, 0x9B, 0x40, 0x61, 0x90, 0x32, 0x51, 0x9E, 0x99,
- 0xD2, 0x5D, 0xFD, 0x51, 0x92, 0x49, 0x72, 0x6C, 0x26, 0x3E, 0x4A, 0x4D, 0xE3, 0x05, 0x8D, 0xCF,
- 0xFC, 0x07, 0x77, 0x9A, 0x3F, 0x4F, 0x44, 0x11, 0x54, 0x72, 0xD2, 0xB1, 0x62, 0x30, 0xE1, 0x81,
- 0xEC, 0xBF, 0x1E, 0x51, 0x1B, 0x11, 0xE8, 0xAE, 0x2F, 0x1D, 0xCC, 0x0E, 0x9F, 0x5E, 0xFF, 0x00,
- 0xC5, 0x5B, 0xB4, 0x20, 0x5C, 0x9A, 0x84, 0xE0, 0x22, 0x6E, 0xFF, 0x4A, 0x29, 0x93, 0x56, 0x51,
- 0xE1, 0xC1, 0xDB, 0x77, 0x91, 0x71, 0x8A, 0x38, 0xC4, 0x9D, 0x7E, 0x8A, 0x94, 0x71, 0x2D, 0xA7,
- 0x4D, 0xF5, 0xF7, 0x0A, 0xBD, 0x9A, 0xED, 0x8A, 0xE8, 0x95, 0x96, 0x5E, 0xA1, 0xE6, 0xAE, 0x5C,
- 0x4E, 0xAC, 0x36, 0xB7, 0x47, 0x8A, 0xB1, 0x03, 0xEA, 0x2D, 0xC4, 0x1A, 0x23, 0xE3, 0xE6, 0x2B,
- 0xE2, 0xDA, 0xDE, 0xAA, 0xC1, 0xCE, 0xD7, 0x64, 0x91, 0x54, 0x15, 0x6D, 0x10, 0x17, 0x0C, 0xF8,
- 0xE2, 0x97, 0x57, 0x2F, 0x59, 0xD2, 0x51, 0xD7, 0x2A, 0x47, 0xE9, 0x0E, 0x87, 0xBF, 0xEB, 0x5C,
- 0x3B, 0x03, 0x83, 0xAD, 0x01, 0x4D, 0xB3, 0x48, 0x36, 0x71, 0x63, 0xC9, 0x62, 0x81, 0x1D, 0x7E,
- 0x10, 0x73, 0xB2, 0xD2, 0x93, 0x02, 0xF8, 0xB8, 0x54, 0x16, 0x6F, 0x91, 0x15, 0x05, 0x22, 0xF1,
- 0x09, 0xA5, 0xE0, 0xB0, 0x86, 0x70, 0xE5, 0x80, 0x65, 0x19, 0xB9, 0xCE, 0xBB, 0x63, 0xA8, 0xE0,
- 0xE7, 0x04, 0x7D, 0x62, 0x26, 0x19, 0x65, 0x69, 0xE1, 0x95, 0x4C, 0x89, 0x16, 0x10, 0x99, 0xF8,
- 0xF1, 0x7B, 0x6B, 0x0C, 0xC9, 0xF1, 0x19, 0x78, 0x7E, 0xC3, 0x05, 0x0D, 0x8E, 0x6F, 0x8A, 0xD4,
- 0x11, 0xE6, 0x4A, 0x80, 0xAC, 0x2A, 0x04, 0x4F, 0x43, 0x7A, 0x6E, 0x29, 0xFB, 0xE8, 0xD9, 0xA9,
- 0xDE, 0x2B, 0xAE, 0xDD, 0xB2, 0x36, 0x2D, 0xCF, 0xB0, 0xC3, 0x75, 0xD3, 0x8A, 0x3E, 0x25, 0xC5,
- 0x20, 0x49, 0x30, 0x6B, 0xC2, 0x66, 0xDA, 0x14, 0xC5, 0x2F, 0xA2, 0x01, 0x91, 0xEC, 0x6A, 0x40,
- 0xE4, 0xC8, 0x9E, 0xEE, 0xE2, 0x32, 0xED, 0x42, 0x06, 0x72, 0x99, 0xC5, 0x0C, 0xF6, 0xD6, 0x8F,
- 0x19, 0x2B, 0xD0, 0xD2, 0x09, 0xAA, 0x14, 0x0A, 0x6D, 0x06, 0x2C, 0xAC, 0x18, 0x62, 0x86, 0x48,
- 0xDA, 0x6C, 0xB7, 0x99, 0xAE, 0x0E, 0x17, 0x21, 0x58, 0x69, 0x1E, 0xF9, 0xA4, 0xF8, 0x8D, 0xB5,
- 0x6C, 0x71, 0xF0, 0x40, 0x0B, 0x57, 0x14, 0xD4, 0x70, 0x5A, 0xC9, 0x04, 0xB2, 0xDF, 0x2B, 0x21,
- 0x50, 0xEE, 0xBA, 0xE0, 0xB4, 0xF0, 0xD3, 0xBA, 0xD8, 0x1A, 0x23, 0xC3, 0xB8, 0xE3, 0x18, 0x73,
- 0x46, 0x24, 0xBB, 0xA2, 0x04, 0xF1, 0xF5, 0xEE, 0x34, 0x0B, 0xF9, 0x5A, 0x57, 0x7A, 0xA3, 0xA0,
- 0x15, 0xDD, 0xB7, 0x96, 0xE8, 0x83, 0x8B, 0x95, 0xC7, 0xAA, 0xF2, 0x51, 0x97, 0x5D, 0x42, 0xA1,
- 0xDE, 0x65, 0x27, 0xD4, 0xC7, 0x15, 0xD5, 0xC7, 0x52, 0x7D, 0x46, 0x90, 0x34, 0x84, 0xE5, 0x2D,
- 0x7F, 0xEC, 0x8C, 0xBF, 0x3D, 0x4D, 0x34, 0x5B, 0x8D, 0x0B, 0xE5, 0x94, 0xAD, 0xB8, 0xA2, 0x5E,
- 0x31, 0x41, 0xEA, 0x9E, 0x62, 0xA1, 0xD6, 0x6A, 0x5C, 0x4D, 0xAD, 0xA8, 0x95, 0x67, 0x04, 0x89,
- 0x5A, 0xFA, 0x86, 0x3F, 0x52, 0x25, 0xDE, 0x42, 0xE6, 0xFF, 0xA7, 0x4B, 0xFC, 0xCE, 0x94, 0x58,
- 0x58, 0xB1, 0xFF, 0x5A, 0x5A, 0xCA, 0xC4, 0x30, 0x45, 0xC9, 0x78, 0xC9, 0x50, 0x4A, 0x1A, 0x8F,
- 0x54, 0xA8, 0x63, 0x39, 0x0A, 0xA9, 0xA3, 0x41, 0xA2, 0x06, 0xC6, 0x5F, 0x2B, 0x19, 0x2B, 0x1E,
- 0x9D, 0x04, 0x42, 0xC2, 0x40, 0x34, 0xE0, 0x23, 0xE3, 0x2C, 0xBB, 0xD4, 0x14, 0x8D, 0x90, 0x50,
- 0x36, 0xD3, 0xFE, 0xA8, 0x03, 0x62, 0x95, 0x52, 0x63, 0xE2, 0x00, 0x11, 0xF4, 0x79, 0x62, 0x96,
- 0x8A, 0x82, 0x1C, 0xEC, 0xD3, 0x9A, 0xF9, 0x93, 0x83, 0xD9, 0xF2, 0x41, 0xDE, 0x14, 0x7E, 0xF1,
- 0xC3, 0x73, 0xC3, 0xF3, 0x0D, 0xF1, 0x16, 0x4D, 0x3F, 0x7E, 0x6B, 0x8E, 0x21, 0x5F, 0x31, 0xC7,
- 0x17, 0x69, 0xC4, 0x9D, 0x1A, 0x74, 0x46, 0x02, 0xE8, 0x59, 0xD9, 0x93, 0xE0, 0xF8, 0xAE, 0x19,
- 0xBF, 0x45, 0xAE, 0x54, 0x3D, 0xD1, 0xA4, 0x7E, 0x17, 0x2B, 0x92, 0x31, 0xA7, 0xA0, 0x49, 0x6C,
- 0x79, 0x57, 0xEA, 0xB8, 0x96, 0x58, 0x8A, 0x96, 0x85, 0x1B, 0x98, 0x30, 0x3E, 0xFD, 0xC5, 0x5A,
- 0x51, 0xAF, 0x40, 0xA9, 0x21, 0x63, 0xB2, 0xC4, 0x96, 0x89, 0xAE, 0x6B, 0xD6, 0xD4, 0xAD, 0xBD,
- 0x0B, 0x10, 0x65, 0x5B, 0x49, 0xDA, 0x6C, 0x9E, 0x8F, 0x8A, 0xB0, 0xB8, 0xA8, 0x72, 0xE2, 0x33,
- 0x38, 0x8D, 0x36, 0x2C, 0xC5, 0x37, 0xF1, 0x52, 0xAE, 0xC1, 0xA9, 0xF8, 0x9F, 0x0A, 0xFF, 0x0B,
- 0x9B, 0xFC, 0x8E, 0x51, 0xC1, 0x70, 0x00, 0x00
-};
-
-#define index_config_html_gz_len 3676
-const uint8_t index_config_html_gz[] = {
-  0x1f,0x8b,0x08,0x08,0xce,0xdb,0xb8,0x62,0x00,0xff,0x69,0x6e,0x64,0x65,0x78,0x2e,0x68,0x74,0x6d,0x6c
-,0x2e,0x67,0x7a,0x00,0xad,0x55,0xef,0x4f,0xdb,0x3c,0x10,0xfe,0xce,0x5f,0xe1,0x65,0x08,0xb5,0x12,0x69
-,0xa1,0x93,0xe0,0x05,0x92,0xbc,0x1f,0xde,0xbd,0x12,0x5f,0xa6,0x49,0x1b,0x12,0xd2,0xbe,0xac,0xae,0x7d
-,0x4d,0x2c,0x5c,0xbb,0xb3,0x9d,0xa2,0xaa,0xca,0xff,0xce,0xd9,0x4e,0x69,0x02,0x85,0xb1,0x89,0x7c,0x88
-,0x7f,0xdc,0xdd,0x73,0x77,0xcf,0x9d,0xed,0xec,0x03,0xd7,0xcc,0xad,0x97,0x40,0x2a,0xb7,0x90,0xc5,0x41
-,0x16,0x07,0x82,0x5f,0x56,0x01,0xe5,0x71,0x1a,0x96,0x0b,0x70,0x94,0xb0,0x8a,0x1a,0x0b,0x2e,0x4f,0x6a
-,0x37,0x4f,0xff,0x49,0x9e,0x8a,0x15,0x5d,0x40,0x9e,0xac,0x04,0xdc,0x2f,0xb5,0x71,0x09,0x61,0x5a,0x39
-,0x50,0xa8,0x7e,0x2f,0xb8,0xab,0x72,0x0e,0x2b,0xc1,0x20,0x0d,0x8b,0x63,0xa1,0x84,0x13,0x54,0xa6,0x96
-,0x51,0x09,0xf9,0x69,0x17,0xcb,0x09,0x27,0xa1,0xf8,0xa6,0x67,0xda,0x91,0x1f,0x60,0x34,0xf9,0xaa,0x80
-,0xdc,0x52,0x4b,0xae,0xc1,0x40,0x36,0x8e,0xe2,0x18,0xe4,0x78,0x17,0x65,0x36,0xd3,0x7c,0xdd,0x41,0xe1
-,0x62,0x45,0x04,0xcf,0x13,0xa9,0x4b,0xdd,0x41,0x0f,0x32,0x49,0x67,0x20,0xc9,0x5c,0x9b,0x3c,0x51,0x74
-,0x95,0x3a,0x5d,0x96,0x12,0x52,0x36,0x4b,0x82,0xc5,0x6e,0x2b,0x29,0x8e,0x3e,0x5e,0x9c,0x9f,0x9f,0x5d
-,0x1d,0xa9,0x99,0x5d,0xb6,0xff,0x9b,0x20,0x22,0xc8,0x83,0x13,0xaa,0xb4,0xd9,0x38,0xa0,0x75,0x3c,0x64
-,0x63,0xf4,0x5d,0x1c,0xec,0x42,0x99,0x0b,0x90,0x1c,0xf5,0xbb,0x51,0x64,0x12,0x4a,0x50,0xbc,0xf8,0x0e
-,0x8e,0xb0,0xda,0x18,0xe4,0x89,0x38,0xb1,0x80,0x4b,0xc4,0x8b,0x92,0x1d,0x40,0x3f,0xe2,0x56,0x3b,0xf5
-,0xda,0x49,0xf1,0x3f,0x52,0x6c,0x88,0xab,0xe0,0x19,0xca,0x93,0xa8,0x48,0x26,0xd4,0xb2,0x46,0x31,0x96
-,0x3b,0x4f,0x38,0x75,0xe0,0x15,0x53,0xa9,0xb1,0x00,0x31,0xef,0x16,0xe0,0x67,0x00,0xee,0x12,0x16,0xeb
-,0xda,0x13,0x13,0xad,0xb0,0x19,0x54,0x89,0xfb,0x38,0x70,0x09,0x03,0x57,0x09,0x3b,0x4c,0xc8,0x8a,0xca
-,0x1a,0x37,0x27,0x27,0x93,0x49,0x7a,0x72,0x96,0x9e,0x4e,0x6e,0x4e,0x2f,0x2e,0x3f,0x9d,0x74,0xeb,0x3b
-,0xde,0xf1,0xf1,0x76,0x8e,0xe6,0x06,0x7e,0xd5,0xa0,0xd8,0xba,0x43,0x10,0x21,0x5d,0xe5,0x40,0x7a,0xaf
-,0xcc,0xdd,0x84,0x0d,0xe5,0x42,0xc7,0x3c,0x39,0x15,0x72,0x9d,0xb4,0x59,0x3d,0xe2,0x3e,0x86,0xde,0x8a
-,0x7b,0x50,0xed,0xf7,0x52,0xd2,0xac,0x02,0x76,0x07,0x9d,0xe3,0xf2,0xb4,0x66,0x11,0xb3,0xf8,0xec,0x87
-,0x7d,0xa5,0x89,0x1d,0xf3,0x37,0xc9,0xdc,0x03,0xdc,0xbd,0x96,0xcd,0x56,0xfe,0x27,0xe9,0xbc,0x9c,0x47
-,0x8b,0x56,0xdc,0x86,0xf1,0x7d,0x33,0x59,0xe0,0x6d,0x51,0xbd,0x96,0xca,0xa3,0xc2,0xfb,0xe4,0xb2,0x85
-,0x2b,0xbe,0xc4,0xc9,0xef,0xb3,0x79,0x7b,0xe7,0xf6,0x5a,0x77,0x29,0x98,0xab,0x0d,0x84,0x83,0x49,0xc6
-,0x84,0xd3,0x7e,0x0f,0xef,0x0d,0xae,0xb5,0x89,0x87,0xad,0xf8,0xaf,0xd2,0xda,0xb6,0x00,0x28,0xde,0x22
-,0xee,0x3b,0xe5,0x7d,0x7a,0xe3,0x59,0xf5,0xec,0xf6,0x00,0x9f,0x31,0x18,0x29,0xef,0xeb,0xbc,0xc0,0xe8
-,0x7e,0x3a,0xe2,0x3a,0x5e,0xc1,0x78,0x2b,0xc7,0xd7,0xc4,0x32,0x23,0x96,0x28,0x9c,0xd7,0x8a,0x39,0xa1
-,0x15,0x69,0x81,0xac,0x61,0xc3,0x0d,0x9a,0xac,0xa8,0x21,0x33,0x6a,0xe1,0x5a,0x5b,0x47,0x72,0x82,0x6f
-,0x51,0xbd,0xc0,0x1b,0x66,0xe4,0xef,0x24,0xaf,0x3f,0xd2,0x46,0x94,0x42,0x5d,0xb5,0xaa,0xb1,0x0d,0xd0
-,0x78,0x14,0x66,0xdb,0x6d,0x1f,0x3b,0x5a,0xfb,0x7d,0x3f,0xf5,0x95,0xc1,0x87,0x07,0x11,0xb1,0x7d,0xcc
-,0x1a,0x25,0xd3,0xc3,0xcd,0xd6,0x4b,0x33,0xf6,0x6f,0x92,0xd1,0xf2,0x5f,0xb4,0xcc,0x0f,0x37,0xde,0xa0
-,0x39,0x42,0x38,0x9c,0x07,0xd0,0x66,0xea,0xed,0xe7,0xe0,0x58,0x35,0x08,0xf6,0x43,0x5c,0x8e,0xf0,0x7a
-,0x55,0x03,0x03,0x76,0x89,0xb8,0xe8,0xab,0x20,0x3e,0x7a,0xfc,0xbc,0x1f,0x2d,0x01,0x03,0x2e,0x07,0xd3
-,0xd0,0xaf,0xe8,0xd6,0x69,0x72,0xb8,0x09,0xb6,0x0d,0x99,0xe3,0x33,0x67,0x2b,0xe0,0xc7,0xc4,0x3a,0xea
-,0x6a,0x7b,0x89,0xa2,0x2d,0xce,0x28,0x6e,0x35,0x53,0xef,0xa2,0x19,0x1e,0x34,0x48,0x5c,0xcb,0xd8,0x03
-,0x52,0xd6,0x4b,0xc5,0x98,0x07,0x00,0x00};
-
-#define eric_config_html_gz_len 8280
-const uint8_t eric_config_html_gz[] = {
-0x1f,0x8b,0x08,0x08,0xa2,0x49,0x26,0x63,0x00,0xff,0x69,0x6e,0x64,0x65,0x78,0x2e,0x68,0x74,0x6d,0x6c
-,0x2e,0x67,0x7a,0x00,0x95,0x58,0x6d,0x73,0xda,0x38,0x1e,0x7f,0xcf,0xa7,0x50,0xdd,0xde,0x16,0x52,0x0c
-,0x84,0xb6,0x69,0x4a,0x42,0x6e,0x6e,0xd3,0xec,0xb5,0x33,0xb7,0xd7,0x4e,0x93,0xd9,0x9b,0x7d,0xd5,0x0a
-,0x5b,0xc6,0xba,0x18,0xcb,0x27,0xcb,0x50,0x9a,0xc9,0x77,0xdf,0xdf,0x5f,0x92,0x8d,0x79,0x48,0xae,0xc5
-,0x03,0xc8,0xd2,0xff,0xf9,0xd9,0x3e,0x7f,0xf2,0xee,0xe3,0xe5,0xcd,0x9f,0x9f,0xae,0x58,0x6a,0x16,0xd9
-,0x45,0xe7,0x9c,0xfe,0x58,0xc6,0xf3,0xf9,0x34,0x10,0x79,0x70,0xd1,0x61,0xec,0x3c,0x15,0x3c,0xa6,0x05
-,0x96,0x46,0x9a,0x4c,0x5c,0x5c,0x0b,0x63,0x64,0x3e,0x2f,0xc3,0x4b,0xbe,0x10,0x9a,0xb3,0x6b,0xc3,0x8d
-,0x54,0xf9,0xf9,0xd0,0x1d,0x3b,0xd0,0x85,0x30,0x9c,0x45,0x29,0xd7,0xa5,0x30,0xd3,0xa0,0x32,0x49,0x78
-,0x6a,0xc9,0xd5,0x47,0x39,0x70,0xa7,0xc1,0x52,0x8a,0x55,0xa1,0xb4,0x09,0x58,0xa4,0x72,0x23,0x72,0x80
-,0xae,0x64,0x6c,0xd2,0x69,0x2c,0x96,0x32,0x12,0xa1,0xbd,0xe9,0xcb,0x5c,0x1a,0xc9,0xb3,0xb0,0x8c,0x78
-,0x26,0xa6,0xc7,0x7d,0x56,0x95,0x42,0xdb,0x3b,0x3e,0xc3,0xc6,0x5a,0x94,0x4e,0xd2,0x61,0x2d,0xea,0xf9
-,0x4c,0xc5,0x6b,0xbb,0x88,0xe5,0x92,0x45,0x19,0x2f,0xcb,0x69,0x60,0x54,0x91,0xf3,0xa5,0x83,0x84,0x68
-,0x6e,0x93,0x47,0x46,0x2e,0x45,0xc0,0x52,0x2d,0x92,0x69,0x30,0x0c,0x2e,0x7e,0x79,0x7a,0xfa,0xf6,0x64
-,0xfc,0x5e,0x2d,0xc4,0xf9,0x90,0x7b,0x58,0x7f,0x58,0x1a,0x2d,0xf8,0x62,0x40,0x26,0x0a,0x2e,0xae,0xed
-,0xcd,0x3e,0x8c,0xb7,0x4d,0x0d,0x15,0xa5,0x22,0xae,0xb2,0x7d,0x5a,0xa9,0xc8,0x0a,0x0f,0xf3,0x1e,0xcb
-,0xfa,0x7c,0x08,0x79,0x77,0xe5,0x8e,0x60,0x16,0xa1,0x83,0x8b,0xf6,0x9e,0x67,0x73,0x43,0x06,0x27,0x99
-,0x8f,0xc7,0xa7,0xc7,0x6f,0xdf,0x7c,0x4a,0x95,0x51,0xec,0x86,0xdf,0xe2,0x88,0xd5,0xac,0x27,0x8e,0xe8
-,0x41,0xd2,0x35,0x19,0x35,0x9f,0x67,0xe2,0x9f,0x5a,0x55,0x85,0x33,0xcf,0x83,0x9c,0xe0,0x6a,0x6d,0x6a
-,0x0e,0x96,0x5d,0xc9,0xb8,0xf1,0x2c,0x9c,0x77,0x65,0x5e,0x54,0x86,0x99,0x75,0x01,0xf7,0xc6,0xdc,0x08
-,0x23,0x17,0x22,0xcc,0x14,0x9c,0x15,0xb0,0x25,0xcf,0x2a,0x6c,0x8f,0x47,0xc7,0x6f,0xc3,0xd1,0x9b,0x70
-,0xf4,0xfa,0xe6,0x78,0x34,0x19,0x8d,0x02,0xa6,0x72,0x84,0x4a,0x3e,0xc7,0x19,0xf8,0xbd,0x03,0xd6,0x0d
-,0xb0,0xba,0xbd,0x80,0xc9,0x18,0x5b,0xc4,0xf4,0x0b,0xd1,0xf9,0x62,0x89,0x07,0x3e,0x78,0x78,0x51,0x60
-,0xad,0xc5,0xff,0x2a,0xa9,0x85,0xf3,0xfb,0x4f,0x28,0xe9,0x80,0x36,0xab,0xc3,0x0a,0x7f,0x16,0x85,0xe0
-,0x86,0x5d,0x2d,0x85,0x5e,0x6f,0xa9,0xd9,0x5a,0xb6,0x90,0x63,0xad,0x8a,0x58,0xad,0x5c,0xe6,0x50,0x1c
-,0x56,0xc6,0xa8,0xbc,0x7d,0x3a,0x33,0xb9,0xd3,0x2a,0x21,0xc1,0x45,0x1e,0xad,0xbd,0x52,0x17,0x61,0x58
-,0x8a,0x4c,0x44,0x26,0x0c,0xcf,0x87,0x0e,0xef,0x61,0xfa,0xa1,0x4f,0x97,0x9a,0x4f,0x1d,0x57,0x4f,0xad
-,0x29,0x33,0x19,0xdd,0x5a,0x45,0xac,0x87,0x7e,0xab,0x19,0x75,0x9f,0xff,0x2e,0xf3,0xca,0x88,0xe7,0xbd
-,0xe0,0xc2,0xad,0x7c,0xd8,0xfd,0x38,0x81,0xf7,0xaa,0xd2,0x84,0x4e,0xff,0x3f,0x8d,0xfc,0x8e,0xaf,0x09
-,0x17,0x7f,0x3f,0x8d,0xfa,0x1f,0x21,0x6e,0x09,0x97,0xfe,0x7f,0x1a,0xf9,0x77,0xd8,0x2a,0xb5,0x4a,0xd3
-,0x62,0x83,0x7e,0xc0,0x9b,0x8f,0x27,0xe0,0xb6,0x37,0x4b,0xbe,0x14,0xbf,0xda,0x9d,0x36,0x7b,0x6c,0xd6
-,0xf5,0x11,0xf1,0x7b,0x71,0x8d,0xfb,0xc6,0x9d,0x1b,0xea,0x33,0x0d,0x6a,0xfa,0xf1,0x5c,0xfb,0x43,0xe8
-,0x12,0x65,0x95,0x7d,0xc8,0x13,0xa5,0x17,0xb6,0xc4,0x6e,0x22,0xf0,0x91,0x14,0x55,0x89,0x59,0x71,0x2d
-,0x98,0xc7,0x9f,0xb0,0xe5,0xf1,0x60,0x34,0x18,0x75,0x79,0x56,0xa4,0xbc,0xf7,0x03,0x14,0x2e,0x55,0xb1
-,0xd6,0x72,0x9e,0x1a,0x86,0xc2,0x72,0xf2,0x96,0x8d,0x47,0xe3,0xf1,0xc0,0xe3,0x59,0x1b,0xb9,0xea,0x8a
-,0x72,0x6b,0x7b,0x46,0xe7,0xbc,0x8c,0xb4,0x2c,0x0c,0x11,0x5d,0x72,0xcd,0x66,0xbc,0x14,0xef,0x55,0x69
-,0xd8,0x94,0xc5,0x2a,0xaa,0x16,0xb0,0xde,0x80,0xf2,0x9f,0x14,0x18,0x28,0x10,0x96,0xf9,0x19,0xd1,0x69
-,0x0e,0xe7,0xc2,0x5c,0x65,0x82,0x96,0xbf,0xae,0x3f,0xc4,0xdd,0xe7,0xbb,0xf9,0xfe,0xbc,0x37,0x88,0x45
-,0xc2,0xab,0xcc,0xfc,0x41,0xf5,0x03,0x74,0x81,0x41,0x05,0xe2,0x37,0xad,0x16,0x97,0x99,0x04,0x62,0xb7
-,0x77,0xf6,0x18,0xc5,0x9d,0x5c,0x03,0x41,0x99,0xe7,0x42,0xdf,0x88,0x6f,0x24,0x65,0x40,0xd1,0x1c,0x58
-,0x99,0x48,0xfe,0xc5,0xfa,0x4b,0x03,0xcf,0xa6,0xf5,0x61,0x73,0xb6,0x91,0x0e,0xa8,0xbb,0xa2,0x0e,0x6c
-,0x85,0x63,0x35,0x38,0x1d,0xd0,0x3a,0xa9,0x72,0xf4,0x19,0xf8,0x72,0xab,0xba,0xdd,0xd9,0xd8,0x23,0x98
-,0xe9,0x61,0x3a,0x84,0xca,0xa8,0x33,0x96,0x2a,0x13,0xb0,0xe1,0xbc,0xfb,0xd5,0x7b,0xca,0x62,0x31,0x14
-,0xfb,0x67,0x77,0x87,0x51,0xef,0xbf,0x5a,0x8b,0xdc,0xe3,0xdb,0xe6,0x7f,0xc0,0x70,0x4e,0x0a,0x92,0x36
-,0x57,0x2b,0xa8,0x94,0x8b,0x15,0x23,0x19,0x9d,0x49,0x19,0xcb,0x84,0x61,0xb1,0x4c,0x12,0x3a,0x52,0x2b
-,0x32,0x2d,0x51,0xf8,0xae,0x72,0xf1,0x31,0x49,0x20,0x4e,0xb7,0x37,0x3c,0x19,0x39,0x50,0x3a,0xc7,0x0e
-,0x59,0xac,0xec,0x7a,0x60,0x77,0xd3,0x63,0xa1,0x25,0xd2,0x3b,0x63,0xc3,0x21,0x8f,0xff,0x5b,0x95,0x46
-,0xc4,0x0c,0x71,0xed,0x14,0xa1,0x23,0xa1,0x61,0x70,0xd1,0xd0,0x31,0x8a,0x84,0x40,0x97,0x85,0xb6,0xdd
-,0xde,0xa0,0x44,0x7a,0x89,0xee,0xa8,0x1f,0xbe,0xee,0xd5,0x20,0x53,0x07,0xf6,0xe1,0xfa,0x63,0x0d,0xd5
-,0x48,0x61,0x8f,0x1a,0x94,0x53,0x7f,0xa0,0x85,0xa9,0x74,0x4e,0xe7,0xd6,0x32,0x3b,0x7e,0xd9,0xa9,0x1a
-,0x4d,0x08,0x7c,0x20,0xa3,0x7a,0x2b,0x1d,0x74,0xc5,0x26,0x58,0xac,0x3f,0x76,0x62,0x6d,0x13,0x69,0xde
-,0x25,0xe0,0xfa,0x10,0x04,0x4c,0xbc,0xcd,0xd6,0x06,0x12,0xdb,0x89,0xc8,0x47,0xf0,0x9d,0xcb,0xdb,0x8a
-,0x55,0x05,0xf5,0xe0,0x2f,0xa2,0x2c,0xba,0xd4,0x34,0xfb,0xae,0x05,0xf7,0xd8,0xc6,0xeb,0x3f,0x94,0xae
-,0x35,0x30,0xf8,0x6a,0x12,0xe1,0xeb,0xb3,0xbb,0x1a,0xef,0x7e,0x48,0xbd,0x48,0xab,0xec,0xef,0x00,0x98
-,0x3e,0xbb,0x23,0x36,0xf7,0xbf,0x80,0x0d,0xd6,0x3e,0x14,0xbd,0xda,0xc2,0x44,0x69,0xd7,0x52,0xe8,0x0d
-,0x4c,0x2a,0xf2,0xae,0x86,0x58,0xb0,0x28,0x12,0xe9,0xc2,0x0b,0xb4,0x6b,0x63,0xab,0x29,0x64,0xb3,0x96
-,0xb5,0xa8,0xf7,0x2c,0xc1,0x38,0x58,0x62,0xb6,0xe9,0x53,0xf6,0x99,0xaa,0x9c,0xe0,0xa8,0xa6,0x34,0x70
-,0x5b,0x8d,0xa9,0xef,0x7b,0x14,0xfe,0xbb,0x59,0xb0,0x5d,0xa4,0x5b,0x69,0xd8,0xc4,0xfe,0xe1,0xa4,0xf2
-,0x44,0xa3,0x4a,0x23,0x56,0x6d,0x1a,0x4c,0x0f,0x24,0xd4,0x1e,0x4c,0x43,0xb5,0xb5,0xe9,0xa0,0xea,0x1a
-,0x71,0x23,0xb3,0xcc,0x8e,0x56,0xd3,0x2e,0xdd,0xd6,0x49,0xd6,0xed,0x85,0x2d,0x94,0xcd,0x6e,0x6f,0x78
-,0x3c,0x1a,0xf9,0x9c,0x93,0x09,0xb3,0x38,0x0d,0x89,0xf3,0xe9,0xa8,0x77,0x37,0x1c,0x16,0x76,0x16,0xb4
-,0x7a,0xb8,0x1c,0x93,0x25,0x22,0xdf,0x90,0xff,0x65,0xec,0x6d,0x8d,0x69,0x5a,0x9b,0x6e,0x70,0xf5,0xf9
-,0xf3,0xc7,0xcf,0x13,0xf6,0x27,0x32,0x95,0x26,0x76,0x8c,0x61,0x25,0x5b,0x21,0x1d,0x2d,0x3c,0xd9,0x2a
-,0x66,0x33,0x11,0x71,0x0c,0xdd,0x0c,0x6e,0x63,0x7b,0x94,0xd7,0xaa,0x02,0x9e,0xc2,0x71,0xca,0x31,0x0e
-,0x66,0x18,0x8c,0xe3,0x35,0x2b,0x38,0xfc,0x86,0x04,0x07,0x5f,0xc2,0xf2,0x8a,0x58,0x8c,0x01,0xfb,0x94
-,0x09,0x84,0x0f,0xb3,0x8d,0x95,0xf1,0x36,0x31,0x93,0x62,0xdc,0x02,0x0e,0x7e,0x09,0x06,0x24,0x72,0xc1
-,0x16,0x76,0x5a,0x61,0x32,0xb7,0xa4,0x92,0x0a,0x79,0x2c,0x06,0x81,0xb3,0x21,0x39,0x97,0x31,0x91,0x95
-,0xe2,0x01,0xad,0xad,0xc6,0x8c,0xe7,0x31,0x8b,0x78,0x0e,0x4d,0x9c,0x4a,0x7d,0xa8,0x68,0x37,0x90,0xc6
-,0x7b,0x02,0x5a,0xe8,0x52,0xd8,0x1f,0x17,0x26,0x14,0x81,0x84,0x6a,0x14,0x46,0x4d,0xc8,0xc4,0xae,0xae
-,0x3f,0xd5,0x11,0x6b,0x4b,0xa4,0x2b,0x9e,0x07,0xc2,0xc1,0xe7,0xf0,0x5e,0x68,0x5f,0x57,0xb3,0x85,0x74
-,0x15,0x04,0x49,0xa3,0x56,0xf7,0xfd,0x87,0x8b,0x39,0x1d,0xfd,0xff,0xba,0x42,0x9f,0x56,0xbe,0x07,0x5e
-,0x23,0x4b,0x2e,0xe8,0x83,0x05,0xaa,0xef,0x41,0xc0,0x0d,0xd7,0xa0,0xff,0x68,0xe4,0xef,0x22,0x36,0x32
-,0x05,0xfd,0x07,0xc5,0x6b,0xa1,0xfa,0x78,0xbb,0xf4,0x31,0x46,0xb3,0x51,0xfc,0x84,0x5d,0xaf,0xd1,0x0c
-,0x16,0x6c,0x85,0x00,0x66,0x86,0xdf,0xc2,0xf8,0x3e,0xc4,0x04,0x0d,0xdd,0x2c,0x78,0xf1,0x20,0xe9,0x17
-,0x01,0xe3,0x09,0x45,0x50,0xf0,0xe2,0xb0,0xd8,0x2f,0x82,0x27,0x3e,0x4a,0xea,0x38,0xb9,0xc7,0xd8,0x52
-,0x8f,0x2b,0xe7,0xa5,0x59,0xd3,0xf3,0x2a,0xf5,0xac,0x66,0xfc,0xa1,0x6a,0x90,0xa0,0xa0,0x85,0x09,0x5f
-,0xc8,0x6c,0x3d,0x61,0x78,0x3c,0x5b,0xe2,0x21,0x26,0xe2,0x7d,0x08,0x9c,0x97,0xe1,0xb5,0xd0,0x32,0x21
-,0x9d,0x22,0x95,0x29,0x3d,0x61,0x4f,0x5f,0x8a,0x53,0xf1,0xea,0x98,0x76,0x0c,0x64,0x0a,0x11,0x6d,0x73
-,0x0c,0x5d,0x6e,0x68,0x3c,0xeb,0xdc,0x6f,0xc8,0x6f,0x1e,0x40,0xee,0x3a,0xb1,0x2c,0x8b,0x8c,0x83,0x7c
-,0x92,0x89,0x6f,0x67,0x9d,0x82,0xc7,0x31,0x40,0x26,0xec,0x78,0x54,0x7c,0xc3,0xc0,0x85,0x9f,0x66,0x75
-,0xd6,0x21,0x98,0x70,0xa5,0x79,0x31,0x61,0xf4,0x7b,0xd6,0xa1,0xfe,0x29,0x93,0x75,0xfd,0x14,0xd0,0xe6
-,0xd6,0xe9,0x0c,0xdc,0x8d,0xad,0xa8,0x0b,0xae,0x51,0xbf,0x27,0x8c,0x57,0x46,0x91,0x84,0xf6,0x79,0x7a
-,0xc2,0x5e,0x8f,0xfe,0x46,0x77,0x5b,0x5c,0x2d,0xf2,0x60,0x33,0xd4,0x5a,0xfc,0x46,0xcc,0x19,0x5a,0xc2
-,0x2d,0xe1,0x38,0x8a,0x61,0x26,0x12,0xb0,0xad,0xc9,0xfa,0x4d,0x3b,0x34,0xee,0x31,0x7b,0xe5,0x98,0xa5
-,0xc2,0x9d,0xbe,0x7c,0x4d,0xbc,0x9a,0xd3,0x37,0x96,0x35,0x63,0x33,0xa5,0x63,0x01,0x73,0xbe,0x84,0xd6
-,0x48,0x12,0x64,0xec,0x5c,0x0b,0x61,0x5b,0xcf,0x8c,0x47,0xb7,0x73,0x98,0x2d,0x8f,0xa1,0xf0,0xae,0xcd
-,0xfd,0xce,0x2a,0x95,0xc6,0x8d,0x5a,0xe4,0xbb,0x52,0x7e,0x17,0xd0,0xca,0x73,0x72,0xa4,0x43,0xcd,0x63
-,0x49,0xdd,0xc2,0xee,0x42,0xd7,0xe1,0x51,0xfd,0x34,0xc5,0xd0,0xf4,0xaa,0x70,0xf7,0x73,0x34,0xec,0x0c
-,0xfc,0x13,0x1b,0x6c,0xf1,0x3d,0x94,0x79,0x2c,0xbe,0x01,0xfd,0xac,0xf3,0x88,0x40,0xdb,0xe2,0x0c,0x8f
-,0x4e,0x1b,0x1b,0x83,0x2b,0x28,0xb6,0xc5,0x3b,0x21,0x41,0x6a,0xbd,0x73,0xd4,0x39,0xa0,0x63,0x58,0x22
-,0xfc,0x42,0x49,0xe7,0xd0,0xe1,0x11,0xf0,0x51,0x71,0x32,0x99,0x0b,0xa0,0xd7,0x46,0x1c,0x5b,0x25,0x50
-,0x16,0xdd,0x1b,0x12,0xf2,0x60,0xed,0xc2,0xe1,0x11,0xbb,0xa1,0x72,0x06,0x46,0x1c,0x48,0xda,0x3d,0xe6
-,0x62,0xfe,0xca,0x85,0x20,0x4a,0x48,0xac,0x42,0x95,0x78,0xa1,0x02,0x17,0x53,0xdd,0x6b,0x8c,0xe0,0x83
-,0x89,0xd5,0x7a,0xdb,0xcd,0xbb,0x4e,0x0d,0x3c,0xc1,0xfc,0x94,0x61,0x2a,0x58,0x42,0xcc,0x26,0x2c,0x64
-,0x4e,0x82,0x85,0x3e,0x3a,0x3c,0xfb,0x77,0x35,0xf2,0xa5,0xa7,0xd8,0x7d,0x2f,0xa1,0x04,0x6a,0xef,0x9a
-,0xbd,0x73,0x83,0x7c,0x6f,0x8b,0x4b,0x1d,0xc7,0x6d,0x33,0xbf,0x6a,0x71,0x71,0xb6,0xd9,0x08,0xc2,0x67
-,0x88,0x10,0x34,0x84,0x83,0x9e,0x48,0xde,0xd2,0x75,0xc8,0x38,0x33,0xf5,0x2d,0x2c,0x53,0x0e,0x8e,0x13
-,0x46,0xc9,0x75,0x4a,0x59,0x06,0x27,0xd8,0x1b,0x3d,0x9f,0x71,0x0c,0x8b,0xf6,0x1a,0x8c,0x51,0xb4,0xf6
-,0x02,0xc9,0x6b,0xf7,0x2f,0x99,0xdf,0x96,0x50,0xbc,0x94,0xb1,0xeb,0x87,0x8d,0xad,0x0e,0xaa,0xc4,0xa1
-,0x94,0x17,0x6d,0x96,0x41,0xda,0x76,0xae,0x8f,0xbd,0x00,0x67,0x1d,0x5b,0x39,0x62,0x11,0x29,0xed,0x9e
-,0xf3,0xbc,0xca,0xbb,0xe9,0xe7,0x24,0x70,0xf5,0xd3,0x45,0x3e,0x53,0xc9,0x46,0x00,0xf8,0x02,0xa2,0xc1
-,0xaf,0xa9,0x42,0xe9,0x7c,0x40,0x9e,0x89,0x3b,0xc4,0xfc,0xb6,0x6f,0xba,0x63,0xba,0x1c,0x93,0xeb,0x14
-,0x0d,0x6d,0x4b,0x3d,0x4a,0x92,0xc3,0xc4,0x3d,0xc9,0x43,0xfe,0x7c,0x54,0x03,0x22,0xbf,0x11,0x63,0xa3
-,0xd0,0x16,0x5b,0xff,0xd0,0xbd,0xc2,0xc0,0x78,0x38,0x5e,0xd1,0xe2,0x4b,0x08,0xbb,0x6d,0xff,0xb6,0x48
-,0x2e,0x81,0x1f,0x49,0xda,0x7b,0xc8,0xb4,0x97,0xfe,0x5b,0x35,0xe0,0xa7,0xb5,0x1c,0x1e,0xfd,0x9b,0x2f
-,0x67,0x18,0xef,0xa8,0xc7,0xd8,0xd7,0x71,0xd4,0xa0,0x88,0x9c,0x7b,0x0d,0x69,0xab,0xeb,0xa3,0x85,0x8d
-,0x98,0x25,0x19,0xc5,0x6a,0x6a,0xb3,0xa7,0x29,0x6e,0xbe,0x31,0xfd,0x43,0xe3,0x95,0x68,0x7f,0xd3,0x9d
-,0x4a,0x6a,0x4e,0x78,0x2f,0x4a,0xcd,0x09,0x4d,0xc7,0xb3,0xa1,0xf0,0x03,0x5e,0xa6,0xf0,0x96,0x0e,0x73
-,0x4a,0x62,0xda,0x9d,0x2b,0x19,0xd3,0xf5,0x50,0xe7,0x6a,0xf7,0x87,0x57,0x4d,0xa4,0x7a,0xd8,0xfd,0x58
-,0xdd,0x2e,0xbd,0x6f,0x5c,0x35,0x6a,0xc4,0xa8,0xa3,0xee,0x01,0xad,0x5f,0x9e,0xf2,0x97,0x27,0x5b,0x08
-,0x03,0xf7,0x66,0xf6,0x21,0x8c,0xf1,0xc9,0x9b,0xd3,0x31,0xb2,0x7c,0xb7,0x01,0x1c,0xb0,0xfc,0x55,0x1e
-,0xc3,0xee,0x68,0xfb,0xb6,0xdb,0xff,0x05,0xdf,0xd6,0xa6,0xc1,0xf2,0x16,0x00,0x00
-};
-
-#define help_config_html_gz_len 8280
-const uint8_t help_config_html_gz[] = {
-0x1f,0x8b,0x08,0x08,0xd5,0xcc,0x17,0x63,0x00,0xff,0x69,0x6e,0x64,0x65,0x78,0x2e,0x68,0x74,0x6d,0x6c
-,0x2e,0x67,0x7a,0x00,0xc5,0x57,0x5d,0x6f,0xdb,0x38,0x16,0x7d,0xf7,0xaf,0xb8,0x70,0x81,0x41,0x5b,0xf8
-,0xa3,0x49,0x3a,0x69,0xea,0x49,0x0c,0xec,0xa4,0x01,0x5a,0xa0,0x9b,0x06,0x71,0x16,0x83,0x7d,0xa4,0x24
-,0xca,0x22,0x22,0x91,0x5a,0x92,0xb2,0xab,0x59,0x14,0xe8,0x8f,0xd8,0xc7,0xdd,0x3f,0xd7,0x5f,0xd2,0x73
-,0x49,0xa9,0x56,0xd2,0x78,0xd3,0xdd,0x97,0xc2,0x7e,0xb0,0x44,0xde,0xaf,0x73,0xcf,0x3d,0xa4,0x4f,0x33
-,0xb5,0xa1,0xb4,0x14,0xce,0x9d,0x8d,0xbd,0xa9,0xb5,0xd8,0x8c,0x97,0x23,0xa2,0x53,0xaf,0x7c,0x29,0x97
-,0x6f,0x65,0x59,0x4f,0xcf,0x45,0x25,0xad,0xa0,0x95,0x17,0x5e,0x19,0x7d,0x3a,0x8f,0x4b,0xbc,0xa9,0x92
-,0x5e,0x50,0x5a,0x08,0xeb,0xa4,0x3f,0x1b,0x37,0x3e,0x9f,0x9e,0x44,0xeb,0xb0,0xa0,0x61,0x77,0x36,0xde
-,0x28,0xb9,0xad,0x8d,0xf5,0x63,0x4a,0x8d,0xf6,0x52,0x63,0xe3,0x56,0x65,0xbe,0x38,0xcb,0xe4,0x46,0xa5
-,0x72,0x1a,0x1e,0x26,0x4a,0x2b,0xaf,0x44,0x39,0x75,0xa9,0x28,0xe5,0xd9,0xc1,0x84,0x1a,0x27,0x6d,0x78
-,0x12,0x09,0x5e,0xb4,0xd2,0xc1,0xf1,0x29,0x82,0xc5,0x4c,0x45,0xea,0xd5,0x46,0x8e,0xa9,0xb0,0x32,0x3f
-,0x1b,0xcf,0xc7,0xcb,0x5f,0x9e,0x9c,0xbc,0x3e,0x3e,0x7c,0x6b,0x2a,0x79,0x3a,0x17,0x61,0x67,0xb7,0xe4
-,0xbc,0x95,0xa2,0x9a,0x15,0xbe,0x2a,0xc7,0xcb,0x55,0x78,0xb8,0xbf,0x43,0x7a,0xaf,0xf4,0xda,0xf5,0x7b
-,0xd2,0x42,0x66,0x4d,0x79,0xdf,0x4f,0x01,0x24,0xba,0x1d,0x0c,0x4a,0x5c,0x9d,0x03,0xbc,0xe5,0x68,0x34
-,0xc4,0xb0,0x12,0x4a,0xdf,0x30,0x40,0xe3,0xe5,0x8d,0x35,0x0d,0x92,0x77,0x85,0x31,0x1c,0x80,0xde,0xe9
-,0xdc,0x74,0x26,0x43,0x8b,0x2e,0xfe,0x8d,0xfc,0xe8,0xc7,0xcb,0xcb,0x0f,0x37,0x17,0x0b,0xba,0x29,0x94
-,0xa3,0x5a,0xac,0x65,0xc0,0x0c,0x1e,0x1d,0xf9,0x7b,0xce,0x14,0x9c,0x51,0x6e,0x2c,0xf9,0x42,0xd2,0x56
-,0x26,0x80,0x6b,0x23,0x2d,0x7d,0xb8,0x7c,0xff,0xf7,0x19,0xbd,0xcb,0xa9,0x35,0x0d,0x69,0x29,0x33,0xf2
-,0x86,0x32,0x99,0x34,0x6b,0xd2,0x46,0x4f,0x77,0x1b,0xad,0x2c,0x85,0xc7,0xb2,0x72,0xae,0x91,0xee,0xa9
-,0x9a,0xc9,0x19,0x55,0x2a,0xb5,0x66,0xf5,0x86,0x52,0x61,0xfb,0x85,0x67,0x84,0x10,0xc2,0x4a,0xc4,0x8b
-,0xee,0x4c,0x4e,0x06,0x21,0x2d,0x65,0x26,0x6d,0x2a,0xb4,0x33,0x90,0x62,0x42,0x75,0x29,0x85,0x93,0x94
-,0x29,0x87,0x94,0xb5,0x4c,0x3d,0xe5,0xd6,0x54,0xf7,0xb2,0x13,0x3a,0xa3,0xb5,0xe1,0x94,0x12,0xe5,0x67
-,0x65,0x3b,0x97,0xae,0x4e,0x45,0x35,0xac,0x6d,0xd6,0x23,0x94,0xd8,0xe5,0x43,0x28,0x45,0x68,0xaf,0x18
-,0x9b,0x37,0xca,0x22,0x8e,0xb1,0xed,0x97,0xcf,0xff,0xda,0xf7,0x8d,0xde,0xd8,0xd9,0x83,0x98,0x47,0x6f
-,0x4c,0x9b,0xc5,0x63,0x9d,0x79,0x2b,0x1c,0x95,0x4a,0xdf,0xa2,0x15,0x86,0x44,0x59,0x76,0x30,0x70,0x97
-,0xdc,0xb7,0xa4,0xf7,0x86,0x88,0xcc,0x7b,0x34,0xc8,0x79,0xc4,0x2e,0xc4,0x60,0xe8,0x00,0x0e,0x8f,0x1e
-,0xcf,0xd0,0x6c,0xc8,0x0a,0xa1,0x29,0x91,0x3c,0x23,0xa1,0xbf,0x5e,0xdc,0x4a,0xaa,0x0b,0xe3,0x8d,0xe3
-,0x76,0x39,0x2f,0xac,0x27,0x81,0x6c,0x37,0x12,0x0f,0x1c,0x18,0x5b,0x99,0x34,0x3b,0x97,0x33,0x3a,0x2f
-,0x84,0x46,0xea,0xdc,0xd8,0x2e,0x4a,0x3f,0x08,0x84,0xba,0xd0,0x35,0x85,0x1a,0x11,0x04,0xf4,0x2f,0x91
-,0x12,0x53,0x45,0x93,0x57,0x15,0x78,0x53,0xa3,0xd1,0x21,0xdc,0xda,0x8a,0xba,0x68,0x49,0x55,0x3f,0x08
-,0x42,0x37,0x5a,0x8f,0xc3,0xd0,0xe5,0xd6,0xa1,0x10,0x62,0x71,0x95,0x5c,0x83,0xeb,0x9c,0xf4,0x20,0x54
-,0x22,0x93,0x21,0x63,0x06,0x48,0x92,0xdf,0x9a,0x5d,0x21,0x4c,0x5c,0x76,0x30,0xbe,0x0a,0x1e,0xa0,0x60
-,0x00,0xe6,0x06,0x35,0x8c,0x27,0xb4,0x2d,0x54,0x5a,0x80,0xe5,0xf8,0x21,0x75,0x8f,0x5e,0x28,0x3a,0xe2
-,0xc7,0x24,0x85,0x35,0xa0,0x05,0xbb,0x99,0xb8,0xe3,0x6b,0x59,0x4b,0xe1,0xe9,0x02,0x4c,0x6e,0x17,0x43
-,0x0f,0x1c,0x22,0xb7,0xf2,0x1f,0x8d,0xd4,0x69,0x7b,0xc7,0x55,0xef,0x81,0xc4,0x8e,0xd8,0xfb,0x69,0x08
-,0x5d,0x79,0x14,0x9a,0x07,0xa4,0x21,0x11,0x4e,0xa5,0x0f,0x0a,0x44,0x84,0xa4,0x32,0xce,0xa3,0x8d,0x29
-,0x86,0x15,0x40,0x95,0x75,0xd4,0x0e,0xb8,0x11,0x1b,0xa1,0x82,0xbe,0x22,0xbd,0xc5,0xfe,0x91,0xfc,0xa1
-,0x89,0xfc,0x43,0x26,0xb4,0x8a,0x53,0x7e,0x65,0x0d,0x4c,0x2b,0xb7,0x7f,0x14,0xff,0x0b,0x08,0x9d,0xf1
-,0x82,0xce,0x85,0xd6,0xc6,0x53,0x37,0x11,0xdc,0x8e,0x5d,0x88,0xc7,0x40,0x5a,0x99,0xb2,0x61,0x59,0x5a
-,0x8c,0x9e,0x8a,0x67,0x7f,0xe5,0xe9,0x70,0x0d,0xa8,0xc0,0x9a,0xc8,0x94,0xe8,0x14,0xaa,0x1b,0x1e,0x20
-,0x74,0xb1,0xba,0x3a,0x3a,0x44,0xc4,0x0a,0x5d,0xcb,0x15,0x84,0x0e,0x2c,0xb2,0xb7,0xa1,0xeb,0x9c,0x03
-,0xec,0xec,0x9d,0x95,0x88,0xeb,0xdf,0xae,0xdf,0x0f,0x15,0x18,0xb4,0x0b,0xe5,0x87,0xc6,0xb3,0x59,0xf0
-,0x61,0xd0,0x7b,0xdd,0x76,0x62,0xd1,0x99,0x8f,0x9e,0x26,0x83,0xac,0x90,0x43,0x6d,0xa5,0x8b,0x34,0x4a
-,0x1a,0xef,0x61,0x82,0x77,0x1d,0x0b,0xef,0xe8,0xe7,0x56,0xf9,0x02,0x53,0x78,0xf0,0x02,0xb1,0x50,0x44
-,0x86,0x71,0xcf,0x29,0x41,0x8b,0x9a,0x7a,0x46,0xd7,0x92,0x7f,0x51,0x02,0x06,0xb2,0xbb,0x7e,0xde,0xbf
-,0x7c,0xfe,0xf7,0xb5,0x04,0x3a,0x5f,0x3e,0xff,0x87,0x7e,0x0f,0xde,0x7b,0x26,0xfe,0x0f,0x5d,0x88,0xc9
-,0xb0,0xa0,0x44,0x3d,0x99,0xdf,0x91,0x1c,0xfd,0xff,0xb6,0xe6,0x9d,0x86,0x5e,0x65,0x28,0x2c,0x62,0xb0
-,0x61,0x86,0xa6,0x56,0xb8,0x42,0xba,0xc9,0x7d,0x58,0x79,0xdc,0x8d,0x2e,0xdb,0x5e,0xd1,0x60,0x62,0x34
-,0x0e,0x9c,0x70,0x8b,0x00,0x81,0x21,0x78,0xac,0x4e,0xe1,0xf0,0xab,0x9a,0xd2,0x2b,0x9c,0x48,0xdd,0xaa
-,0x9b,0xf3,0x6d,0x22,0xca,0xc1,0x77,0xbd,0xbf,0x7b,0x3a,0x39,0x1c,0x05,0xec,0x56,0x96,0xd0,0x38,0x8c
-,0x48,0x0c,0x86,0xec,0x27,0x81,0x3d,0xfd,0x50,0x37,0x3a,0x8c,0x4d,0x68,0x53,0xb8,0x5f,0xa0,0xa3,0x4c
-,0x89,0x41,0xbe,0x95,0x68,0xa9,0x10,0x50,0xe0,0x58,0x50,0x16,0xdc,0xc3,0xa3,0x36,0x54,0x1a,0xa8,0x1b
-,0x1f,0xc1,0xae,0x46,0x13,0xe1,0x1c,0x7c,0xb2,0x2d,0x3f,0x33,0xcc,0x7d,0xe3,0x06,0xbe,0x42,0x66,0x7d
-,0x26,0x24,0xd6,0x18,0xfb,0x58,0x71,0x69,0xb6,0xd1,0x51,0x87,0xea,0xec,0xc1,0x3b,0xc9,0x9e,0xde,0xae
-,0x7a,0x99,0xec,0xe5,0xf6,0x12,0x9d,0x5e,0x89,0x0d,0xde,0xf5,0x6e,0x1e,0x6f,0x23,0x6e,0x35,0x24,0xb2
-,0x0c,0xb7,0xb7,0x48,0xdb,0x2a,0xaa,0x34,0x2e,0x85,0xec,0x32,0xa2,0x56,0x35,0x10,0xa0,0x1d,0xc7,0xc1
-,0x48,0x44,0x91,0x4c,0xc8,0x8e,0xee,0x22,0xf7,0x01,0xb1,0xa1,0x69,0x28,0x7a,0x2b,0x94,0x07,0xd8,0x5e
-,0x95,0x78,0xc4,0xa9,0x2b,0xc1,0xc2,0xda,0xd4,0x8e,0x9a,0x9a,0x47,0x4c,0xe5,0x2d,0x5b,0x70,0x0c,0x5f
-,0x00,0x90,0x70,0xbe,0x75,0xe6,0x01,0xfb,0x44,0x42,0x7b,0x1d,0x7e,0x65,0x3d,0xc4,0xa5,0x11,0x8c,0x78
-,0x8f,0x70,0x50,0x52,0xcc,0xf0,0x5e,0xec,0x77,0xc3,0xe2,0x7c,0xcb,0xd7,0xde,0xd9,0xb7,0x1b,0xde,0x3f
-,0x71,0xd3,0xcd,0x21,0xc2,0xd3,0x1c,0x7d,0x29,0xdb,0x05,0x41,0xc0,0x37,0xd2,0xab,0x54,0x4c,0x00,0xa3
-,0x76,0x53,0x4c,0x84,0xca,0x7f,0xc3,0xae,0xd4,0x94,0xc6,0x2e,0xe8,0xc9,0x91,0x3c,0x91,0x2f,0x0f,0xf8
-,0x4d,0xcd,0x98,0xe9,0xf5,0xb4,0x94,0x39,0xa4,0xf7,0xe0,0x45,0xfd,0x71,0xf8,0xd6,0xaa,0x75,0x31,0x78
-,0x1d,0x82,0x38,0xf5,0xa7,0x5c,0xd0,0xcb,0xf0,0xea,0xd3,0x68,0x36,0xec,0xe9,0xcf,0x48,0xe4,0xf0,0x7e
-,0x22,0xa0,0xc5,0xcf,0xc8,0xe3,0xe0,0xd7,0x98,0xc7,0x68,0xfe,0xfc,0x52,0x6c,0x12,0xc1,0xd7,0x9f,0x16
-,0xf7,0xb4,0x75,0x3c,0xed,0x9f,0xcf,0x47,0xb3,0xf8,0xb7,0x86,0x38,0xbb,0x44,0xa4,0xb7,0x6b,0x1c,0x6d
-,0x3a,0x9b,0x7e,0x9f,0xc2,0x30,0xf5,0xbf,0x58,0xfc,0x1b,0x99,0xec,0xf2,0x77,0x9c,0x3e,0x18,0x11,0xd3
-,0x37,0x20,0x46,0x8e,0xd9,0x5b,0x50,0xa1,0xb2,0x4c,0xea,0x00,0x44,0x17,0x46,0x84,0x40,0x58,0xe5,0x33
-,0x95,0xab,0x19,0xd6,0x9b,0x1f,0xf2,0x87,0xdf,0x78,0xe0,0x35,0x15,0xa5,0x5a,0x63,0x84,0xf8,0x64,0x96
-,0x76,0x50,0x2f,0xca,0x7a,0x59,0x7f,0xa4,0x83,0xe3,0x58,0x6e,0xd8,0x9b,0x41,0xf1,0x6d,0xb8,0x6c,0x2f
-,0xf8,0x2a,0x2f,0xef,0xe3,0xf0,0xaa,0xeb,0x47,0x9f,0xc6,0xa2,0xe0,0x2c,0xf7,0x56,0x7d,0x74,0x22,0x8e
-,0x8e,0xef,0x18,0xcc,0xe2,0x9f,0xaa,0x7d,0x16,0x87,0xc7,0xaf,0x4e,0x0e,0x5f,0x0f,0x8a,0xc1,0xf5,0xc7
-,0x23,0x8b,0x4f,0xdf,0x23,0x7f,0xa1,0x33,0xe0,0x0e,0x0d,0x89,0x23,0xf3,0x15,0xd1,0x16,0x2c,0x73,0x63
-,0x0e,0x00,0x00
-};
-
-#define homepage_config_html_gz_len 5201
-const uint8_t homepage_config_html_gz[] = {
-0x1f,0x8b,0x08,0x08,0x5f,0x63,0x17,0x63,0x00,0xff,0x69,0x6e,0x64,0x65,0x78,0x2e,0x68,0x74,0x6d,0x6c
-,0x2e,0x67,0x7a,0x00,0xad,0x56,0x7d,0x6f,0xe3,0x36,0x0f,0xff,0xbf,0x9f,0x42,0xf0,0x01,0xeb,0xf5,0x50
-,0x3b,0x2f,0x4d,0xd3,0xd4,0x4b,0x0a,0xdc,0x8a,0x7b,0x70,0x03,0x86,0x61,0xc0,0xdd,0x17,0x50,0x2c,0x3a
-,0xd6,0x4e,0x96,0x0c,0x49,0x4e,0x9a,0x0e,0xfd,0xee,0x47,0xbd,0xd8,0x71,0xd3,0x66,0x68,0x87,0x07,0x41
-,0x12,0x8b,0x22,0x29,0xf2,0xc7,0x1f,0x29,0x2f,0x2b,0x5b,0x8b,0xbb,0x33,0x42,0x96,0x15,0x50,0xe6,0x1e
-,0xf0,0xb1,0x06,0x4b,0x49,0x51,0x51,0x6d,0xc0,0xae,0x92,0xd6,0x96,0xe9,0x22,0x19,0x6e,0x49,0x5a,0xc3
-,0x2a,0xd9,0x72,0xd8,0x35,0x4a,0xdb,0x84,0x14,0x4a,0x5a,0x90,0xa8,0xba,0xe3,0xcc,0x56,0x2b,0x06,0x5b
-,0x5e,0x40,0xea,0x17,0x97,0x5c,0x72,0xcb,0xa9,0x48,0x4d,0x41,0x05,0xac,0x26,0x97,0xa4,0x35,0xa0,0xfd
-,0x8a,0xae,0x51,0xb0,0x07,0xd3,0xb9,0xb6,0xdc,0x0a,0xb8,0xfb,0x66,0x35,0xd0,0x3a,0xbd,0xc7,0x23,0x34
-,0x25,0xdf,0x2c,0xb5,0x5c,0xc9,0xe5,0x28,0x6c,0x06,0x45,0xc6,0xb7,0xa4,0x10,0xd4,0x98,0x55,0x62,0x55
-,0x23,0xe9,0xd6,0x7b,0x88,0xf6,0x27,0x0c,0x97,0x98,0x50,0x30,0xa1,0x85,0xe5,0x5b,0x48,0x48,0xa5,0xa1
-,0x5c,0x25,0xa3,0xe4,0xee,0x97,0x0f,0x8b,0xdb,0xf9,0xf4,0xab,0xaa,0x61,0x39,0xa2,0x5e,0x33,0x6e,0x19
-,0x1f,0x4a,0xe6,0x10,0x4a,0x62,0x5c,0xc7,0x1a,0x60,0x2d,0x97,0x1b,0xd3,0xe9,0xc4,0xe5,0x91,0x56,0x05
-,0xa2,0x89,0x1a,0x5f,0xf1,0x31,0xec,0x8e,0x30,0x0b,0xf7,0x17,0x60,0x77,0xf1,0xaf,0x15,0xdb,0xfb,0x44
-,0x06,0xf9,0xc5,0x03,0xbe,0xbb,0x24,0x92,0x17,0xb9,0x79,0x17,0xc7,0x90,0x54,0x4a,0xf3,0x47,0x2c,0x08
-,0x15,0x7f,0xd0,0xbd,0x6a,0x6d,0x72,0x47,0x9c,0xfb,0x63,0xb5,0x2d,0x68,0xcb,0xb1,0x0a,0x51,0x89,0x28
-,0x59,0x08,0x5e,0xfc,0x58,0x25,0x1b,0xf5,0x5d,0xfd,0x45,0x37,0xf0,0xf1,0x3c,0xe4,0x7f,0x7e,0x81,0x1e
-,0x48,0xe7,0x61,0xdd,0x5a,0xab,0x64,0xe7,0xa4,0x95,0xbc,0x50,0x0c,0x7e,0xaf,0x37,0x0e,0xc6,0xc9,0x74
-,0x31,0x9d,0xdd,0x2c,0x47,0x41,0x27,0x44,0xf6,0xc2,0xa4,0xa8,0x14,0x92,0xe3,0x37,0x2f,0x3b,0xa0,0x7a
-,0x64,0x12,0x32,0xfb,0x8f,0x51,0xc7,0x22,0xbc,0x3d,0xee,0xdb,0xdb,0xf9,0x3b,0xa3,0xee,0xeb,0xfc,0x7f
-,0x8c,0xdb,0xb1,0xe4,0x1d,0x58,0x8f,0xc7,0xf3,0xc5,0xbb,0x82,0x0e,0xd4,0x3b,0x1d,0xf0,0x90,0x4e,0xdd
-,0x23,0xea,0x7b,0x52,0x22,0x4d,0xfd,0x98,0x38,0x5b,0x9a,0x42,0xf3,0xc6,0xba,0xbd,0xb2,0x95,0xd8,0x49
-,0x78,0x5a,0x9f,0x42,0x83,0x3f,0x17,0xff,0x78,0x0f,0xbc,0x24,0x7e,0xb9,0x42,0x0a,0xfb,0x12,0x27,0x71
-,0x83,0x90,0x1d,0x97,0x4c,0xed,0x32,0xa1,0x0a,0xcf,0xe2,0xcc,0x35,0x09,0x59,0x91,0xf3,0x61,0xbb,0x9d
-,0xff,0xea,0x95,0x9f,0xfc,0x2f,0x08,0x03,0xcf,0x1c,0x46,0xf4,0xdf,0xe2,0x72,0xd8,0x9f,0xff,0xea,0xd4
-,0xa1,0xff,0x06,0x87,0x7d,0x2b,0xbf,0x70,0x16,0x4c,0xef,0x95,0x34,0x4a,0x00,0x5a,0x6e,0xb2,0x46,0x73
-,0x69,0x85,0xfc,0x98,0x7c,0xd1,0x5a,0x69,0x32,0x1b,0xcf,0x72,0xe2,0x70,0x22,0x52,0x59,0x52,0xaa,0x56
-,0xb2,0x2c,0xb9,0x88,0xd5,0x76,0x7e,0x9e,0x10,0xe6,0x03,0xbc,0x4b,0x63,0xf7,0x61,0xe2,0x65,0x87,0xca
-,0x87,0x43,0x4a,0xec,0xee,0xd4,0xf0,0x47,0xc8,0xc9,0x74,0x32,0x6e,0x1e,0x42,0x28,0x16,0x1e,0x6c,0x4a
-,0x05,0xdf,0xc8,0x9c,0x14,0x38,0x8d,0x41,0x07,0xb9,0x1f,0xc3,0x39,0xb9,0x1a,0xf7,0x9a,0x15,0xf0,0x4d
-,0x65,0x9f,0x89,0xd6,0xb4,0xf8,0xb1,0xd1,0x2e,0xa6,0x9c,0xec,0x2a,0x6e,0x21,0x8a,0x95,0x66,0x38,0xad
-,0x35,0x65,0xbc,0x35,0x39,0xb9,0x6e,0x1e,0xfc,0x17,0xcd,0xdc,0xd7,0xe9,0x3c,0x39,0xf2,0x64,0xc3,0x31
-,0x35,0x88,0xb1,0xa4,0x35,0x17,0xfb,0xfc,0xb3,0xc6,0x0b,0xe0,0x12,0xf9,0xb7,0x05,0xd7,0x04,0x97,0x86
-,0x4a,0x93,0xe2,0x2d,0xc0,0x4b,0xe7,0x61,0x90,0xcd,0x2c,0x3a,0xad,0xb9,0x0c,0xb7,0x07,0x26,0xd8,0xc5
-,0x58,0x28,0xa1,0x74,0x4e,0x3e,0x5c,0xc1,0x02,0x66,0x13,0x27,0x79,0x3d,0x61,0x0c,0x28,0x3b,0x1e,0x81
-,0x2e,0x24,0xc6,0x4d,0x23,0xe8,0x3e,0x27,0xa5,0x00,0xef,0xd0,0xfd,0xa7,0x3b,0x4d,0x1b,0xcc,0x18,0x7f
-,0x7b,0x11,0xe3,0x1a,0x3c,0xb1,0x73,0xa2,0xd5,0xce,0x89,0xff,0x6e,0x8d,0xe5,0xe5,0x3e,0x8d,0xd7,0xdc
-,0xe1,0x34,0x77,0xd6,0xf3,0xce,0x3e,0x7d,0xd2,0xc0,0x2d,0xa6,0xd2,0xd6,0xd2,0xed,0x04,0x7c,0xb1,0x12
-,0x08,0x28,0xf2,0x86,0x33,0xb2,0x16,0x58,0x89,0xc3,0x56,0x0f,0x7d,0x57,0xe7,0x86,0x32,0x86,0x48,0x1f
-,0x04,0x35,0xd5,0x1b,0x8e,0x4e,0x0f,0xeb,0x87,0xb4,0x2b,0xf0,0xf5,0xf5,0x40,0x18,0x01,0x8d,0x32,0x17
-,0xfa,0x70,0x3e,0x10,0x17,0x79,0xa3,0x0c,0x5e,0xd6,0x3e,0x73,0x10,0xc8,0xfc,0xad,0xa7,0xc1,0x63,0x8a
-,0xdd,0x00,0x0f,0x39,0x49,0x3d,0xec,0x7d,0x7a,0x5c,0x0a,0x2e,0x21,0x5d,0x63,0x97,0x84,0x88,0x7b,0x0e
-,0x21,0x52,0xa1,0x58,0xb3,0xfb,0xcf,0xff,0xbb,0x1e,0x0f,0xca,0xd7,0x73,0x6b,0x50,0xf5,0x09,0x52,0xca
-,0x89,0x7a,0x5a,0xc6,0x75,0xd1,0x6a,0xe3,0x6c,0x1a,0x85,0x7d,0x14,0x8a,0xdb,0x93,0x82,0x04,0x95,0x23
-,0x90,0x22,0x2f,0x3b,0x9e,0x0e,0xf0,0x4a,0xf1,0x45,0x01,0xed,0x42,0xe6,0x19,0xb6,0x53,0x48,0x78,0x08
-,0xd6,0xac,0x63,0xda,0x00,0xac,0x81,0x2c,0xa0,0x4c,0x5b,0xab,0x9c,0x8b,0xd1,0xa7,0x3f,0xe9,0x76,0x4d
-,0x35,0x71,0x5d,0x8a,0xfe,0xdd,0x9d,0xac,0xed,0xa7,0xd1,0x59,0x16,0xde,0x48,0xbc,0xf7,0x57,0x00,0x39
-,0xb0,0xf7,0xed,0x0d,0xa2,0x90,0x62,0xa5,0x50,0xbb,0x9c,0x54,0x9c,0x31,0x40,0xe2,0x60,0x0a,0xf1,0x18
-,0xea,0x0f,0xc2,0x5d,0x8a,0x19,0x08,0x28,0xed,0xb0,0x55,0xca,0xa9,0xfb,0x9c,0x6e,0x95,0x03,0x97,0x66
-,0x08,0xd8,0x64,0x1e,0x52,0xf5,0xba,0x0c,0x0a,0xa5,0xfd,0xec,0xcb,0x71,0x5c,0xc9,0x17,0x25,0xbb,0x89
-,0x48,0x76,0x61,0xe4,0x95,0x8b,0xf2,0x64,0xd6,0x57,0x0b,0x7a,0x35,0x7f,0x66,0x90,0x85,0xd7,0xb0,0x53
-,0x16,0xd3,0xf9,0xcd,0x62,0x7a,0xfb,0x92,0x38,0xaf,0x20,0xff,0x45,0x32,0xc4,0xdd,0xdd,0x55,0x61,0x62
-,0xfe,0x04,0xb5,0xe9,0xe1,0x43,0xd2,0x0a,0x00,0x00
-};
+//Note: More modern camera SOC assemblies may use the OV5640 sensor instead of OV2640. You may need to change this file accordingly.
+//File: index_ov2640.html.gz, Size: 4316
+#define index_ov2640_html_gz_len 5048
+const uint8_t index_ov2640_html_gz[] = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x5c,0x7d,0x77,0x9b,0x46,0xb3,0xff,0xdf,0x9f
+,0x62,0x4d,0xda,0x08,0x9e,0xa0,0x57,0x3b,0x8e,0x8a,0x2c,0xf9,0xda,0xb2,0x93,0xf4,0x9e,0x34,0x6d,0xe3
+,0xb4,0x7d,0xce,0xe9,0xe9,0x49,0x56,0xb0,0x48,0x1b,0x23,0x50,0x00,0x59,0x56,0xf4,0xf0,0x39,0xef,0xd7
+,0xb9,0x33,0xbb,0x0b,0x02,0xbd,0xf8,0x45,0x4a,0xac,0xde,0x9e,0xdb,0x9c,0xda,0xb0,0xcc,0xce,0xce,0xcc
+,0x6f,0xde,0x16,0x03,0xc7,0xfb,0x4e,0x60,0xc7,0xd3,0x11,0x23,0x83,0x78,0xe8,0x75,0xf6,0x8e,0xe5,0x2f
+,0x02,0xff,0x1d,0x0f,0x18,0x75,0xe4,0xa1,0x38,0x1d,0xb2,0x98,0x12,0x7b,0x40,0xc3,0x88,0xc5,0x6d,0x6d
+,0x1c,0xbb,0xe5,0xa6,0xb6,0x78,0xd9,0xa7,0x43,0xd6,0xd6,0xae,0x39,0x9b,0x8c,0x82,0x30,0xd6,0x88,0x1d
+,0xf8,0x31,0xf3,0x81,0x7c,0xc2,0x9d,0x78,0xd0,0x76,0xd8,0x35,0xb7,0x59,0x59,0x9c,0x98,0xdc,0xe7,0x31
+,0xa7,0x5e,0x39,0xb2,0xa9,0xc7,0xda,0x75,0x93,0x8c,0x23,0x16,0x8a,0x33,0xda,0x83,0x81,0x29,0x8b,0xf2
+,0xec,0x63,0x1e,0x7b,0xac,0x73,0x19,0x87,0x8c,0x0e,0xcb,0x5d,0x58,0x26,0xa4,0xe4,0x32,0xa6,0x31,0x0f
+,0xfc,0xe3,0xaa,0xbc,0x38,0x27,0x8e,0xe2,0x29,0x9e,0xf7,0x02,0x67,0x3a,0x73,0x41,0x84,0xb2,0x4b,0x87
+,0xdc,0x9b,0x5a,0xa7,0x21,0x2c,0x68,0xbe,0x66,0xde,0x35,0x8b,0xb9,0x4d,0xcd,0x88,0xfa,0x51,0x19,0x56
+,0xe5,0x6e,0xab,0x47,0xed,0xab,0x7e,0x18,0x8c,0x7d,0xc7,0x7a,0xe2,0x52,0xf7,0x85,0xfb,0xa2,0x65,0x07
+,0x5e,0x10,0x5a,0x4f,0x0e,0x58,0x93,0x1d,0xd6,0x5b,0x82,0x4f,0xc4,0xbf,0x30,0xab,0x7e,0x34,0xba,0x49
+,0x06,0x8d,0x59,0x6e,0xa4,0x09,0x23,0x11,0xb3,0x51,0x9a,0xca,0x90,0x72,0x7f,0xe6,0xf0,0x68,0xe4,0xd1
+,0xa9,0xe5,0x7a,0xec,0x26,0x79,0x32,0x64,0xfe,0xd8,0x2c,0x5c,0xc7,0xf1,0xb2,0xc3,0x43,0x39,0x66,0xc1
+,0x52,0xe3,0xa1,0x2f,0x09,0xb3,0xb9,0x7e,0xe0,0xb3,0x96,0x20,0x9c,0x84,0x74,0x04,0xa7,0xf8,0xab,0x35
+,0xe4,0xbe,0x34,0xa0,0x75,0x70,0x58,0x1b,0xdd,0x14,0x04,0x3f,0x38,0xc2,0x7f,0xad,0x11,0x75,0x1c,0xee
+,0xf7,0xad,0x26,0x5e,0x0e,0x42,0x07,0xcc,0x1a,0x52,0x87,0x8f,0x23,0xeb,0x10,0x46,0x86,0x34,0xec,0x03
+,0x8f,0x38,0x18,0x59,0xe5,0x7a,0x6d,0x3e,0x10,0xf2,0xfe,0x20,0xb6,0x70,0x24,0x79,0xa2,0x70,0x2b,0xa8
+,0x91,0x13,0x45,0x08,0x42,0x3d,0xde,0xf7,0xcb,0x3c,0x66,0xc3,0xc8,0x8a,0x00,0x97,0xd8,0x1e,0x24,0x2e
+,0xef,0x8f,0x43,0x36,0x4b,0x05,0xa8,0x29,0xde,0x70,0x50,0x9e,0xb0,0xde,0x15,0x8f,0xcb,0x6a,0xb1,0x1e
+,0x73,0x83,0x90,0x65,0x04,0xe5,0x9e,0x17,0xd8,0x57,0xe5,0x28,0xa6,0x61,0xbc,0x4c,0x4c,0xdd,0x98,0x85
+,0x8b,0xb4,0x0c,0x14,0x5e,0xa2,0x4c,0x19,0xa8,0x53,0xee,0x7b,0xdc,0x67,0xeb,0xd8,0x4a,0x0e,0x45,0x52
+,0x31,0xa6,0xd4,0x20,0x7c,0xd8,0xcf,0x2c,0x20,0x16,0x6d,0x49,0xc3,0xd7,0x6b,0xb5,0xef,0x5b,0x03,0x26
+,0xec,0x45,0xc7,0x71,0x70,0xbb,0x91,0xd1,0x37,0xfe,0x6b,0xc8,0x1c,0x4e,0x89,0x3e,0x07,0x8f,0x34,0x6b
+,0x60,0x69,0x83,0x50,0xdf,0x21,0x7a,0x10,0x72,0xb0,0xb6,0x70,0x66,0xcb,0x83,0x11,0x08,0x82,0x11,0x33
+,0x66,0x77,0xc1,0xa0,0x3c,0x62,0x3d,0x10,0x2b,0x34,0x18,0xd2,0x9b,0x72,0x4e,0x0b,0x3c,0x55,0x9a,0x40
+,0xe0,0xd9,0x3a,0x0c,0x5e,0x0f,0x48,0x99,0xa0,0x6b,0x19,0x4a,0x5d,0xa1,0x62,0x4e,0xdd,0x7f,0x0a,0xca
+,0x69,0xc4,0x3e,0xe9,0x8d,0xe3,0x38,0xf0,0xa3,0x3b,0xcc,0xfc,0x69,0x1c,0xc5,0xdc,0x9d,0x96,0x15,0x28
+,0x56,0x34,0xa2,0x90,0xcb,0x7a,0x2c,0x9e,0x30,0x06,0xa1,0xeb,0xd3,0x6b,0x80,0xbb,0xdf,0xf7,0xd8,0xcc
+,0x1e,0x87,0x11,0x64,0x8e,0x51,0xc0,0x81,0x32,0x6c,0x15,0x00,0xc8,0x13,0x96,0xed,0xde,0x2c,0x18,0xc7
+,0x28,0x12,0x88,0x18,0x00,0x3f,0x1e,0x4f,0xe1,0x48,0x9a,0xbd,0x96,0xda,0xbc,0xb6,0x30,0xc7,0xb2,0x07
+,0xcc,0xbe,0x62,0xce,0xb3,0x62,0xba,0x10,0xa9,0xa6,0xc2,0xfd,0xd1,0x38,0x2e,0x63,0x42,0x18,0xdd,0xa1
+,0x8f,0xb0,0x84,0x5a,0xa2,0xd1,0xc8,0x7c,0xd6,0x7a,0x3e,0xba,0x21,0xb5,0x02,0xa3,0x0e,0x64,0x64,0xe6
+,0x65,0xec,0x94,0x11,0xa5,0x3f,0x29,0x27,0xc8,0x65,0x8f,0x5c,0x86,0x3a,0x7c,0xf1,0x7d,0x81,0x11,0x11
+,0xc7,0x66,0x61,0x28,0x62,0x1e,0xc0,0x20,0x13,0x22,0x8c,0x4c,0xac,0x7a,0x52,0x09,0xa9,0xdf,0x67,0x00
+,0xe0,0x8d,0x99,0x1e,0xe6,0x52,0xea,0xaa,0xe5,0xad,0x1a,0x01,0xb1,0x13,0x09,0xe4,0x92,0xc7,0xa7,0x6a
+,0xe5,0xa8,0xeb,0x8d,0x2c,0x37,0x82,0xa1,0x0b,0xa6,0xc0,0xac,0xb9,0x80,0xa0,0xaa,0x04,0xae,0x5b,0xac
+,0x13,0x87,0xdd,0xd3,0x97,0xcf,0x6b,0x0b,0xd1,0x8f,0xeb,0x14,0x6b,0x45,0x2b,0xc3,0x58,0x09,0x68,0x0d
+,0x82,0x6b,0x16,0xce,0xf2,0xac,0x1a,0x47,0x2f,0x9a,0x8d,0x1f,0xd2,0xeb,0x14,0xfc,0xf2,0x9a,0x15,0x08
+,0xdc,0x46,0xdd,0x6e,0xd4,0x15,0x41,0x05,0x34,0xc4,0x22,0xe9,0xa4,0xae,0xe6,0x30,0x97,0x8e,0xbd,0xb8
+,0x20,0x1d,0xad,0xe1,0xbf,0x44,0xd8,0xfa,0x4f,0x2c,0xf1,0x6d,0x61,0xcb,0xbf,0x66,0x69,0x80,0xd0,0xd1
+,0x88,0x51,0x18,0xb3,0x99,0x2c,0x35,0xcb,0xc9,0x4d,0xb8,0xc5,0x8a,0x02,0xb3,0x60,0x9e,0x34,0xfc,0x97
+,0xd7,0xb2,0xdc,0xc0,0x1e,0x47,0x73,0x27,0x5f,0x41,0x61,0xa5,0xe2,0x44,0x1e,0x17,0x66,0x1c,0xfb,0x3e
+,0xea,0x56,0x8e,0x43,0x58,0x78,0xb6,0x42,0xa8,0x65,0x7c,0xf2,0x22,0x5e,0xbc,0xc4,0x7f,0x0b,0xa0,0xd4
+,0x32,0xac,0x49,0x14,0xc0,0x3a,0x44,0x91,0xdd,0x43,0x9e,0x78,0x30,0x1e,0xf6,0x66,0x6a,0x7a,0x1d,0x62
+,0x43,0x32,0x08,0xfb,0x3d,0xaa,0xd7,0xcc,0x9a,0x79,0x00,0x3f,0x8c,0x82,0xc1,0xa4,0xc8,0x8d,0xc6,0x52
+,0xf5,0x7d,0xbe,0x54,0xaf,0x65,0x6b,0xb1,0xa0,0xcd,0x3a,0x7c,0x0a,0x85,0xbb,0x5e,0x41,0x87,0x5f,0x63
+,0xf0,0xbb,0x8c,0xba,0x6c,0xaf,0x95,0x86,0x18,0x06,0x5f,0xca,0x32,0xfe,0x76,0x86,0x45,0x4e,0x84,0x6f
+,0x88,0x83,0xeb,0x1e,0xd4,0x0e,0x0e,0x17,0x34,0x59,0x2d,0x4f,0xb4,0xa1,0x2d,0x6a,0x24,0x4b,0x14,0x32
+,0x9b,0x00,0x1b,0x1f,0x4a,0x48,0x08,0xa5,0xa4,0xb5,0x34,0xb2,0x6e,0x6d,0x97,0x7b,0x5e,0xd9,0x0b,0x26
+,0x0b,0xd9,0xa3,0x60,0xe7,0x45,0xbb,0x2e,0x9a,0xff,0x56,0xde,0x63,0xf0,0xb9,0x6f,0xc0,0xfb,0xd1,0xc1
+,0xcb,0x81,0x72,0x4b,0x90,0xdc,0x65,0xd1,0x7b,0x4c,0x5d,0x36,0x98,0xcc,0x91,0x49,0x25,0x9a,0x70,0xe8
+,0xc4,0x16,0x8a,0xd1,0x28,0x88,0xb8,0x68,0xf3,0x42,0xe6,0x51,0x4c,0xf2,0xcb,0x65,0x78,0xa1,0x78,0xe4
+,0x2e,0xa5,0x3c,0x65,0x19,0xbd,0x5f,0xeb,0x50,0x91,0x19,0x40,0xf9,0xab,0x30,0x5e,0x21,0xb9,0x17,0x6c
+,0xdb,0xb8,0xd5,0x87,0x95,0xe3,0xf6,0x43,0x36,0x4d,0xd9,0x9a,0xea,0xb7,0x25,0x3b,0xbd,0xd5,0x35,0x5a
+,0xf8,0xb5,0xd4,0xba,0x72,0x18,0x25,0x0b,0x53,0x96,0x2d,0x92,0x36,0x58,0x9a,0xb6,0x04,0x7d,0x16,0x6c
+,0xc2,0x34,0x2a,0x06,0xf1,0xd0,0x63,0x6e,0x2c,0x1a,0x6f,0xcc,0x8e,0x07,0x05,0x0f,0x29,0xcf,0xab,0xb7
+,0xc4,0x33,0xeb,0x9f,0x52,0xdb,0x2c,0xd3,0xca,0xc4,0xbc,0x9a,0x3c,0x15,0x3c,0x4d,0xb1,0x42,0x3d,0x18
+,0x19,0xca,0x00,0x06,0x25,0xd8,0xbf,0xf5,0xc6,0x11,0xf6,0xcf,0xeb,0x2f,0x25,0xaa,0xed,0x59,0x0a,0x89
+,0xb4,0xc4,0xe6,0xbc,0xe0,0x70,0x01,0xb3,0x39,0xee,0x4b,0x9d,0x07,0x74,0x5b,0x43,0x0a,0xc9,0x12,0x4d
+,0x08,0xdb,0x4c,0xd0,0x6d,0xd9,0xbc,0xf3,0xf6,0xac,0x7e,0x84,0x9b,0xbd,0x8a,0xed,0x05,0x51,0x0e,0x07
+,0xda,0x03,0x49,0xc6,0x31,0x6b,0xc9,0x96,0xee,0xb9,0x32,0xea,0xf3,0xd5,0x61,0x97,0xc3,0x20,0x0f,0x4d
+,0x51,0xb2,0x3a,0xee,0x75,0xf2,0x5d,0x54,0xcc,0x6e,0xa0,0xbe,0xe1,0xbe,0xc5,0xb2,0x99,0x70,0xb3,0x7c
+,0x18,0xd4,0x97,0x5b,0xb0,0xa4,0x32,0xe0,0x8e,0xc3,0xfc,0xc2,0xe6,0x38,0x11,0x3b,0xfe,0xea,0xbf,0xde
+,0xd2,0xeb,0x1e,0x0d,0x09,0xee,0xfa,0xa1,0xbb,0xc3,0xdb,0x02,0x61,0xfc,0xaf,0xea,0x5e,0x05,0xc4,0x86
+,0xc6,0x99,0xcc,0x80,0x6c,0x09,0x62,0x92,0x16,0x5f,0xb8,0x88,0xdd,0x98,0x0b,0x39,0xc0,0x22,0x72,0x91
+,0xd6,0x5e,0x92,0x4d,0xa6,0x62,0x3a,0x5c,0xa5,0xb1,0x45,0xd0,0xcb,0x70,0x42,0xca,0xc2,0x6d,0xe0,0x3f
+,0x1c,0xc9,0x29,0x44,0x94,0x46,0x30,0x9a,0xf6,0x9b,0x04,0x31,0x24,0xc2,0x30,0x29,0xad,0xc3,0xec,0x20
+,0x94,0x3b,0x3e,0x22,0xaa,0x3b,0xae,0x92,0x61,0x4e,0xea,0x2f,0x90,0x36,0x27,0x86,0xec,0x19,0xd7,0xea
+,0x72,0xd0,0xa4,0xe0,0x34,0xf9,0x09,0x15,0xd9,0x44,0xae,0x9b,0x21,0x1b,0xce,0x9c,0x32,0x93,0x01,0xec
+,0x20,0x91,0xc3,0x92,0x3d,0x2f,0x7c,0x07,0xac,0xb9,0xa7,0x10,0x28,0x83,0xe3,0x0e,0x71,0x53,0x2a,0x8c
+,0x7f,0xcd,0x23,0xde,0xe3,0x1e,0x26,0x9f,0xcc,0x78,0x38,0x9e,0xc2,0xa4,0x74,0xdb,0x93,0x50,0x1d,0x57
+,0xd5,0x9d,0x19,0x79,0x32,0xbf,0xc1,0x74,0x8c,0xb7,0x6a,0xd4,0xa1,0xc3,0xaf,0x89,0xed,0xd1,0x28,0x6a
+,0x6b,0x52,0x17,0x75,0x1b,0xe8,0x98,0xa6,0xc3,0x52,0x33,0x8d,0x0c,0x42,0xe6,0xb6,0xb5,0xaa,0xd6,0x79
+,0xfa,0xa4,0xf9,0xc3,0x51,0xe3,0x75,0x30,0x64,0xc7,0x55,0x9a,0x51,0xab,0xcb,0x91,0xb8,0x67,0x54,0xc1
+,0x1b,0x5b,0x9a,0xba,0x81,0xb4,0x8a,0x8a,0xc5,0x31,0x28,0x1b,0xa5,0x74,0x10,0xf4,0xce,0xd8,0x5b,0xc5
+,0x6f,0xc0,0xbc,0x91,0xa2,0x7a,0x0d,0x87,0x73,0x8a,0x2a,0x48,0x9e,0xaa,0x13,0xe6,0xef,0x46,0xc9,0x6d
+,0x66,0x2a,0x3d,0xde,0xff,0xc9,0xdd,0xd9,0xca,0x74,0xe6,0x4e,0x5b,0xf3,0x82,0x7e,0xb0,0x70,0x4d,0x5c
+,0x17,0x1b,0x30,0xf0,0x8f,0xb0,0xad,0x15,0xb6,0x82,0x9a,0x98,0x35,0x1f,0x42,0x53,0xfc,0xf0,0xe2,0xc5
+,0x51,0xeb,0xa9,0xdf,0x8b,0x46,0xea,0xe7,0x7b,0x71,0x89,0xa4,0x1a,0x1e,0x57,0x05,0xb7,0x15,0xab,0xe4
+,0xa5,0x5e,0xd0,0x68,0x49,0x52,0x95,0xa4,0x57,0x09,0x9b,0x92,0x44,0x90,0x2d,0xc1,0x8f,0x56,0x90,0xe0
+,0x7f,0x2b,0x07,0x8f,0x45,0xc6,0x25,0xa2,0xe0,0x6a,0x22,0xef,0xf6,0x82,0x9b,0x45,0x25,0x85,0xde,0x2a
+,0x29,0x2b,0x2a,0xe6,0xac,0x59,0xe5,0x18,0x63,0x01,0xa7,0xe3,0x56,0x19,0x68,0x56,0x12,0x15,0x61,0x42
+,0x6a,0x75,0x47,0x60,0x0d,0xd3,0xb9,0xc1,0x04,0x99,0x98,0xd1,0x67,0x10,0xba,0x31,0x74,0x04,0x08,0x41
+,0xbd,0xd1,0x6c,0x1c,0x36,0xc9,0x7b,0x7a,0xc5,0xc8,0x2f,0x83,0x20,0x0e,0x8e,0xab,0x92,0xf4,0xfe,0xfc
+,0x94,0xaa,0xd2,0x79,0x15,0xcf,0x83,0x5a,0x53,0x26,0x37,0xf2,0x06,0xfc,0x3f,0x52,0xae,0x7c,0x2f,0xce
+,0xb9,0xa0,0x2a,0x86,0xb1,0xd6,0xc9,0xaf,0xea,0x52,0x9b,0x7d,0x60,0x7e,0x18,0x80,0x1e,0x29,0x7d,0xba
+,0xd7,0xd4,0x48,0x7a,0x94,0x1b,0xeb,0x5c,0x08,0x62,0xf2,0x12,0x26,0x66,0xa2,0x1c,0x2f,0xb9,0x4d,0xd1
+,0xab,0x94,0xa5,0xd7,0x93,0xec,0xdd,0x47,0x8f,0xdc,0x4d,0x04,0xe9,0x21,0x6e,0x48,0x87,0x0c,0xd3,0xa7
+,0x1a,0xbc,0xc3,0x24,0xb9,0x98,0xca,0x66,0x6a,0x9d,0x2e,0x1d,0xc5,0x78,0xe7,0xec,0x1d,0x13,0x55,0x50
+,0xdc,0x5e,0x5e,0x13,0x2f,0x0b,0xde,0x83,0xf5,0xbc,0x28,0xc7,0xdc,0x84,0x72,0x7b,0x5e,0xa6,0x42,0xef
+,0x3b,0x04,0x13,0xec,0x82,0x91,0xf0,0xc5,0x6b,0xea,0x8d,0x21,0x12,0xea,0x35,0xad,0xf3,0xdb,0xbf,0x5f
+,0x9d,0xea,0x50,0xb1,0x6b,0x37,0xf5,0x46,0xad,0x66,0x1c,0x57,0x25,0xc9,0x83,0x79,0xfd,0xa0,0xa9,0x5b
+,0x2e,0x88,0x63,0x7a,0x04,0x09,0x4f,0xb0,0x6f,0x34,0x81,0x7d,0xad,0x71,0xb8,0x39,0xfb,0xa6,0xd6,0x11
+,0x9c,0x80,0xc9,0xcd,0x8b,0xa3,0xe6,0xe6,0x8c,0x5e,0x80,0x4c,0xbf,0x03,0xa7,0x26,0x68,0x7c,0xb4,0x8d
+,0xc2,0x47,0x5a,0x07,0xf9,0x1c,0x1d,0xd6,0x6e,0x0e,0x9b,0x5b,0xf0,0x79,0x0e,0xce,0xf1,0xe3,0x4b,0xfd
+,0x10,0xe4,0x69,0xfc,0x70,0xb4,0x39,0x9f,0x43,0xad,0xf3,0x2b,0x0a,0x74,0xd0,0x00,0x46,0x87,0x5b,0x08
+,0x74,0x00,0x05,0x48,0x70,0x02,0x2e,0x37,0xf5,0x17,0x5b,0x88,0x04,0xee,0xf5,0xab,0xe0,0x04,0xfe,0x85
+,0xee,0x75,0x4f,0x4e,0x18,0xc9,0xe8,0x3f,0xb7,0xc5,0xfa,0xed,0xa9,0xe0,0xb6,0x70,0x1e,0x85,0x0c,0xff
+,0x90,0xf4,0x61,0xa3,0x88,0xce,0x4f,0x4e,0xab,0xfe,0x36,0x31,0x5d,0xe0,0xf7,0xb5,0xc2,0xfa,0x2b,0xba
+,0xf8,0xca,0x98,0xfe,0x7f,0xb7,0xff,0x3f,0xe8,0xf6,0x9f,0xc7,0x14,0xdb,0xe9,0x07,0x7b,0xbc,0x9a,0x37
+,0xaf,0x60,0xbf,0xca,0x81,0xfb,0xb9,0x7a,0x4e,0xa2,0xec,0x8e,0x3b,0xd8,0x19,0xb6,0x63,0x77,0xe8,0xb2
+,0xd4,0xb5,0x89,0xe9,0x05,0x55,0x34,0x02,0xcc,0x44,0x11,0x23,0x43,0x7a,0x03,0xde,0x7a,0xa0,0xe5,0x0a
+,0xdb,0x46,0xc1,0xb4,0x42,0x5e,0x7a,0xa3,0x75,0xde,0x04,0x93,0xbb,0x4c,0xbf,0x05,0x32,0x3d,0xb1,0x21
+,0xf6,0x59,0x14,0x3d,0x18,0x9c,0xf9,0x54,0xad,0x73,0x96,0x1d,0x6f,0x03,0x4d,0xb9,0xb1,0x05,0x30,0x39
+,0x71,0x24,0x36,0xe5,0x86,0xc2,0xa6,0xa1,0xcd,0x83,0xe3,0x6b,0x22,0xd3,0xf8,0x86,0xb8,0xe0,0x56,0x24
+,0xa4,0x51,0xfc,0x60,0x54,0xd2,0x89,0x10,0x33,0xea,0x68,0x67,0x88,0x64,0xa2,0xfc,0x03,0xf0,0x88,0x28
+,0xe4,0x1f,0x71,0x6b,0xe3,0xc1,0x88,0xcc,0xa7,0x42,0x69,0xcc,0x8e,0x77,0x86,0x4a,0x4e,0x9c,0x7f,0x02
+,0x2e,0x23,0x66,0x73,0xea,0x7d,0x60,0xae,0x0b,0xd5,0xeb,0xe1,0xd8,0x14,0xa6,0x03,0x3e,0xf2,0x9c,0x5c
+,0x88,0xf3,0x07,0x77,0x54,0x0b,0xec,0xbe,0x56,0x4f,0x55,0x5b,0xdd,0x0a,0xbd,0x0d,0x32,0x39,0x37,0x6c
+,0x16,0xea,0xc0,0x84,0xf5,0xc5,0x2d,0xd4,0x8d,0x79,0x34,0xb4,0xce,0xab,0x90,0x4e,0xc5,0x13,0x4f,0xdb
+,0xf4,0x3f,0xef,0x98,0x43,0xde,0x73,0x3f,0xde,0xa6,0x19,0x7b,0x15,0x32,0xe6,0x6f,0xc7,0x05,0x5a,0xc3
+,0x33,0x38,0xd8,0x8e,0x09,0x6c,0xcf,0x2e,0xd9,0x88,0xd3,0xbf,0x43,0xef,0x45,0x27,0xbd,0x07,0x87,0x05
+,0xcc,0xd1,0x3a,0xa7,0x7f,0x9c,0x3d,0x38,0x49,0xc9,0xbf,0xe5,0xdc,0xc7,0xc3,0x65,0x76,0x52,0x02,0x6a
+,0x4b,0x77,0xc7,0x56,0x47,0xce,0x7d,0xef,0x90,0xad,0xd0,0x2b,0x15,0x50,0xfc,0xb9,0x43,0xcb,0xa9,0x79
+,0x3f,0x1d,0xbf,0x5d,0x06,0x03,0x21,0x3e,0xf4,0x29,0xf7,0x37,0x01,0x49,0x4c,0x14,0x48,0x91,0x57,0x70
+,0xf4,0x58,0x70,0xc9,0x65,0x77,0x86,0x99,0xd2,0x7a,0xd7,0xc0,0x81,0x20,0xc3,0xc0,0x79,0xf8,0x36,0x5e
+,0xcd,0xd3,0x3a,0x80,0xda,0x4f,0x70,0xf0,0xe0,0x2a,0x93,0x32,0xf8,0xc6,0xe5,0xe5,0x74,0x8c,0xf7,0x78
+,0x37,0xaf,0x2c,0x97,0x63,0xdf,0x9f,0x6e,0x53,0x56,0xba,0x5e,0x30,0x76,0xa6,0xdb,0xd4,0x94,0x9f,0x5d
+,0x97,0xdb,0x6c,0x9b,0x8a,0x22,0xff,0xfe,0xf2,0x37,0xc8,0xe2,0xcc,0x7e,0x78,0x82,0x60,0x36,0xa0,0x78
+,0xd1,0x25,0x97,0x17,0x6f,0x2f,0x7f,0x7e,0xf7,0x38,0xd9,0x01,0xd6,0xdc,0x51,0x62,0x40,0x6d,0x77,0x9e
+,0xcc,0x99,0xdd,0xd8,0x04,0xa7,0x86,0x04,0xea,0xfc,0xf2,0x97,0xc7,0x42,0xa9,0xb1,0x3b,0x98,0x1a,0x7f
+,0x07,0x9c,0x3e,0x78,0xec,0x9a,0x79,0x1b,0x60,0x25,0x27,0x22,0x5e,0xe4,0x0d,0x1e,0xed,0x6c,0x23,0x97
+,0x89,0xf2,0x0f,0xd8,0xc6,0x81,0x57,0x7c,0x10,0x42,0x6f,0x12,0x3c,0x72,0xa6,0xd6,0xb9,0xb8,0x19,0x05
+,0xd1,0x38,0x64,0xdb,0x20,0x52,0xdb,0x0a,0x90,0x54,0x14,0x89,0x48,0x7a,0x6f,0x10,0xff,0xb6,0x95,0x61
+,0xd2,0xa8,0x1d,0x7e,0x55,0x54,0x90,0xf9,0xb7,0x04,0xa6,0xbf,0x41,0xdd,0xe9,0x63,0xdd,0x79,0xd5,0x7d
+,0x9c,0x54,0xd6,0xdf,0x59,0xc1,0xe9,0xef,0xb4,0xe0,0xa8,0x47,0x53,0x32,0x98,0x36,0xdc,0x44,0xa8,0x89
+,0xb0,0x77,0xde,0x64,0x03,0x91,0x8b,0x9c,0xfa,0xcd,0x36,0xa1,0x93,0x8a,0x51,0x8c,0x9c,0x83,0x79,0xdc
+,0x3c,0xff,0xaa,0x51,0x73,0x70,0xa7,0xb4,0xdb,0x04,0x0d,0x6a,0x62,0x33,0x8e,0x0f,0x1a,0x3d,0x18,0x90
+,0xdc,0x5c,0x89,0x09,0xe9,0xca,0xb3,0x6d,0xb0,0x69,0x6c,0x83,0x4d,0x5e,0xa2,0x22,0x3c,0x47,0xdf,0xa8
+,0xd2,0xd4,0x1b,0xcd,0x6f,0x09,0x4f,0x6f,0xf4,0xf0,0x9c,0x06,0x73,0xb4,0xce,0xd9,0x2f,0x8f,0x93,0xd3
+,0x70,0xb1,0x7b,0xe6,0xb4,0xad,0x32,0x98,0x50,0x6a,0xe7,0xdb,0xe8,0x0d,0xd0,0x98,0xa0,0xe0,0x7f,0x3c
+,0x12,0x1a,0x93,0xd1,0xae,0x2a,0xcc,0xe4,0xef,0x80,0x4f,0x48,0x27,0x1f,0xfa,0x43,0xfa,0x60,0x8c,0xd4
+,0x3c,0xad,0xf3,0x8e,0x4e,0xc8,0xab,0x9f,0x4e,0x1f,0x05,0xab,0x74,0xd1,0xdd,0xe0,0x95,0xa9,0xbc,0x6b
+,0xcc,0x3c,0xe6,0x3f,0x3c,0xa8,0x70,0x92,0xd6,0x79,0xc3,0xfc,0x88,0x74,0x83,0x50,0xbd,0xc5,0xfb,0x28
+,0xa8,0x89,0x95,0x77,0x03,0x99,0x54,0x7a,0xd7,0x78,0x0d,0x86,0x3c,0x0c,0x83,0xf0,0xc1,0x90,0xa9,0x79
+,0x5a,0xe7,0x75,0xf9,0x27,0x71,0xf4,0x28,0x70,0xa5,0xab,0xee,0x06,0xb1,0x4c,0xe7,0x5d,0x83,0x76,0xed
+,0x7a,0x7c,0xf4,0x60,0xc8,0xc4,0x2c,0xad,0xf3,0x7b,0xf9,0x25,0xfc,0x7e,0x14,0xb8,0xe4,0x8a,0xbb,0x01
+,0x4b,0x69,0xbb,0x6b,0xa8,0x1c,0x7b,0xf2,0x60,0xa0,0x60,0x8e,0xd6,0x39,0xef,0xfe,0x41,0xf4,0xf3,0x60
+,0xe2,0xe3,0x33,0x72,0xe4,0xe2,0xad,0xf1,0x28,0x88,0xe1,0xd2,0xbb,0xc1,0x4b,0x28,0xbd,0x6b,0xb4,0xc4
+,0xcb,0x1b,0x3d,0x1a,0x6e,0xf0,0xec,0x8b,0x9c,0x88,0xcf,0xbe,0xc0,0x11,0x39,0xa3,0x8f,0x93,0x10,0xb3
+,0x75,0x1f,0xa3,0x69,0x9f,0x2b,0xf9,0xc8,0x38,0x2d,0x3e,0x63,0xbf,0xe1,0x03,0xed,0xf8,0x34,0xbe,0xc3
+,0xe2,0x4d,0x9e,0xd6,0xc8,0xcd,0xd5,0x3a,0xf8,0x74,0x3e,0x39,0x17,0x27,0x8f,0xd5,0xa7,0xe4,0xd7,0x7f
+,0x0c,0xa8,0x0b,0xfa,0xee,0x3a,0x2a,0x85,0x30,0xd0,0x15,0x06,0x7d,0x7f,0xa3,0xd7,0x11,0x0a,0xd3,0x15
+,0x7c,0xef,0xe4,0xf9,0xe3,0x02,0x38,0x17,0xe2,0xd1,0x30,0xcc,0xe9,0xfd,0x48,0x30,0xae,0x79,0x73,0xa8
+,0xea,0xd3,0x15,0x97,0xd6,0xf0,0x3b,0x96,0xdf,0x44,0x59,0xc3,0x2a,0x7b,0x23,0x4a,0x7e,0xbe,0x28,0x7b
+,0x3b,0x33,0xb3,0xe2,0xc2,0x5b,0x9b,0xe9,0xfd,0xca,0xfb,0xb9,0x9f,0x78,0x7f,0x53,0x95,0x03,0x3c,0xcc
+,0x5e,0x1a,0xfa,0x9f,0xbb,0x94,0xe7,0xc3,0x7e,0x4e,0x2e,0x8d,0x44,0xa1,0xdd,0xd6,0xd6,0xbd,0x49,0xb5
+,0x46,0xf1,0xea,0x2a,0xcd,0x17,0x88,0x73,0xaf,0xfc,0xec,0x1d,0x47,0x76,0xc8,0x47,0x71,0x67,0xaf,0x5a
+,0xcd,0x5e,0x49,0x23,0xfd,0x40,0xbc,0x84,0x49,0x02,0x9f,0x91,0x3f,0x58,0xef,0x32,0x80,0xf2,0x1c,0xe3
+,0x2b,0x89,0x1e,0x23,0x1c,0xfc,0x31,0x22,0xc1,0x88,0xf9,0x26,0xa1,0x11,0xa9,0x8a,0x47,0x25,0x03,0x8f
+,0x84,0xec,0xf3,0x98,0x45,0x31,0x5c,0x8a,0x07,0x2c,0x9c,0xf0,0x88,0xed,0xc1,0xa5,0x28,0x26,0x29,0x41
+,0x9b,0xe8,0xba,0x41,0xda,0x1d,0xf1,0x0a,0xa4,0x87,0xfc,0x22,0x18,0xf3,0xc7,0x9e,0x67,0x0a,0x76,0x70
+,0xe2,0x52,0x2f,0x62,0x26,0xf1,0xd9,0x4d,0x0c,0x67,0x35,0x13,0x06,0xb8,0x07,0xda,0x20,0x61,0x4d,0xbc
+,0x1b,0x89,0x0c,0x81,0x16,0x5f,0xe3,0x84,0xb1,0x59,0x92,0x0d,0xc2,0x4f,0x1f,0x9f,0x32,0x80,0x55,0xb2
+,0x45,0x88,0x5a,0x82,0x4d,0xe6,0x5a,0xe8,0x1f,0x27,0x91,0x55,0xad,0x7e,0x37,0xf3,0x02,0x5b,0x3c,0x4a
+,0x58,0x19,0x04,0x51,0x9c,0x54,0x27,0xd1,0x47,0x43,0x4d,0xa9,0x04,0xbe,0x92,0x47,0xb1,0x4a,0xc5,0x8b
+,0xc3,0x31,0x6b,0x15,0x64,0x22,0xc9,0x7c,0x8e,0x00,0x7b,0x79,0x92,0xd0,0xa9,0x45,0xb8,0x4b,0xf4,0x67
+,0xcf,0xb2,0xb9,0xc7,0xe4,0xb9,0x81,0xf6,0x7e,0xcf,0x87,0x2c,0x18,0xc7,0xba,0x12,0xdf,0x24,0x8d,0x5a
+,0xad,0x66,0xe4,0xd9,0x0e,0x59,0x14,0x81,0x37,0x02,0x27,0x36,0xd7,0x2b,0xd5,0x7a,0x08,0xc3,0xff,0x7d
+,0xf9,0xf3,0xdb,0xca,0x08,0xbf,0x03,0xa6,0xb3,0x8a,0x43,0x63,0x6a,0x28,0x12,0x5c,0x72,0x58,0xa1,0xf6
+,0x15,0xd9,0x6f,0xb7,0xc9,0xd8,0x87,0xdc,0x00,0xde,0xec,0x90,0xa7,0x4f,0x53,0x13,0xfe,0x29,0x2e,0xff
+,0x65,0x80,0xb4,0xc5,0x11,0x98,0x17,0x5c,0x19,0x2d,0xe2,0x40,0xc9,0x8c,0xd9,0xc2,0x45,0x25,0x1d,0x21
+,0x0c,0x34,0x53,0xab,0x44,0x31,0x8d,0xc7,0x11,0xb2,0x56,0x70,0x57,0x50,0x3e,0x1c,0x33,0x96,0x46,0x32
+,0x72,0x29,0x28,0x72,0xc3,0xff,0xc1,0x1a,0x3f,0xe2,0x9b,0xba,0xd7,0xd4,0x53,0x8e,0x22,0x2c,0x08,0x2c
+,0xc1,0x0e,0x11,0x48,0xa0,0x97,0x66,0x49,0xc9,0x30,0x49,0xbd,0x26,0x6c,0x04,0x0e,0x7b,0xc5,0xd8,0x28
+,0x22,0xe0,0x6f,0x29,0xfc,0xf8,0x04,0x84,0x1b,0x06,0x43,0xd2,0x63,0xe8,0x21,0x78,0x85,0x3b,0x1e,0xb8
+,0xa5,0xf4,0x13,0x24,0xd1,0x71,0xd5,0x90,0xc5,0xe3,0xd0,0x27,0x3a,0x7e,0x20,0xcd,0x94,0x77,0x82,0x73
+,0x5e,0x23,0x6d,0x2b,0x3e,0x60,0x04,0xf6,0x1d,0xb1,0x10,0xdf,0x19,0xc7,0x0f,0x7f,0x54,0xfc,0x60,0xa2
+,0x1b,0x39,0x1a,0x07,0x23,0x04,0x20,0xbf,0xe6,0x14,0x9c,0xf8,0xca,0x58,0x44,0x28,0xf0,0x58,0xc5,0x0b
+,0xfa,0xfa,0xc7,0xef,0x66,0xb8,0x54,0xd2,0xfe,0x6e,0x26,0x16,0x4b,0x64,0x7c,0xc1,0x19,0xa7,0x89,0x05
+,0xbf,0x83,0x2b,0x72,0x42,0x4a,0xc1,0x55,0x89,0x58,0xa4,0x84,0x5e,0xc2,0x9c,0x52,0x42,0xb8,0x0f,0x97
+,0xf4,0x25,0x01,0x48,0x59,0x0a,0x67,0x54,0xe2,0xe0,0x25,0xbf,0x61,0x8e,0x5e,0x37,0x12,0x32,0x4c,0x3d
+,0x38,0x53,0x2f,0xb8,0xca,0x0c,0x2c,0xbd,0x01,0x0d,0x6a,0x2c,0xb8,0x10,0x77,0x40,0x81,0x67,0xcf,0x30
+,0xe6,0xd4,0x78,0x6a,0x6e,0xe1,0x58,0x90,0x8b,0xc0,0x92,0xdc,0x9d,0xea,0x33,0xee,0x58,0x40,0x8d,0xe6
+,0x0a,0x2d,0x92,0x59,0xce,0x22,0x97,0x82,0x44,0x97,0x56,0x4c,0x8c,0x05,0x21,0x30,0xfa,0x7e,0x01,0x48
+,0x20,0x21,0xe8,0x21,0xbe,0xf1,0x73,0x2d,0xfd,0x38,0x73,0x2a,0xee,0xfc,0x05,0x12,0xa4,0x97,0x12,0x50
+,0x6a,0xc0,0x7c,0x1d,0x0c,0x02,0x54,0x68,0x5f,0xbd,0x34,0x89,0x4a,0xc2,0xba,0x46,0x4e,0x1d,0xc5,0xdd
+,0xc5,0xcf,0x6b,0xa1,0x79,0xb3,0x70,0x0e,0x42,0xde,0xe7,0x7e,0x92,0xe6,0xa5,0x13,0x90,0xb6,0xad,0xac
+,0xff,0x14,0x44,0xcc,0x10,0xf8,0xa8,0x16,0x0a,0xe7,0xeb,0x0c,0xe2,0x78,0x04,0x2b,0x85,0x15,0xb5,0x56
+,0xb2,0x97,0x18,0x00,0x37,0x38,0x9a,0x7c,0x87,0x10,0xf3,0x5d,0x8f,0xfb,0x34,0x9c,0xe6,0xb2,0xa2,0x8a
+,0x4f,0xc8,0x7b,0x3e,0xc1,0xaf,0xec,0x91,0x66,0xdd,0x14,0x8e,0x37,0x84,0x3a,0xcc,0x47,0xe8,0x43,0xea
+,0x9d,0x67,0x48,0xa0,0xe0,0xcf,0xf1,0x80,0xc6,0x22,0x87,0x44,0x2a,0x3f,0x4e,0x22,0xf5,0x3e,0xd4,0x6d
+,0x09,0x72,0x1c,0x7a,0xd9,0xb1,0x12,0x46,0x24,0x48,0xfc,0x86,0x81,0x6f,0x4f,0x0b,0xf9,0x31,0x8a,0x83
+,0xd1,0x42,0x1e,0x44,0xf0,0x27,0x11,0xc6,0x79,0x21,0x55,0x21,0xbf,0x16,0x0e,0x89,0x01,0xdd,0x68,0xcd
+,0x97,0xcc,0xc2,0xb2,0x18,0x0c,0x3a,0xbe,0x76,0x85,0x79,0xd9,0xf3,0xf0,0x2d,0xf6,0xdc,0x12,0x28,0x70
+,0x3f,0x88,0xd3,0x8c,0x27,0xc6,0x50,0x12,0xdd,0x78,0x50,0x26,0x16,0x40,0x59,0xcd,0x3a,0x24,0x64,0x65
+,0xb6,0x79,0x5e,0x96,0xb6,0x7f,0x8f,0x9f,0x47,0x6c,0x93,0x12,0x0d,0x43,0x3a,0xed,0x8d,0x5d,0x97,0x85
+,0xa5,0x3b,0xd3,0x25,0x1a,0x00,0x5b,0xa6,0xc0,0x25,0x32,0x49,0x92,0x36,0xe4,0xc4,0x92,0xf4,0xee,0x92
+,0xa1,0xdc,0x49,0x11,0x8b,0x52,0xf8,0xd9,0x24,0xb6,0x7a,0x75,0x27,0xe6,0xe8,0xeb,0xd9,0x59,0x40,0x30
+,0x3c,0x20,0xde,0xd0,0xfc,0x60,0x1b,0xf1,0x26,0x3f,0x14,0x07,0x3e,0x12,0x63,0x0a,0x9e,0xe8,0x8a,0x8f
+,0x46,0xcc,0x29,0xc4,0xda,0x40,0xd9,0xe0,0x1c,0x04,0xf8,0x1d,0x0c,0xb9,0x90,0xb0,0x95,0xa9,0xd9,0x67
+,0x20,0x1b,0x54,0xfa,0x2c,0xfe,0x8d,0xfb,0xf1,0x41,0x43,0x07,0x9c,0xb1,0xf4,0x40,0xea,0x93,0x9a,0x65
+,0xd7,0xea,0x47,0x7a,0x33,0xbb,0x16,0xc6,0xf1,0xc2,0xb5,0x7a,0x3a,0x71,0x21,0xb0,0x3f,0xce,0x34,0xc0
+,0x4e,0xb3,0xbe,0x9b,0xc1,0x5a,0x49,0x92,0xa5,0x0d,0x09,0x1f,0xce,0x28,0x08,0x14,0x78,0x98,0x22,0xc0
+,0x03,0xd5,0xa8,0xf4,0xc5,0xdf,0xde,0xbd,0xa9,0xd8,0x80,0x4f,0xcc,0x7e,0xee,0x7d,0x82,0xbc,0x0a,0xe7
+,0x3a,0xea,0x76,0xe6,0x05,0x3d,0xfd,0x4f,0x3c,0x42,0x29,0x9a,0xa7,0x88,0x92,0xd2,0x13,0x52,0xf7,0x91
+,0xf1,0x97,0x49,0x66,0x88,0x04,0xe4,0x39,0xd1,0x66,0x55,0x3f,0x8d,0x58,0xbf,0x34,0x4f,0x1b,0xe8,0x60
+,0x15,0xe8,0x7c,0x0a,0x4b,0x8a,0xe4,0xe5,0x39,0x86,0x58,0x35,0x64,0xd7,0xc1,0x55,0x6e,0x55,0xbc,0xa0
+,0xe8,0xd2,0x70,0x78,0xd6,0x16,0xa6,0x7a,0x26,0x8c,0x52,0x25,0x8d,0x1c,0x1b,0x28,0xc2,0x12,0xa0,0xef
+,0xc9,0x41,0x4d,0x78,0x41,0x6d,0x9e,0x12,0x17,0xb2,0xb6,0x74,0x40,0xcc,0xcf,0x7a,0xca,0xb9,0x0a,0xb3
+,0xe6,0x79,0xb7,0x26,0xf2,0xae,0x2c,0x39,0x39,0xff,0x80,0x06,0x08,0x1c,0xe6,0xbb,0x59,0x01,0x8c,0x86
+,0x02,0x23,0x59,0xf0,0x90,0xcc,0xfc,0x64,0x21,0x9a,0xe7,0xc9,0x6e,0x7d,0x97,0x91,0x21,0xab,0xc2,0x36
+,0xa7,0xe8,0x3e,0xc0,0x69,0x64,0x91,0xaa,0x17,0x8b,0xad,0x4a,0x9f,0x33,0xf9,0x95,0x3e,0x19,0xde,0xa6
+,0x88,0x57,0x4b,0xfc,0x54,0xa9,0xcf,0x09,0xec,0x31,0x6e,0x99,0x2b,0xd4,0x71,0x2e,0xae,0xe1,0xe0,0x0d
+,0x8f,0x40,0x44,0x16,0xea,0xa5,0xf3,0x9f,0x7f,0xea,0xca,0x8f,0x0e,0xbc,0x09,0xa8,0x03,0xe5,0xca,0x74
+,0xc7,0xbe,0xa8,0xc0,0xba,0x31,0x4b,0x0f,0x49,0x4f,0x3f,0x33,0x66,0x98,0x1a,0xba,0x2d,0xb9,0xeb,0xd1
+,0xcf,0x2a,0x88,0xbe,0x31,0xb3,0x69,0xc4,0x4a,0xe9,0xfe,0xa5,0x64,0x75,0xdb,0x67,0x15,0x75,0x1f,0xe8
+,0xa4,0x8e,0xdf,0x52,0x01,0xcb,0x5f,0xb5,0x04,0x91,0xf8,0xf3,0x6a,0xc9,0x12,0xc7,0xf2,0x41,0xc5,0x32
+,0xa4,0x6b,0x39,0x45,0xe4,0xf2,0x3c,0xb1,0x7c,0xe7,0x3d,0xa5,0x1e,0xf7,0x86,0x3c,0x46,0xca,0x52,0xbd
+,0xa4,0xa8,0xd4,0x0e,0xc9,0x92,0x16,0x68,0x25,0xaa,0x4e,0x80,0x5c,0x50,0xdb,0xba,0x46,0x02,0xf5,0x82
+,0xd8,0xed,0x4c,0xf1,0x85,0xba,0xd2,0x92,0x21,0xc1,0xda,0x67,0xed,0xce,0x0c,0x24,0xc6,0x96,0x1f,0x6d
+,0x82,0x06,0x82,0x02,0x22,0xf6,0x09,0x25,0x23,0x31,0xdd,0x25,0x82,0x90,0x0d,0xa1,0xe6,0xe7,0x69,0xfa
+,0xab,0x99,0xa4,0x2f,0xf3,0x43,0xab,0x73,0x96,0x7d,0x59,0xae,0xbd,0x5f,0x4b,0xcc,0xc1,0x5a,0xa6,0x6b
+,0xe6,0xd4,0x13,0x93,0xb7,0xf5,0x33,0xb3,0x6b,0x9e,0x1b,0x30,0xf3,0xbc,0xbd,0xaf,0xa3,0x93,0xec,0xb7
+,0xcf,0x8d,0xff,0xfc,0xe7,0xbc,0x85,0xb8,0x5c,0xb4,0xe6,0x20,0x40,0x30,0x48,0x74,0x4e,0xf4,0x8b,0x39
+,0x1c,0x66,0xb7,0xbd,0xbf,0xdf,0x35,0xb3,0xf3,0x76,0xd7,0xb0,0xc4,0x75,0x61,0x7b,0x53,0xfd,0x86,0x51
+,0xf3,0xfc,0xe9,0xd3,0x0b,0x68,0x35,0xbb,0x27,0x88,0xba,0xb5,0x0f,0xa7,0x7a,0x89,0x32,0x5b,0xf2,0xe5
+,0xce,0x49,0xf7,0x84,0xe9,0xd7,0x86,0xe5,0xe2,0x8f,0x12,0xed,0xe7,0x2f,0xe8,0xae,0x1e,0x1b,0x26,0xd3
+,0x23,0x03,0x98,0x33,0x3c,0x76,0xc5,0x71,0x29,0x7d,0x68,0x3a,0x47,0xeb,0xea,0x37,0x86,0xc5,0xf0,0x47
+,0xa9,0xb8,0x45,0x4d,0x69,0x60,0xdd,0xee,0xc9,0x40,0xf7,0x0d,0xab,0x0f,0x3f,0x0c,0x23,0x69,0x65,0x70
+,0xc2,0x1e,0x25,0x9c,0x5e,0x0a,0x27,0x0a,0xc2,0x53,0xcf,0xd3,0x4b,0xb2,0xf6,0x95,0x8c,0x0a,0xf4,0x58
+,0x17,0x14,0x1d,0x54,0xd8,0x18,0x23,0x8d,0xdb,0x57,0x6d,0x1d,0x0d,0xc7,0xc0,0x3b,0xe4,0x97,0xc0,0xde
+,0x06,0x0e,0x44,0x70,0x02,0xe2,0xa5,0x8d,0x87,0x9d,0x54,0x65,0x37,0x9b,0x36,0x14,0x59,0x18,0x80,0xe7
+,0xab,0x30,0x3b,0xab,0x7c,0x8a,0x30,0x2e,0x92,0x15,0x24,0xb7,0x89,0x56,0xdc,0xcd,0xe7,0x64,0xec,0x82
+,0x50,0x5c,0x07,0x50,0xfe,0xec,0x82,0xbe,0x7f,0x99,0xfb,0xd0,0x00,0xc2,0xbf,0xd6,0x62,0xab,0x2d,0x1c
+,0x66,0xe3,0x15,0x90,0x37,0xf6,0xa0,0x67,0x4f,0x9f,0x2e,0x2f,0xa6,0x22,0xe1,0xd3,0x3c,0x54,0x20,0xd7
+,0x5d,0xc8,0x3b,0x6c,0x67,0xd3,0x1f,0xc1,0x91,0x65,0xf6,0x04,0x97,0xbc,0xba,0x8b,0x66,0xbe,0xd5,0x06
+,0x6a,0x6f,0x3d,0x75,0xf6,0x55,0x0f,0x20,0x1b,0xae,0x27,0x2b,0x7c,0xac,0x03,0x48,0xfd,0xf5,0xa4,0xb9
+,0x2f,0x6c,0x00,0x61,0xb0,0x9e,0x30,0xbf,0x95,0x07,0xca,0x91,0x74,0x8c,0xb4,0x77,0xab,0xc8,0x4e,0xc7
+,0x9c,0x70,0xdf,0x09,0x26,0xe9,0xd9,0xb0,0xc2,0x61,0xcb,0x11,0xbe,0x7e,0xff,0xd3,0x9b,0x76,0x69,0xed
+,0x27,0x43,0x4a,0x89,0xf9,0x79,0x89,0x1b,0x90,0xe8,0x9f,0x4c,0x31,0xfa,0x09,0xab,0x61,0x1b,0x3d,0xed
+,0x59,0x09,0x1a,0xa3,0x52,0x92,0xf6,0x45,0xe8,0x85,0xfa,0xd5,0xc2,0x32,0x97,0xd8,0xfc,0x5d,0x2a,0xc6
+,0x2d,0xaf,0xe8,0xc7,0x28,0xd4,0x9c,0x1d,0xf4,0xc8,0xb2,0x64,0x9d,0x7c,0xb0,0x7b,0xd0,0x17,0x43,0x57
+,0xa2,0x36,0x18,0xc9,0x47,0xc1,0x39,0x31,0x83,0xe5,0xf9,0x4c,0x5c,0x18,0x16,0x2f,0x48,0x5f,0x38,0x2b
+,0x2e,0x0f,0xd1,0x98,0x13,0xad,0x75,0x76,0x02,0xd3,0xad,0xcf,0xc0,0xdd,0xf4,0x8b,0xb3,0x7b,0x10,0xa5
+,0x89,0xb9,0x91,0x9b,0x66,0xc1,0x3a,0xc0,0x22,0x21,0xd8,0x61,0xf2,0x91,0xa1,0x80,0xbd,0xd9,0x7a,0x44
+,0x31,0x01,0x19,0x66,0x74,0x2b,0x41,0xee,0xc9,0x34,0xa0,0x8d,0x6f,0xf1,0xcc,0xc5,0xe7,0xa6,0x4a,0x46
+,0x2b,0x2c,0xca,0x05,0x6a,0x86,0x86,0x19,0x66,0x55,0x6e,0x4d,0xca,0x4b,0x03,0x6b,0x7c,0x8b,0x60,0x0c
+,0x25,0xbf,0xbe,0x95,0x20,0xff,0x4c,0x2a,0xc8,0x32,0x5e,0x92,0x65,0x6c,0x98,0xe3,0x4c,0x96,0x2c,0x2f
+,0xa7,0xab,0x4f,0x6e,0x61,0x9e,0x66,0x64,0xc3,0xbc,0x59,0x4f,0x55,0x78,0xc5,0x04,0x04,0x98,0x2c,0x09
+,0x30,0x81,0x70,0xc9,0x04,0xc8,0x72,0x7a,0x2a,0xc0,0xf4,0x8e,0x98,0x95,0xf7,0x96,0x41,0x86,0x2f,0x77
+,0x10,0xce,0xab,0x83,0x61,0x9e,0xde,0x42,0x9b,0x7e,0x25,0x06,0x64,0x3d,0x5d,0x92,0xf5,0xd4,0x30,0x9f
+,0x1f,0x9f,0xca,0x4a,0x07,0xd5,0x85,0xeb,0x53,0xcc,0x82,0x26,0xd7,0xbf,0xe0,0x6f,0x70,0xde,0xe9,0xc2
+,0x14,0x95,0xf8,0xb3,0x49,0x27,0x3a,0xf5,0x18,0xc4,0x74,0xe9,0x17,0x8f,0x41,0x67,0xa2,0xde,0x5a,0x21
+,0xdd,0x1f,0x5f,0x92,0x20,0x24,0xe2,0x83,0x87,0x72,0x0b,0x3c,0x96,0x6d,0x93,0xf8,0xa6,0x1d,0x61,0xf8
+,0x95,0x50,0x79,0x23,0x83,0x43,0x97,0xc9,0xf0,0xfd,0x57,0xb6,0x8f,0xd8,0x07,0x98,0x99,0xa5,0x14,0x86
+,0x85,0x67,0x7a,0x4f,0x9f,0x1a,0xe6,0xfe,0x34,0xb5,0x28,0x48,0x89,0xc5,0x2f,0x13,0x11,0x64,0xfc,0xb2
+,0x13,0x19,0xbf,0x14,0x64,0xfc,0x02,0x80,0xcd,0x23,0x60,0x20,0x25,0x04,0x35,0x6a,0x86,0x2a,0xd6,0x50
+,0x5b,0x5b,0x7b,0xf9,0x3b,0x95,0xea,0xf6,0xa4,0x3c,0x93,0xdf,0x25,0x3b,0xae,0xca,0xcf,0xe2,0xff,0x2f
+,0x6d,0xc9,0x0b,0xdb,0x2e,0x5f,0x00,0x00
+};
+
+//File: index_ov3660.html.gz, Size: 4408
+#define index_ov3660_html_gz_len 5435
+const uint8_t index_ov3660_html_gz[] = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x5d,0xeb,0x72,0xdb,0x46,0xb2,0xfe,0xef,0xa7
+,0x18,0x23,0x8e,0x09,0x96,0x79,0xd7,0xc5,0x0a,0x25,0xd2,0x6b,0x3b,0x72,0x9c,0x53,0xbe,0x24,0xb6,0x93
+,0x6c,0x55,0xca,0x65,0x83,0xc0,0x90,0x44,0x04,0x02,0x30,0x00,0x8a,0xd2,0xaa,0xf8,0x1c,0xe7,0x81,0xf6
+,0xc5,0xb6,0x7b,0x66,0x00,0x0c,0x40,0x5c,0x49,0x4b,0xf4,0xc9,0x1e,0xab,0x2c,0x81,0xc0,0x4c,0x4f,0x5f
+,0xbf,0xee,0x19,0x00,0xc3,0xb3,0xfb,0x86,0xa3,0x07,0xd7,0x2e,0x25,0xf3,0x60,0x61,0x8d,0xef,0x9d,0xf1
+,0x3f,0x04,0xfe,0x9d,0xcd,0xa9,0x66,0xf0,0x43,0xf6,0x71,0x41,0x03,0x8d,0xe8,0x73,0xcd,0xf3,0x69,0x30
+,0x52,0x96,0xc1,0xb4,0x7d,0xa2,0xa4,0x2f,0xdb,0xda,0x82,0x8e,0x94,0x4b,0x93,0xae,0x5c,0xc7,0x0b,0x14
+,0xa2,0x3b,0x76,0x40,0x6d,0x68,0xbe,0x32,0x8d,0x60,0x3e,0x32,0xe8,0xa5,0xa9,0xd3,0x36,0xfb,0xd0,0x32
+,0x6d,0x33,0x30,0x35,0xab,0xed,0xeb,0x9a,0x45,0x47,0x7d,0x99,0x56,0x60,0x06,0x16,0x1d,0x9f,0xbf,0xff
+,0xe5,0x60,0x40,0xde,0xfe,0x7e,0x70,0x7c,0xdc,0x3b,0xeb,0xf2,0x73,0x71,0x1b,0x3f,0xb8,0x96,0x3f,0xe3
+,0xbf,0x89,0x63,0x5c,0x93,0x9b,0xc4,0x29,0xfc,0x37,0x05,0x26,0xda,0x53,0x6d,0x61,0x5a,0xd7,0x43,0xf2
+,0xd4,0x83,0x31,0x5b,0x2f,0xa9,0x75,0x49,0x03,0x53,0xd7,0x5a,0xbe,0x66,0xfb,0x6d,0x9f,0x7a,0xe6,0xf4
+,0x74,0xa3,0xe3,0x44,0xd3,0x2f,0x66,0x9e,0xb3,0xb4,0x8d,0x21,0xf9,0xae,0x7f,0x82,0x3f,0x9b,0x8d,0x74
+,0xc7,0x72,0x3c,0xb8,0x7e,0xfe,0x02,0x7f,0x4e,0xb3,0x47,0xf7,0xcd,0x7f,0xd1,0x21,0xe9,0x1f,0xbb,0x57
+,0x89,0xeb,0xeb,0x7b,0x89,0x8f,0xf3,0x41,0x1e,0xf7,0xa2,0xff,0x49,0x71,0x7f,0x9f,0xea,0x81,0xe9,0xd8
+,0x9d,0x85,0x66,0xda,0x19,0x94,0x0c,0xd3,0x77,0x2d,0x0d,0x74,0x30,0xb5,0x68,0x21,0x9d,0xef,0x16,0xd4
+,0x5e,0xb6,0x4a,0xa8,0x21,0x91,0xb6,0x61,0x7a,0xbc,0xd5,0x10,0xf5,0xb0,0x5c,0xd8,0xa5,0x64,0x8b,0xf8
+,0xb2,0x1d,0x9b,0x9e,0x66,0x0f,0xb4,0xf2,0x34,0x17,0x1b,0xe0,0xdf,0xcd,0x26,0x0b,0xd3,0xe6,0x4e,0x35
+,0x24,0x07,0x87,0x3d,0xf7,0xaa,0xc4,0x94,0x07,0xc7,0xf8,0xb3,0xd9,0xc8,0xd5,0x0c,0xc3,0xb4,0x67,0x43
+,0x72,0x92,0x49,0xc2,0xf1,0x0c,0xea,0xb5,0x3d,0xcd,0x30,0x97,0xfe,0x90,0x1c,0x66,0xb5,0x59,0x68,0xde
+,0x0c,0x78,0x09,0x1c,0x60,0xb6,0xdd,0xef,0x15,0x34,0xf1,0xcc,0xd9,0x3c,0x00,0x93,0x6e,0xb4,0x49,0x2b
+,0x4d,0x84,0x50,0x99,0x3d,0x0b,0xf5,0x96,0xad,0x35,0xcd,0x32,0x67,0x76,0xdb,0x0c,0xe8,0x02,0xc4,0xf1
+,0x03,0x8f,0x06,0xfa,0xbc,0x88,0x95,0xa9,0x39,0x5b,0x7a,0x34,0x83,0x91,0x48,0x6f,0x05,0x02,0xc3,0xc5
+,0xcd,0x4b,0xed,0x15,0x9d,0x5c,0x98,0x41,0x5b,0xe8,0x64,0x42,0xa7,0x8e,0x47,0x33,0x5b,0x86,0x2d,0x2c
+,0x47,0xbf,0x68,0xfb,0x81,0xe6,0x05,0x55,0x08,0x6a,0xd3,0x80,0x7a,0xe5,0xf4,0x28,0x7a,0x45,0x39,0xb5
+,0xfc,0x61,0x45,0x03,0xd3,0xb6,0x4c,0x9b,0x56,0x67,0x2f,0x6f,0xdc,0x24,0x39,0xde,0xaa,0x82,0x61,0xcc
+,0xc5,0xac,0xc8,0x4b,0x98,0xac,0x9b,0x83,0x89,0xb8,0xe9,0xf7,0x7a,0xdf,0x6f,0x5e,0x9c,0x53,0xee,0xa6
+,0xda,0x32,0x70,0x76,0x8f,0x88,0x93,0x12,0x5f,0xff,0xc7,0x82,0x1a,0xa6,0x46,0x54,0x29,0x9c,0x4f,0x7a
+,0xe0,0x53,0x4d,0xa2,0xd9,0x06,0x51,0x1d,0xcf,0x84,0x40,0xd0,0x18,0xdc,0x58,0x70,0x06,0x12,0x87,0x4b
+,0x9b,0x19,0x22,0x17,0xc4,0x8c,0xac,0x91,0xec,0xb0,0xa9,0x08,0x39,0x95,0x02,0x28,0x43,0xc6,0x52,0x7b
+,0x55,0xb1,0x19,0x57,0xec,0x55,0xbb,0xd0,0x76,0x61,0xa3,0xd0,0x86,0x90,0x66,0x75,0x15,0x9a,0x5e,0xce
+,0x49,0x9b,0x20,0x4a,0x36,0xb3,0xfb,0x08,0xa2,0xd9,0x26,0x4f,0x3b,0x45,0x0d,0x71,0xb3,0x45,0x8d,0xb1
+,0x83,0xff,0xb8,0x57,0x79,0x92,0xe4,0xa2,0x48,0x3d,0x24,0xa9,0x81,0x26,0xb5,0x10,0xa5,0x32,0xaa,0xd4
+,0x42,0x96,0x3a,0xe8,0x52,0x03,0x61,0x2a,0xa1,0x0c,0x37,0x67,0x79,0xbd,0xf1,0xdd,0x64,0x19,0x04,0x8e
+,0xed,0xef,0x94,0xa2,0xf2,0xe2,0xec,0xaf,0xa5,0x1f,0x98,0xd3,0xeb,0xb6,0x08,0x69,0x88,0x33,0x57,0x83
+,0x12,0x72,0x42,0x83,0x15,0xa5,0xc5,0xe5,0x86,0xad,0x5d,0x02,0xee,0xcc,0x66,0x56,0x96,0xef,0xe9,0x4b
+,0xcf,0xc7,0xba,0xcd,0x75,0x4c,0x20,0xec,0x9d,0x96,0xe0,0x66,0xc5,0x81,0xda,0xfa,0x24,0x63,0x2c,0x67
+,0x19,0xa0,0x8e,0x33,0x2d,0xe1,0x80,0x38,0x66,0x70,0x9d,0x79,0x4d,0x44,0x62,0x2f,0x1f,0x97,0x7b,0xd5
+,0xf9,0x1a,0xea,0x73,0xaa,0x5f,0x50,0xe3,0x51,0x69,0x19,0x56,0x56,0x1e,0x76,0x4c,0xdb,0x5d,0x06,0x6d
+,0x2c,0xa7,0xdc,0x5b,0xb1,0x39,0x73,0xc8,0x50,0xc4,0xc1,0xa0,0xa8,0xa8,0x38,0x72,0xaf,0x8a,0x95,0x20
+,0x33,0x3b,0xb6,0xb4,0x09,0xb5,0x8a,0x58,0x16,0xc1,0x90,0x03,0xbb,0x02,0xab,0xf2,0x6b,0xb7,0x54,0x2d
+,0x7a,0xf8,0xf8,0xfb,0xca,0x7a,0x64,0xc7,0xad,0xc4,0x29,0x9f,0x5a,0x10,0x60,0x79,0xa5,0x37,0xb4,0x59
+,0x01,0x0f,0x85,0x03,0x78,0x9a,0x3d,0xa3,0x80,0x05,0x57,0xad,0xf0,0xb0,0x78,0x62,0x50,0x49,0x7c,0x84
+,0xea,0xa3,0xe2,0x89,0x08,0x07,0x84,0x2d,0x8a,0x11,0xc9,0xac,0x85,0xe3,0xf7,0x07,0xf9,0x15,0x7a,0x66
+,0xc0,0x24,0x5d,0x2a,0xb3,0xbe,0x2f,0x45,0x84,0x70,0xa6,0x37,0x9d,0x96,0xcd,0x15,0xa7,0xd3,0x83,0xde
+,0xc1,0x61,0x69,0xc1,0x94,0x29,0x65,0x6a,0xbe,0x78,0x5a,0x80,0x26,0xe5,0x26,0x18,0xce,0x9d,0x4b,0xea
+,0x65,0x18,0x22,0xc5,0xee,0xe1,0x0f,0x87,0x46,0x05,0x6a,0x1a,0xe0,0xfd,0x25,0x2d,0x25,0x37,0xe8,0xeb
+,0x83,0x7e,0x39,0xb9,0x0e,0x78,0x83,0x36,0xb1,0xa8,0x51,0x00,0xcf,0x06,0x9d,0x6a,0x4b,0x2b,0x28,0xd1
+,0xb7,0xd6,0xc3,0x9f,0xa2,0x11,0x59,0x5c,0xfd,0x89,0x0b,0x1d,0x23,0x16,0x09,0x1f,0x33,0xc6,0x0c,0x73
+,0xa7,0xe6,0xba,0x54,0x83,0x56,0x3a,0xcd,0x9b,0x92,0x56,0xaa,0x99,0xb3,0x81,0xab,0xd2,0x44,0xb4,0xd4
+,0x15,0xa3,0x6a,0xa8,0x96,0xcc,0xc3,0xa9,0xa3,0x2f,0xfd,0xc2,0x04,0x55,0x8f,0xde,0x30,0x54,0x99,0x6f
+,0x99,0xcc,0xb1,0x97,0xb6,0x8d,0x16,0x6d,0x07,0x1e,0x88,0x99,0x31,0x50,0x35,0xc5,0x6d,0x15,0x9d,0x09
+,0xc5,0xe6,0x2d,0xc6,0xa4,0x02,0xb0,0x57,0x80,0x21,0xc4,0x77,0x40,0xa8,0x90,0xd4,0x6e,0x7a,0x09,0xe6
+,0xcb,0x45,0x56,0x61,0x10,0x0e,0xd6,0x87,0x2c,0xc6,0x87,0xf3,0x66,0x13,0x4d,0xed,0xb5,0x7a,0xad,0x03
+,0xf8,0xd5,0xac,0xeb,0x5c,0x42,0xbd,0x83,0x41,0x85,0xf5,0x8b,0xa3,0xf2,0x75,0x92,0x3c,0x18,0x2b,0xb5
+,0x45,0xf5,0x48,0x4a,0x2e,0x98,0xf4,0x3b,0x25,0x89,0x25,0xc7,0xa5,0xeb,0x3b,0x62,0x86,0xb7,0xd4,0x35
+,0xf1,0xc2,0xf9,0x57,0x9b,0x67,0xd5,0xff,0x7a,0x6f,0x97,0x54,0xf1,0xb7,0xf6,0xf4,0xda,0x7a,0xf1,0xf7
+,0xed,0x1b,0xbd,0x7c,0xab,0xb7,0x45,0x3d,0x03,0x1c,0xda,0x30,0xa9,0xf2,0x60,0x76,0x95,0x5b,0xf3,0x48
+,0x6d,0xb6,0xd0,0xc1,0xd4,0xb4,0xac,0xb6,0xe5,0xac,0xca,0x2b,0x91,0x62,0x4f,0xde,0xf0,0xd3,0x72,0x97
+,0xdf,0x96,0xdb,0x25,0x20,0xd7,0xff,0x09,0x6e,0xff,0xdb,0x52,0x8b,0x14,0x1a,0xdb,0x25,0x8a,0x2d,0xfc
+,0x71,0xb7,0x81,0x2a,0xb9,0x12,0xaf,0x04,0x0b,0x27,0x73,0xfe,0xca,0x0c,0xf4,0xf9,0x16,0x93,0x2a,0xd7
+,0xf1,0x4d,0x7e,0x8f,0xc6,0xa3,0x96,0x86,0x15,0xfc,0x56,0x53,0xee,0xd2,0x89,0x89,0xdc,0xbd,0x8a,0x24
+,0x4c,0x75,0xdf,0xce,0x72,0x49,0x87,0xd7,0x0e,0xf9,0x58,0x9d,0xed,0xd6,0x25,0xe5,0x7e,0x32,0x32,0x06
+,0xbb,0x22,0x7a,0x08,0xda,0x33,0x8f,0x5e,0x57,0x10,0xa6,0x25,0xfe,0x0e,0xf9,0x82,0xe8,0xf6,0x73,0x7f
+,0x96,0x00,0x84,0x17,0x75,0x0e,0xfd,0x0a,0x43,0xe7,0x0f,0x59,0xc5,0x1f,0xa3,0xe5,0x3e,0x45,0xa9,0x00
+,0x37,0x05,0x29,0x34,0xdb,0x55,0xc3,0xec,0x9b,0x79,0xd1,0xa2,0xd3,0x20,0xe7,0x6e,0x06,0xab,0x53,0x0f
+,0x8a,0xd1,0xad,0x2d,0xad,0x13,0x94,0x22,0x47,0xb4,0x2a,0x97,0xef,0x7d,0x99,0x94,0x11,0x3d,0x6b,0x13
+,0xcf,0x37,0x49,0x58,0x3e,0x33,0x33,0x43,0x9b,0x85,0x48,0xf9,0x60,0x1e,0xfa,0x4f,0x75,0x70,0x9c,0x79
+,0xb3,0xa0,0xa0,0x71,0xf1,0xaa,0x71,0xce,0xb2,0xd6,0x66,0xca,0xca,0x9d,0x20,0xcb,0x58,0x74,0x58,0x3f
+,0x2a,0x8b,0x10,0x66,0x73,0x8d,0xa6,0x78,0x0d,0x6f,0xa1,0x41,0xd9,0x8b,0xee,0xaa,0x01,0x45,0x6f,0x4b
+,0x77,0x97,0x16,0x0d,0xfb,0xc7,0xbd,0x92,0x21,0x75,0xcb,0xf1,0x8b,0xe3,0x4a,0x9b,0x80,0xfe,0x96,0x41
+,0xc6,0x40,0x62,0xe9,0xf2,0x28,0xd7,0xb9,0x8f,0xb6,0x4e,0xdd,0x85,0x31,0x55,0x1c,0x8e,0x29,0x9d,0xf7
+,0x7b,0x99,0x48,0x5b,0xb8,0xfe,0x16,0xd0,0x2b,0x98,0x6f,0xe2,0x0d,0xb9,0x21,0xd1,0x69,0x36,0x8c,0x26
+,0x92,0x5c,0xbf,0xca,0x22,0x60,0xa1,0x1d,0xe6,0xa6,0x61,0x50,0xbb,0xec,0x81,0x86,0x8a,0xc5,0x03,0xf2
+,0xff,0xf1,0xae,0x82,0xa2,0xf0,0x3e,0x7d,0xff,0xb6,0x23,0x46,0x24,0x9a,0xbc,0x35,0xe2,0x64,0x29,0x52
+,0xc8,0xea,0xa0,0x70,0x99,0x18,0x55,0x06,0x7a,0xc0,0x56,0x9b,0x68,0x2e,0x71,0x75,0xd6,0x95,0x9e,0x25
+,0x3a,0xeb,0xc6,0x8f,0x3d,0x9d,0xe1,0x03,0x45,0xf2,0x23,0x47,0xfc,0x7e,0x17,0xd1,0x2d,0xcd,0xf7,0x47
+,0x0a,0x3e,0x18,0xa3,0x24,0x9f,0x40,0x3a,0x33,0xcc,0x4b,0x62,0x1a,0x23,0xc5,0x72,0x66,0x4e,0xea,0x1a
+,0xbb,0xce,0xef,0x40,0x00,0x68,0x8e,0x94,0xc4,0xdd,0x19,0x85,0xf5,0x8a,0x4f,0x29,0xe3,0x87,0xdf,0xfd
+,0xf0,0xf8,0xf1,0xf1,0xe9,0x43,0x7b,0xe2,0xbb,0xe2,0xf7,0x07,0x7e,0x33,0x8b,0x3f,0x11,0x05,0x38,0x1a
+,0x04,0x20,0xa7,0x7f,0xd6,0x65,0x44,0x53,0x8c,0x74,0x81,0x93,0x1c,0xde,0x44,0x6e,0xcd,0x62,0x2f,0x6c
+,0xe2,0x43,0xba,0x98,0x68,0x5e,0x46,0x13,0xd6,0x8c,0x57,0x6e,0xcc,0x6f,0x15,0x96,0x63,0x26,0xce,0x55
+,0x5a,0x02,0x26,0x94,0x48,0x40,0xa2,0x15,0x35,0xf2,0x08,0x42,0x37,0xd6,0x1d,0x6f,0x4d,0xe5,0xb4,0x89
+,0xf8,0x13,0xda,0x97,0xee,0x94,0xf0,0xa1,0xa7,0x9e,0xb6,0xa0,0xe8,0xfe,0xe2,0x64,0x3e,0x99,0xb4,0x25
+,0xa2,0x9e,0xca,0xf8,0xb9,0xe6,0x06,0x78,0xb3,0xfa,0x1d,0x65,0x08,0x0a,0xd6,0xce,0x54,0xef,0x06,0x35
+,0x91,0xd4,0x12,0x7c,0x28,0x21,0xab,0x62,0x11,0xbb,0xad,0x31,0xf7,0x29,0x61,0x8c,0x91,0x73,0x5c,0xe6
+,0x68,0x97,0x9a,0xb5,0x04,0x15,0xf7,0xfb,0xca,0xf8,0xd7,0x7f,0xfe,0xf4,0x54,0x1d,0xf4,0x0e,0x4f,0xae
+,0xfa,0x47,0xc7,0x87,0xcd,0xb3,0x2e,0x6f,0x52,0x9f,0x56,0x4f,0x19,0xff,0x86,0xb4,0x20,0xcf,0xf4,0xae
+,0xfa,0x83,0x5e,0x6f,0x7b,0x5a,0x3f,0x28,0xe3,0xf7,0x8c,0xd4,0xe0,0x04,0x48,0xf5,0x06,0x3b,0xb0,0x75
+,0xa2,0x8c,0x19,0x25,0x20,0x72,0xf5,0xf8,0xf8,0x64,0x7b,0x42,0x8f,0x81,0xa7,0xdf,0x81,0xd2,0x09,0x48
+,0x77,0xbc,0x8b,0x70,0xc7,0xca,0x18,0xe9,0x1c,0x1f,0xf6,0xae,0x0e,0x4f,0x76,0xa0,0x73,0xa4,0x88,0x8a
+,0x07,0xc3,0x20,0x3c,0x02,0x47,0xfb,0xf9,0x85,0x7a,0x08,0x3c,0x0e,0x7e,0x38,0xde,0x9e,0xf6,0x21,0xf8
+,0x05,0x32,0x79,0x30,0x00,0x42,0x87,0x3b,0x30,0x79,0xa0,0x8c,0x5f,0x32,0x4a,0x40,0xe5,0xaa,0xff,0x78
+,0x07,0x96,0xc0,0xbd,0x7e,0x65,0x94,0xc0,0xbf,0xd0,0xbd,0x2a,0x52,0x02,0x0c,0x66,0xaa,0x29,0x88,0xfd
+,0x4d,0x44,0xab,0x0c,0x0d,0xae,0x47,0xf1,0x99,0xd4,0x4f,0x5b,0xa1,0x83,0xdc,0x19,0x9c,0x2b,0xf0,0xa8
+,0xb6,0xd8,0x05,0x1f,0x12,0xf4,0xbe,0x16,0x44,0x7c,0x45,0xb7,0xcf,0x74,0xd7,0xaf,0x14,0x0a,0xff,0xef
+,0xf6,0x77,0xe9,0xf6,0x5f,0x96,0x50,0x10,0x07,0xd7,0xb5,0x3d,0x5e,0xf4,0x8b,0xb3,0xe1,0xaf,0xfc,0x44
+,0x35,0x57,0x97,0x38,0x8a,0x1e,0x3a,0x50,0xc6,0x87,0x25,0x82,0x6c,0xd4,0x15,0xac,0x6f,0x42,0x0e,0x05
+,0xa7,0x49,0x68,0x7d,0x7c,0xac,0x0d,0x3c,0xf5,0x40,0x91,0x92,0xda,0x56,0x81,0x94,0xc1,0xab,0x76,0xa5
+,0x8c,0x8f,0x0f,0xca,0xb4,0xbe,0x83,0x51,0x26,0x6c,0x0a,0x66,0x53,0xdf,0xaf,0x6d,0x97,0xb8,0xab,0x32
+,0x7e,0x16,0x1d,0xef,0x62,0x95,0xf6,0xc1,0x0e,0x66,0x91,0xd8,0xe1,0x96,0x69,0x1f,0x08,0xd3,0xc4,0x96
+,0xf9,0xba,0x86,0xb9,0x4d,0xbb,0x60,0x55,0xec,0x69,0x7e,0x50,0xdb,0x2a,0x61,0x47,0x08,0x17,0x71,0xb4
+,0x37,0x8b,0x44,0xac,0xfc,0x0d,0xec,0xe1,0x6b,0x00,0x3d,0xec,0x61,0xdf,0xda,0x16,0x89,0xbb,0x42,0x56
+,0x8c,0x8e,0x77,0xb2,0xca,0x2e,0xf0,0x25,0xb1,0x23,0xec,0x12,0x42,0xd8,0xe1,0x2d,0xd9,0xe5,0xf0,0x36
+,0xed,0x32,0xd7,0x3c,0x77,0x2b,0xf8,0x8a,0x7a,0x82,0x55,0xc2,0xc3,0xbd,0x85,0x4a,0xcc,0xcc,0xdf,0x20
+,0x56,0x0c,0x6a,0x3b,0xa6,0x5f,0xbf,0xb4,0x15,0xfd,0x94,0xf1,0x8f,0xb4,0xfd,0x06,0x8f,0x76,0x31,0xc7
+,0xd3,0x65,0xe0,0xec,0x60,0x90,0x90,0x17,0x6e,0x8e,0x9e,0xb0,0xc6,0xc9,0x2d,0x59,0xe3,0xe4,0x16,0xad
+,0xa1,0xd1,0x4f,0x16,0xbd,0xa4,0x56,0x6d,0x73,0x84,0x1d,0x95,0xf1,0xf9,0x95,0xeb,0xf8,0x58,0x79,0xbd
+,0xc2,0xcf,0x3b,0x05,0xc9,0xd1,0x0e,0x36,0x89,0x18,0x12,0x31,0x72,0x24,0xac,0x72,0x74,0x4b,0x56,0x39
+,0xba,0x45,0xab,0xcc,0x34,0xd3,0xd6,0xa9,0x69,0xe1,0x03,0xbc,0x75,0x0d,0x23,0xf5,0x55,0xc6,0x3f,0xc5
+,0x1f,0x76,0x31,0x4c,0x6f,0x07,0xbb,0xc8,0xfc,0x24,0xe3,0xe5,0xa8,0xdf,0xbf,0x2d,0xdb,0xf4,0xfb,0xb7
+,0x99,0x55,0x5c,0xaa,0x9b,0x9a,0xf5,0x89,0x4e,0xa7,0x30,0x1d,0xaa,0x9f,0x5a,0x12,0xdd,0x21,0xbf,0xf0
+,0xcf,0xe4,0x9c,0x7d,0xae,0x3d,0x45,0x4f,0x91,0xfb,0x5a,0x93,0xf4,0x5e,0xf6,0xdc,0xfa,0x8d,0x13,0xf1
+,0xb9,0xed,0xa2,0x1e,0x10,0xa1,0x33,0x76,0x6f,0x69,0x6b,0x1a,0x03,0xf0,0x6c,0x4f,0xbb,0x66,0x6f,0xe3
+,0xee,0x32,0xa1,0x7e,0x47,0x0d,0xf2,0xc1,0xb4,0x83,0x5d,0x66,0xf7,0x3f,0x79,0x94,0xda,0xbb,0x51,0x39
+,0x82,0x29,0x12,0x1c,0xec,0x46,0xe4,0x18,0x3c,0x89,0xba,0xa6,0xf6,0x2d,0x4c,0xe6,0xb5,0xd5,0xa4,0x7e
+,0x42,0x59,0x4d,0x20,0x2f,0xff,0xf1,0x8c,0x9c,0xb3,0xa7,0x21,0x6b,0xc3,0x15,0x7f,0x50,0xa3,0x8a,0xa3
+,0x73,0xa0,0x12,0x7c,0x2a,0x1b,0xb7,0x06,0xb2,0x03,0xa8,0xea,0xed,0x81,0x0c,0xf1,0x42,0x06,0xd9,0x7d
+,0x6d,0x45,0x92,0xb6,0x9a,0x8c,0xb7,0x58,0x8a,0xe9,0xab,0xfa,0x65,0x98,0xbe,0x02,0x33,0x19,0x97,0xf8
+,0xa0,0xac,0x41,0xc0,0x5e,0x77,0x62,0x28,0x1c,0x75,0x3f,0x86,0x62,0xf2,0xee,0xdb,0x50,0xe0,0x2d,0x9f
+,0x30,0x8f,0x6e,0x13,0x54,0xac,0xa3,0x32,0x7e,0xad,0xd9,0x4b,0x48,0x32,0x77,0x65,0xb0,0x68,0xe0,0xbd
+,0x85,0x97,0x90,0x7b,0xdf,0xa6,0x03,0x46,0x16,0x8e,0x51,0x7f,0xba,0x23,0xfa,0x71,0x48,0x7c,0x0d,0x47
+,0xb5,0x0b,0x83,0x90,0xc2,0x2d,0x57,0x04,0x7c,0x2a,0xb5,0x7d,0x31,0xf0,0x7e,0x69,0xdb,0xd7,0xbb,0x54
+,0x02,0xcf,0x2d,0x67,0x69,0x5c,0xef,0x52,0x06,0xbc,0x9d,0x4e,0x4d,0x9d,0xee,0x52,0x04,0xbc,0x74,0x16
+,0xf4,0x9b,0x48,0xbc,0x54,0xdf,0x62,0x26,0xa7,0x83,0x15,0xcf,0x9f,0xdf,0x69,0xe2,0x85,0x31,0xf7,0x84
+,0x0c,0x28,0xed,0xde,0xf1,0x9c,0xea,0x9f,0x98,0xf3,0x6c,0x63,0x2c,0xde,0x33,0x42,0xf4,0x70,0xfa,0xbd
+,0xaf,0xf9,0x5d,0xcc,0x51,0x72,0x76,0xd7,0x3f,0x3a,0x38,0x8e,0xa6,0x77,0x07,0x83,0xaf,0x3b,0xc1,0x43
+,0xe2,0xb7,0x6b,0x9f,0xc1,0x36,0xa6,0x01,0x34,0x7a,0x83,0xf7,0x19,0x6a,0x00,0xf6,0xee,0x81,0x34,0xd8
+,0x5f,0x24,0x0d,0xbe,0x81,0x50,0x9a,0x6d,0x81,0x78,0x33,0x44,0xbc,0x9f,0x9e,0xdf,0x8d,0x85,0x66,0x7b
+,0x83,0xba,0xd9,0x5e,0xa1,0x8e,0xf0,0x67,0x0e,0x23,0x33,0x6d,0x59,0xc1,0x8a,0x8e,0x7c,0x2d,0x6b,0x17
+,0x90,0xeb,0x5f,0xed,0x82,0x72,0x21,0x1b,0x49,0x90,0x3b,0x8e,0xef,0x8a,0x1c,0x7d,0xdd,0xdb,0xba,0x87
+,0x57,0xb7,0x18,0x34,0x9e,0xb6,0xfa,0x34,0x5b,0x68,0xb5,0x8d,0x21,0xfa,0x81,0x2d,0x5e,0x3f,0xbd,0xcb
+,0x72,0x21,0x1c,0x77,0x3f,0x71,0x14,0x49,0xbd,0x6f,0xac,0xb3,0xa8,0x5d,0x1f,0xec,0xb0,0x93,0x32,0x7e
+,0x45,0x6d,0x9f,0x3c,0x77,0x3c,0xb1,0x05,0xda,0x9d,0x58,0x8d,0x8d,0xbc,0x1f,0x93,0x71,0xa1,0xf7,0x6d
+,0xaf,0xf9,0xc2,0xf4,0x3c,0xc7,0xab,0x6d,0x32,0xd1,0x0f,0xa6,0x15,0xed,0xd7,0xec,0xe8,0x4e,0xcc,0x15
+,0x8e,0xba,0x1f,0x8b,0x45,0x32,0xef,0xdb,0x68,0x97,0x53,0xcb,0x74,0x6b,0x9b,0x8c,0xf5,0x52,0xc6,0xbf
+,0xb7,0x5f,0xc0,0xdf,0x3b,0x31,0x17,0x1f,0x71,0x3f,0xc6,0x12,0xd2,0xee,0xdb,0x54,0x13,0xb7,0x3e,0x1c
+,0x42,0x1f,0x65,0xfc,0xec,0x97,0xbb,0xa9,0xfd,0x70,0xb0,0x8a,0x16,0xda,0xc9,0x1e,0x4c,0xa8,0xbd,0xaf
+,0x74,0x6d,0x61,0x8d,0x15,0x32,0xfe,0xc7,0x1d,0x59,0x63,0xe5,0xee,0x2b,0x1d,0xad,0xbe,0x05,0xfb,0xb0
+,0x57,0x92,0x26,0x9a,0xb7,0xc5,0x43,0x63,0xbc,0x23,0x3e,0x34,0x06,0x47,0xe4,0x99,0x76,0x37,0x09,0x29
+,0x1a,0xf7,0x2e,0x42,0x28,0x16,0x72,0xdf,0x76,0x9a,0x6a,0x3a,0xfd,0x64,0xd0,0x60,0x9b,0x7b,0xcb,0x52
+,0x5f,0x65,0xfc,0x02,0x3e,0x90,0x1f,0xd9,0x87,0xbb,0x2a,0xf9,0xe4,0xf1,0xef,0xc2,0x6a,0x09,0x79,0xbf
+,0x09,0xc3,0x41,0x81,0xed,0xcc,0xec,0xad,0xde,0xec,0x49,0x74,0x17,0xe6,0x7b,0xc7,0x3f,0xdf,0xad,0x01
+,0x63,0x26,0xee,0xcc,0x86,0x92,0xdc,0x77,0x61,0xc6,0xf0,0xed,0x38,0x96,0xa4,0xf9,0x8e,0x90,0x65,0x96
+,0x12,0xef,0x00,0xb2,0x47,0x5a,0x68,0xd0,0xf6,0x03,0xd3,0xb2,0x60,0x22,0x4c,0x03,0xf2,0x1e,0x0f,0xcf
+,0xba,0xbc,0x41,0x75,0x2a,0xe2,0xd5,0x33,0x9f,0xbd,0xa4,0x81,0x2f,0x6b,0x68,0x1e,0xd2,0xc2,0x4f,0xf5
+,0x89,0x31,0x25,0x52,0xdb,0x73,0x80,0xa9,0xc8,0x48,0x62,0xcb,0x32,0x85,0x84,0x47,0xd2,0xb9,0xf1,0x39
+,0x6b,0x4c,0xd0,0xcb,0xca,0x87,0xc3,0xbb,0x16,0x7a,0xfe,0xcd,0x8d,0xb3,0xae,0xad,0x65,0xa8,0x3b,0xc7
+,0x0a,0x67,0x7c,0x93,0xd5,0x1c,0x52,0xd1,0x6b,0x7d,0x4c,0x13,0xf1,0xdb,0xca,0x91,0x58,0xe9,0xb7,0x98
+,0xc5,0x32,0x53,0xb5,0xa0,0x65,0xef,0x23,0x8b,0x7c,0x88,0x87,0x91,0xfa,0xff,0xfd,0xbf,0x65,0x3e,0x83
+,0x5b,0xe0,0xc6,0x8c,0x29,0xc4,0xf7,0xf4,0x91,0x92,0xf7,0x92,0x60,0x8e,0xe4,0xdd,0x2c,0xd1,0x53,0x8d
+,0x33,0x74,0x7d,0xe6,0xeb,0x9e,0xe9,0x06,0xe3,0x7b,0xdd,0x6e,0xf4,0x2a,0x25,0x99,0x39,0x84,0x6d,0x98
+,0xe7,0xd8,0x94,0xfc,0x41,0x27,0xef,0x1d,0xa8,0x53,0x02,0xb2,0x9a,0x9b,0x16,0x25,0x26,0x44,0xb3,0x4f
+,0x1c,0x97,0xda,0x2d,0xa2,0xf9,0xa4,0xcb,0x1e,0xb6,0x76,0x2c,0xe2,0xd1,0x2f,0x4b,0xea,0x07,0x70,0x29
+,0x98,0x53,0x6f,0x65,0xfa,0xf4,0x1e,0x5c,0xf2,0x03,0x12,0x36,0x18,0x11,0x55,0x6d,0x92,0xd1,0x98,0xbd
+,0xeb,0x6a,0x21,0x3d,0x1f,0xce,0xd9,0x4b,0xcb,0x6a,0x31,0x72,0xf0,0x61,0xaa,0x59,0x3e,0x6d,0x11,0x9b
+,0x5e,0x05,0xf0,0xa9,0xd7,0x82,0x13,0xa6,0x05,0x42,0x61,0x43,0xdc,0xb4,0x82,0x13,0x84,0xb6,0xf8,0x66
+,0x2b,0x9c,0xbb,0x59,0x47,0x27,0xe1,0xb7,0x8d,0xb7,0x27,0x61,0x94,0x68,0x10,0x22,0x86,0xa0,0xab,0x58
+,0x0a,0xf5,0xf3,0xca,0x1f,0x76,0xbb,0x0f,0x6e,0x2c,0x47,0x67,0x0f,0x23,0x77,0xe6,0x8e,0x1f,0xac,0xbb
+,0x2b,0xff,0x73,0x53,0x74,0xe9,0x38,0xb6,0xe0,0x47,0x90,0x0a,0xd9,0x0b,0xbc,0x25,0x3d,0x4d,0xf0,0x24
+,0x36,0x86,0x65,0x7d,0xf8,0xfb,0xe8,0x1b,0x9d,0x98,0x4c,0xa7,0xc4,0x9c,0x12,0xf5,0xd1,0xa3,0xa8,0xef
+,0x19,0x39,0x6a,0xa2,0xbe,0x3f,0x98,0x0b,0xea,0x2c,0x03,0x55,0xb0,0xdf,0x22,0x83,0x5e,0xaf,0xd7,0x94
+,0xc9,0x2e,0xa8,0xef,0x83,0x57,0x02,0x25,0x1a,0xcb,0x15,0x4a,0xbd,0x80,0xd3,0xff,0xf3,0xfe,0xed,0x9b
+,0x8e,0x8b,0xdf,0x47,0xa0,0xd2,0x8e,0xa1,0x05,0x5a,0xb8,0xed,0x00,0x0e,0xb9,0xe8,0xe0,0xbe,0x4b,0xf7
+,0x47,0x23,0xb2,0xb4,0x01,0x59,0xc1,0xab,0x0d,0xf2,0xf0,0x61,0xa8,0xc2,0x3f,0xd9,0xe5,0x8f,0x4d,0xe0
+,0x36,0x79,0x06,0xfa,0x39,0x17,0xcd,0x53,0x62,0x50,0x30,0x14,0x4d,0x5d,0x8c,0x76,0xc3,0xa5,0x20,0x99
+,0x18,0xc5,0x0f,0xb4,0x60,0xe9,0x23,0x69,0x61,0xee,0x0e,0xf2,0x87,0xe7,0x9a,0x1b,0x67,0xa2,0xe6,0x9c
+,0x51,0xa4,0x86,0xff,0x41,0x1b,0x3f,0xe3,0xcb,0xe6,0x97,0x9a,0x25,0x1c,0x85,0x69,0x10,0x48,0x82,0x1e
+,0x7c,0xe0,0x40,0x6d,0xdc,0xac,0x1b,0xcd,0x16,0xbe,0x17,0x8f,0x3a,0x02,0x87,0xbd,0xa0,0xd4,0xf5,0x09
+,0xf8,0x5b,0x68,0x7e,0x04,0xde,0xa9,0xe7,0x2c,0xc8,0x84,0xa2,0x87,0xe0,0x15,0xd3,0xb0,0xc0,0x2d,0xb9
+,0x9f,0x60,0x13,0x15,0x47,0xf5,0x68,0xb0,0xf4,0x6c,0xa2,0xe2,0x17,0x35,0xb4,0xf8,0x32,0xab,0xe4,0x35
+,0x5c,0xb7,0x6c,0x87,0x61,0xd0,0xaf,0x4b,0x3d,0xdc,0xdd,0x01,0x9f,0x4a,0xe9,0xd8,0xce,0x4a,0x6d,0x4a
+,0x6d,0x0c,0x8c,0x10,0x30,0xf9,0xa5,0xa9,0x81,0x13,0x5f,0x34,0xd3,0x16,0x72,0x2c,0xda,0xb1,0x9c,0x99
+,0xfa,0xf9,0xc1,0x0d,0x0e,0xb5,0x1e,0x3d,0xb8,0x61,0x83,0xad,0x79,0x7c,0xc1,0x27,0x53,0x5b,0x0f,0xe1
+,0xaf,0x73,0x41,0x9e,0x90,0x86,0x73,0xd1,0x20,0x43,0xd2,0x40,0x2f,0xa1,0x46,0x63,0x4d,0x4c,0x1b,0x2e
+,0xa9,0x1b,0x0c,0x90,0x36,0x67,0xae,0xd9,0x09,0x9c,0x17,0xe6,0x15,0x35,0xd4,0x7e,0x73,0x4d,0x16,0xa1
+,0x07,0x47,0xe2,0x39,0x17,0x91,0x82,0xb9,0x37,0xa0,0x42,0x9b,0x29,0x17,0x32,0x0d,0x10,0xe0,0xd1,0x23
+,0x8c,0x39,0x71,0x3e,0x54,0x37,0x73,0x2c,0x80,0x24,0xd0,0xa4,0x39,0xbd,0x56,0x6f,0x4c,0x63,0x08,0xad
+,0x51,0x5d,0xde,0x90,0x44,0x9a,0x1b,0x62,0x62,0x81,0x26,0x2a,0xd7,0xe2,0xba,0x99,0x62,0x02,0xa3,0xef
+,0x17,0x30,0x09,0x00,0x82,0xea,0xe1,0xeb,0x82,0x97,0xdc,0x8f,0x23,0xa7,0x32,0x8d,0x8f,0xc0,0x41,0x78
+,0x69,0x0d,0x42,0xcd,0xa9,0xad,0x82,0x42,0xa0,0x15,0xea,0x57,0x6d,0xac,0xfc,0x06,0xd3,0x6e,0x53,0x12
+,0x47,0x50,0x9f,0xe2,0x66,0xe3,0xa8,0xde,0x28,0x9c,0x1d,0xcf,0x9c,0x99,0xf6,0x3a,0xc4,0xa5,0x27,0xc0
+,0xed,0x48,0x68,0xff,0x21,0xb0,0x18,0x59,0xe0,0xb3,0x18,0xc8,0x8b,0xc7,0x99,0x07,0x81,0x0b,0x23,0x79
+,0x1d,0x31,0xd6,0xfa,0xde,0xba,0x09,0xe6,0x06,0x47,0xe3,0x2f,0x33,0x23,0xde,0x4d,0x4c,0x5b,0xf3,0xae
+,0x25,0x54,0x14,0xf1,0x09,0xb8,0x67,0x13,0xfc,0xb6,0x0f,0x72,0xd2,0x6f,0x31,0xc7,0x5b,0x40,0x15,0x63
+,0xba,0xe8,0x43,0x5d,0x8e,0xeb,0x00,0xa0,0xe0,0xcf,0xc1,0x5c,0x0b,0x18,0x86,0xf8,0x02,0x1f,0x57,0xbe
+,0x78,0x99,0xb2,0x08,0x20,0x97,0x9e,0x15,0x1d,0x0b,0x66,0x18,0x40,0xe2,0x66,0x23,0xb6,0x7e,0x9d,0xc0
+,0x47,0x3f,0x70,0xdc,0x14,0x0e,0xa2,0xf1,0x57,0x3e,0xc6,0x79,0x02,0xaa,0x90,0xde,0x29,0x9e,0x62,0x27
+,0xd4,0xe6,0x69,0x3c,0x64,0x14,0x96,0xc9,0x60,0x50,0xf1,0x9d,0x4d,0xc4,0x65,0xcb,0xc2,0xdd,0x30,0xa4
+,0x21,0x90,0xe1,0x99,0x13,0x84,0x88,0xc7,0xce,0x21,0x27,0x6a,0xb3,0x16,0x12,0x33,0x43,0x0d,0x4f,0xfa
+,0x00,0xc8,0x42,0x6d,0x31,0x2e,0x73,0xdd,0x7f,0xc0,0xaf,0x69,0x19,0x91,0x86,0xe6,0x79,0xda,0xf5,0x64
+,0x39,0x9d,0x52,0xaf,0x51,0x0a,0x97,0xa8,0x00,0x2c,0x38,0x9d,0x29,0xe1,0x20,0x49,0x46,0x80,0x89,0x0d
+,0xee,0xdd,0x8d,0xa6,0x70,0x27,0xd1,0x98,0xa5,0xc2,0x2f,0x2d,0xa2,0x8b,0xf7,0xfe,0x02,0x13,0x7d,0x3d
+,0xfa,0xe4,0x10,0x0c,0x0f,0x88,0x37,0x54,0x3f,0xe8,0x86,0xed,0x08,0x02,0xc9,0xc1,0x74,0xd9,0x39,0x61
+,0x1e,0xff,0xc2,0x74,0x5d,0x6a,0x24,0x62,0x6d,0x2e,0x74,0xf0,0x23,0x30,0xf0,0x3b,0x28,0x32,0x05,0xd8
+,0x42,0xd5,0xf4,0x0b,0x34,0x9b,0x77,0xa0,0x14,0xfc,0xcd,0xb4,0x83,0x83,0x81,0x0a,0x76,0xc6,0xd4,0x03
+,0xd0,0xc7,0x25,0x8b,0xae,0xf5,0x8f,0xd5,0x93,0xe8,0x9a,0x17,0x04,0xa9,0x6b,0xfd,0xb0,0x63,0x2a,0xb0
+,0x3f,0xdf,0x28,0x60,0x3b,0x65,0xf8,0xe0,0x06,0xc6,0x5a,0xaf,0x23,0xd8,0xe0,0xe6,0xc3,0x1e,0x09,0x86
+,0x1c,0x0b,0x21,0x02,0x3c,0x50,0x9c,0xe5,0xbe,0xf8,0xdb,0xbb,0x57,0x1d,0x1d,0xec,0x13,0xd0,0xb7,0x93
+,0xbf,0x00,0x57,0xe1,0xb3,0x8a,0xb2,0x3d,0xb3,0x9c,0x89,0xfa,0x27,0x1e,0x21,0x17,0x27,0x4f,0xd1,0x4a
+,0x42,0x4e,0x80,0xee,0xe3,0xe6,0xc7,0x16,0xb9,0x41,0x4b,0x00,0xce,0xb1,0x72,0xab,0xfb,0x97,0x4b,0x67
+,0x8d,0x18,0x36,0xd0,0xc1,0x3a,0x50,0x00,0x25,0x86,0x64,0xe0,0x65,0x19,0x4d,0x36,0xaa,0x47,0x2f,0x9d
+,0x0b,0x69,0x54,0xbc,0x20,0xda,0x85,0xe1,0xf0,0x68,0xc4,0x54,0xf5,0x88,0x29,0xa5,0x4b,0x06,0x12,0x19
+,0x48,0xc2,0xdc,0x40,0xdf,0x93,0x83,0x1e,0xf3,0x82,0x9e,0xfc,0xe5,0x09,0x09,0xd4,0xe6,0x0e,0x88,0xf8
+,0xac,0x86,0x94,0xbb,0xd0,0x2b,0xc6,0xdd,0x1e,0xc3,0x5d,0x9e,0x72,0x24,0xff,0x80,0x02,0x08,0x1c,0xe6
+,0xc1,0x4d,0xc2,0x18,0x03,0x61,0x8c,0x75,0xca,0x43,0x3e,0xc7,0xdb,0x04,0x25,0xa3,0x39,0x06,0xbb,0xfc
+,0x2a,0x23,0xb2,0xac,0x08,0x5b,0x49,0xd0,0xfb,0x60,0xce,0x66,0x14,0xa9,0x6a,0x32,0xd9,0x0a,0xf8,0xbc
+,0x11,0xdb,0xe8,0xb3,0x3f,0x2d,0x16,0xaf,0x43,0xf6,0x5b,0x40,0x9f,0xe1,0xe8,0xcb,0x05,0xb5,0x83,0x8e
+,0x66,0x18,0xe7,0x97,0x70,0xf0,0xca,0xf4,0x81,0x45,0xea,0xa9,0x8d,0x1f,0xdf,0xbe,0x7e,0xce,0x77,0xd0
+,0x78,0xe5,0x68,0x06,0xa4,0x2b,0xf0,0xfc,0xa5,0xcd,0x53,0xb0,0x4a,0xb1,0x2d,0x57,0x2b,0xe0,0x2f,0x99
+,0x68,0x3e,0x7d,0x09,0xc1,0x0d,0x4c,0x46,0x14,0x53,0x80,0x2d,0x5a,0x72,0x8d,0xff,0xc6,0x3c,0x2c,0xea
+,0xf5,0x88,0x34,0x00,0x11,0x1a,0xf7,0x22,0x34,0x82,0xba,0x9c,0x45,0xb8,0x15,0xeb,0x80,0x5a,0x1d,0x56
+,0x87,0x23,0x83,0xc8,0x2d,0xa0,0x39,0x2b,0xde,0x1b,0xcd,0x24,0x8e,0xcd,0x9d,0x55,0x51,0x4f,0x8f,0x2e
+,0x20,0x33,0xa7,0x3a,0x47,0xbd,0xc5,0x14,0xa7,0x74,0xe8,0x70,0x2a,0xd4,0x68,0x86,0x0d,0xa2,0x3d,0x9e
+,0xa3,0xf8,0x92,0xc8,0x52,0xbb,0x8c,0x6a,0xc8,0x56,0x21,0xe1,0x10,0x77,0x25,0xca,0x4b,0x17,0xe2,0x8e
+,0xfe,0x8e,0x09,0x0f,0x7d,0x86,0x5a,0xa2,0xd8,0x69,0x89,0x2b,0xef,0x80,0x6e,0x20,0x97,0x3e,0xf2,0x69
+,0x8c,0xc0,0xc4,0x47,0x91,0x19,0x9e,0x30,0x11,0xa0,0x50,0x91,0xaf,0x46,0x39,0x40,0x7c,0x9f,0x15,0x1b
+,0x33,0xca,0x3d,0xc0,0x28,0xfb,0x76,0x2d,0x06,0xba,0xe1,0x94,0xbf,0x11,0xc7,0x9d,0xdc,0x89,0xe9,0xa1
+,0x23,0x16,0x47,0x43,0x50,0x10,0x17,0xee,0xdf,0xbf,0x8c,0xe8,0x12,0xa9,0x19,0x5c,0x8a,0x2f,0xac,0x79
+,0x61,0x9a,0x4f,0x3b,0x45,0x23,0x24,0x2e,0x51,0xb8,0x17,0x71,0x9e,0xd0,0x00,0xd4,0xa2,0x09,0x6a,0x58
+,0x57,0x8b,0xe2,0x31,0x1c,0x8d,0xb7,0x87,0xc8,0x80,0xe9,0x18,0x88,0x2d,0xf6,0x0b,0x5b,0x87,0xb5,0xb2
+,0x7a,0x3f,0xa1,0xf8,0x38,0x3d,0xa1,0x8a,0xb0,0x14,0x03,0x8a,0xec,0x41,0xb2,0x66,0x0c,0x49,0x9c,0xbf
+,0x27,0xcc,0xeb,0x55,0x2a,0x9e,0xc9,0x6a,0x82,0xfe,0xd1,0x99,0xe3,0x13,0x21,0x62,0x44,0x43,0xc9,0x14
+,0x67,0x09,0x8a,0x28,0x58,0x8a,0x6f,0xfc,0xc7,0x06,0x80,0xa6,0xf8,0x38,0x44,0x0c,0x4a,0x29,0x75,0xb2
+,0xbc,0x8e,0x03,0x6f,0x36,0x2c,0xe4,0x20,0x7c,0x6c,0x36,0x43,0x30,0x46,0x6e,0x35,0x41,0x91,0x18,0x0b
+,0x70,0x58,0x44,0x2a,0xb5,0xaa,0x93,0x41,0x90,0x07,0x94,0xca,0x17,0x2d,0x9e,0xb1,0x05,0x08,0x24,0x2e
+,0x62,0x25,0x79,0x7e,0x03,0x68,0x99,0xf1,0x23,0x28,0x93,0xed,0x89,0x7e,0xdc,0x94,0xca,0x9d,0xd8,0x61
+,0xc4,0x56,0x8e,0xa1,0x9f,0x4b,0x35,0x36,0x60,0x98,0xe4,0xf1,0xc3,0x14,0xab,0xb2,0xab,0x03,0xdf,0x7d
+,0x22,0x6f,0xce,0x38,0x01,0x28,0xbc,0x48,0xd0,0x61,0x4f,0x71,0x44,0x44,0xf8,0x39,0xfe,0xcc,0x67,0x1b
+,0x0a,0xd8,0x6c,0xea,0xb2,0xb3,0x67,0xd1,0xe4,0xeb,0x33,0x69,0xa2,0xcb,0xc9,0xc2,0x0c,0x32,0x08,0x36
+,0xfa,0x8d,0x4c,0x5a,0x62,0xd5,0x2e,0xee,0x20,0x15,0x54,0x22,0x9a,0x44,0x41,0xce,0x2d,0x19,0x4e,0xba
+,0x42,0x7d,0x87,0x69,0x81,0xb5,0xec,0x7c,0x59,0x52,0xef,0xfa,0x3d,0x13,0xcc,0xf1,0x9e,0x5a,0x96,0xda
+,0xe0,0x15,0xaa,0x80,0xbd,0x0e,0x4c,0x87,0xce,0x35,0xa8,0xfb,0x65,0xbc,0x64,0xa1,0x8c,0xf9,0xd1,0x84
+,0x09,0x6f,0x3a,0x3f,0x0a,0xdf,0x86,0x16,0x7c,0xf7,0xde,0x37,0x8e,0x41,0x53,0x96,0x6f,0x22,0x1b,0x50
+,0xf9,0x81,0x50,0x46,0x18,0xe5,0x9c,0x49,0xdc,0xe6,0x31,0x9a,0x67,0x84,0x49,0x69,0xdd,0xe5,0x73,0x58
+,0x91,0xbd,0xf9,0x5c,0x22,0x4e,0x80,0x30,0x9d,0x71,0x01,0x81,0x25,0x4f,0x10,0x19,0x37,0xbc,0xd0,0xf9
+,0xcb,0x77,0xec,0x30,0x29,0x67,0xd3,0xc0,0x01,0x24,0x02,0x09,0x15,0xe5,0xa9,0x29,0xb9,0x7a,0xda,0x88
+,0x83,0x33,0x47,0x67,0x32,0x68,0x31,0x4c,0x63,0x39,0x82,0x8d,0xfc,0x27,0x33,0xd4,0xc7,0x16,0xcf,0x2b
+,0x52,0x98,0x37,0x93,0x0a,0xd3,0xe7,0xe8,0x95,0x3e,0x71,0x97,0xfe,0x1c,0xbc,0x98,0x4d,0x6c,0x71,0xfe
+,0x13,0x15,0xfa,0xf7,0xc8,0xc6,0x12,0x00,0x18,0x88,0x8d,0x11,0xb3,0x92,0x92,0xae,0x86,0x6c,0xb9,0x92
+,0x89,0xc4,0x63,0xa2,0x39,0x89,0x50,0x66,0x0d,0x49,0xd7,0xa9,0xe4,0x8f,0x85,0xa9,0x5c,0xc0,0x40,0x69
+,0x77,0x6e,0x51,0x3c,0x7c,0x76,0xfd,0x33,0x24,0x7d,0x5e,0xba,0x30,0xb6,0xe2,0x0e,0xcf,0xa3,0xb5,0xc4
+,0xd2,0x9e,0xf1,0xba,0xa3,0x44,0x83,0xad,0x05,0x73,0xa4,0x2a,0xa2,0x10,0x2d,0x1b,0x27,0xba,0x22,0xd5
+,0xf2,0xbe,0x89,0xc5,0x62,0xa9,0xbf,0x8c,0x92,0x45,0xfd,0xa5,0xf5,0x61,0xa9,0x37,0x8b,0xd7,0xf2,0xce
+,0xf2,0x4a,0x69,0xa3,0x79,0x2f,0x31,0x87,0x8d,0xa7,0xc5,0x89,0x15,0x3d,0x7e,0xba,0x23,0xcf,0x2d,0x4d
+,0xdb,0x70,0x56,0xe2,0xcc,0xa9,0x98,0x79,0xc6,0xc2,0x77,0x4c,0x1b,0x94,0xfa,0xf2,0xc3,0xeb,0x57,0x08
+,0x60,0xf2,0x62,0x78,0x23,0x69,0x61,0x56,0x05,0x97,0x8d,0x0a,0x4d,0xc4,0x24,0x38,0x5c,0xe8,0x93,0x66
+,0x2c,0x00,0x10,0x51,0x05,0xbb,0x0e,0xe7,0xaf,0x61,0xc4,0xb0,0x34,0x97,0x70,0x8a,0x66,0x29,0xaf,0x30
+,0x93,0x4f,0xb1,0x0a,0x11,0xf7,0x34,0x08,0xc0,0xdf,0x09,0x8f,0x03,0x1f,0x27,0x1c,0xe2,0x46,0x03,0xae
+,0xa2,0xc5,0x0e,0x93,0x83,0x86,0xb1,0x6a,0x85,0xfa,0x92,0xfc,0xc7,0x00,0x27,0x26,0x34,0x4f,0x3e,0xe9
+,0x93,0xd1,0x83,0x1b,0x98,0xb3,0x8a,0xe5,0xa7,0xf5,0xe7,0x02,0x71,0xb8,0x3a,0x63,0xe3,0x57,0x65,0x82
+,0xe1,0x73,0x36,0xb5,0x84,0x7e,0xb2,0xc9,0xc9,0x1e,0xcf,0x1f,0x1e,0x34,0x18,0xc4,0x64,0x2b,0x76,0xb4
+,0xa9,0x5a,0x8e,0x16,0x09,0x02,0x31,0xf2,0x6e,0x30,0x9b,0x2a,0x89,0x24,0xbf,0x49,0x4c,0xb3,0xe0,0x97
+,0x1c,0x44,0x39,0xbc,0x27,0x2b,0xc6,0x54,0x69,0x92,0x32,0xb9,0x80,0x40,0x5c,0x6b,0xe2,0xb0,0x2b,0x9c
+,0xa0,0x4a,0x06,0xcd,0x84,0xcf,0xc2,0x54,0xca,0x47,0x08,0xb9,0x4d,0x57,0xb6,0xc9,0x2c,0xf0,0x7c,0x09
+,0x5a,0x5a,0x84,0x3e,0xc9,0xcf,0x61,0x79,0x18,0x05,0x17,0x94,0x8b,0x45,0x40,0x00,0x97,0x25,0xf4,0x10
+,0xb5,0x65,0x49,0x07,0xe9,0xb1,0x5f,0xd6,0x17,0x4e,0x6d,0xb2,0x9d,0xa1,0x64,0x68,0xd7,0x8c,0x6c,0x8e
+,0x9d,0x44,0x05,0x16,0x5b,0x7c,0xb3,0x12,0x4e,0x9b,0x7c,0xa3,0x02,0x5e,0x4b,0xd6,0x0a,0x5f,0x9c,0x88
+,0xe5,0xa1,0xc5,0xc2,0x53,0x59,0xf8,0xb0,0xa2,0x2f,0xe9,0x21,0xbf,0xe6,0xc1,0xc5,0xa7,0x15,0xc5,0xa7
+,0x42,0x7c,0xec,0x10,0x17,0x9f,0xe5,0xd3,0x8b,0xc8,0x19,0xff,0x78,0x16,0x4b,0xb6,0x9a,0x14,0xf2,0x29
+,0xca,0x7e,0x49,0xbc,0xe2,0x0e,0x89,0x97,0xda,0xb8,0x58,0xab,0x49,0x35,0xb1,0xc2,0x69,0x03,0x76,0x88
+,0xc5,0xca,0x9e,0x5c,0x84,0xa2,0x44,0xcf,0x30,0xb0,0xef,0xd6,0x8c,0xf6,0xac,0x8c,0x67,0xfc,0xec,0x7a
+,0x69,0xfa,0xe3,0xcd,0x24,0x21,0xa3,0xe9,0x49,0x69,0xd7,0xa8,0xa5,0xd4,0x3b,0xe2,0xa3,0xb0,0x77,0xd8
+,0x88,0xe7,0xcd,0xe8,0x63,0x25,0x65,0x45,0xad,0xe3,0x40,0x88,0x09,0xf0,0x62,0x7f,0x8c,0xb7,0xa8,0x92
+,0xd3,0x5a,0x5e,0x37,0x71,0x61,0x53,0xd5,0x92,0xdc,0x20,0x12,0x29,0xd1,0x26,0x0a,0x10,0xde,0x3f,0x8f
+,0xcd,0x52,0x56,0x34,0x8b,0x42,0x0a,0x56,0x7e,0xb1,0x28,0x4e,0x55,0xc4,0x5b,0x89,0xcf,0x7f,0x7e,0x41
+,0x1c,0x8f,0xf0,0x6f,0x33,0xf0,0xa2,0x5d,0x09,0x89,0xd8,0xea,0x9b,0x4d,0x08,0xf9,0x1d,0x21,0xd3,0x87
+,0x62,0x1e,0xb7,0x22,0xa2,0xf7,0x95,0x68,0x37,0xef,0x52,0xf1,0x78,0xf5,0x7e,0x2a,0xad,0xc6,0x25,0xd4
+,0xc9,0xfb,0xc4,0xba,0xbc,0x2f,0x64,0xdc,0x00,0x96,0xa2,0x29,0x68,0x0d,0x15,0x46,0x97,0xbf,0x59,0x2d
+,0x66,0x0b,0x50,0xaa,0xc8,0xa8,0x5b,0xac,0xcb,0x58,0xd6,0x0d,0x6d,0x66,0xcd,0xf3,0x0b,0x2c,0x1a,0xaf
+,0x85,0xa7,0xd0,0x3c,0xdf,0x2a,0x6b,0x71,0x1b,0x28,0xb1,0x4d,0xb2,0xb8,0x63,0xce,0x3f,0xf1,0xcd,0x91
+,0xcf,0xba,0xfc,0x1b,0xe3,0xff,0x03,0x6c,0xe8,0x14,0x91,0x49,0x7e,0x00,0x00
+};
+
+#define index_config_html_gz_len 1185
+const uint8_t index_config_html_gz[] = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x56,0x6d,0x8f,0xe2,0x36,0x10,0xfe,0xce,0xaf
+,0x98,0x4b,0x4f,0x4b,0xa2,0x05,0xc2,0x6e,0xd5,0xbb,0x1e,0x4b,0xb8,0x0f,0x7d,0x51,0x5b,0xa9,0xbd,0xaa
+,0xbb,0xd2,0x49,0xad,0x4e,0xdd,0x10,0x0f,0xc4,0xc2,0xd8,0xd4,0x76,0xe0,0x56,0x28,0xff,0xbd,0xe3,0xd8
+,0x84,0xc0,0xee,0x5e,0xaf,0xd2,0x21,0x41,0x62,0xcf,0x78,0xe6,0x99,0x67,0x5e,0xcc,0xf4,0x05,0x53,0x85
+,0x7d,0xd8,0x20,0x94,0x76,0x2d,0x66,0xbd,0xa9,0x7f,0x00,0x7d,0xa6,0x25,0xe6,0xcc,0xbf,0x36,0xcb,0x35
+,0xda,0x1c,0x8a,0x32,0xd7,0x06,0x6d,0x16,0x55,0x76,0x31,0xfc,0x36,0x3a,0x17,0xcb,0x7c,0x8d,0x59,0xb4
+,0xe5,0xb8,0xdb,0x28,0x6d,0x23,0x28,0x94,0xb4,0x28,0x49,0x7d,0xc7,0x99,0x2d,0x33,0x86,0x5b,0x5e,0xe0
+,0xb0,0x59,0x0c,0xb8,0xe4,0x96,0xe7,0x62,0x68,0x8a,0x5c,0x60,0x76,0xd5,0xb5,0x65,0xb9,0x15,0x38,0xfb
+,0x43,0xcd,0x95,0x85,0x3f,0x51,0x2b,0x78,0x27,0x11,0xde,0xe7,0x06,0x7e,0x42,0x8d,0xd3,0xd4,0x8b,0x3d
+,0xc8,0xf4,0x88,0x72,0x3a,0x57,0xec,0xa1,0x63,0x85,0xf1,0x2d,0x70,0x96,0x45,0x42,0x2d,0x55,0xc7,0x7a
+,0x23,0x13,0xf9,0x1c,0x05,0x2c,0x94,0xce,0x22,0x99,0x6f,0x87,0x56,0x2d,0x97,0x02,0x87,0xc5,0x3c,0x6a
+,0x4e,0x1c,0xb7,0xa2,0xd9,0xc5,0x57,0x6f,0x5e,0xbf,0x7e,0x75,0x73,0x21,0xe7,0x66,0x13,0x7e,0xef,0x1a
+,0x11,0x10,0x0f,0x96,0xcb,0xa5,0x99,0xa6,0x8d,0xb5,0x8e,0x87,0x69,0x4a,0xbe,0x67,0xbd,0x23,0x94,0x05
+,0x47,0xc1,0x48,0xbf,0x8b,0x62,0x2a,0x70,0x89,0x92,0xcd,0x6e,0xd1,0x42,0x51,0x69,0x4d,0x3c,0x81,0xe5
+,0x6b,0x9c,0x90,0x3d,0x2f,0xe9,0xf5,0x9e,0x46,0x1c,0xb4,0x87,0x4e,0x3b,0x9a,0xfd,0x40,0x14,0x6b,0xb0
+,0x25,0x3e,0xb2,0x72,0x86,0x0a,0xa6,0x5c,0x6e,0x2a,0x12,0x53,0xba,0xb3,0x88,0xe5,0x16,0x9d,0xe2,0x50
+,0x28,0x4a,0x80,0x8f,0x3b,0x18,0xf8,0xbb,0x31,0xdc,0x25,0xcc,0xe7,0xf5,0x44,0x0c,0x4a,0x52,0x31,0xc8
+,0x25,0xed,0xd3,0x83,0x09,0x8c,0x6d,0xc9,0x4d,0x12,0xc1,0x36,0x17,0x15,0x6d,0x5e,0x8f,0xaf,0xaf,0x87
+,0xe3,0x57,0xc3,0xab,0xeb,0xbb,0xab,0x37,0x93,0xaf,0xc7,0xdd,0xfc,0xa6,0x47,0x3e,0x3e,0x9f,0xa3,0x85
+,0xc6,0x7f,0x2a,0x94,0xc5,0x43,0x87,0x20,0x80,0xae,0x72,0x43,0xfa,0x49,0x9a,0xbb,0x01,0xeb,0x9c,0x71
+,0xe5,0xe3,0x64,0x39,0x17,0x0f,0x51,0x88,0xaa,0xb5,0xdb,0x42,0x0f,0xe2,0x13,0x53,0xe1,0xf3,0x5c,0xd0
+,0x45,0x89,0xc5,0x0a,0xd9,0xf3,0x55,0xe6,0x6d,0xce,0xbe,0x77,0x8f,0xa7,0x52,0x93,0x9e,0x81,0xff,0xfc
+,0x60,0x76,0x88,0xab,0x4f,0x45,0x73,0x90,0xff,0x9f,0x70,0x9e,0x8f,0x23,0x58,0x9b,0xbd,0x6f,0x9e,0x5f
+,0x36,0x92,0x35,0x4d,0x8b,0xf2,0x53,0xa1,0xb4,0x0a,0x5f,0x26,0x96,0x83,0xb9,0xd9,0xaf,0xfe,0xe5,0xbf
+,0xa3,0xf9,0xfc,0xca,0x3d,0x29,0xdd,0x0d,0x2f,0x6c,0xa5,0xb1,0x69,0x4c,0x48,0x81,0xe5,0xa7,0x35,0xfc
+,0x24,0xb8,0x70,0xc6,0x37,0xdb,0xec,0xbb,0x52,0x29,0x13,0x0c,0x90,0xf8,0x60,0xf1,0xa9,0x2e,0x3f,0xa5
+,0xd7,0xf7,0xaa,0x63,0xf7,0xc4,0xe0,0x23,0x06,0x3d,0xe5,0xa7,0x3a,0xcf,0x30,0xfa,0x34,0x1d,0x7e,0xed
+,0x47,0x30,0x4d,0x65,0x7f,0x9b,0x98,0x42,0xf3,0x0d,0x09,0xd3,0xb4,0x9d,0x96,0xb0,0x54,0xa0,0xb6,0x34
+,0xb1,0x94,0x9b,0xe9,0x38,0xbf,0x55,0xd4,0x38,0x16,0x76,0x25,0xa7,0x91,0xca,0x2d,0x70,0x03,0x6a,0x83
+,0x72,0x00,0x34,0xee,0x53,0x77,0x7f,0x68,0x25,0xa0,0xa9,0x04,0x63,0x49,0x44,0x73,0x4e,0xef,0xb8,0xc1
+,0x1e,0x89,0x8c,0x85,0x83,0x42,0x06,0x71,0x9c,0x40,0x36,0x83,0x3d,0x01,0x11,0xce,0x9e,0xa1,0x3d,0x59
+,0x09,0x31,0x68,0xcc,0xd1,0x62,0x91,0x0b,0x83,0x03,0x90,0xf8,0xd1,0xd2,0x6a,0x3c,0xa0,0x0d,0x2e,0x28
+,0x58,0xa7,0x38,0xa6,0x53,0xde,0x20,0xe9,0x32,0x82,0x49,0x7b,0xfb,0xba,0xdd,0xa4,0x5f,0x89,0x85,0x3b
+,0x76,0x74,0x02,0xc1,0x05,0xee,0x8e,0x51,0xc4,0xf7,0x3b,0x33,0x49,0xd3,0x97,0x7b,0x37,0x53,0x2d,0x57
+,0x72,0x54,0x2a,0x63,0xeb,0x74,0x67,0xee,0x93,0x70,0x64,0xa4,0x64,0xc0,0x13,0x4c,0x1d,0xe0,0x59,0x5d
+,0xe1,0xcd,0x09,0x26,0xa8,0x8f,0x67,0x0a,0xe1,0xd2,0xff,0xe8,0x50,0x13,0xd3,0x0d,0xf0,0x05,0xc4,0x97
+,0x97,0xed,0xd9,0x29,0x7c,0x93,0x38,0xbe,0xef,0x28,0x8b,0xaa,0xb2,0x71,0x80,0x3f,0x80,0xeb,0xf1,0x78
+,0x9c,0x74,0xcd,0xae,0xd1,0x98,0x7c,0xe9,0x0c,0xe3,0x31,0xae,0x43,0xd4,0x6b,0xda,0xfe,0xe5,0xf6,0xdd
+,0x6f,0xa3,0x8d,0xbb,0xf3,0x63,0x1c,0xd1,0x95,0x91,0x27,0x41,0xc5,0xb9,0x5c,0x8f,0xf2,0x62,0x05,0x2f
+,0xb2,0x0c,0x2a,0xc9,0x70,0xc1,0x25,0x32,0xb8,0xb8,0x38,0x50,0xf8,0x57,0x23,0xfe,0x90,0x10,0xda,0xd3
+,0x1d,0x3a,0xa7,0x56,0xc9,0x0d,0x30,0xa4,0x44,0xe1,0x99,0x30,0xa0,0x03,0x40,0x8a,0x2c,0x78,0x31,0x36
+,0xb7,0x95,0x71,0xa6,0x43,0xba,0x47,0x0e,0x9f,0xdb,0x4b,0x1e,0xed,0xb4,0xea,0x1e,0xa8,0xb3,0xe6,0xbe
+,0xc4,0xc6,0xcf,0xee,0x9e,0xa4,0x41,0x12,0x0a,0xa5,0x61,0x90,0x4c,0x12,0x0f,0x86,0x10,0xc4,0xfd,0x7d
+,0xdd,0x4f,0x06,0x70,0x35,0x6e,0x38,0xa2,0x82,0x5d,0x21,0x6e,0x8c,0xbf,0x57,0x3d,0x7f,0x94,0x4f,0xba
+,0x84,0xd4,0x1a,0xe6,0xe8,0x2a,0xc4,0x49,0x38,0x75,0x85,0xb1,0xbe,0x4e,0x9c,0x4a,0xec,0xbc,0x6a,0xa4
+,0x1e,0x92,0x10,0xbb,0x96,0x1a,0xf8,0xd1,0xd5,0xa9,0x1a,0xcf,0x2d,0x61,0xd4,0xae,0x9e,0x36,0xa8,0xa9
+,0x9d,0xd7,0xb9,0x2c,0x70,0x24,0xd5,0x2e,0x4e,0x3a,0x3a,0xcc,0x75,0x08,0xa5,0x7c,0xcb,0x73,0x2a,0xe2
+,0x55,0x72,0x9e,0x21,0x25,0x70,0x44,0xff,0x6d,0xe2,0xfb,0x97,0x7b,0xe7,0xaa,0xce,0x5e,0xee,0x1b,0x67
+,0xb5,0xef,0x2f,0x5a,0xf1,0xbc,0x9e,0xd0,0x53,0xad,0xe0,0x2d,0xf4,0xd5,0xaa,0x0f,0x13,0xe8,0xbb,0x2a
+,0x41,0xd6,0xaf,0x81,0x4b,0x12,0xc5,0x8f,0x00,0xc0,0xd0,0x83,0x4b,0x46,0x56,0xfd,0xc8,0x3f,0x22,0x8b
+,0xaf,0x92,0x1a,0xd6,0x87,0x0a,0x6e,0xc3,0x53,0xab,0x96,0x60,0x5f,0x0d,0x8e,0xd0,0xe4,0xac,0x84,0x38
+,0xa3,0x00,0x2e,0x2f,0x5d,0xcf,0x85,0xfd,0x03,0xdd,0x4d,0x61,0x19,0xab,0x89,0x49,0xbe,0x78,0x88,0xf7
+,0x9c,0x4d,0x48,0xdb,0xd1,0xa5,0x27,0xd0,0x32,0x37,0x81,0xdb,0x46,0x25,0xf6,0x2c,0xd6,0xc9,0x19,0x08
+,0xd7,0x7d,0xbf,0x53,0x4a,0x68,0x20,0xc4,0x54,0xf9,0x4a,0x6c,0x7d,0x1d,0xb7,0x45,0xc5,0xd9,0x07,0x42
+,0x70,0x10,0xd5,0x14,0x54,0x89,0x32,0x26,0x42,0x48,0xcb,0xf1,0x1b,0xf7,0x77,0xa6,0xdf,0xb0,0x9b,0x74
+,0xc2,0x09,0xd6,0x17,0x68,0x8b,0xd2,0xd1,0xdb,0xb6,0xb3,0xd2,0x7c,0xc9,0x65,0x7d,0x98,0x4b,0x6f,0x09
+,0x6d,0x16,0xd8,0xbf,0x20,0x88,0x6d,0x06,0xee,0x83,0x23,0x7d,0xf4,0x53,0x5a,0xbb,0x21,0x4f,0x7a,0x14
+,0x7c,0xd5,0xbd,0x3a,0xa1,0x74,0xf7,0x16,0x95,0xf4,0xa5,0x15,0x66,0xac,0xd1,0x45,0xb2,0xf7,0x15,0xe5
+,0x5c,0xb8,0xf5,0xc8,0xf3,0xe1,0xde,0x3c,0x0f,0xbd,0x9a,0x46,0x6c,0x98,0xad,0xff,0x02,0x04,0x01,0xa8
+,0x92,0xc2,0x0b,0x00,0x00
+};
+
+#define eric_config_html_gz_len 4858
+const uint8_t eric_config_html_gz[] = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x5b,0x79,0x77,0xd3,0xc8,0x96,0xff,0x3f,0x9f
+,0xa2,0x50,0xf3,0x88,0x45,0x6c,0xd9,0x49,0x20,0x24,0x76,0x6c,0x4e,0x77,0xa0,0x07,0x66,0x9a,0xe5,0x90
+,0xf4,0xeb,0x79,0xc3,0xe1,0x90,0xb2,0x55,0x8e,0xd5,0x91,0x25,0x3d,0xa9,0x14,0xc7,0xa4,0xfd,0xdd,0xe7
+,0x77,0x6b,0xd1,0x62,0xcb,0x21,0xf4,0x79,0x70,0x48,0xa4,0x5a,0xee,0x56,0x77,0x2f,0x71,0xfa,0xe8,0xd5
+,0x87,0xb3,0x8b,0x7f,0x7d,0x7c,0xcd,0x66,0x72,0x1e,0x8e,0x76,0x4e,0xe9,0x17,0x0b,0x79,0x74,0x35,0x74
+,0x44,0xe4,0x8c,0x76,0x18,0x3b,0x9d,0x09,0xee,0xd3,0x03,0x1e,0x65,0x20,0x43,0x31,0x3a,0x17,0x52,0x06
+,0xd1,0x55,0xd6,0x39,0xe3,0x73,0x91,0x72,0x76,0x2e,0xb9,0x0c,0xe2,0xe8,0xb4,0xab,0xa7,0xf5,0xd2,0xb9
+,0x90,0x9c,0x4d,0x66,0x3c,0xcd,0x84,0x1c,0x3a,0xb9,0x9c,0x76,0x8e,0x9d,0xea,0x54,0x84,0xbd,0x43,0xe7
+,0x26,0x10,0x8b,0x24,0x4e,0xa5,0xc3,0x26,0x71,0x24,0x45,0x84,0xa5,0x8b,0xc0,0x97,0xb3,0xa1,0x2f,0x6e
+,0x82,0x89,0xe8,0xa8,0x97,0x76,0x10,0x05,0x32,0xe0,0x61,0x27,0x9b,0xf0,0x50,0x0c,0xf7,0xdb,0x2c,0xcf
+,0x44,0xaa,0xde,0xf8,0x18,0x03,0x4b,0x91,0x69,0x4a,0xbb,0x96,0xd4,0xd3,0x71,0xec,0x2f,0xd5,0x83,0x1f
+,0xdc,0xb0,0x49,0xc8,0xb3,0x6c,0xe8,0xc8,0x38,0x89,0xf8,0x8d,0x5e,0xc9,0xed,0x20,0x9f,0xc8,0xe0,0x46
+,0x38,0x6c,0x96,0x8a,0xe9,0xd0,0xe9,0x3a,0xa3,0x27,0x3f,0x1d,0x9f,0x1c,0x1d,0xbc,0x89,0xe7,0xe2,0xb4
+,0xcb,0xcd,0x5a,0x33,0x99,0xc9,0x54,0xf0,0xb9,0x47,0x22,0x72,0x46,0xe7,0xea,0x65,0x73,0x8d,0x91,0x8d
+,0x5d,0x35,0x99,0x09,0x3f,0x0f,0x37,0x61,0xcd,0x44,0x98,0x98,0x35,0x6f,0xf0,0x68,0xe7,0xbb,0xa0,0x77
+,0x9d,0xee,0x09,0xc4,0x22,0x52,0x67,0x54,0x1d,0x33,0x68,0x2e,0x48,0xe0,0x44,0xf3,0xfe,0xc1,0xf1,0xfe
+,0xc9,0x8b,0x8f,0xb3,0x58,0xc6,0xec,0x82,0x5f,0x63,0x8a,0x59,0xd4,0x7d,0x0d,0xb4,0x11,0xb4,0x05,0x13
+,0x5f,0x5d,0x85,0xe2,0xbf,0xd2,0x38,0x4f,0x9c,0x6d,0x4b,0x34,0x26,0x1c,0x75,0x2a,0x2d,0x06,0x85,0x2e
+,0x63,0x5c,0xf6,0x0b,0xe0,0xd8,0x1b,0x44,0x49,0x2e,0x99,0x5c,0x26,0x38,0x5e,0x9f,0x4b,0x21,0x83,0xb9
+,0xe8,0x84,0x31,0x0e,0xcb,0x61,0x37,0x3c,0xcc,0x31,0x7c,0xd0,0xdb,0x3f,0xe9,0xf4,0x5e,0x74,0x7a,0xcf
+,0x2f,0xf6,0x7b,0xfd,0x5e,0xcf,0x61,0x71,0x04,0x55,0x89,0xae,0x84,0xc2,0xf7,0x0a,0xbb,0x2e,0xb0,0xab
+,0xe5,0x3a,0x2c,0xf0,0x31,0x44,0x48,0xbf,0x12,0x9c,0xaf,0x0a,0xb8,0x63,0x94,0x87,0x27,0x09,0x9e,0x53
+,0xf1,0xef,0x3c,0x48,0x85,0xbf,0x55,0x7e,0x5b,0x98,0xd4,0x8b,0xca,0xa7,0x66,0x86,0x3f,0x89,0x44,0x70
+,0xc9,0x5e,0xdf,0x88,0x74,0x59,0x63,0xb3,0xdb,0xb8,0xd9,0x4f,0xe3,0xc4,0x8f,0x17,0x91,0xc5,0x30,0xce
+,0xa5,0x8c,0xa3,0xea,0xec,0x58,0x46,0x9a,0xab,0x29,0x11,0x2e,0xa2,0xc9,0xd2,0x30,0x35,0xea,0x74,0x32
+,0x11,0x8a,0x89,0xec,0x74,0x4e,0xbb,0x7a,0xdf,0x76,0xf8,0x1d,0x63,0x2e,0x16,0x8f,0xd5,0xab,0x9f,0x94
+,0x28,0xc3,0x60,0x72,0xad,0x18,0x51,0x27,0xf4,0xab,0x45,0xd4,0xda,0x7d,0x17,0x44,0xb9,0x14,0xbb,0xae
+,0x33,0xd2,0x4f,0x46,0xed,0x1e,0x0e,0xe0,0x4d,0x9c,0xa7,0xb4,0x9d,0x7e,0xff,0xf0,0xe6,0x57,0x7c,0x49
+,0x7b,0xf1,0xeb,0x87,0xb7,0xfe,0x21,0xc4,0x35,0xed,0xa5,0xdf,0x3f,0xbc,0xf9,0x1d,0x64,0x35,0x53,0x4c
+,0xd3,0x43,0xb9,0xbd,0xe1,0x34,0xef,0x37,0xc0,0xfa,0x69,0x66,0xfc,0x46,0xfc,0xa2,0x46,0xaa,0xe8,0x31
+,0x68,0xfd,0x23,0xf4,0x77,0x74,0x8e,0xf7,0xe2,0x38,0x4b,0xe8,0xe3,0xf4,0x6f,0x5a,0xf9,0xe1,0xe1,0xc9
+,0x19,0x4f,0x64,0x9e,0x0a,0xf6,0x09,0xc6,0x9d,0x3d,0xc0,0xba,0xdf,0xc7,0x52,0x68,0x42,0x7c,0x96,0xd2
+,0x1e,0x98,0x4c,0x12,0xf2,0x89,0x60,0x72,0x26,0x58,0x66,0xdc,0x04,0xe3,0xe3,0xf8,0x46,0x78,0xec,0x35
+,0x9f,0xcc,0xd4,0x32,0xc6,0x7d,0x3f,0x63,0x13,0x8d,0x2c,0x6b,0xb3,0x69,0x9c,0x32,0x71,0xcb,0xe7,0x09
+,0xa6,0x04,0x99,0x03,0xdb,0xef,0xb1,0xb9,0x52,0xa3,0x8c,0x4d,0xd3,0x78,0xce,0x7a,0x47,0xb0,0x65,0x06
+,0x0f,0x74,0x40,0x46,0x0d,0x99,0xb0,0x05,0x8e,0xcb,0xe7,0xcb,0xcc,0xfb,0x41,0xc3,0x94,0xe4,0xd7,0xed
+,0x32,0x22,0xe6,0x82,0x06,0xb4,0xdd,0x28,0x16,0xbe,0xaa,0x15,0x90,0x56,0x57,0x3d,0xfc,0x0d,0xdb,0xd7
+,0xb6,0x56,0x40,0xfc,0x0a,0x8f,0xe6,0xd7,0xfc,0xd0,0x2c,0x5e,0x90,0x84,0x7f,0x0d,0x44,0xe8,0xab,0xa3
+,0x54,0xfb,0xb0,0x33,0x4e,0x28,0xda,0x59,0x5f,0x06,0x80,0xca,0x39,0x9c,0x76,0xf5,0xf8,0x96,0x65,0x73
+,0xa3,0x7d,0xe1,0xf7,0x16,0xc6,0xce,0xe8,0x43,0x34,0x11,0xf5,0x55,0xa7,0x5d,0x4d,0xae,0xa5,0x3d,0xe1
+,0x91,0xa2,0x3c,0x11,0x69,0x10,0xfb,0xc1,0xe4,0xeb,0x54,0x51,0x59,0xd2,0x58,0x75,0xc2,0x51,0x3e,0x1f
+,0x43,0xb3,0x4a,0x56,0xf5,0x2e,0x87,0x0e,0x6f,0xe8,0xec,0x17,0x5e,0x79,0x1f,0x7e,0x38,0x93,0x4b,0x04
+,0x54,0x1d,0x83,0xfb,0xcf,0x7b,0xc9,0x6d,0x09,0x72,0x5d,0x60,0x39,0x82,0x72,0x31,0xbb,0xc1,0xc6,0x51
+,0xcf,0x19,0x19,0xe5,0x58,0x67,0x78,0x63,0xed,0xe1,0x11,0x42,0xc0,0x68,0x06,0x97,0xb2,0xb1,0xb6,0xce
+,0x38,0xd3,0x7a,0x56,0xe3,0x8e,0xc2,0x42,0x85,0x37,0x15,0x2b,0x0a,0x96,0x94,0x46,0x16,0x44,0x42,0x33
+,0xef,0xdb,0x2a,0x48,0x01,0x8a,0x08,0x55,0xdd,0x58,0x0a,0x5c,0x2d,0x24,0x8d,0x26,0xd5,0xa3,0xd1,0xe2
+,0x7c,0xca,0xe7,0x62,0xf1,0x5c,0x1f,0xb8,0x3d,0x1c,0x36,0x0b,0x7c,0x5f,0x14,0xac,0x81,0x7f,0x00,0xfa
+,0xce,0x51,0xcd,0xb1,0xa4,0x3c,0xa8,0x39,0xbf,0x85,0xb4,0x2a,0x27,0x76,0xdf,0x81,0x21,0x6a,0xdd,0xc7
+,0xad,0x7e,0xb5,0x80,0x0e,0x4a,0x76,0x9b,0x79,0x89,0x23,0x01,0x8b,0x90,0x5b,0x78,0x59,0xc7,0xb5,0x1e
+,0xf7,0x0b,0xac,0x5c,0x36,0x61,0xa9,0xfb,0x55,0xf8,0x9d,0x0d,0xb7,0x8a,0x31,0x32,0x46,0x32,0xc3,0x9f
+,0x7d,0xbf,0x1a,0x1f,0x7f,0x3c,0xe4,0x37,0x7b,0x57,0x4a,0x38,0xd8,0x37,0xb0,0xc9,0x5a,0x1f,0x3f,0x9c
+,0xbf,0xfd,0x5f,0x76,0xf1,0x7f,0x6e,0xff,0x49,0x34,0xce,0x92,0xc1,0xb6,0xec,0x46,0x8a,0x5b,0xa9,0x79
+,0x93,0xdf,0x6c,0x66,0xa2,0x1c,0xeb,0x2c,0x0e,0x7d,0x91,0x0e,0x9d,0x8f,0xe7,0x17,0xc7,0x1f,0x5f,0x5d
+,0xb4,0xdf,0x1d,0x7a,0x07,0x5e,0xaf,0xfd,0x6e,0x7f,0xdf,0xdb,0xf7,0x7a,0xce,0x7f,0x2c,0xd0,0xa8,0x08
+,0x60,0xa3,0x8c,0x8e,0x07,0xff,0xc9,0x58,0xb3,0x7f,0xd2,0xd3,0x19,0xe5,0x79,0xf0,0x4d,0xb0,0x8b,0x3c
+,0x12,0xe9,0x83,0xc3,0x0d,0x52,0x44,0x84,0x85,0x44,0x67,0x88,0xf1,0x54,0x85,0x9a,0x49,0x9e,0xa6,0xc0
+,0x8c,0x90,0x23,0x20,0x66,0xe8,0x8c,0x1f,0x4c,0xa7,0x42,0x0f,0x01,0x03,0x32,0xc9,0xc8,0x67,0xff,0xce
+,0x79,0x88,0x6c,0xdf,0xbc,0x5d,0x0b,0x91,0x64,0x6a,0x73,0xc8,0xd3,0x2b,0x91,0xe9,0x95,0x6a,0x6a,0x4c
+,0x6f,0x7a,0xf5,0x12,0x2b,0x00,0x0e,0xb6,0xbf,0x64,0x8b,0x40,0xce,0x82,0x88,0x71,0x36,0xce,0xfd,0x2b
+,0x21,0x3d,0xa6,0x64,0x53,0x8b,0x74,0xd3,0x20,0xcd,0x64,0x5b,0x8d,0xe9,0x45,0xcc,0x47,0x96,0x17,0x21
+,0xda,0x41,0xe6,0x70,0xfb,0xa0,0x17,0xb9,0x95,0x25,0x9e,0x23,0xd4,0x4a,0x70,0x13,0x79,0x24,0x02,0xca
+,0x7b,0xa5,0xe2,0x2d,0x4f,0xc8,0xa1,0x70,0x13,0x02,0xbd,0xbf,0x1f,0x7e,0x24,0x04,0x8b,0x78,0x06,0xf6
+,0xe4,0xb6,0x20,0xa3,0x3d,0xce,0x19,0x4f,0x7d,0xc8,0x21,0x93,0x94,0x73,0xb3,0x50,0xe0,0x89,0xb5,0x68
+,0xca,0xfd,0x5e,0xf0,0x19,0x93,0xcf,0x42,0xf6,0x94,0x06,0x52,0x09,0x7e,0x1e,0xd3,0xd6,0x77,0xbf,0x80
+,0x7c,0x4c,0x7c,0x6f,0xfb,0x02,0xfc,0x7e,0x9d,0x67,0x2a,0xfb,0x5f,0x32,0x4e,0xaf,0x25,0x90,0x39,0x88
+,0x61,0x34,0xe4,0xde,0x1b,0xb2,0xb6,0x79,0x39,0xc5,0x7c,0x18,0xcc,0x11,0x4b,0xd6,0xe3,0xd1,0xc9,0x7a
+,0x3c,0x7a,0x51,0xba,0xb7,0xed,0x2e,0xa3,0x00,0x3a,0x5e,0xb7,0x18,0x1a,0x25,0x63,0x21,0x45,0x7e,0xa8
+,0x07,0x51,0xca,0x5c,0xc2,0x44,0x22,0x94,0x87,0xd2,0xa9,0x1b,0x57,0x83,0x81,0xd5,0x8d,0xe9,0x9f,0x22
+,0xcd,0x48,0x9c,0x6f,0x23,0xe4,0x50,0x73,0x55,0x2b,0xf7,0xef,0x55,0x17,0x53,0x6b,0x41,0x0d,0x17,0xa4
+,0x7d,0x66,0x7f,0x9f,0xdd,0xc0,0x7b,0x78,0xbd,0x16,0x0f,0x93,0x19,0x77,0x1f,0x00,0xe1,0x2c,0x4e,0x96
+,0x69,0x70,0x35,0x93,0x0c,0xf6,0x7c,0x74,0x82,0xbc,0xec,0xe0,0xc0,0x2a,0xaa,0x62,0x5c,0x97,0xc9,0xa8
+,0x9b,0x55,0xf1,0xbf,0x73,0x9a,0x4d,0xd2,0x20,0xc1,0x91,0x75,0xbb,0xcc,0x16,0xb2,0xec,0x2a,0x66,0x48
+,0x0c,0x53,0x46,0xae,0xf1,0x0f,0x31,0x3e,0x8f,0x27,0xd7,0xb0,0x98,0xc5,0x2c,0x80,0x25,0x05,0xd0,0x60
+,0x58,0x0d,0x8c,0xa7,0xcd,0x78,0xc6,0xba,0x54,0x95,0xa4,0x71,0xa8,0x6a,0x32,0x41,0x7a,0x1a,0xc3,0xc8
+,0xd2,0x45,0x90,0x89,0x1d,0x4c,0x41,0x5d,0xec,0x82,0x21,0x6b,0xb5,0x5c,0x36,0x1c,0xb1,0x3b,0xd0,0x11
+,0x12,0xbc,0x0c,0x63,0x51,0x1e,0x86,0x6d,0x05,0x0e,0x2f,0x53,0x1e,0x66,0xa2,0xcd,0x22,0x38,0x59,0xbc
+,0xf5,0x90,0x80,0xf2,0x20,0xa4,0x54,0x94,0xde,0xb0,0x4b,0x03,0x24,0xbb,0x25,0x9b,0x1c,0xb2,0xbb,0x55
+,0x31,0x88,0x9f,0x11,0x59,0x17,0xb0,0x14,0x48,0x98,0x41,0x21,0x16,0x25,0x17,0xad,0xcb,0x45,0xd6,0xef
+,0x76,0x1f,0xdf,0x51,0x98,0xa2,0x63,0xf1,0x66,0xd0,0xe9,0x55,0x77,0x91,0x5d,0xba,0x66,0x8b,0x17,0x47
+,0x86,0x1e,0x03,0xca,0x92,0x27,0xd3,0x5c,0x0c,0x6a,0x34,0xb1,0x55,0xb9,0x67,0x12,0xc6,0x99,0xd8,0xdc
+,0xa4,0x78,0x1a,0xb0,0x60,0xca,0x5a,0x7b,0x7b,0xc5,0xde,0x53,0xf6,0xdc,0x25,0x79,0x53,0x08,0x8a,0x73
+,0xd9,0x32,0xe4,0xb7,0x71,0x5e,0xbd,0x9e,0x5b,0x05,0x3b,0x17,0x59,0xc6,0xaf,0x08,0xb0,0x28,0xf9,0xb2
+,0x5c,0xcf,0x31,0xfc,0xdf,0xe7,0x1f,0xde,0x7b,0x09,0x35,0x5d,0x5a,0xc2,0x43,0x14,0xe6,0xae,0x59,0x42
+,0x28,0xe7,0x1e,0x9f,0x5c,0xb3,0x47,0xc3,0x21,0xcb,0x23,0x5f,0x4c,0x83,0x08,0x05,0xc1,0x93,0x27,0x56
+,0x84,0x9f,0xd5,0xf4,0x17,0x17,0xd4,0xd6,0x47,0xb0,0x2f,0xbe,0x76,0x07,0x70,0x92,0x38,0x28,0xb1,0x36
+,0x69,0xa8,0x63,0x4c,0x80,0x33,0x83,0x05,0x7e,0x58,0xe6,0x19,0x81,0x36,0xc7,0xed,0x11,0x7d,0x34,0xe6
+,0x6e,0x8c,0x14,0xcb,0x35,0xa1,0x04,0x8d,0xfe,0x41,0x1a,0x6f,0x29,0x46,0xc1,0x15,0x18,0x45,0x51,0x12
+,0x04,0x48,0xc8,0x21,0x03,0x05,0xad,0xdd,0xbb,0xd5,0xae,0xdb,0x46,0x0d,0xa2,0x64,0x04,0x85,0x2d,0x43
+,0x85,0x91,0x1f,0x99,0x9c,0xca,0x17,0xc7,0x42,0x79,0x6d,0xcc,0x04,0x3e,0x42,0xa4,0xd4,0x7a,0x42,0x4b
+,0x5a,0x84,0x35,0x15,0xa8,0x70,0x22,0xd6,0xa2,0xa6,0x42,0x5b,0x3b,0x9f,0x8a,0xd6,0x68,0xd9,0xaa,0xb4
+,0x12,0xf2,0x45,0xea,0xac,0x6c,0x18,0x19,0xba,0x17,0xc5,0x8b,0x96,0x5b,0x59,0xe3,0x93,0x85,0xe0,0xc8
+,0x6f,0x02,0x0e,0x25,0xbe,0x76,0xd7,0x4f,0x28,0x0e,0x85,0x17,0xc6,0x57,0xad,0xcb,0xc7,0x77,0x84,0x6a
+,0x35,0x7c,0x7c,0xa7,0x90,0xad,0xb4,0x7d,0xe1,0x2d,0xe0,0xab,0x3e,0x7e,0xc7,0xd7,0xec,0x25,0xdb,0x8d
+,0xaf,0x77,0x59,0x9f,0xed,0x92,0x96,0x08,0x7f,0x77,0xc5,0x10,0xd4,0x1e,0xdf,0xb5,0x36,0x08,0x60,0x1d
+,0x4d,0x9c,0xeb,0xa1,0xe6,0x0d,0x6e,0x85,0xdf,0xda,0x77,0x57,0x6c,0x6e,0x35,0xb8,0x60,0x2f,0xbe,0x2e
+,0x04,0xac,0xb5,0x81,0x04,0xea,0xae,0xa9,0x50,0xe0,0x83,0x81,0xbd,0x3d,0xb2,0x39,0x33,0x6e,0xc5,0xad
+,0x14,0x2b,0x93,0x29,0x24,0x19,0x4c,0x97,0xad,0xbb,0xc0,0xef,0x63,0x35,0x89,0x2b,0xed,0xb3,0x42,0x72
+,0x7d,0x76,0xae,0x96,0xb4,0xb4,0x14,0x57,0xee,0x1a,0x11,0x64,0x7d,0x1f,0x71,0x24,0x70,0x08,0x2d,0x68
+,0x7e,0x1c,0xde,0x68,0x3d,0x2e,0x94,0x2a,0xf0,0xbf,0x80,0x02,0x3b,0xb5,0x02,0x53,0x33,0x11,0xb5,0x20
+,0x10,0xac,0x22,0xf9,0xb6,0x76,0x17,0xd9,0xae,0x92,0xae,0x5b,0x61,0xc7,0x40,0x9f,0x0a,0x39,0x99,0x91
+,0x78,0x0b,0x73,0x8e,0xe1,0xfd,0x82,0x68,0x65,0xfd,0xd2,0x4b,0x50,0x3b,0x34,0xd2,0x7f,0x02,0x12,0x8b
+,0x13,0xb8,0x34,0x88,0xd2,0x12,0xcf,0x4c,0xca,0x04,0x98,0x52,0xcf,0xe0,0x5a,0xed,0xac,0x5c,0x75,0xdc
+,0x80,0xc1,0xc6,0x3c,0x13,0x6f,0x28,0xfc,0x0d,0xb1,0x7a,0x92,0xcf,0x91,0xc2,0x78,0x6b,0x48,0x07,0xe4
+,0x61,0x8b,0x49,0xc4,0xf6,0xd7,0xa1,0xa0,0xc7,0x5f,0x96,0x6f,0xa1,0xbc,0xeb,0x2d,0xad,0x5d,0xd7,0x83
+,0x45,0x72,0x04,0x97,0x7f,0x12,0x41,0x80,0x7b,0xa5,0xfd,0xc1,0xaf,0x90,0xd6,0x59,0x18,0x60,0x63,0xcb
+,0x1d,0xdc,0x07,0x71,0xad,0x9d,0x04,0x80,0x01,0x54,0x3c,0xbd,0xd0,0xee,0xd3,0xa1,0x86,0x8d,0xa3,0x68
+,0x22,0xfa,0xe7,0x28,0x4a,0xec,0x7a,0x36,0xb4,0x93,0xc5,0x5c,0x49,0x1d,0xb6,0xae,0x93,0xea,0x29,0x91
+,0x31,0xbb,0x9c,0x26,0xe8,0x79,0x9a,0x47,0xda,0xe4,0x6a,0x0d,0x3c,0xad,0x5e,0xb4,0x66,0xd8,0x0c,0x67
+,0xb0,0xb3,0x61,0x1e,0x26,0xf2,0xa8,0x5d,0x94,0x62,0x3d,0xbe,0x6b,0xde,0x8a,0x53,0x1b,0x18,0x77,0x51
+,0xc5,0xdf,0x20,0x38,0x4d,0x05,0x51,0x0b,0x93,0x31,0x41,0x80,0x68,0xd4,0x22,0xd5,0x01,0x88,0x72,0x51
+,0x9a,0x8a,0x17,0x9e,0x81,0x40,0xc5,0xc0,0x87,0xe9,0x14,0xe4,0xb4,0xdc,0xee,0x51,0x4f,0x2f,0xa5,0x79
+,0x8c,0x90,0xc4,0xb2,0x96,0x59,0xac,0x5f,0xc8,0x12,0x09,0x08,0x3c,0x65,0xb7,0xcb,0xfd,0x3f,0xf3,0x4c
+,0xc2,0xbf,0x52,0xd7,0x44,0x31,0x62,0x73,0xdd,0x89,0x28,0xe0,0xc8,0x98,0x88,0x30,0x16,0xe3,0x7a,0x19
+,0xd2,0x14,0xd1,0xea,0xb5,0x3b,0xcf,0x5d,0xbb,0x64,0xa8,0x97,0xbd,0x3d,0xff,0x60,0x57,0x0d,0x6a,0x53
+,0xc5,0x96,0x63,0x33,0x61,0xed,0x2c,0x5e,0x28,0xc9,0xac,0x9d,0xcb,0x5a,0x63,0xac,0x50,0x81,0xb7,0x24
+,0x54,0xf7,0x6e,0xfb,0x51,0x94,0xca,0xa2,0xce,0x63,0x4d,0xd7,0x4a,0x4d,0x33,0x47,0xc2,0xd8,0xd6,0x15
+,0x14,0x04,0x6b,0x68,0x99,0xde,0x50,0xd7,0xc8,0x7b,0xf6,0x0f,0x2c,0x63,0xc6,0xe9,0xf2,0xe5,0x7b,0x98
+,0x33,0x05,0xe0,0xcf,0xce,0x79,0x1e,0x39,0x6d,0xe7,0x5d,0x4c,0x3f,0x2f,0x72,0x81,0x9f,0x7f,0x08,0x9f
+,0x9e,0x67,0x39,0x7e,0xfe,0x9a,0x06,0xf8,0x79,0x8e,0x12,0xf4,0x8b,0x55,0x5e,0xdd,0x0e,0xc3,0xd6,0x2f
+,0xda,0x5c,0x0d,0x30,0x0f,0xa7,0x46,0x7d,0xb0,0x96,0x89,0x09,0x41,0xc5,0x97,0x17,0x1d,0x00,0x4d,0xd3
+,0x9b,0x8b,0x77,0xbf,0xb1,0xbd,0x21,0xbb,0x3c,0x0d,0xf9,0x58,0x84,0xa3,0x5a,0xa2,0x8b,0x82,0x63,0x72
+,0x3d,0x8e,0x6f,0x75,0x06,0x89,0x4d,0x5f,0x1f,0xdf,0x05,0x2b,0x87,0xfc,0x78,0xc0,0x46,0xc8,0x18,0x10
+,0xcf,0x02,0x84,0xff,0x23,0x17,0x0e,0x5f,0xaf,0x06,0xbd,0xf0,0xfa,0x8e,0xb3,0x1a,0x19,0x3f,0x75,0xda
+,0xd5,0x80,0x2f,0x15,0xe3,0x4a,0xbc,0xa6,0x92,0x36,0x86,0xb8,0xc5,0x55,0xd0,0xd1,0x5b,0x7f,0x68,0xdd
+,0xd5,0xaa,0x6b,0x6b,0xa0,0xc2,0xe1,0x89,0x2c,0x81,0x1c,0x95,0x17,0xb6,0xcf,0xde,0x9f,0x59,0x1c,0xb5
+,0x5c,0xb3,0xa2,0xa8,0x9a,0x0a,0x09,0xd8,0x62,0xb7,0xc0,0x6f,0x97,0x78,0xf2,0xdb,0xa0,0x90,0x51,0x56
+,0x9d,0xd0,0x03,0x2f,0xd7,0x06,0xbc,0x2c,0x41,0xf1,0xd6,0xda,0x1d,0xec,0xba,0xe0,0xf9,0xf3,0x17,0xbd
+,0xd9,0x36,0xde,0x32,0xad,0xec,0x2b,0xc3,0x4b,0xa1,0xc6,0x6b,0x7d,0x39,0x4d,0xd3,0x5a,0x23,0xcc,0xd3
+,0xed,0x09,0x0a,0x25,0xb6,0xb7,0x67,0xa8,0x7d,0x04,0x5f,0x98,0x38,0x46,0xe7,0x6a,0xfd,0x99,0xfb,0xf7
+,0xcc,0xcd,0x9e,0x7a,0x1f,0xe4,0xfe,0x3d,0xb1,0x33,0xd8,0xb0,0x42,0x5f,0x50,0x8e,0x3d,0x56,0xa5,0x7b
+,0x8b,0x36,0x19,0x06,0xc8,0x05,0x4d,0x0d,0x1c,0x2b,0x97,0xf6,0xae,0xb1,0x26,0x0a,0xd7,0xd3,0xcf,0x3d
+,0x84,0x46,0x45,0x7d,0x19,0xb5,0x95,0xe3,0x82,0x2e,0x52,0x1c,0x2a,0x74,0x37,0x08,0x91,0x38,0xd5,0x55
+,0x77,0xfa,0x79,0xff,0x0b,0x7b,0xc2,0x5a,0xfb,0xec,0xf4,0x14,0x43,0xae,0xf7,0x67,0x1c,0x44,0x2d,0x87
+,0x39,0x06,0x81,0x86,0xa4,0x85,0x48,0xd6,0xf7,0xf9,0xd9,0x17,0xf6,0x0f,0x46,0x7d,0x39,0x1c,0x1a,0x14
+,0x48,0x0d,0x74,0xd9,0x51,0x6f,0x65,0x3b,0xbe,0x97,0x38,0xb1,0x72,0x82,0x56,0xae,0x98,0xea,0xe0,0x5d
+,0x0e,0xea,0x21,0xff,0x52,0x75,0x47,0xa1,0xf2,0x1a,0xfa,0x4a,0xa7,0x64,0xb4,0xf3,0xe0,0xcb,0xca,0xb8
+,0x93,0xcf,0x87,0x78,0x8c,0x29,0xbf,0x21,0x66,0x56,0x06,0xc4,0xaa,0xcc,0x29,0x0b,0xe6,0xe7,0x15,0xe6
+,0x2d,0x02,0xd3,0x57,0xb5,0x0d,0x35,0x82,0xb7,0x0f,0x78,0xa8,0x50,0x0d,0x96,0x7b,0xe0,0xc5,0x0d,0xf0
+,0xa8,0xfd,0xaa,0x77,0x17,0x71,0x42,0xc9,0xef,0xa9,0x4a,0x36,0x29,0xcf,0xfa,0x8d,0xba,0x5a,0x85,0xe3
+,0x2e,0xe0,0x57,0x3d,0x30,0x9d,0xe3,0xe6,0xe9,0x57,0x74,0xbb,0xf4,0x26,0xa6,0x99,0x5d,0xf1,0x27,0x20
+,0xcc,0x29,0x4f,0x5e,0xdb,0x4a,0x28,0xa2,0x2b,0x39,0x23,0xa2,0x7b,0x15,0x92,0xb7,0x6d,0x3f,0x95,0xa8
+,0x4b,0xa5,0x3f,0x7a,0x1f,0xeb,0x35,0xed,0x86,0x5e,0x3f,0x95,0x6e,0x79,0x26,0x7c,0x54,0x84,0x58,0x89
+,0x1f,0xe9,0xc8,0xa9,0x71,0xa2,0xf0,0x16,0xae,0x90,0x5e,0xeb,0xae,0x70,0x1b,0x7e,0xe5,0x0e,0x0d,0x01
+,0x38,0xd2,0x0d,0x8d,0x5f,0x69,0x84,0xf4,0xcf,0x94,0xf1,0x45,0x8d,0xae,0x6b,0x0c,0xb5,0x94,0x5c,0xa5
+,0xab,0x3a,0x51,0x90,0xfa,0x51,0xa5,0xaf,0x65,0x89,0xb5,0x62,0x77,0x9b,0xac,0xac,0x00,0x13,0x54,0x25
+,0xad,0x2c,0x0b,0x11,0x33,0x40,0xe1,0xe0,0x36,0xbb,0x9b,0x1a,0x9c,0xa2,0xed,0x58,0x1a,0xa9,0x3d,0xd8
+,0x86,0xb3,0x19,0x0d,0xd9,0x71,0x79,0x36,0xd0,0x90,0x54,0xb6,0x9c,0xd7,0x9f,0x3e,0x7d,0xf8,0xd4,0x67
+,0x3f,0x9b,0x7e,0xc9,0xb1,0x71,0x8e,0x13,0x1e,0xa1,0x2e,0x61,0xd4,0xc5,0xf3,0xbd,0xd2,0x0c,0xb5,0xf6
+,0x0c,0xd6,0x52,0xf5,0x75,0xe7,0x72,0x8f,0x1b,0xe8,0x59,0x48,0xdf,0x89,0x65,0x0a,0xee,0xb6,0x64,0xf2
+,0xd2,0x86,0x2a,0x84,0x09,0x13,0x95,0x5c,0x8d,0xe0,0xaf,0x21,0xd3,0x3e,0x64,0x60,0xe4,0x6e,0xd1,0x23
+,0x7f,0xb7,0x5e,0x50,0xd4,0xe8,0xec,0xe9,0x0b,0x5e,0xc4,0xb7,0x83,0x67,0xea,0xa9,0xbf,0xb6,0x6a,0x50
+,0xa9,0x50,0x35,0x13,0x54,0x4b,0xff,0xf5,0x17,0x2b,0xfb,0xf9,0x06,0x1c,0xe4,0x8b,0x5d,0x25,0xdb,0xeb
+,0x32,0xfe,0x08,0x15,0x2a,0x3b,0x63,0x54,0x8d,0x91,0x3f,0xa0,0x5e,0x21,0x37,0x05,0x9c,0xca,0xc4,0xc6
+,0x02,0x22,0xd1,0x2d,0x41,0xa2,0x9a,0xc6,0x2a,0x27,0x50,0x3f,0x03,0x56,0xd4,0xb7,0xea,0x4a,0x0c,0x8a
+,0x9d,0xb4,0x8d,0x97,0xc2,0xef,0x75,0x0a,0x69,0x0c,0x20,0x8b,0x29,0xed,0xf2,0x0c,0xf5,0x4f,0x59,0x71
+,0x6d,0x62,0xf3,0xd7,0x0d,0xbf,0xd4,0x74,0xd0,0x35,0x97,0x67,0x88,0x98,0x5b,0x0c,0x74,0x3f,0x50,0xe2
+,0x2e,0x1a,0xfb,0x8d,0x08,0xd6,0x81,0xc4,0xd8,0xf1,0x8e,0xcb,0x99,0x37,0x0d,0xe3,0x38,0x6d,0x15,0xce
+,0xae,0x96,0x5e,0xb8,0x36,0x1b,0x46,0x7e,0xdb,0xd5,0x0e,0x70,0xcd,0xdf,0x29,0x0b,0x48,0xf2,0x6c,0xa6
+,0x8d,0x7b,0xbb,0x55,0xf1,0x6c,0x19,0x4d,0x2a,0xbe,0xb0,0x6c,0x60,0x97,0xd6,0x25,0xbf,0x81,0x32,0xbe
+,0xe0,0x81,0xbc,0x2f,0x7b,0x79,0x29,0xbf,0x0d,0x49,0xd2,0x93,0xd8,0x17,0xbf,0x7f,0x7a,0x7b,0x16,0xcf
+,0x91,0xb8,0x50,0xde,0xb3,0x96,0x9a,0x40,0x89,0x9c,0xdf,0x2f,0xce,0x7a,0x8e,0x5b,0x24,0xa6,0xba,0xb3
+,0xa5,0xdb,0x04,0xa8,0xd8,0xa0,0x2f,0x57,0x3c,0x50,0x09,0xb3,0xf6,0x90,0xfa,0x53,0x16,0x76,0x8d,0x01
+,0xdd,0x4c,0x90,0xf6,0x5e,0x40,0x6d,0xdf,0x4a,0x5a,0xb5,0xc2,0x34,0x7d,0x6e,0x75,0x12,0xa6,0xcc,0x6c
+,0x48,0xd1,0x0a,0x92,0x94,0x57,0x29,0xf2,0xb0,0x07,0x70,0xaf,0x44,0xde,0x2c,0x00,0x7d,0x1a,0x2a,0xba
+,0x53,0x5a,0x55,0x22,0x21,0xed,0x92,0xdf,0x50,0xcc,0x52,0xce,0x59,0x64,0x7a,0xd4,0xa5,0xa8,0x3a,0x91
+,0x32,0xd9,0x33,0x64,0xac,0xe5,0x84,0x83,0xba,0x6f,0x53,0xc7,0xa7,0x1a,0xec,0xfe,0x23,0xf6,0x9e,0xb2
+,0x73,0xd5,0x33,0x27,0x1b,0x74,0xd8,0x5e,0x59,0x66,0x15,0x69,0x1f,0x35,0x16,0xbe,0x9a,0x2b,0xe5,0xad
+,0xf1,0xd4,0x6d,0xd4,0xda,0xba,0xa9,0x5f,0xe0,0x64,0xb4,0x23,0xb5,0xf5,0x95,0xba,0xba,0x59,0xa0,0xc2
+,0xc2,0x59,0x4a,0xc6,0x27,0x13,0x91,0x50,0xfd,0x35,0x5e,0xaa,0x53,0xbc,0x48,0x79,0x10,0x9e,0xf1,0x79
+,0x61,0xe8,0xab,0xc6,0xd8,0x4c,0xad,0xe1,0x96,0xad,0x84,0x48,0x64,0x8f,0x64,0x29,0xa0,0x4a,0x07,0xb8
+,0x5e,0x5b,0xbf,0x07,0x42,0x9a,0xf4,0xd9,0x52,0x48,0xcf,0xd9,0xee,0xcb,0x2b,0x7e,0x5a,0x7a,0xea,0xe1
+,0x94,0x51,0x86,0xe5,0x20,0x18,0xe4,0x11,0xe9,0x1c,0x34,0x51,0x35,0xc7,0xe9,0xca,0x44,0x35,0xfd,0xe1
+,0x2e,0xcd,0x52,0x78,0xbf,0x13,0xfc,0xa1,0xe5,0x4b,0xc1,0x53,0x35,0x05,0xfd,0xd0,0xb3,0x2b,0xb5,0xda
+,0x18,0xe6,0x36,0x42,0xd5,0xea,0x39,0x68,0x00,0x88,0xdf,0x33,0xc8,0x5a,0x95,0x1a,0x1f,0xa8,0xf9,0x64
+,0xee,0x41,0xc4,0x0d,0x92,0x59,0x14,0x48,0x2b,0x46,0x4b,0x55,0xd7,0x7d,0x75,0x4b,0x8f,0x33,0x41,0x6d
+,0xe4,0x55,0x71,0xdf,0x42,0x63,0xe6,0x79,0x05,0x32,0xd8,0x9e,0xe1,0xf9,0xd2,0xb8,0x94,0x34,0xce,0x23
+,0xbf,0x25,0xbd,0x3f,0x13,0x71,0xf5,0x75,0xbc,0xa4,0x4f,0x04,0xc8,0x7b,0x1c,0x3c,0x73,0x57,0xec,0x7f
+,0xe8,0xda,0x41,0x29,0x4a,0x9b,0x2a,0x21,0xe0,0xd1,0xf7,0x0b,0xd6,0xbf,0xd4,0x1a,0x59,0x99,0xbd,0x6f
+,0x50,0x77,0x0c,0xed,0x3a,0x2a,0x70,0xa3,0x6e,0x36,0x56,0xcc,0x5e,0x65,0xe8,0x3c,0x67,0x42,0x17,0x25
+,0xc8,0x6e,0xa6,0x79,0x18,0xea,0xbe,0x99,0x92,0x91,0xba,0xc0,0xc1,0x29,0x55,0x12,0x3b,0xe9,0x29,0xe5
+,0xd9,0x9a,0xda,0x79,0x97,0x65,0x52,0xb0,0x69,0x91,0x24,0xe8,0x7b,0x2b,0x29,0xd5,0xc9,0x5b,0xb3,0x21
+,0xc8,0x9c,0xfa,0xdc,0xb6,0xbc,0x32,0x5a,0xa7,0xab,0x9c,0x35,0x17,0xa9,0x6f,0x2c,0xee,0xca,0x43,0xd5
+,0x39,0x90,0xe7,0x07,0x19,0xa5,0x5c,0xbe,0x6d,0x43,0xdf,0x7b,0xea,0xce,0x3b,0x84,0xc3,0x9c,0xf8,0xf1
+,0x3c,0xab,0x9c,0x0f,0x75,0x39,0x04,0xf3,0x25,0xe4,0x5c,0xde,0x50,0x99,0xc8,0x32,0x34,0x83,0xea,0xe6
+,0xa6,0xd6,0x8e,0xd9,0x4a,0xa9,0xee,0x7d,0x97,0x39,0x4d,0x93,0x0f,0x2a,0x6c,0xb0,0xd1,0xfb,0x34,0x3b
+,0x86,0xad,0x7c,0x57,0x5c,0x85,0x35,0x7f,0x36,0x89,0xf3,0xd0,0x57,0x1e,0x82,0xb6,0x79,0xec,0x8c,0xb2
+,0x1b,0xa5,0x33,0xe7,0xaf,0x0a,0xb5,0x09,0x22,0xcf,0xd9,0xe6,0x25,0xf2,0x84,0xee,0xb6,0xbf,0x82,0xb0
+,0x7a,0xbf,0xb8,0x68,0x9e,0x50,0x14,0xa8,0x4d,0x35,0xf5,0xa8,0xea,0x5f,0x09,0x55,0x9a,0x64,0xa5,0xcb
+,0x6c,0x6c,0x79,0x19,0x09,0x98,0x00,0x43,0x11,0x65,0xd8,0x10,0x59,0x36,0xd6,0x14,0x50,0x2b,0x83,0x6e
+,0xd1,0x13,0x23,0x24,0x17,0x41,0x18,0xaa,0x6f,0xfb,0x86,0x2d,0x95,0x3f,0x14,0x41,0xbf,0x53,0xd9,0x52
+,0x8e,0xba,0x5d,0xb2,0x97,0x4a,0x64,0xa9,0x82,0x38,0x1d,0xf6,0xdc,0xbb,0x6e,0x57,0x87,0x82,0x4a,0xde
+,0x05,0xc9,0x92,0xe0,0xc1,0x48,0xe0,0x37,0x3a,0xf5,0x7f,0xa1,0x7e,0x64,0xfa,0xfb,0x9b,0xac,0x74,0xe5
+,0x2a,0x45,0x46,0xd2,0x36,0xe1,0x28,0x56,0xd4,0x51,0x6d,0x40,0x5e,0xc6,0x39,0xf6,0xd1,0x8d,0xcb,0x8c
+,0xc3,0x61,0x84,0xa9,0xe0,0xfe,0x92,0x25,0x2a,0x0b,0x4c,0x09,0x6f,0xf5,0xf6,0x59,0xf1,0xc7,0x3e,0x52
+,0x92,0x48,0x09,0x20,0x6a,0xe5,0x7a,0x7a,0xa8,0xae,0x92,0x83,0xac,0x9e,0x48,0xea,0xaa,0x97,0x7c,0x09
+,0x81,0x9a,0xe6,0x14,0xc0,0x10,0x4b,0x2a,0xbe,0x9d,0x74,0x72,0x0b,0xd7,0x8a,0x63,0x95,0x87,0x56,0xb3
+,0xfe,0x36,0x58,0x54,0x03,0x45,0x3e,0x52,0x21,0x50,0xad,0xa6,0xc6,0x7b,0x79,0x0f,0x07,0xb0,0xb4,0x55
+,0x22,0x77,0xf5,0xa9,0xd6,0x7d,0x7d,0xfe,0xb1,0x48,0x59,0xc9,0x9e,0x75,0x6b,0xb3,0x41,0x1d,0x58,0x99
+,0xda,0xd6,0x9a,0x7b,0xe7,0xf9,0x18,0xc6,0xab,0xfa,0x7b,0xf0,0x88,0xf1,0x62,0xd5,0xde,0xde,0x6a,0x6d
+,0x3f,0xa8,0xeb,0x47,0x7f,0x2a,0x06,0xe2,0x54,0x13,0x21,0xa7,0x0d,0x14,0xee,0x80,0x35,0x2e,0x2c,0xb1
+,0x3a,0xed,0x7b,0x35,0x7f,0x7d,0x63,0x41,0x93,0xd3,0xde,0x4a,0x5e,0x65,0xab,0xd1,0xb7,0x33,0xa3,0x63
+,0x26,0x73,0x39,0x5f,0x66,0x52,0xcc,0xd9,0x02,0x0a,0xac,0xee,0xf6,0x6d,0x78,0x32,0x9f,0xb9,0x39,0x7b
+,0x5b,0x41,0xef,0x39,0x8c,0x4f,0x49,0x83,0x9c,0xbd,0x66,0xb2,0xf7,0x9c,0x47,0x8e,0x5b,0xab,0x24,0x56
+,0x3b,0xa7,0x5d,0x7b,0xcd,0x7a,0xaa,0xae,0xb7,0x47,0x3b,0x5e,0xf5,0xda,0x96,0xbc,0xc1,0x14,0x7e,0xa4
+,0x33,0xe5,0xf3,0x20,0x5c,0xf6,0xd9,0x1b,0x11,0xde,0x08,0x19,0x4c,0x78,0x1b,0x04,0x47,0x59,0xe7,0x1c
+,0x55,0xc5,0x74,0xa0,0x3a,0xa0,0x61,0x9c,0xf6,0xd9,0x4f,0x87,0xe2,0x58,0x3c,0xdb,0xa7,0x11,0xfa,0x22
+,0xa5,0x03,0x6d,0xbb,0x8a,0xfa,0x4c,0x7f,0xe4,0x31,0xd8,0x59,0x15,0xe0,0xe9,0x32,0xfb,0xe1,0xd0,0x9b
+,0x60,0x99,0xbd,0xf4,0x0d,0x46,0x9f,0xed,0x3f,0x4b,0x6e,0x15,0xf8,0xe2,0x03,0xbd,0x87,0x03,0x1f,0xc7
+,0xa9,0x2f,0xd2,0x0e,0x38,0x08,0x79,0x92,0x01,0x98,0x7d,0xaa,0x03,0x64,0xd2,0xbf,0x2b,0x57,0x8f,0x63
+,0xc4,0x94,0x39,0x10,0x27,0xb7,0x0c,0x6a,0x0c,0x9b,0xfa,0xc9,0xf7,0x7d,0x02,0x97,0xa0,0x50,0x07,0x83
+,0x7d,0x06,0x92,0x10,0xca,0x0d,0x5d,0xc5,0x57,0x01,0x0a,0x06,0x9f,0x5c,0x5f,0xa9,0xb4,0xa4,0xb3,0x29
+,0x37,0x33,0xb2,0x98,0x05,0x52,0x94,0xe4,0x21,0x50,0xc3,0xf6,0x2b,0xe4,0xa6,0xdc,0x0f,0xf2,0xac,0xcf
+,0x9e,0x1b,0x04,0x9b,0x9f,0x77,0xdc,0xed,0x20,0xe2,0x25,0x21,0x07,0xef,0xd3,0x50,0x60,0x55,0x41,0x19
+,0x51,0xc5,0x0e,0x7a,0x86,0x3e,0xf5,0x34,0xd8,0xa1,0x35,0x9d,0x45,0xca,0x13,0xe0,0xc6,0xcf,0xc1,0x0e
+,0xdd,0x1a,0x04,0xd3,0xa5,0xfd,0xbc,0xb7,0x7a,0x8a,0x3b,0x3b,0x9e,0x7e,0x51,0xb1,0x66,0x8e,0x68,0x1c
+,0xe0,0x64,0x78,0x2e,0x63,0xa2,0x50,0x7f,0x21,0xc1,0x9e,0xf7,0xfe,0x51,0x93,0x87,0x95,0x05,0x68,0x2d
+,0x3e,0x22,0x52,0xfb,0x0b,0x32,0xc7,0x54,0x05,0x0d,0x0a,0x88,0x9d,0x50,0x4c,0x65,0x09,0xd6,0x0c,0xaa
+,0x8f,0x08,0x36,0x90,0x3d,0xd3,0xc8,0x74,0x6e,0xd8,0x67,0x87,0x4a,0x2c,0xc5,0xec,0x8b,0x9e,0x7e,0xb5
+,0xb2,0x3c,0x2c,0x4e,0xed,0x2a,0x15,0x42,0xe5,0xc5,0x3f,0x74,0x26,0x55,0xcd,0x7b,0x5e,0x05,0xbd,0x7e
+,0x2c,0x3b,0xdd,0xa7,0xf6,0x33,0x69,0x36,0x17,0x51,0xde,0x59,0xff,0xf3,0xb4,0xbb,0xe3,0x99,0x4f,0xb1
+,0x21,0x8b,0x6f,0x1d,0xd4,0xdb,0xe2,0x16,0xdb,0x07,0x3b,0xf7,0x10,0x54,0x27,0xa7,0xfb,0xf4,0xb8,0x90
+,0x31,0xb0,0x02,0x62,0x95,0xbc,0x23,0x22,0xa4,0xae,0x43,0x70,0x85,0x19,0xed,0x4f,0x50,0x9a,0xa9,0x03
+,0xed,0x3e,0xc5,0x7e,0x78,0xf2,0x30,0x88,0x04,0xb6,0x5b,0x21,0x1e,0x28,0x26,0x10,0x6e,0x3a,0x46,0x8c
+,0x08,0xb4,0x05,0x5b,0x2a,0x97,0x21,0xd5,0x40,0xc9,0x0a,0x3d,0x50,0xdf,0xaf,0xb3,0x0e,0xea,0x2c,0x41
+,0x90,0xe0,0xb0,0x92,0x38,0x0b,0x74,0xe6,0x88,0x85,0x85,0x10,0x8c,0x32,0x31,0xcb,0xb7,0x1a,0xbc,0xdb
+,0xb1,0x8b,0xfb,0xc8,0xb3,0x42,0x4e,0xff,0x0d,0x62,0x50,0x6a,0x6f,0x10,0x11,0x61,0x1d,0xa3,0x1d,0x06
+,0xfd,0x2b,0xbb,0xf9,0xcc,0x40,0x6c,0xbd,0xd1,0xfd,0x6f,0x54,0x59,0xaf,0xf4,0xf5,0xa5,0x5b,0xc3,0x62
+,0xf5,0xb8,0x2a,0xe6,0x67,0x15,0x2c,0x5a,0x36,0x25,0x21,0x7c,0x0c,0x0d,0xc9,0x49,0xc0,0x0d,0x27,0x31
+,0x3d,0xa1,0xbf,0x4d,0xc2,0x19,0xc7,0xb7,0x9d,0x6c,0xc6,0x81,0xb1,0xcf,0xc8,0xb8,0x8e,0xc9,0xca,0x70
+,0x08,0xea,0x25,0xbd,0x1a,0xf3,0x56,0xaf,0xad,0xfe,0x7a,0x07,0x08,0x06,0x1b,0x8a,0x64,0xb8,0xfb,0x2d
+,0x88,0xae,0x29,0xf9,0xcb,0x02,0x5f,0xd4,0x05,0xd8,0xc8,0x12,0x07,0x53,0x86,0xb4,0x71,0xc8,0x49,0x4a
+,0xa5,0xd5,0x1d,0x18,0x02,0x06,0x3b,0xca,0x8b,0xfa,0x62,0x12,0xa7,0xfa,0xbb,0x1f,0xc3,0xf2,0xba,0xf9
+,0x69,0x0a,0x74,0x5c,0xd2,0x9a,0xaf,0x2a,0x40,0x4b,0x40,0xa8,0x48,0x53,0x5f,0xa7,0x51,0xb5,0xd6,0x4c
+,0x4f,0x5f,0x4f,0xde,0x35,0x89,0x6e,0x9f,0xfe,0x6a,0x24,0xe7,0x33,0xd3,0xeb,0xa8,0x19,0x49,0x33,0x70
+,0x03,0xb2,0xe9,0x3c,0xef,0xe5,0x40,0x7d,0x5a,0x57,0x90,0x51,0x32,0x54,0x43,0x6b,0x7a,0xbf,0x0b,0x94
+,0x41,0xcd,0xfa,0x8a,0xd4,0x89,0x0a,0x82,0x68,0x2b,0x49,0xda,0x80,0xef,0x31,0xda,0x15,0x68,0xea,0x34
+,0xfe,0xf9,0xdb,0x5c,0x76,0x9f,0xbe,0xe7,0x37,0x63,0xa4,0xcd,0x14,0xbb,0xd5,0xff,0xb3,0xa1,0xc0,0x4f
+,0xe0,0xf4,0xff,0x2f,0x62,0xdf,0x0d,0x36,0x84,0x6c,0x1a,0x92,0xae,0xea,0xdb,0xa3,0xc1,0x5a,0xd4,0xfc
+,0x39,0x0d,0x78,0xd8,0x2e,0x43,0x67,0x46,0x91,0x33,0xd3,0x91,0x73,0x55,0xa0,0xe1,0x0a,0x11,0xe0,0x70
+,0x78,0x0d,0x72,0xda,0xd5,0x8c,0x60,0x7a,0x40,0x7f,0xb7,0x47,0xf1,0x52,0x53,0x9f,0x15,0x9a,0x6a,0xd6
+,0x6e,0xea,0x6a,0xdd,0xf5,0xbe,0x30,0xb1,0xcf,0x92,0x61,0xb5,0x6e,0x0b,0xd7,0x87,0xc7,0xfc,0xf0,0xa8
+,0xb6,0xc1,0xd3,0xff,0xe5,0x6a,0xdb,0x8e,0x83,0xa3,0x17,0xc7,0x07,0x27,0x9b,0x01,0xa0,0x41,0xf2,0xaf
+,0x23,0x1f,0x72,0x47,0x3a,0xa5,0xb2,0xa8,0xff,0x07,0x85,0x15,0x09,0xa2,0xcb,0x36,0x00,0x00
+};
+
+#define help_config_html_gz_len 8280
+const uint8_t help_config_html_gz[] = {
+0x1f,0x8b,0x08,0x08,0xd5,0xcc,0x17,0x63,0x00,0xff,0x69,0x6e,0x64,0x65,0x78,0x2e,0x68,0x74,0x6d,0x6c
+,0x2e,0x67,0x7a,0x00,0xc5,0x57,0x5d,0x6f,0xdb,0x38,0x16,0x7d,0xf7,0xaf,0xb8,0x70,0x81,0x41,0x5b,0xf8
+,0xa3,0x49,0x3a,0x69,0xea,0x49,0x0c,0xec,0xa4,0x01,0x5a,0xa0,0x9b,0x06,0x71,0x16,0x83,0x7d,0xa4,0x24
+,0xca,0x22,0x22,0x91,0x5a,0x92,0xb2,0xab,0x59,0x14,0xe8,0x8f,0xd8,0xc7,0xdd,0x3f,0xd7,0x5f,0xd2,0x73
+,0x49,0xa9,0x56,0xd2,0x78,0xd3,0xdd,0x97,0xc2,0x7e,0xb0,0x44,0xde,0xaf,0x73,0xcf,0x3d,0xa4,0x4f,0x33
+,0xb5,0xa1,0xb4,0x14,0xce,0x9d,0x8d,0xbd,0xa9,0xb5,0xd8,0x8c,0x97,0x23,0xa2,0x53,0xaf,0x7c,0x29,0x97
+,0x6f,0x65,0x59,0x4f,0xcf,0x45,0x25,0xad,0xa0,0x95,0x17,0x5e,0x19,0x7d,0x3a,0x8f,0x4b,0xbc,0xa9,0x92
+,0x5e,0x50,0x5a,0x08,0xeb,0xa4,0x3f,0x1b,0x37,0x3e,0x9f,0x9e,0x44,0xeb,0xb0,0xa0,0x61,0x77,0x36,0xde
+,0x28,0xb9,0xad,0x8d,0xf5,0x63,0x4a,0x8d,0xf6,0x52,0x63,0xe3,0x56,0x65,0xbe,0x38,0xcb,0xe4,0x46,0xa5
+,0x72,0x1a,0x1e,0x26,0x4a,0x2b,0xaf,0x44,0x39,0x75,0xa9,0x28,0xe5,0xd9,0xc1,0x84,0x1a,0x27,0x6d,0x78
+,0x12,0x09,0x5e,0xb4,0xd2,0xc1,0xf1,0x29,0x82,0xc5,0x4c,0x45,0xea,0xd5,0x46,0x8e,0xa9,0xb0,0x32,0x3f
+,0x1b,0xcf,0xc7,0xcb,0x5f,0x9e,0x9c,0xbc,0x3e,0x3e,0x7c,0x6b,0x2a,0x79,0x3a,0x17,0x61,0x67,0xb7,0xe4
+,0xbc,0x95,0xa2,0x9a,0x15,0xbe,0x2a,0xc7,0xcb,0x55,0x78,0xb8,0xbf,0x43,0x7a,0xaf,0xf4,0xda,0xf5,0x7b
+,0xd2,0x42,0x66,0x4d,0x79,0xdf,0x4f,0x01,0x24,0xba,0x1d,0x0c,0x4a,0x5c,0x9d,0x03,0xbc,0xe5,0x68,0x34
+,0xc4,0xb0,0x12,0x4a,0xdf,0x30,0x40,0xe3,0xe5,0x8d,0x35,0x0d,0x92,0x77,0x85,0x31,0x1c,0x80,0xde,0xe9
+,0xdc,0x74,0x26,0x43,0x8b,0x2e,0xfe,0x8d,0xfc,0xe8,0xc7,0xcb,0xcb,0x0f,0x37,0x17,0x0b,0xba,0x29,0x94
+,0xa3,0x5a,0xac,0x65,0xc0,0x0c,0x1e,0x1d,0xf9,0x7b,0xce,0x14,0x9c,0x51,0x6e,0x2c,0xf9,0x42,0xd2,0x56
+,0x26,0x80,0x6b,0x23,0x2d,0x7d,0xb8,0x7c,0xff,0xf7,0x19,0xbd,0xcb,0xa9,0x35,0x0d,0x69,0x29,0x33,0xf2
+,0x86,0x32,0x99,0x34,0x6b,0xd2,0x46,0x4f,0x77,0x1b,0xad,0x2c,0x85,0xc7,0xb2,0x72,0xae,0x91,0xee,0xa9
+,0x9a,0xc9,0x19,0x55,0x2a,0xb5,0x66,0xf5,0x86,0x52,0x61,0xfb,0x85,0x67,0x84,0x10,0xc2,0x4a,0xc4,0x8b
+,0xee,0x4c,0x4e,0x06,0x21,0x2d,0x65,0x26,0x6d,0x2a,0xb4,0x33,0x90,0x62,0x42,0x75,0x29,0x85,0x93,0x94
+,0x29,0x87,0x94,0xb5,0x4c,0x3d,0xe5,0xd6,0x54,0xf7,0xb2,0x13,0x3a,0xa3,0xb5,0xe1,0x94,0x12,0xe5,0x67
+,0x65,0x3b,0x97,0xae,0x4e,0x45,0x35,0xac,0x6d,0xd6,0x23,0x94,0xd8,0xe5,0x43,0x28,0x45,0x68,0xaf,0x18
+,0x9b,0x37,0xca,0x22,0x8e,0xb1,0xed,0x97,0xcf,0xff,0xda,0xf7,0x8d,0xde,0xd8,0xd9,0x83,0x98,0x47,0x6f
+,0x4c,0x9b,0xc5,0x63,0x9d,0x79,0x2b,0x1c,0x95,0x4a,0xdf,0xa2,0x15,0x86,0x44,0x59,0x76,0x30,0x70,0x97
+,0xdc,0xb7,0xa4,0xf7,0x86,0x88,0xcc,0x7b,0x34,0xc8,0x79,0xc4,0x2e,0xc4,0x60,0xe8,0x00,0x0e,0x8f,0x1e
+,0xcf,0xd0,0x6c,0xc8,0x0a,0xa1,0x29,0x91,0x3c,0x23,0xa1,0xbf,0x5e,0xdc,0x4a,0xaa,0x0b,0xe3,0x8d,0xe3
+,0x76,0x39,0x2f,0xac,0x27,0x81,0x6c,0x37,0x12,0x0f,0x1c,0x18,0x5b,0x99,0x34,0x3b,0x97,0x33,0x3a,0x2f
+,0x84,0x46,0xea,0xdc,0xd8,0x2e,0x4a,0x3f,0x08,0x84,0xba,0xd0,0x35,0x85,0x1a,0x11,0x04,0xf4,0x2f,0x91
+,0x12,0x53,0x45,0x93,0x57,0x15,0x78,0x53,0xa3,0xd1,0x21,0xdc,0xda,0x8a,0xba,0x68,0x49,0x55,0x3f,0x08
+,0x42,0x37,0x5a,0x8f,0xc3,0xd0,0xe5,0xd6,0xa1,0x10,0x62,0x71,0x95,0x5c,0x83,0xeb,0x9c,0xf4,0x20,0x54
+,0x22,0x93,0x21,0x63,0x06,0x48,0x92,0xdf,0x9a,0x5d,0x21,0x4c,0x5c,0x76,0x30,0xbe,0x0a,0x1e,0xa0,0x60
+,0x00,0xe6,0x06,0x35,0x8c,0x27,0xb4,0x2d,0x54,0x5a,0x80,0xe5,0xf8,0x21,0x75,0x8f,0x5e,0x28,0x3a,0xe2
+,0xc7,0x24,0x85,0x35,0xa0,0x05,0xbb,0x99,0xb8,0xe3,0x6b,0x59,0x4b,0xe1,0xe9,0x02,0x4c,0x6e,0x17,0x43
+,0x0f,0x1c,0x22,0xb7,0xf2,0x1f,0x8d,0xd4,0x69,0x7b,0xc7,0x55,0xef,0x81,0xc4,0x8e,0xd8,0xfb,0x69,0x08
+,0x5d,0x79,0x14,0x9a,0x07,0xa4,0x21,0x11,0x4e,0xa5,0x0f,0x0a,0x44,0x84,0xa4,0x32,0xce,0xa3,0x8d,0x29
+,0x86,0x15,0x40,0x95,0x75,0xd4,0x0e,0xb8,0x11,0x1b,0xa1,0x82,0xbe,0x22,0xbd,0xc5,0xfe,0x91,0xfc,0xa1
+,0x89,0xfc,0x43,0x26,0xb4,0x8a,0x53,0x7e,0x65,0x0d,0x4c,0x2b,0xb7,0x7f,0x14,0xff,0x0b,0x08,0x9d,0xf1
+,0x82,0xce,0x85,0xd6,0xc6,0x53,0x37,0x11,0xdc,0x8e,0x5d,0x88,0xc7,0x40,0x5a,0x99,0xb2,0x61,0x59,0x5a
+,0x8c,0x9e,0x8a,0x67,0x7f,0xe5,0xe9,0x70,0x0d,0xa8,0xc0,0x9a,0xc8,0x94,0xe8,0x14,0xaa,0x1b,0x1e,0x20
+,0x74,0xb1,0xba,0x3a,0x3a,0x44,0xc4,0x0a,0x5d,0xcb,0x15,0x84,0x0e,0x2c,0xb2,0xb7,0xa1,0xeb,0x9c,0x03
+,0xec,0xec,0x9d,0x95,0x88,0xeb,0xdf,0xae,0xdf,0x0f,0x15,0x18,0xb4,0x0b,0xe5,0x87,0xc6,0xb3,0x59,0xf0
+,0x61,0xd0,0x7b,0xdd,0x76,0x62,0xd1,0x99,0x8f,0x9e,0x26,0x83,0xac,0x90,0x43,0x6d,0xa5,0x8b,0x34,0x4a
+,0x1a,0xef,0x61,0x82,0x77,0x1d,0x0b,0xef,0xe8,0xe7,0x56,0xf9,0x02,0x53,0x78,0xf0,0x02,0xb1,0x50,0x44
+,0x86,0x71,0xcf,0x29,0x41,0x8b,0x9a,0x7a,0x46,0xd7,0x92,0x7f,0x51,0x02,0x06,0xb2,0xbb,0x7e,0xde,0xbf
+,0x7c,0xfe,0xf7,0xb5,0x04,0x3a,0x5f,0x3e,0xff,0x87,0x7e,0x0f,0xde,0x7b,0x26,0xfe,0x0f,0x5d,0x88,0xc9
+,0xb0,0xa0,0x44,0x3d,0x99,0xdf,0x91,0x1c,0xfd,0xff,0xb6,0xe6,0x9d,0x86,0x5e,0x65,0x28,0x2c,0x62,0xb0
+,0x61,0x86,0xa6,0x56,0xb8,0x42,0xba,0xc9,0x7d,0x58,0x79,0xdc,0x8d,0x2e,0xdb,0x5e,0xd1,0x60,0x62,0x34
+,0x0e,0x9c,0x70,0x8b,0x00,0x81,0x21,0x78,0xac,0x4e,0xe1,0xf0,0xab,0x9a,0xd2,0x2b,0x9c,0x48,0xdd,0xaa
+,0x9b,0xf3,0x6d,0x22,0xca,0xc1,0x77,0xbd,0xbf,0x7b,0x3a,0x39,0x1c,0x05,0xec,0x56,0x96,0xd0,0x38,0x8c
+,0x48,0x0c,0x86,0xec,0x27,0x81,0x3d,0xfd,0x50,0x37,0x3a,0x8c,0x4d,0x68,0x53,0xb8,0x5f,0xa0,0xa3,0x4c
+,0x89,0x41,0xbe,0x95,0x68,0xa9,0x10,0x50,0xe0,0x58,0x50,0x16,0xdc,0xc3,0xa3,0x36,0x54,0x1a,0xa8,0x1b
+,0x1f,0xc1,0xae,0x46,0x13,0xe1,0x1c,0x7c,0xb2,0x2d,0x3f,0x33,0xcc,0x7d,0xe3,0x06,0xbe,0x42,0x66,0x7d
+,0x26,0x24,0xd6,0x18,0xfb,0x58,0x71,0x69,0xb6,0xd1,0x51,0x87,0xea,0xec,0xc1,0x3b,0xc9,0x9e,0xde,0xae
+,0x7a,0x99,0xec,0xe5,0xf6,0x12,0x9d,0x5e,0x89,0x0d,0xde,0xf5,0x6e,0x1e,0x6f,0x23,0x6e,0x35,0x24,0xb2
+,0x0c,0xb7,0xb7,0x48,0xdb,0x2a,0xaa,0x34,0x2e,0x85,0xec,0x32,0xa2,0x56,0x35,0x10,0xa0,0x1d,0xc7,0xc1
+,0x48,0x44,0x91,0x4c,0xc8,0x8e,0xee,0x22,0xf7,0x01,0xb1,0xa1,0x69,0x28,0x7a,0x2b,0x94,0x07,0xd8,0x5e
+,0x95,0x78,0xc4,0xa9,0x2b,0xc1,0xc2,0xda,0xd4,0x8e,0x9a,0x9a,0x47,0x4c,0xe5,0x2d,0x5b,0x70,0x0c,0x5f
+,0x00,0x90,0x70,0xbe,0x75,0xe6,0x01,0xfb,0x44,0x42,0x7b,0x1d,0x7e,0x65,0x3d,0xc4,0xa5,0x11,0x8c,0x78
+,0x8f,0x70,0x50,0x52,0xcc,0xf0,0x5e,0xec,0x77,0xc3,0xe2,0x7c,0xcb,0xd7,0xde,0xd9,0xb7,0x1b,0xde,0x3f
+,0x71,0xd3,0xcd,0x21,0xc2,0xd3,0x1c,0x7d,0x29,0xdb,0x05,0x41,0xc0,0x37,0xd2,0xab,0x54,0x4c,0x00,0xa3
+,0x76,0x53,0x4c,0x84,0xca,0x7f,0xc3,0xae,0xd4,0x94,0xc6,0x2e,0xe8,0xc9,0x91,0x3c,0x91,0x2f,0x0f,0xf8
+,0x4d,0xcd,0x98,0xe9,0xf5,0xb4,0x94,0x39,0xa4,0xf7,0xe0,0x45,0xfd,0x71,0xf8,0xd6,0xaa,0x75,0x31,0x78
+,0x1d,0x82,0x38,0xf5,0xa7,0x5c,0xd0,0xcb,0xf0,0xea,0xd3,0x68,0x36,0xec,0xe9,0xcf,0x48,0xe4,0xf0,0x7e
+,0x22,0xa0,0xc5,0xcf,0xc8,0xe3,0xe0,0xd7,0x98,0xc7,0x68,0xfe,0xfc,0x52,0x6c,0x12,0xc1,0xd7,0x9f,0x16
+,0xf7,0xb4,0x75,0x3c,0xed,0x9f,0xcf,0x47,0xb3,0xf8,0xb7,0x86,0x38,0xbb,0x44,0xa4,0xb7,0x6b,0x1c,0x6d
+,0x3a,0x9b,0x7e,0x9f,0xc2,0x30,0xf5,0xbf,0x58,0xfc,0x1b,0x99,0xec,0xf2,0x77,0x9c,0x3e,0x18,0x11,0xd3
+,0x37,0x20,0x46,0x8e,0xd9,0x5b,0x50,0xa1,0xb2,0x4c,0xea,0x00,0x44,0x17,0x46,0x84,0x40,0x58,0xe5,0x33
+,0x95,0xab,0x19,0xd6,0x9b,0x1f,0xf2,0x87,0xdf,0x78,0xe0,0x35,0x15,0xa5,0x5a,0x63,0x84,0xf8,0x64,0x96
+,0x76,0x50,0x2f,0xca,0x7a,0x59,0x7f,0xa4,0x83,0xe3,0x58,0x6e,0xd8,0x9b,0x41,0xf1,0x6d,0xb8,0x6c,0x2f
+,0xf8,0x2a,0x2f,0xef,0xe3,0xf0,0xaa,0xeb,0x47,0x9f,0xc6,0xa2,0xe0,0x2c,0xf7,0x56,0x7d,0x74,0x22,0x8e
+,0x8e,0xef,0x18,0xcc,0xe2,0x9f,0xaa,0x7d,0x16,0x87,0xc7,0xaf,0x4e,0x0e,0x5f,0x0f,0x8a,0xc1,0xf5,0xc7
+,0x23,0x8b,0x4f,0xdf,0x23,0x7f,0xa1,0x33,0xe0,0x0e,0x0d,0x89,0x23,0xf3,0x15,0xd1,0x16,0x2c,0x73,0x63
+,0x0e,0x00,0x00
+};
+
+#define homepage_config_html_gz_len 5201
+const uint8_t homepage_config_html_gz[] = {
+0x1f,0x8b,0x08,0x08,0x5f,0x63,0x17,0x63,0x00,0xff,0x69,0x6e,0x64,0x65,0x78,0x2e,0x68,0x74,0x6d,0x6c
+,0x2e,0x67,0x7a,0x00,0xad,0x56,0x7d,0x6f,0xe3,0x36,0x0f,0xff,0xbf,0x9f,0x42,0xf0,0x01,0xeb,0xf5,0x50
+,0x3b,0x2f,0x4d,0xd3,0xd4,0x4b,0x0a,0xdc,0x8a,0x7b,0x70,0x03,0x86,0x61,0xc0,0xdd,0x17,0x50,0x2c,0x3a
+,0xd6,0x4e,0x96,0x0c,0x49,0x4e,0x9a,0x0e,0xfd,0xee,0x47,0xbd,0xd8,0x71,0xd3,0x66,0x68,0x87,0x07,0x41
+,0x12,0x8b,0x22,0x29,0xf2,0xc7,0x1f,0x29,0x2f,0x2b,0x5b,0x8b,0xbb,0x33,0x42,0x96,0x15,0x50,0xe6,0x1e
+,0xf0,0xb1,0x06,0x4b,0x49,0x51,0x51,0x6d,0xc0,0xae,0x92,0xd6,0x96,0xe9,0x22,0x19,0x6e,0x49,0x5a,0xc3
+,0x2a,0xd9,0x72,0xd8,0x35,0x4a,0xdb,0x84,0x14,0x4a,0x5a,0x90,0xa8,0xba,0xe3,0xcc,0x56,0x2b,0x06,0x5b
+,0x5e,0x40,0xea,0x17,0x97,0x5c,0x72,0xcb,0xa9,0x48,0x4d,0x41,0x05,0xac,0x26,0x97,0xa4,0x35,0xa0,0xfd
+,0x8a,0xae,0x51,0xb0,0x07,0xd3,0xb9,0xb6,0xdc,0x0a,0xb8,0xfb,0x66,0x35,0xd0,0x3a,0xbd,0xc7,0x23,0x34
+,0x25,0xdf,0x2c,0xb5,0x5c,0xc9,0xe5,0x28,0x6c,0x06,0x45,0xc6,0xb7,0xa4,0x10,0xd4,0x98,0x55,0x62,0x55
+,0x23,0xe9,0xd6,0x7b,0x88,0xf6,0x27,0x0c,0x97,0x98,0x50,0x30,0xa1,0x85,0xe5,0x5b,0x48,0x48,0xa5,0xa1
+,0x5c,0x25,0xa3,0xe4,0xee,0x97,0x0f,0x8b,0xdb,0xf9,0xf4,0xab,0xaa,0x61,0x39,0xa2,0x5e,0x33,0x6e,0x19
+,0x1f,0x4a,0xe6,0x10,0x4a,0x62,0x5c,0xc7,0x1a,0x60,0x2d,0x97,0x1b,0xd3,0xe9,0xc4,0xe5,0x91,0x56,0x05
+,0xa2,0x89,0x1a,0x5f,0xf1,0x31,0xec,0x8e,0x30,0x0b,0xf7,0x17,0x60,0x77,0xf1,0xaf,0x15,0xdb,0xfb,0x44
+,0x06,0xf9,0xc5,0x03,0xbe,0xbb,0x24,0x92,0x17,0xb9,0x79,0x17,0xc7,0x90,0x54,0x4a,0xf3,0x47,0x2c,0x08
+,0x15,0x7f,0xd0,0xbd,0x6a,0x6d,0x72,0x47,0x9c,0xfb,0x63,0xb5,0x2d,0x68,0xcb,0xb1,0x0a,0x51,0x89,0x28
+,0x59,0x08,0x5e,0xfc,0x58,0x25,0x1b,0xf5,0x5d,0xfd,0x45,0x37,0xf0,0xf1,0x3c,0xe4,0x7f,0x7e,0x81,0x1e
+,0x48,0xe7,0x61,0xdd,0x5a,0xab,0x64,0xe7,0xa4,0x95,0xbc,0x50,0x0c,0x7e,0xaf,0x37,0x0e,0xc6,0xc9,0x74
+,0x31,0x9d,0xdd,0x2c,0x47,0x41,0x27,0x44,0xf6,0xc2,0xa4,0xa8,0x14,0x92,0xe3,0x37,0x2f,0x3b,0xa0,0x7a
+,0x64,0x12,0x32,0xfb,0x8f,0x51,0xc7,0x22,0xbc,0x3d,0xee,0xdb,0xdb,0xf9,0x3b,0xa3,0xee,0xeb,0xfc,0x7f
+,0x8c,0xdb,0xb1,0xe4,0x1d,0x58,0x8f,0xc7,0xf3,0xc5,0xbb,0x82,0x0e,0xd4,0x3b,0x1d,0xf0,0x90,0x4e,0xdd
+,0x23,0xea,0x7b,0x52,0x22,0x4d,0xfd,0x98,0x38,0x5b,0x9a,0x42,0xf3,0xc6,0xba,0xbd,0xb2,0x95,0xd8,0x49
+,0x78,0x5a,0x9f,0x42,0x83,0x3f,0x17,0xff,0x78,0x0f,0xbc,0x24,0x7e,0xb9,0x42,0x0a,0xfb,0x12,0x27,0x71
+,0x83,0x90,0x1d,0x97,0x4c,0xed,0x32,0xa1,0x0a,0xcf,0xe2,0xcc,0x35,0x09,0x59,0x91,0xf3,0x61,0xbb,0x9d
+,0xff,0xea,0x95,0x9f,0xfc,0x2f,0x08,0x03,0xcf,0x1c,0x46,0xf4,0xdf,0xe2,0x72,0xd8,0x9f,0xff,0xea,0xd4
+,0xa1,0xff,0x06,0x87,0x7d,0x2b,0xbf,0x70,0x16,0x4c,0xef,0x95,0x34,0x4a,0x00,0x5a,0x6e,0xb2,0x46,0x73
+,0x69,0x85,0xfc,0x98,0x7c,0xd1,0x5a,0x69,0x32,0x1b,0xcf,0x72,0xe2,0x70,0x22,0x52,0x59,0x52,0xaa,0x56
+,0xb2,0x2c,0xb9,0x88,0xd5,0x76,0x7e,0x9e,0x10,0xe6,0x03,0xbc,0x4b,0x63,0xf7,0x61,0xe2,0x65,0x87,0xca
+,0x87,0x43,0x4a,0xec,0xee,0xd4,0xf0,0x47,0xc8,0xc9,0x74,0x32,0x6e,0x1e,0x42,0x28,0x16,0x1e,0x6c,0x4a
+,0x05,0xdf,0xc8,0x9c,0x14,0x38,0x8d,0x41,0x07,0xb9,0x1f,0xc3,0x39,0xb9,0x1a,0xf7,0x9a,0x15,0xf0,0x4d
+,0x65,0x9f,0x89,0xd6,0xb4,0xf8,0xb1,0xd1,0x2e,0xa6,0x9c,0xec,0x2a,0x6e,0x21,0x8a,0x95,0x66,0x38,0xad
+,0x35,0x65,0xbc,0x35,0x39,0xb9,0x6e,0x1e,0xfc,0x17,0xcd,0xdc,0xd7,0xe9,0x3c,0x39,0xf2,0x64,0xc3,0x31
+,0x35,0x88,0xb1,0xa4,0x35,0x17,0xfb,0xfc,0xb3,0xc6,0x0b,0xe0,0x12,0xf9,0xb7,0x05,0xd7,0x04,0x97,0x86
+,0x4a,0x93,0xe2,0x2d,0xc0,0x4b,0xe7,0x61,0x90,0xcd,0x2c,0x3a,0xad,0xb9,0x0c,0xb7,0x07,0x26,0xd8,0xc5
+,0x58,0x28,0xa1,0x74,0x4e,0x3e,0x5c,0xc1,0x02,0x66,0x13,0x27,0x79,0x3d,0x61,0x0c,0x28,0x3b,0x1e,0x81
+,0x2e,0x24,0xc6,0x4d,0x23,0xe8,0x3e,0x27,0xa5,0x00,0xef,0xd0,0xfd,0xa7,0x3b,0x4d,0x1b,0xcc,0x18,0x7f
+,0x7b,0x11,0xe3,0x1a,0x3c,0xb1,0x73,0xa2,0xd5,0xce,0x89,0xff,0x6e,0x8d,0xe5,0xe5,0x3e,0x8d,0xd7,0xdc
+,0xe1,0x34,0x77,0xd6,0xf3,0xce,0x3e,0x7d,0xd2,0xc0,0x2d,0xa6,0xd2,0xd6,0xd2,0xed,0x04,0x7c,0xb1,0x12
+,0x08,0x28,0xf2,0x86,0x33,0xb2,0x16,0x58,0x89,0xc3,0x56,0x0f,0x7d,0x57,0xe7,0x86,0x32,0x86,0x48,0x1f
+,0x04,0x35,0xd5,0x1b,0x8e,0x4e,0x0f,0xeb,0x87,0xb4,0x2b,0xf0,0xf5,0xf5,0x40,0x18,0x01,0x8d,0x32,0x17
+,0xfa,0x70,0x3e,0x10,0x17,0x79,0xa3,0x0c,0x5e,0xd6,0x3e,0x73,0x10,0xc8,0xfc,0xad,0xa7,0xc1,0x63,0x8a
+,0xdd,0x00,0x0f,0x39,0x49,0x3d,0xec,0x7d,0x7a,0x5c,0x0a,0x2e,0x21,0x5d,0x63,0x97,0x84,0x88,0x7b,0x0e
+,0x21,0x52,0xa1,0x58,0xb3,0xfb,0xcf,0xff,0xbb,0x1e,0x0f,0xca,0xd7,0x73,0x6b,0x50,0xf5,0x09,0x52,0xca
+,0x89,0x7a,0x5a,0xc6,0x75,0xd1,0x6a,0xe3,0x6c,0x1a,0x85,0x7d,0x14,0x8a,0xdb,0x93,0x82,0x04,0x95,0x23
+,0x90,0x22,0x2f,0x3b,0x9e,0x0e,0xf0,0x4a,0xf1,0x45,0x01,0xed,0x42,0xe6,0x19,0xb6,0x53,0x48,0x78,0x08
+,0xd6,0xac,0x63,0xda,0x00,0xac,0x81,0x2c,0xa0,0x4c,0x5b,0xab,0x9c,0x8b,0xd1,0xa7,0x3f,0xe9,0x76,0x4d
+,0x35,0x71,0x5d,0x8a,0xfe,0xdd,0x9d,0xac,0xed,0xa7,0xd1,0x59,0x16,0xde,0x48,0xbc,0xf7,0x57,0x00,0x39
+,0xb0,0xf7,0xed,0x0d,0xa2,0x90,0x62,0xa5,0x50,0xbb,0x9c,0x54,0x9c,0x31,0x40,0xe2,0x60,0x0a,0xf1,0x18
+,0xea,0x0f,0xc2,0x5d,0x8a,0x19,0x08,0x28,0xed,0xb0,0x55,0xca,0xa9,0xfb,0x9c,0x6e,0x95,0x03,0x97,0x66
+,0x08,0xd8,0x64,0x1e,0x52,0xf5,0xba,0x0c,0x0a,0xa5,0xfd,0xec,0xcb,0x71,0x5c,0xc9,0x17,0x25,0xbb,0x89
+,0x48,0x76,0x61,0xe4,0x95,0x8b,0xf2,0x64,0xd6,0x57,0x0b,0x7a,0x35,0x7f,0x66,0x90,0x85,0xd7,0xb0,0x53
+,0x16,0xd3,0xf9,0xcd,0x62,0x7a,0xfb,0x92,0x38,0xaf,0x20,0xff,0x45,0x32,0xc4,0xdd,0xdd,0x55,0x61,0x62
+,0xfe,0x04,0xb5,0xe9,0xe1,0x43,0xd2,0x0a,0x00,0x00
+};
@@ -0,0 +1,74 @@
+#include <Arduino.h>
+#include <Preferences.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+#include "camera_profile.h"
+
+#define CAPTURE_DEFAULT_FRAMESIZE FRAMESIZE_QVGA  // as DEFAULT_FRAMESIZE in the sketch
+#define CAPTURE_DEFAULT_QUALITY 10
+
+extern Preferences preferences;
+
+static camera_profile_stats_t stats;
+static portMUX_TYPE stats_mux = portMUX_INITIALIZER_UNLOCKED;
+
+void camera_profile_preview(camera_profile_t * profile){
+  profile->framesize = (framesize_t)preferences.getUChar("preview_size", PROFILE_DEFAULT_PREVIEW_SIZE);
+  profile->quality = preferences.getUChar("preview_quality", PROFILE_DEFAULT_PREVIEW_QUALITY);
+}
+
+void camera_profile_capture(camera_profile_t * profile){
+  profile->framesize = (framesize_t)preferences.getUInt("framesize", CAPTURE_DEFAULT_FRAMESIZE);
+  profile->quality = preferences.getUInt("quality", CAPTURE_DEFAULT_QUALITY);
+}
+
+void camera_profile_apply(sensor_t * s, const camera_profile_t * profile){
+  if (s->status.framesize != profile->framesize) {
+    s->set_framesize(s, profile->framesize);
+  }
+  if (s->status.quality != profile->quality) {
+    s->set_quality(s, profile->quality);
+  }
+}
+
+camera_fb_t * camera_profile_grab(sensor_t * s){
+  camera_profile_t capture;
+
+  camera_profile_capture(&capture);
+  bool resize = s->status.framesize != capture.framesize;
+  int64_t start = esp_timer_get_time();
+  camera_profile_apply(s, &capture);
+
+  // frames already on their way are still the preview size, the first at the capture size is kept
+  camera_fb_t * fb = esp_camera_fb_get();
+  int dropped = 0;
+  while (resize && fb && fb->width != resolution[capture.framesize].width && dropped < PROFILE_MAX_DISCARD) {
+    esp_camera_fb_return(fb);
+    dropped++;
+    fb = esp_camera_fb_get();
+  }
+  if (resize) {
+    uint16_t ms = (esp_timer_get_time() - start) / 1000;
+    if (fb && fb->width != resolution[capture.framesize].width) {
+      // a preview-size frame is not the photo that was asked for, the still fails instead
+      Serial.printf("profile: no frame at %ux%u after %d\n", resolution[capture.framesize].width,
+                    resolution[capture.framesize].height, dropped);
+      esp_camera_fb_return(fb);
+      fb = NULL;
+    }
+    portENTER_CRITICAL(&stats_mux);
+    stats.switches++;
+    stats.discarded += dropped;
+    stats.last_ms = ms;
+    stats.last_discarded = dropped;
+    stats.mean_ms += (ms - stats.mean_ms) / stats.switches;
+    portEXIT_CRITICAL(&stats_mux);
+  }
+  return fb;
+}
+
+void camera_profile_get_stats(camera_profile_stats_t * s){
+  portENTER_CRITICAL(&stats_mux);
+  *s = stats;
+  portEXIT_CRITICAL(&stats_mux);
+}
@@ -0,0 +1,48 @@
+/*
+ * Preview and capture profiles. While the access point is up the sensor
+ * runs at the preview profile ("preview_size", "preview_quality") so the
+ * stream stays fast, and a capture switches it to the capture profile
+ * (the stored "framesize" and "quality") for one frame and back. Trail
+ * camera wakes start the sensor at the capture profile directly and
+ * never switch.
+ */
+#ifndef _CAMERA_PROFILE_H_
+#define _CAMERA_PROFILE_H_
+
+#include <stdint.h>
+#include "esp_camera.h"
+
+#define PROFILE_DEFAULT_PREVIEW_SIZE FRAMESIZE_VGA
+#define PROFILE_DEFAULT_PREVIEW_QUALITY 12
+#define PROFILE_MAX_DISCARD 6     // frames dropped waiting for the new size at most
+
+typedef struct {
+  framesize_t framesize;
+  uint8_t quality;
+} camera_profile_t;
+
+typedef struct {
+  uint32_t switches;        // captures that had to change the framesize
+  uint32_t discarded;       // frames dropped across all of them
+  uint16_t last_ms;         // last switch, from the request to a frame at the new size
+  uint8_t last_discarded;
+  float mean_ms;
+} camera_profile_stats_t;
+
+void camera_profile_preview(camera_profile_t * profile);
+void camera_profile_capture(camera_profile_t * profile);
+
+void camera_profile_apply(sensor_t * s, const camera_profile_t * profile);
+
+/*
+ * Switch the sensor to the capture profile and take one frame. Frames
+ * still at the preview size are dropped until one at the capture size
+ * arrives. If none has after PROFILE_MAX_DISCARD frames, the last one goes
+ * back to the driver and NULL is returned. Switching back is left to the
+ * caller, the frame arbiter.
+ */
+camera_fb_t * camera_profile_grab(sensor_t * s);
+
+void camera_profile_get_stats(camera_profile_stats_t * stats);
+
+#endif
@@ -0,0 +1,130 @@
+#include <Arduino.h>
+#include <Preferences.h>
+#include "rom/crc.h"
+#include "camera_settings.h"
+
+extern Preferences preferences;
+
+const char * const camera_setting_keys[CAM_SETTING_COUNT] = {
+  "framesize", "quality", "contrast", "brightness", "saturation", "gainceiling",
+  "colorbar", "awb", "agc", "aec", "hmirror", "vflip", "awb_gain", "agc_gain",
+  "aec_value", "aec2", "dcw", "bpc", "wpc", "raw_gma", "lenc", "special_effect",
+  "wb_mode", "ae_level"
+};
+
+int camera_setting_id(const char * key){
+  for (int i = 0; i < CAM_SETTING_COUNT; i++) {
+    if (!strcmp(key, camera_setting_keys[i])) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+void camera_settings_load(camera_settings_t * settings){
+  memset(settings, 0, sizeof(*settings));
+  for (int i = 0; i < CAM_SETTING_COUNT; i++) {
+    if (preferences.isKey(camera_setting_keys[i])) {
+      // stored with putUInt, negative levels come back through the cast
+      settings->value[i] = (int)preferences.getUInt(camera_setting_keys[i]);
+      settings->present |= 1UL << i;
+    }
+  }
+  settings->fb_count = preferences.getUChar("fb_count", 0);
+}
+
+void camera_settings_set(camera_settings_t * settings, int id, int value){
+  settings->value[id] = value;
+  settings->present |= 1UL << id;
+}
+
+uint32_t camera_settings_hash(const camera_settings_t * settings){
+  uint32_t crc = crc32_le(0, (const uint8_t *)&settings->present, sizeof(settings->present));
+
+  for (int i = 0; i < CAM_SETTING_COUNT; i++) {
+    if (settings->present & (1UL << i)) {
+      crc = crc32_le(crc, (const uint8_t *)&settings->value[i], sizeof(settings->value[i]));
+    }
+  }
+  return crc;
+}
+
+int camera_setting_current(const sensor_t * s, int id){
+  const camera_status_t * st = &s->status;
+
+  switch (id) {
+    case CAM_FRAMESIZE:      return st->framesize;
+    case CAM_QUALITY:        return st->quality;
+    case CAM_CONTRAST:       return st->contrast;
+    case CAM_BRIGHTNESS:     return st->brightness;
+    case CAM_SATURATION:     return st->saturation;
+    case CAM_GAINCEILING:    return st->gainceiling;
+    case CAM_COLORBAR:       return st->colorbar;
+    case CAM_AWB:            return st->awb;
+    case CAM_AGC:            return st->agc;
+    case CAM_AEC:            return st->aec;
+    case CAM_HMIRROR:        return st->hmirror;
+    case CAM_VFLIP:          return st->vflip;
+    case CAM_AWB_GAIN:       return st->awb_gain;
+    case CAM_AGC_GAIN:       return st->agc_gain;
+    case CAM_AEC_VALUE:      return st->aec_value;
+    case CAM_AEC2:           return st->aec2;
+    case CAM_DCW:            return st->dcw;
+    case CAM_BPC:            return st->bpc;
+    case CAM_WPC:            return st->wpc;
+    case CAM_RAW_GMA:        return st->raw_gma;
+    case CAM_LENC:           return st->lenc;
+    case CAM_SPECIAL_EFFECT: return st->special_effect;
+    case CAM_WB_MODE:        return st->wb_mode;
+    case CAM_AE_LEVEL:       return st->ae_level;
+    default:                 return -1;
+  }
+}
+
+static int camera_setting_apply(sensor_t * s, int id, int val){
+  switch (id) {
+    case CAM_FRAMESIZE:      return s->set_framesize(s, (framesize_t)val);
+    case CAM_QUALITY:        return s->set_quality(s, val);
+    case CAM_CONTRAST:       return s->set_contrast(s, val);
+    case CAM_BRIGHTNESS:     return s->set_brightness(s, val);
+    case CAM_SATURATION:     return s->set_saturation(s, val);
+    case CAM_GAINCEILING:    return s->set_gainceiling(s, (gainceiling_t)val);
+    case CAM_COLORBAR:       return s->set_colorbar(s, val);
+    case CAM_AWB:            return s->set_whitebal(s, val);
+    case CAM_AGC:            return s->set_gain_ctrl(s, val);
+    case CAM_AEC:            return s->set_exposure_ctrl(s, val);
+    case CAM_HMIRROR:        return s->set_hmirror(s, val);
+    case CAM_VFLIP:          return s->set_vflip(s, val);
+    case CAM_AWB_GAIN:       return s->set_awb_gain(s, val);
+    case CAM_AGC_GAIN:       return s->set_agc_gain(s, val);
+    case CAM_AEC_VALUE:      return s->set_aec_value(s, val);
+    case CAM_AEC2:           return s->set_aec2(s, val);
+    case CAM_DCW:            return s->set_dcw(s, val);
+    case CAM_BPC:            return s->set_bpc(s, val);
+    case CAM_WPC:            return s->set_wpc(s, val);
+    case CAM_RAW_GMA:        return s->set_raw_gma(s, val);
+    case CAM_LENC:           return s->set_lenc(s, val);
+    case CAM_SPECIAL_EFFECT: return s->set_special_effect(s, val);
+    case CAM_WB_MODE:        return s->set_wb_mode(s, val);
+    case CAM_AE_LEVEL:       return s->set_ae_level(s, val);
+    default:                 return -1;
+  }
+}
+
+int camera_settings_apply(sensor_t * s, const camera_settings_t * settings){
+  int failed = 0;
+  int written = 0;
+
+  for (int i = 0; i < CAM_SETTING_COUNT; i++) {
+    if (!(settings->present & (1UL << i)) || camera_setting_current(s, i) == settings->value[i]) {
+      continue;
+    }
+    written++;
+    if (camera_setting_apply(s, i, settings->value[i])) {
+      Serial.printf("%s %d rejected\n", camera_setting_keys[i], settings->value[i]);
+      failed++;
+    }
+  }
+  Serial.printf("camera settings: %d written\n", written);
+  return failed;
+}
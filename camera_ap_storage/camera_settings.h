@@ -0,0 +1,70 @@
+/*
+ * Sensor settings persisted by the web interface, one NVS key each. The
+ * table gives every key an id so the settings can be held decoded (in
+ * the warm boot cache) and applied in one pass.
+ */
+#ifndef _CAMERA_SETTINGS_H_
+#define _CAMERA_SETTINGS_H_
+
+#include <stdint.h>
+#include "esp_camera.h"
+
+// in the order they are applied, framesize first
+typedef enum {
+  CAM_FRAMESIZE,
+  CAM_QUALITY,
+  CAM_CONTRAST,
+  CAM_BRIGHTNESS,
+  CAM_SATURATION,
+  CAM_GAINCEILING,
+  CAM_COLORBAR,
+  CAM_AWB,
+  CAM_AGC,
+  CAM_AEC,
+  CAM_HMIRROR,
+  CAM_VFLIP,
+  CAM_AWB_GAIN,
+  CAM_AGC_GAIN,
+  CAM_AEC_VALUE,
+  CAM_AEC2,
+  CAM_DCW,
+  CAM_BPC,
+  CAM_WPC,
+  CAM_RAW_GMA,
+  CAM_LENC,
+  CAM_SPECIAL_EFFECT,
+  CAM_WB_MODE,
+  CAM_AE_LEVEL,
+  CAM_SETTING_COUNT
+} camera_setting_t;
+
+#define CAM_MAX_FB_COUNT 3
+
+typedef struct {
+  uint32_t present;                  // bit per camera_setting_t that has a stored value
+  int16_t value[CAM_SETTING_COUNT];
+  uint8_t fb_count;                  // frame buffers for trail camera captures, 0 for the default
+} camera_settings_t;
+
+extern const char * const camera_setting_keys[CAM_SETTING_COUNT];
+
+// id of a preference key, or -1
+int camera_setting_id(const char * key);
+
+void camera_settings_load(camera_settings_t * settings);
+void camera_settings_set(camera_settings_t * settings, int id, int value);
+
+// identifies a set of settings in the capture catalog
+uint32_t camera_settings_hash(const camera_settings_t * settings);
+
+// the value the sensor driver reports for a setting
+int camera_setting_current(const sensor_t * s, int id);
+
+/*
+ * Apply every setting present in one pass, skipping those the sensor
+ * already has so no mode switch is repeated. Returns how many the sensor
+ * rejected.
+ */
+int camera_settings_apply(sensor_t * s, const camera_settings_t * settings);
+
+#endif
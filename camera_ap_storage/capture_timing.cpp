@@ -0,0 +1,181 @@
+#include <Arduino.h>
+#include <sys/time.h>
+#include "capture_timing.h"
+#include "rtc_state.h"
+#include "rtc_wake.h"
+#include "schedule.h"
+
+#define TIMING_MAGIC 0x54494d45  // "TIME"
+#define TIMING_MAX_WAIT_US (TIMING_MAX_LEAD_US + TIMING_EARLY_US)
+
+typedef struct {
+  uint32_t magic;
+  int64_t target_us;       // capture the coming wake is for, 0 when nothing is scheduled
+  int64_t armed_us;        // wake time actually programmed, the alarm only has whole seconds
+  int32_t lead_us;         // wake this much before the target
+  int32_t shutter_lag_us;  // end of the wait until the frame is taken
+  uint32_t count;          // jitter statistics
+  double sum_ms;
+  double sumsq_ms;
+  float max_ms;
+  float last_ms;
+  float boot_to_ready_ms;
+  float shutter_ms[2];     // wake to shutter without the wait, NVS and warm boot cache wakes
+} timing_state_t;
+
+RTC_DATA_ATTR static timing_state_t timing;
+
+static bool cold;            // no target known, capture straight away as before
+static bool warm;
+static int64_t waited_us;
+static int64_t ready_us;     // epoch time the wait ended
+
+int64_t epoch_us(void){
+  struct timeval now;
+
+  gettimeofday(&now, NULL);
+  return (int64_t)now.tv_sec * 1000000LL + now.tv_usec;
+}
+
+// the learned lead and the statistics come back from the NVS copy, the target is unknown
+static bool timing_load(timing_state_t * state){
+  if (!rtc_state_restore("timing", state, sizeof(*state), TIMING_MAGIC)) {
+    return false;
+  }
+  state->target_us = 0;
+  state->armed_us = 0;
+  return true;
+}
+
+void timing_begin_wake(bool warm_boot){
+  warm = warm_boot;
+  cold = timing.magic != TIMING_MAGIC;
+  if (cold) {
+    timing_load(&timing);
+  }
+  waited_us = 0;
+  ready_us = 0;
+}
+
+bool timing_capture_due(void){
+  if (cold) {
+    return true;
+  }
+  if (timing.target_us == 0) {
+    Serial.println("no capture scheduled for this wake");
+    return false;
+  }
+  int64_t early = timing.target_us - epoch_us();
+  if (early > timing.lead_us + TIMING_EARLY_US) {
+    Serial.printf("woke %lld ms before the capture, not due yet\n", (long long)(early / 1000));
+    return false;
+  }
+  return true;
+}
+
+/*
+ * Frames come out of esp_camera_fb_get() shutter_lag_us after asking,
+ * so stop waiting that much before the target.
+ */
+void timing_wait_for_target(void){
+  timing.boot_to_ready_ms = esp_timer_get_time() / 1000.0f;
+  if (!cold) {
+    int64_t wait = timing.target_us - timing.shutter_lag_us - epoch_us();
+    if (wait > TIMING_MAX_WAIT_US) {
+      wait = TIMING_MAX_WAIT_US;
+    }
+    if (wait > 0) {
+      delayMicroseconds(wait % 1000);
+      delay(wait / 1000);
+      waited_us = wait;
+    }
+  }
+  ready_us = epoch_us();
+}
+
+void timing_record_shutter(int64_t shutter_us){
+  if (cold || timing.target_us == 0 || ready_us == 0) {
+    return;
+  }
+
+  // what the boot cache saves shows up here, waiting for the target is left out
+  float boot_ms = (shutter_us - (epoch_us() - esp_timer_get_time()) - waited_us) / 1000.0f;
+  float * average = &timing.shutter_ms[warm];
+  *average = *average ? *average + (boot_ms - *average) / 4 : boot_ms;
+  Serial.printf("wake to shutter %.0f ms, settings from %s\n", boot_ms, warm ? "boot cache" : "NVS");
+
+  int64_t jitter_us = shutter_us - timing.target_us;
+  float jitter_ms = jitter_us / 1000.0f;
+  timing.count++;
+  timing.sum_ms += jitter_ms;
+  timing.sumsq_ms += (double)jitter_ms * jitter_ms;
+  timing.last_ms = jitter_ms;
+  if (fabsf(jitter_ms) > timing.max_ms) {
+    timing.max_ms = fabsf(jitter_ms);
+  }
+
+  if (jitter_us > TIMING_MAX_LEAD_US) {
+    Serial.printf("shutter %.0f ms late, not learned from\n", jitter_ms);
+    return;
+  }
+
+  // the wake-to-shutter latency this wake needed, had it not waited
+  int64_t latency = timing.target_us - timing.armed_us + jitter_us - waited_us;
+  int64_t lead = latency + TIMING_LEAD_MARGIN_US;
+  int64_t lag = shutter_us - ready_us;
+  if (timing.count == 1) {
+    timing.lead_us = lead;
+    timing.shutter_lag_us = lag;
+  } else {
+    timing.lead_us += (lead - timing.lead_us) / 4;
+    timing.shutter_lag_us += (lag - timing.shutter_lag_us) / 4;
+  }
+  timing.lead_us = constrain(timing.lead_us, 0, TIMING_MAX_LEAD_US);
+  timing.shutter_lag_us = constrain(timing.shutter_lag_us, 0, TIMING_MAX_LEAD_US);
+
+  Serial.printf("shutter %+.1f ms from the target, waited %lld ms, lead now %d ms\n",
+                jitter_ms, (long long)(waited_us / 1000), timing.lead_us / 1000);
+  // the first sample is saved too
+  rtc_state_save_every("timing", &timing, sizeof(timing), timing.count - 1, TIMING_SAVE_INTERVAL);
+}
+
+/*
+ * Called just before going to sleep, so the sleep length is measured
+ * from the real end of this wake rather than from its start.
+ */
+int64_t timing_arm_next(int64_t target_s, int64_t other_s){
+  int64_t wake_us;
+
+  if (target_s == SCHED_NONE) {
+    timing.target_us = 0;
+    wake_us = epoch_us() + IDLE_SLEEP_TIME * 1000000LL;
+  } else {
+    timing.target_us = target_s * 1000000LL;
+    wake_us = timing.target_us - timing.lead_us;
+  }
+  if (other_s != SCHED_NONE && other_s * 1000000LL < wake_us) {
+    wake_us = other_s * 1000000LL;
+  }
+  timing.armed_us = rtc_wake_arm(wake_us);
+  return timing.armed_us;
+}
+
+void timing_get_stats(timing_stats_t * stats){
+  timing_state_t saved;
+  const timing_state_t * state = &timing;
+
+  if (timing.magic != TIMING_MAGIC) {
+    timing_load(&saved);
+    state = &saved;
+  }
+  stats->count = state->count;
+  stats->mean_ms = state->count ? state->sum_ms / state->count : 0;
+  stats->std_ms = state->count > 1 ?
+    sqrt(fmax(0, (state->sumsq_ms - state->sum_ms * state->sum_ms / state->count) / (state->count - 1))) : 0;
+  stats->max_ms = state->max_ms;
+  stats->last_ms = state->last_ms;
+  stats->lead_ms = state->lead_us / 1000.0f;
+  stats->boot_to_ready_ms = state->boot_to_ready_ms;
+  stats->shutter_ms[0] = state->shutter_ms[0];
+  stats->shutter_ms[1] = state->shutter_ms[1];
+}
@@ -0,0 +1,56 @@
+/*
+ * Keeps scheduled captures on time. The absolute target of the next
+ * capture lives in RTC memory, the station wakes early by the learned
+ * wake-to-shutter latency and then waits for the target, and the
+ * difference between shutter and target (jitter) is tracked.
+ */
+#ifndef _CAPTURE_TIMING_H_
+#define _CAPTURE_TIMING_H_
+
+#include <stdint.h>
+
+#define TIMING_SAVE_INTERVAL 16       // scheduled wakes between copies of the state to NVS
+#define TIMING_LEAD_MARGIN_US 100000  // wake this much earlier than the learned latency
+#define TIMING_MAX_LEAD_US 30000000
+#define TIMING_EARLY_US 5000000       // a wake earlier than lead + this goes back to sleep
+#define IDLE_SLEEP_TIME (60*60*24)    // sleep time when no schedule rule fires again
+#define WAKE_PHOTOS 5                 // photos taken by each capture wake
+#define WAKE_PHOTO_SPACING_MS 1000    // waited after each one
+
+typedef struct {
+  uint32_t count;          // scheduled captures measured
+  float mean_ms;           // shutter - target
+  float std_ms;
+  float max_ms;            // largest |shutter - target|
+  float last_ms;
+  float lead_ms;           // how early the station wakes
+  float boot_to_ready_ms;  // boot until camera and card are ready, last wake
+  float shutter_ms[2];     // boot to shutter less any wait, averaged over wakes reading NVS [0] and warm ones [1]
+} timing_stats_t;
+
+// call early in a trail camera wake, warm when the settings came from the boot cache
+void timing_begin_wake(bool warm);
+
+// false when this wake came too early or nothing is scheduled
+bool timing_capture_due(void);
+
+// camera and card are ready, wait for the scheduled instant
+void timing_wait_for_target(void);
+
+// the first frame of the burst was taken at shutter_us (epoch microseconds)
+void timing_record_shutter(int64_t shutter_us);
+
+/*
+ * Remember target_s (epoch seconds, or SCHED_NONE) as the next capture
+ * and program the wakeup ahead of it, or at other_s when that comes
+ * first (an uplink session, SCHED_NONE for none); that wake then finds
+ * the capture not due yet. Returns the wake time armed, in epoch
+ * microseconds.
+ */
+int64_t timing_arm_next(int64_t target_s, int64_t other_s);
+
+void timing_get_stats(timing_stats_t *stats);
+
+int64_t epoch_us(void);
+
+#endif
@@ -0,0 +1,487 @@
+#include <Arduino.h>
+#include <SD_MMC.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "rom/crc.h"
+#include "catalog.h"
+#include "phash.h"
+#include "sd_writer.h"
+
+#define CATALOG_MAGIC 0x474c5443  // "CTLG"
+#define CATALOG_TMP_FILE "/catalog.tmp"
+
+static_assert(sizeof(catalog_record_t) == 48, "catalog records are read and written as 48 bytes");
+
+RTC_DATA_ATTR static catalog_summary_t summary;
+
+static bool checked;   // the file has been checked against the summary since the card was mounted
+static File reader;
+
+static uint16_t record_crc(const catalog_record_t * record){
+  return crc16_le(0, (const uint8_t *)record, offsetof(catalog_record_t, crc));
+}
+
+static uint32_t summary_crc(const catalog_summary_t * s){
+  return crc32_le(0, (const uint8_t *)s, offsetof(catalog_summary_t, crc));
+}
+
+static void summary_reset(catalog_summary_t * s){
+  memset(s, 0, sizeof(*s));
+  s->magic = CATALOG_MAGIC;
+  s->sorted = 1;
+}
+
+static void summary_add(catalog_summary_t * s, const catalog_record_t * record){
+  if (s->count == 0) {
+    s->first_time = record->time;
+    s->last_time = record->time;
+  } else if (record->time < s->last_time) {
+    s->sorted = 0;
+    s->first_time = min(s->first_time, record->time);
+  } else {
+    s->last_time = record->time;
+  }
+  s->outcomes[record->flags & CATALOG_OUTCOME_MASK]++;
+  if (record->flags & CATALOG_DELETED) {
+    s->deleted++;
+  } else {
+    s->bytes += record->size;
+  }
+  s->count++;
+}
+
+static void checkpoint_write(void){
+  summary.crc = summary_crc(&summary);
+  File file = SD_MMC.open(CATALOG_CHECKPOINT_FILE, FILE_WRITE);
+  if (file) {
+    file.write((const uint8_t *)&summary, sizeof(summary));
+    file.close();
+  }
+}
+
+// FatFs keeps whatever a torn append left behind, cut the file back to the last whole record
+static void catalog_truncate(size_t length){
+  char path[32];
+
+  snprintf(path, sizeof(path), "%s%s", SD_MOUNT_POINT, CATALOG_FILE);
+  int fd = open(path, O_WRONLY);
+  if (fd >= 0) {
+    ftruncate(fd, length);
+    close(fd);
+  }
+}
+
+/*
+ * A record that fails its crc in the middle of the file was torn by an
+ * in-place rewrite. What it said cannot be trusted, so it is sealed again
+ * as a deleted, dropped record at the time of the one before it; the
+ * index of every record after it stays as it was.
+ */
+static void record_seal_damaged(catalog_record_t * record, const catalog_summary_t * s){
+  memset(record, 0, sizeof(*record));
+  record->time = s->count ? s->last_time : 0;
+  record->flags = PHASH_DROPPED | CATALOG_DELETED;
+  record->crc = record_crc(record);
+}
+
+/*
+ * Carry on from the checkpoint when it describes a prefix of the file,
+ * and check only the records written after it. Only a partial record at
+ * the end, left by a torn append, is cut off.
+ */
+static void catalog_recover(size_t size){
+  catalog_summary_t s;
+  catalog_record_t record;
+  size_t records = size / sizeof(catalog_record_t);
+  uint32_t damaged = 0;
+
+  File file = SD_MMC.open(CATALOG_CHECKPOINT_FILE, FILE_READ);
+  if (!file || file.read((uint8_t *)&s, sizeof(s)) != sizeof(s) ||
+      s.magic != CATALOG_MAGIC || s.crc != summary_crc(&s) || s.count > records) {
+    summary_reset(&s);
+  }
+  if (file) {
+    file.close();
+  }
+
+  uint32_t from = s.count;
+  file = SD_MMC.open(CATALOG_FILE, "r+");
+  if (file) {
+    file.seek(from * sizeof(catalog_record_t));
+    while (s.count < records && file.read((uint8_t *)&record, sizeof(record)) == sizeof(record)) {
+      if (record.crc != record_crc(&record)) {
+        // when the card will not take the sealed record, catalog_read() keeps refusing the old one
+        record_seal_damaged(&record, &s);
+        file.seek(s.count * sizeof(catalog_record_t));
+        file.write((const uint8_t *)&record, sizeof(record));
+        file.seek((s.count + 1) * sizeof(catalog_record_t));
+        damaged++;
+      }
+      summary_add(&s, &record);
+    }
+    file.close();
+  }
+  if (damaged) {
+    Serial.printf("catalog: %u damaged records sealed as deleted\n", damaged);
+  }
+  if (s.count * sizeof(catalog_record_t) < size) {
+    Serial.printf("catalog: dropping %u bytes after record %u\n",
+                  (unsigned)(size - s.count * sizeof(catalog_record_t)), s.count);
+    catalog_truncate(s.count * sizeof(catalog_record_t));
+  }
+  Serial.printf("catalog: %u records, %u checked\n", s.count, s.count - from);
+  summary = s;
+  checkpoint_write();
+}
+
+bool catalog_begin(void){
+  size_t size = 0;
+
+  if (SD_MMC.cardType() == CARD_NONE) {
+    return false;
+  }
+  if (checked) {
+    return true;
+  }
+  File file = SD_MMC.open(CATALOG_FILE, FILE_READ);
+  if (file) {
+    size = file.size();
+    file.close();
+  }
+  // the summary survives deep sleep, on a warm wake only the size is checked
+  if (summary.magic != CATALOG_MAGIC || summary.crc != summary_crc(&summary) ||
+      summary.count * sizeof(catalog_record_t) != size) {
+    catalog_recover(size);
+  }
+  checked = true;
+  return true;
+}
+
+void catalog_end(void){
+  if (reader) {
+    reader.close();
+  }
+  checked = false;
+}
+
+const catalog_summary_t * catalog_summary(void){
+  if (summary.magic != CATALOG_MAGIC || summary.crc != summary_crc(&summary)) {
+    return NULL;
+  }
+  return &summary;
+}
+
+bool catalog_append(catalog_record_t * record){
+  if (!catalog_begin()) {
+    return false;
+  }
+  if (reader) {
+    reader.close();
+  }
+  record->crc = record_crc(record);
+  File file = SD_MMC.open(CATALOG_FILE, FILE_APPEND);
+  if (!file) {
+    return false;
+  }
+  size_t n = file.write((const uint8_t *)record, sizeof(*record));
+  file.close();
+  if (n != sizeof(*record)) {
+    checked = false; // the next catalog_begin() cuts the partial record off
+    return false;
+  }
+  summary_add(&summary, record);
+  if (summary.count % CATALOG_CHECKPOINT == 0) {
+    checkpoint_write();
+  } else {
+    summary.crc = summary_crc(&summary);
+  }
+  return true;
+}
+
+// write a changed record back in place
+static bool catalog_rewrite(uint32_t index, catalog_record_t * record){
+  reader.close();
+  record->crc = record_crc(record);
+  File file = SD_MMC.open(CATALOG_FILE, "r+");
+  if (!file) {
+    return false;
+  }
+  bool written = file.seek(index * sizeof(catalog_record_t)) &&
+                 file.write((const uint8_t *)record, sizeof(*record)) == sizeof(*record);
+  file.close();
+  return written;
+}
+
+// rewrite a record in place with flag set, false when it already was
+static bool catalog_set_flag(uint32_t index, uint8_t flag, catalog_record_t * record){
+  if (!catalog_read(index, record) || (record->flags & flag)) {
+    return false;
+  }
+  record->flags |= flag;
+  return catalog_rewrite(index, record);
+}
+
+bool catalog_mark_deleted(uint32_t index){
+  catalog_record_t record;
+
+  if (!catalog_set_flag(index, CATALOG_DELETED, &record)) {
+    return false;
+  }
+  summary.deleted++;
+  summary.bytes -= record.size;
+  summary.crc = summary_crc(&summary);
+  return true;
+}
+
+bool catalog_mark_uploaded(uint32_t index){
+  catalog_record_t record;
+
+  return catalog_set_flag(index, CATALOG_UPLOADED, &record);
+}
+
+bool catalog_mark_kept(uint32_t index){
+  catalog_record_t record;
+
+  return catalog_set_flag(index, CATALOG_KEPT, &record);
+}
+
+int catalog_add_ref(uint32_t index, int delta){
+  catalog_record_t record;
+
+  if (!catalog_read(index, &record)) {
+    return -1;
+  }
+  if (record.refs == CATALOG_REFS_STUCK || (delta < 0 && !record.refs)) {
+    return record.refs;
+  }
+  record.refs += delta;
+  return catalog_rewrite(index, &record) ? record.refs : -1;
+}
+
+void catalog_checkpoint(void){
+  checkpoint_write();
+}
+
+bool catalog_read(uint32_t index, catalog_record_t * record){
+  if (index >= summary.count) {
+    return false;
+  }
+  if (!reader) {
+    reader = SD_MMC.open(CATALOG_FILE, FILE_READ);
+    if (!reader) {
+      return false;
+    }
+  }
+  return reader.seek(index * sizeof(catalog_record_t)) &&
+         reader.read((uint8_t *)record, sizeof(*record)) == sizeof(*record) &&
+         record->crc == record_crc(record);
+}
+
+uint32_t catalog_find(uint32_t time){
+  catalog_record_t record;
+  uint32_t lo = 0;
+  uint32_t hi = summary.count;
+
+  if (!summary.sorted) {
+    return 0;
+  }
+  while (lo < hi) {
+    uint32_t mid = lo + (hi - lo) / 2;
+    if (!catalog_read(mid, &record)) {
+      return 0; // unreadable, let the caller scan
+    }
+    if (record.time < time) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+// img_%d-%m-%Y_%H-%M-%S.jpg, or .ref, in local time; the extension into ext
+static bool name_time(const char * name, uint32_t * time, char * ext){
+  struct tm tm = {0};
+
+  if (*name == '/') {
+    name++;
+  }
+  if (sscanf(name, "img_%d-%d-%d_%d-%d-%d.%3s", &tm.tm_mday, &tm.tm_mon, &tm.tm_year,
+             &tm.tm_hour, &tm.tm_min, &tm.tm_sec, ext) != 7) {
+    return false;
+  }
+  tm.tm_mon -= 1;
+  tm.tm_year -= 1900;
+  tm.tm_isdst = -1;
+  *time = mktime(&tm);
+  return true;
+}
+
+// an hour either side, a local time in the hour the clocks go back is read either way
+#define NAME_TIME_SLACK 3600
+
+uint32_t catalog_find_name(const char * name){
+  catalog_record_t record;
+  uint32_t time;
+  char ext[4];
+
+  if (!name_time(name, &time, ext)) {
+    return summary.count;
+  }
+  for (uint32_t i = catalog_find(time - NAME_TIME_SLACK); i < summary.count; i++) {
+    if (!catalog_read(i, &record)) {
+      continue;
+    }
+    if (summary.sorted && record.time > time + NAME_TIME_SLACK) {
+      break;
+    }
+    if (!strcmp(record.name, name)) {
+      return i;
+    }
+  }
+  return summary.count;
+}
+
+bool catalog_ref_target(const char * ref_path, char * name, size_t len){
+  File file = SD_MMC.open(ref_path, FILE_READ);
+  if (!file) {
+    return false;
+  }
+  int n = file.read((uint8_t *)name, len - 1);
+  file.close();
+  if (n <= 0) {
+    return false;
+  }
+  name[n] = 0;
+  name[strcspn(name, "\r\n")] = 0; // written with println()
+  return *name != 0;
+}
+
+static int record_compare(const void * a, const void * b){
+  uint32_t ta = ((const catalog_record_t *)a)->time;
+  uint32_t tb = ((const catalog_record_t *)b)->time;
+  return (ta > tb) - (ta < tb);
+}
+
+// img_%d-%m-%Y_%H-%M-%S.jpg, or .ref, in local time
+static bool record_from_file(File & file, catalog_record_t * record){
+  const char * name = file.name();
+  uint32_t time;
+  char ext[4];
+
+  if (*name == '/') {
+    name++;
+  }
+  if (!name_time(name, &time, ext)) {
+    return false;
+  }
+  memset(record, 0, sizeof(*record));
+  record->time = time;
+  record->size = file.size();
+  if (!strcmp(ext, "jpg")) {
+    record->flags = PHASH_STORED;
+  } else if (!strcmp(ext, "ref")) {
+    record->flags = PHASH_REFERENCE;
+  } else {
+    return false;
+  }
+  snprintf(record->name, sizeof(record->name), "/%s", name);
+  record->crc = record_crc(record);
+  return true;
+}
+
+// count the references again from the .ref files, the records are sorted by time
+static void records_count_refs(catalog_record_t * records, size_t count){
+  char target[sizeof(records->name)];
+  uint32_t time;
+  char ext[4];
+
+  for (size_t i = 0; i < count; i++) {
+    if ((records[i].flags & CATALOG_OUTCOME_MASK) != PHASH_REFERENCE ||
+        !catalog_ref_target(records[i].name, target, sizeof(target)) || !name_time(target, &time, ext)) {
+      continue;
+    }
+    size_t lo = 0;
+    size_t hi = count;
+    while (lo < hi) {
+      size_t mid = lo + (hi - lo) / 2;
+      if (records[mid].time < time - NAME_TIME_SLACK) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    for (size_t k = lo; k < count && records[k].time <= time + NAME_TIME_SLACK; k++) {
+      if (!strcmp(records[k].name, target)) {
+        if (records[k].refs < CATALOG_REFS_STUCK) {
+          records[k].refs++;
+          records[k].crc = record_crc(&records[k]);
+        }
+        break;
+      }
+    }
+  }
+}
+
+int catalog_rebuild(void){
+  catalog_record_t * records = NULL;
+  size_t count = 0;
+  size_t capacity = 0;
+
+  catalog_end();
+  File root = SD_MMC.open("/");
+  if (!root) {
+    return -1;
+  }
+  File file = root.openNextFile();
+  while (file) {
+    if (!file.isDirectory()) {
+      if (count == capacity) {
+        capacity = capacity ? capacity * 2 : 256;
+        catalog_record_t * grown = (catalog_record_t *)(psramFound() ?
+            ps_realloc(records, capacity * sizeof(*records)) : realloc(records, capacity * sizeof(*records)));
+        if (!grown) {
+          free(records);
+          file.close();
+          root.close();
+          return -1;
+        }
+        records = grown;
+      }
+      if (record_from_file(file, &records[count])) {
+        count++;
+      }
+    }
+    file.close();
+    file = root.openNextFile();
+  }
+  root.close();
+
+  // the directory is in creation order at best, the catalog has to be in time order
+  qsort(records, count, sizeof(*records), record_compare);
+  records_count_refs(records, count);
+
+  int result = -1;
+  File out = SD_MMC.open(CATALOG_TMP_FILE, FILE_WRITE);
+  if (out) {
+    size_t n = count ? out.write((const uint8_t *)records, count * sizeof(*records)) : 0;
+    out.close();
+    if (n == count * sizeof(*records)) {
+      SD_MMC.remove(CATALOG_FILE);
+      if (SD_MMC.rename(CATALOG_TMP_FILE, CATALOG_FILE)) {
+        summary_reset(&summary);
+        for (size_t i = 0; i < count; i++) {
+          summary_add(&summary, &records[i]);
+        }
+        checkpoint_write();
+        checked = true;
+        result = count;
+      }
+    } else {
+      SD_MMC.remove(CATALOG_TMP_FILE);
+    }
+  }
+  free(records);
+  Serial.printf("catalog: rebuilt with %d records\n", result);
+  return result;
+}
@@ -0,0 +1,97 @@
+/*
+ * Catalog of every capture on the card. Each capture appends one fixed
+ * size record to CATALOG_FILE, so counts, totals and the time range come
+ * from a summary held in RTC memory and a time range is found by binary
+ * search, without listing the FAT directory. A checkpoint of the summary
+ * is written every CATALOG_CHECKPOINT records, and after a power loss only
+ * the records past it are read back and checked.
+ */
+#ifndef _CATALOG_H_
+#define _CATALOG_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define CATALOG_FILE "/catalog.bin"
+#define CATALOG_CHECKPOINT_FILE "/catalog.ckp"
+#define CATALOG_CHECKPOINT 64        // records between checkpoints
+
+// record flags, the low two bits are the PHASH_STORED/REFERENCE/DROPPED outcome
+#define CATALOG_OUTCOME_MASK 0x03
+#define CATALOG_DELETED      0x80    // file removed from the card, the record is kept
+#define CATALOG_UPLOADED     0x40    // the collector has the whole file
+#define CATALOG_KEPT         0x20    // retention keeps it as the first of its day or hour
+#define CATALOG_REFS_STUCK   255     // references counted past this keep the capture for good
+
+typedef struct {
+  uint32_t time;          // capture time, seconds since epoch
+  uint32_t size;          // bytes written to the card, 0 when dropped
+  uint32_t settings;      // camera_settings_hash() of the settings it was taken with
+  uint16_t score;         // detail score, JPEG bits per 100 pixels
+  uint8_t flags;
+  uint8_t refs;           // .ref files naming this capture that are still on the card
+  char name[30];          // file the capture was stored as, the .ref file for references
+  uint16_t crc;           // crc16 of everything before it, a torn write fails it
+} catalog_record_t;
+
+typedef struct {
+  uint32_t magic;
+  uint32_t count;         // records in the file, including deleted ones
+  uint64_t bytes;         // bytes of captures still on the card
+  uint32_t first_time;
+  uint32_t last_time;
+  uint32_t outcomes[3];   // records by PHASH_STORED/REFERENCE/DROPPED
+  uint32_t deleted;
+  uint8_t sorted;         // every record is at or after the one before it
+  uint32_t crc;
+} catalog_summary_t;
+
+/*
+ * With the card mounted, check the catalog against the summary and
+ * recover it when they disagree. Returns false when there is no card.
+ */
+bool catalog_begin(void);
+void catalog_end(void);
+
+// seals the record and appends it
+bool catalog_append(catalog_record_t * record);
+
+// set CATALOG_DELETED on a record in place, once its file has been removed
+bool catalog_mark_deleted(uint32_t index);
+// set CATALOG_UPLOADED on a record in place
+bool catalog_mark_uploaded(uint32_t index);
+// set CATALOG_KEPT on a record in place
+bool catalog_mark_kept(uint32_t index);
+
+/*
+ * Count a reference to the capture at index, or with delta -1 let one
+ * go, in place. Returns the references left, -1 when the record could
+ * not be read or written.
+ */
+int catalog_add_ref(uint32_t index, int delta);
+// write the summary out now, after records before the last checkpoint changed
+void catalog_checkpoint(void);
+
+// NULL until the catalog has been checked since power up
+const catalog_summary_t * catalog_summary(void);
+
+/*
+ * Index of the first record at or after time, count when there is none.
+ * A catalog that is not sorted (the clock was set back) returns 0 and
+ * the caller checks the time of every record.
+ */
+uint32_t catalog_find(uint32_t time);
+bool catalog_read(uint32_t index, catalog_record_t * record);
+
+// index of the capture stored as name (img_...jpg, local time), count when it is not there
+uint32_t catalog_find_name(const char * name);
+// the capture a .ref file names into name, false when it cannot be read
+bool catalog_ref_target(const char * ref_path, char * name, size_t len);
+
+/*
+ * Start a new catalog from the images in the root directory. Slow on a
+ * full card, only run on request. Returns the number of records.
+ */
+int catalog_rebuild(void);
+
+#endif
@@ -0,0 +1,201 @@
+#include <Arduino.h>
+#include <Preferences.h>
+#include <sys/time.h>
+#include "energy.h"
+#include "boot_cache.h"
+#include "rtc_state.h"
+
+#define ENERGY_MAGIC 0x454e5247  // "ENRG"
+#define TICK_SAVE_MS 60000
+
+extern Preferences preferences;
+
+// defaults for an AI Thinker ESP32-CAM on a single Li-ion cell
+const char * const energy_model_keys[] = { "i_boot", "i_cam", "i_sd", "i_wifi", "i_sleep", "bat_mah" };
+static const uint16_t energy_model_defaults[] = { 50, 120, 160, 180, 1500, 2000 };
+
+typedef struct {
+  uint32_t magic;
+  double used_mah;
+  double capture_mah;        // awake energy of capture wakes
+  uint32_t captures;
+  float phase_s[PHASE_COUNT];
+  double sleep_s;
+  int64_t sleep_start;       // epoch seconds going to sleep, 0 when not known
+  float battery_v;
+  uint32_t wakes;
+} energy_state_t;
+
+RTC_DATA_ATTR static energy_state_t energy;
+
+static energy_model_t model;
+static bool model_loaded;
+static energy_phase_t phase = PHASE_BOOT;
+static int64_t phase_start;    // esp_timer time the phase started, boot is at 0
+static double wake_mah;        // awake energy of this wake so far
+static unsigned long last_save;
+
+void energy_model_load(energy_model_t * m){
+  for (int i = 0; i < PHASE_COUNT; i++) {
+    m->phase_ma[i] = preferences.getUShort(energy_model_keys[i], energy_model_defaults[i]);
+  }
+  m->sleep_ua = preferences.getUShort(energy_model_keys[PHASE_COUNT], energy_model_defaults[PHASE_COUNT]);
+  m->capacity_mah = preferences.getUShort(energy_model_keys[PHASE_COUNT + 1], energy_model_defaults[PHASE_COUNT + 1]);
+  m->divider = preferences.getFloat("bat_div", BATTERY_DEFAULT_DIVIDER);
+}
+
+const energy_model_t * energy_model(void){
+  if (boot_cache_valid()) {
+    return &boot_cache.energy;
+  }
+  if (!model_loaded) {
+    energy_model_load(&model);
+    model_loaded = true;
+  }
+  return &model;
+}
+
+void energy_model_changed(void){
+  model_loaded = false;
+}
+
+static void energy_save(void){
+  rtc_state_save("energy", &energy, sizeof(energy));
+}
+
+static void energy_load(energy_state_t * state){
+  rtc_state_restore("energy", state, sizeof(*state), ENERGY_MAGIC);
+  state->sleep_start = 0; // how long it was off is not known
+}
+
+static float battery_sample(void){
+  uint32_t mv = 0;
+
+  analogSetPinAttenuation(BATTERY_ADC_PIN, ADC_0db);
+  for (int i = 0; i < 8; i++) {
+    mv += analogReadMilliVolts(BATTERY_ADC_PIN);
+  }
+  return mv / 8 / 1000.0f * energy_model()->divider;
+}
+
+// resting voltage of a Li-ion cell against charge left
+static float battery_percent(float v){
+  static const float table[][2] = {
+    {3.30f, 0}, {3.50f, 5}, {3.60f, 10}, {3.65f, 15}, {3.70f, 25}, {3.75f, 35},
+    {3.80f, 45}, {3.85f, 55}, {3.90f, 65}, {4.00f, 80}, {4.10f, 90}, {4.20f, 100}
+  };
+  const int n = sizeof(table) / sizeof(table[0]);
+
+  if (v < 2.5f) {
+    return -1; // nothing wired to the pin
+  }
+  if (v <= table[0][0]) {
+    return 0;
+  }
+  for (int i = 1; i < n; i++) {
+    if (v <= table[i][0]) {
+      return table[i-1][1] + (v - table[i-1][0]) / (table[i][0] - table[i-1][0]) * (table[i][1] - table[i-1][1]);
+    }
+  }
+  return 100;
+}
+
+void energy_reset(void){
+  energy.used_mah = 0;
+  energy.capture_mah = 0;
+  energy.captures = 0;
+  memset(energy.phase_s, 0, sizeof(energy.phase_s));
+  energy.sleep_s = 0;
+  energy_save();
+}
+
+void energy_begin_wake(void){
+  if (energy.magic != ENERGY_MAGIC) {
+    energy_load(&energy);
+  }
+  if (energy.sleep_start) {
+    int64_t slept = time(NULL) - energy.sleep_start;
+    if (slept > 0) {
+      energy.sleep_s += slept;
+      energy.used_mah += slept / 3600.0 * energy_model()->sleep_ua / 1000.0;
+    }
+    energy.sleep_start = 0;
+  }
+
+  float v = battery_sample();
+  if (energy.battery_v > 0 && v > energy.battery_v + BATTERY_RECHARGED_V) {
+    Serial.printf("battery %.2f V, was %.2f V, budget restarted\n", v, energy.battery_v);
+    energy_reset();
+  }
+  energy.battery_v = v;
+  energy.wakes++;
+  phase = PHASE_BOOT;
+  phase_start = 0;
+  wake_mah = 0;
+}
+
+void energy_phase(energy_phase_t next){
+  int64_t now = esp_timer_get_time();
+  double seconds = (now - phase_start) / 1e6;
+
+  energy.phase_s[phase] += seconds;
+  wake_mah += seconds / 3600.0 * energy_model()->phase_ma[phase];
+  phase = next;
+  phase_start = now;
+}
+
+void energy_end_wake(bool captured){
+  energy_phase(phase);
+  energy.used_mah += wake_mah;
+  if (captured) {
+    energy.capture_mah += wake_mah;
+    energy.captures++;
+  }
+  Serial.printf("wake used %.3f mAh, %.0f mAh since the battery was charged\n", wake_mah, energy.used_mah);
+  wake_mah = 0;
+  energy.sleep_start = time(NULL);
+  if (energy.wakes % ENERGY_SAVE_INTERVAL == 0) {
+    energy_save();
+  }
+}
+
+void energy_tick(void){
+  energy_phase(phase);
+  energy.used_mah += wake_mah;
+  wake_mah = 0;
+  if (millis() - last_save >= TICK_SAVE_MS) {
+    last_save = millis();
+    energy_save();
+  }
+}
+
+void energy_get_report(energy_report_t * report){
+  const energy_model_t * m = energy_model();
+
+  report->battery_v = energy.battery_v;
+  report->battery_pct = battery_percent(energy.battery_v);
+  report->used_mah = energy.used_mah + wake_mah;
+  report->remaining_mah = m->capacity_mah - report->used_mah;
+  // trust the voltage when it says there is less left than the budget
+  if (report->battery_pct >= 0 && report->battery_pct * m->capacity_mah / 100 < report->remaining_mah) {
+    report->remaining_mah = report->battery_pct * m->capacity_mah / 100;
+  }
+  if (report->remaining_mah < 0) {
+    report->remaining_mah = 0;
+  }
+  report->capture_mah = energy.captures ? energy.capture_mah / energy.captures : 0;
+  report->sleep_hours = energy.sleep_s / 3600;
+  for (int i = 0; i < PHASE_COUNT; i++) {
+    report->phase_s[i] = energy.phase_s[i];
+  }
+  report->captures = energy.captures;
+}
+
+float energy_days_remaining(const energy_report_t * report, float captures_per_day){
+  float daily = captures_per_day * report->capture_mah + 24 * energy_model()->sleep_ua / 1000.0f;
+
+  if (captures_per_day > 0 && report->captures == 0) {
+    return -1; // no capture measured yet
+  }
+  return daily > 0 ? report->remaining_mah / daily : -1;
+}
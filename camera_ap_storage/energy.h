@@ -0,0 +1,70 @@
+/*
+ * Energy accounting. Awake time is split into phases, each charged at a
+ * configurable board current, deep sleep is charged between wakes, and
+ * the battery voltage is sampled at every boot. The running budget lives
+ * in RTC memory with a copy in NVS, and /status turns it into a
+ * prediction for the current schedule.
+ */
+#ifndef _ENERGY_H_
+#define _ENERGY_H_
+
+#include <stdint.h>
+
+/*
+ * Battery through a 1:6 divider, 4.2 V reads 0.7 V. GPIO 12 is a strapping
+ * pin that must be low at boot, and in 4-bit mode it is also SD D2, so it
+ * is sampled before the card is mounted.
+ */
+#define BATTERY_ADC_PIN 12
+#define BATTERY_DEFAULT_DIVIDER 6.0f
+#define BATTERY_RECHARGED_V 0.3f     // a rise this large means a fresh or recharged battery
+#define ENERGY_SAVE_INTERVAL 16      // wakes between copies of the budget to NVS
+
+typedef enum {
+  PHASE_BOOT,     // CPU only, until the camera starts
+  PHASE_CAMERA,   // camera powered
+  PHASE_SD,       // camera powered and the card mounted
+  PHASE_WIFI,     // access point or uplink running
+  PHASE_COUNT
+} energy_phase_t;
+
+// board current in each phase, preferences "i_boot", "i_cam", "i_sd", "i_wifi", "i_sleep", "bat_mah", "bat_div"
+typedef struct {
+  uint16_t phase_ma[PHASE_COUNT];
+  uint16_t sleep_ua;
+  uint16_t capacity_mah;
+  float divider;
+} energy_model_t;
+
+typedef struct {
+  float battery_v;         // last sample, 0 when no battery is wired
+  float battery_pct;       // from the voltage, -1 when unknown
+  float used_mah;          // since the battery was last found recharged or reset
+  float remaining_mah;
+  float capture_mah;       // awake energy of a capture wake, averaged
+  float sleep_hours;
+  float phase_s[PHASE_COUNT];
+  uint32_t captures;
+} energy_report_t;
+
+extern const char * const energy_model_keys[];
+
+void energy_model_load(energy_model_t * model);
+const energy_model_t * energy_model(void);
+// a model preference was written
+void energy_model_changed(void);
+
+// every boot, once the clock is set and before Wi-Fi starts
+void energy_begin_wake(void);
+void energy_phase(energy_phase_t phase);
+// just before deep sleep
+void energy_end_wake(bool captured);
+// from loop() in AP mode
+void energy_tick(void);
+void energy_reset(void);
+
+void energy_get_report(energy_report_t * report);
+// days until the budget runs out at this many captures a day, -1 when unknown
+float energy_days_remaining(const energy_report_t * report, float captures_per_day);
+
+#endif
@@ -0,0 +1,141 @@
+#include <stdio.h>
+#include <string.h>
+#include "exif.h"
+
+// TIFF field types
+#define TIFF_ASCII     2
+#define TIFF_SHORT     3
+#define TIFF_LONG      4
+#define TIFF_UNDEFINED 7
+
+typedef struct {
+  uint16_t tag;
+  uint16_t type;
+  uint32_t count;
+  const void *data;            // the value, a uint16_t or uint32_t for SHORT and LONG
+} exif_entry_t;
+
+static void put16(uint8_t *p, uint16_t v){
+  p[0] = v;
+  p[1] = v >> 8;
+}
+
+static void put32(uint8_t *p, uint32_t v){
+  put16(p, v);
+  put16(p + 2, v >> 16);
+}
+
+static uint32_t value_size(const exif_entry_t *e){
+  return e->count * (e->type == TIFF_SHORT ? 2 : e->type == TIFF_LONG ? 4 : 1);
+}
+
+// the IFD with the values that do not fit in an entry after it, each kept at an even offset
+static uint32_t ifd_size(const exif_entry_t *e, int n){
+  uint32_t size = 2 + 12 * n + 4;
+  for (int i = 0; i < n; i++) {
+    uint32_t v = value_size(&e[i]);
+    if (v > 4) {
+      size += (v + 1) & ~1u;
+    }
+  }
+  return size;
+}
+
+/*
+ * Write an IFD at offset pos of the TIFF data. Entries must be sorted by
+ * tag; the next IFD offset is left 0.
+ */
+static void write_ifd(uint8_t *tiff, uint32_t pos, const exif_entry_t *e, int n){
+  uint8_t *p = tiff + pos;
+  uint32_t data = pos + 2 + 12 * n + 4;
+
+  put16(p, n);
+  p += 2;
+  for (int i = 0; i < n; i++, p += 12) {
+    uint32_t v = value_size(&e[i]);
+    put16(p, e[i].tag);
+    put16(p + 2, e[i].type);
+    put32(p + 4, e[i].count);
+    memset(p + 8, 0, 4);
+    if (e[i].type == TIFF_SHORT) {
+      put16(p + 8, *(const uint16_t *)e[i].data);
+    } else if (e[i].type == TIFF_LONG) {
+      put32(p + 8, *(const uint32_t *)e[i].data);
+    } else if (v <= 4) {
+      memcpy(p + 8, e[i].data, v);
+    } else {
+      put32(p + 8, data);
+      memcpy(tiff + data, e[i].data, v);
+      if (v & 1) {
+        tiff[data + v] = 0;
+      }
+      data += (v + 1) & ~1u;
+    }
+  }
+  put32(p, 0);
+}
+
+size_t exif_build(uint8_t *out, size_t size, const exif_info_t *info){
+  static const uint8_t version[4] = {'0', '2', '3', '2'};
+  char datetime[20], offset[7], subsec[4];
+  char comment[8 + EXIF_COMMENT_MAX];
+  uint32_t width = info->width, height = info->height;
+  uint32_t exif_ifd;
+  struct tm tm;
+
+  localtime_r(&info->time, &tm);
+  strftime(datetime, sizeof(datetime), "%Y:%m:%d %H:%M:%S", &tm);
+  int off = info->utc_offset_min < 0 ? -info->utc_offset_min : info->utc_offset_min;
+  snprintf(offset, sizeof(offset), "%c%02d:%02d", info->utc_offset_min < 0 ? '-' : '+', off / 60 % 100, off % 60);
+  snprintf(subsec, sizeof(subsec), "%03u", info->millis % 1000);
+  // UserComment starts with its character code and has no terminator
+  memcpy(comment, "ASCII\0\0\0", 8);
+  size_t comment_len = info->comment ? strnlen(info->comment, EXIF_COMMENT_MAX) : 0;
+  memcpy(comment + 8, info->comment, comment_len);
+
+  const exif_entry_t ifd0[] = {
+    { 0x010f, TIFF_ASCII, sizeof(EXIF_MAKE), EXIF_MAKE },                        // Make
+    { 0x0110, TIFF_ASCII, (uint32_t)strlen(info->model) + 1, info->model },      // Model
+    { 0x0132, TIFF_ASCII, sizeof(datetime), datetime },                          // DateTime
+    { 0x8769, TIFF_LONG, 1, &exif_ifd },                                         // ExifIFDPointer
+  };
+  const exif_entry_t exif[] = {
+    { 0x9000, TIFF_UNDEFINED, 4, version },                                      // ExifVersion
+    { 0x9003, TIFF_ASCII, sizeof(datetime), datetime },                          // DateTimeOriginal
+    { 0x9011, TIFF_ASCII, sizeof(offset), offset },                              // OffsetTimeOriginal
+    { 0x9286, TIFF_UNDEFINED, (uint32_t)(8 + comment_len), comment },            // UserComment
+    { 0x9291, TIFF_ASCII, sizeof(subsec), subsec },                              // SubSecTimeOriginal
+    { 0xa002, TIFF_LONG, 1, &width },                                            // PixelXDimension
+    { 0xa003, TIFF_LONG, 1, &height },                                           // PixelYDimension
+    { 0xa431, TIFF_ASCII, (uint32_t)strlen(info->station) + 1, info->station },  // BodySerialNumber
+  };
+  const int n0 = sizeof(ifd0) / sizeof(ifd0[0]);
+  const int n1 = sizeof(exif) / sizeof(exif[0]);
+
+  // marker, length, "Exif\0\0", then the TIFF data: header, IFD0, Exif IFD
+  exif_ifd = 8 + ifd_size(ifd0, n0);
+  size_t total = 4 + 6 + exif_ifd + ifd_size(exif, n1);
+  if (total > size || total - 2 > UINT16_MAX) {
+    return 0;
+  }
+  out[0] = 0xff;
+  out[1] = 0xe1;
+  out[2] = (total - 2) >> 8;
+  out[3] = (total - 2) & 0xff;
+  memcpy(out + 4, "Exif\0\0", 6);
+  uint8_t *tiff = out + 10;
+  memcpy(tiff, "II*\0", 4);
+  put32(tiff + 4, 8);
+  write_ifd(tiff, 8, ifd0, n0);
+  write_ifd(tiff, exif_ifd, exif, n1);
+  return total;
+}
+
+int exif_utc_offset(time_t t){
+  struct tm local, utc;
+
+  localtime_r(&t, &local);
+  gmtime_r(&t, &utc);
+  int days = local.tm_year != utc.tm_year ? (local.tm_year > utc.tm_year ? 1 : -1) : local.tm_yday - utc.tm_yday;
+  return days * 1440 + (local.tm_hour - utc.tm_hour) * 60 + (local.tm_min - utc.tm_min);
+}
@@ -0,0 +1,42 @@
+/*
+ * EXIF metadata for captures. An APP1 segment is built in a small
+ * buffer and written between the frame's SOI marker and the rest of
+ * it, so the frame itself is never copied. It carries the capture time
+ * with its UTC offset and milliseconds, the image size, the station ID
+ * (as the body serial number) and a key=value user comment with the
+ * battery voltage and sensor settings, enough for host tools to sort
+ * and group captures without parsing file names or decoding.
+ */
+#ifndef _EXIF_H_
+#define _EXIF_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+
+#define EXIF_MAX        1024         // the whole segment, marker included
+#define EXIF_MAKE       "Frontier TrailCam"
+#define EXIF_STATION_MAX 32          // station ID, terminator included
+#define EXIF_COMMENT_MAX 512
+
+typedef struct {
+  time_t time;                 // capture time, seconds since epoch
+  uint16_t millis;
+  int16_t utc_offset_min;      // local time minus UTC, at the capture time
+  uint16_t width;
+  uint16_t height;
+  const char *model;           // sensor
+  const char *station;
+  const char *comment;         // "key=value key=value ..."
+} exif_info_t;
+
+/*
+ * Build the APP1 segment for info into out, the 0xFFE1 marker included.
+ * Returns its length, or 0 when it does not fit in size.
+ */
+size_t exif_build(uint8_t *out, size_t size, const exif_info_t *info);
+
+// local time minus UTC at t, in minutes, for the TZ in effect
+int exif_utc_offset(time_t t);
+
+#endif
@@ -0,0 +1,445 @@
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "camera_settings.h"
+#include "camera_profile.h"
+#include "frame_arbiter.h"
+
+#define ARBITER_SLOTS CAM_MAX_FB_COUNT
+
+// event bits, FRAME_BIT and STILL_DONE_BIT are set and cleared at once to wake every waiter
+#define FRAME_BIT BIT0          // a stream frame was published
+#define STILL_BIT BIT1          // a still was queued, or the arbiter is asked to stop
+#define STILL_DONE_BIT BIT2
+#define RELEASED_BIT BIT3       // a frame buffer went back to the driver
+#define WANT_BIT BIT4           // a stream asked for a frame
+#define STOPPED_BIT BIT5
+
+typedef struct {
+  camera_fb_t * fb;       // NULL for a free slot
+  uint32_t seq;           // 0 for a still
+  uint8_t refs;           // takers, and the arbiter while it is the newest frame
+} arbiter_slot_t;
+
+// a request that gives up while queued is freed, while being taken it is left to the arbiter
+typedef enum { STILL_FREE, STILL_QUEUED, STILL_TAKING, STILL_DONE, STILL_ABANDONED } still_state_t;
+
+typedef struct {
+  still_state_t state;
+  camera_fb_t * fb;
+  int64_t asked;
+} still_request_t;
+
+static arbiter_slot_t slots[ARBITER_SLOTS];
+static still_request_t stills[ARBITER_STILLS];
+static portMUX_TYPE arbiter_mux = portMUX_INITIALIZER_UNLOCKED;
+static EventGroupHandle_t events;
+static TaskHandle_t arbiter_task;
+static volatile bool running;
+static volatile bool preview_dirty;
+static volatile TickType_t wanted;      // when a stream last asked for a frame
+static int buffers;                     // the driver's frame buffers
+static int newest = -1;                 // slot of the newest stream frame
+static uint32_t newest_seq;
+static frame_arbiter_stats_t stats;
+
+static void broadcast(EventBits_t bit){
+  xEventGroupSetBits(events, bit);
+  xEventGroupClearBits(events, bit);
+}
+
+// frame buffers out of the driver, call inside arbiter_mux
+static int held(void){
+  int n = 0;
+
+  for (int i = 0; i < ARBITER_SLOTS; i++) {
+    if (slots[i].fb) {
+      n++;
+    }
+  }
+  return n;
+}
+
+static int slot_put(camera_fb_t * fb, uint32_t seq){
+  for (int i = 0; i < ARBITER_SLOTS; i++) {
+    if (!slots[i].fb) {
+      slots[i].fb = fb;
+      slots[i].seq = seq;
+      slots[i].refs = 1;
+      return i;
+    }
+  }
+  return -1;
+}
+
+// the driver's queues cannot be used inside a critical section, the buffer goes back after it
+static void slot_unref(int i){
+  camera_fb_t * fb = NULL;
+
+  portENTER_CRITICAL(&arbiter_mux);
+  if (slots[i].refs && --slots[i].refs == 0) {
+    fb = slots[i].fb;
+    slots[i].fb = NULL;
+  }
+  portEXIT_CRITICAL(&arbiter_mux);
+  if (fb) {
+    esp_camera_fb_return(fb);
+    xEventGroupSetBits(events, RELEASED_BIT);
+  }
+}
+
+// the arbiter lets go of the newest frame, takers still using it keep it until they release it
+static void retire_newest(void){
+  portENTER_CRITICAL(&arbiter_mux);
+  int i = newest;
+  newest = -1;
+  portEXIT_CRITICAL(&arbiter_mux);
+  if (i >= 0) {
+    slot_unref(i);
+  }
+}
+
+// until the driver has a buffer to fill, bounded so a stalled taker cannot hold a still back for good
+static bool wait_for_buffer(void){
+  TickType_t start = xTaskGetTickCount();
+  TickType_t limit = pdMS_TO_TICKS(ARBITER_BUFFER_WAIT_MS);
+  bool waited = false;
+
+  while (true) {
+    xEventGroupClearBits(events, RELEASED_BIT);
+    portENTER_CRITICAL(&arbiter_mux);
+    int n = held();
+    portEXIT_CRITICAL(&arbiter_mux);
+    if (n < buffers) {
+      if (waited) {
+        portENTER_CRITICAL(&arbiter_mux);
+        stats.buffer_waits++;
+        portEXIT_CRITICAL(&arbiter_mux);
+      }
+      return true;
+    }
+    // with one buffer the newest frame has to go back first
+    if (newest >= 0) {
+      retire_newest();
+      continue;
+    }
+    TickType_t elapsed = xTaskGetTickCount() - start;
+    if (!running || elapsed >= limit) {
+      return false;
+    }
+    waited = true;
+    xEventGroupWaitBits(events, RELEASED_BIT, pdTRUE, pdTRUE, limit - elapsed);
+  }
+}
+
+static int next_still(void){
+  int r = -1;
+
+  portENTER_CRITICAL(&arbiter_mux);
+  for (int i = 0; i < ARBITER_STILLS; i++) {
+    if (stills[i].state == STILL_QUEUED && (r < 0 || stills[i].asked < stills[r].asked)) {
+      r = i;
+    }
+  }
+  if (r >= 0) {
+    stills[r].state = STILL_TAKING;
+  }
+  portEXIT_CRITICAL(&arbiter_mux);
+  return r;
+}
+
+static void take_still(sensor_t * s, int r, const camera_profile_t * preview){
+  camera_fb_t * fb = NULL;
+  camera_fb_t * unplaced = NULL;
+  camera_fb_t * orphan = NULL;
+
+  if (wait_for_buffer()) {
+    fb = camera_profile_grab(s);
+    camera_profile_apply(s, preview);
+  }
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&arbiter_mux);
+  if (fb && slot_put(fb, 0) < 0) {
+    unplaced = fb;  // cannot happen while the slots outnumber the buffers
+    fb = NULL;
+  }
+  if (stills[r].state == STILL_TAKING) {
+    stills[r].fb = fb;
+    stills[r].state = STILL_DONE;
+    if (fb) {
+      stats.stills++;
+      stats.still_ms = (now - stills[r].asked) / 1000;
+    }
+  } else {
+    // the request gave up while the frame was taken
+    stills[r].state = STILL_FREE;
+    orphan = fb;
+  }
+  portEXIT_CRITICAL(&arbiter_mux);
+  if (unplaced) {
+    esp_camera_fb_return(unplaced);
+  }
+  if (orphan) {
+    frame_arbiter_release(orphan);
+  }
+  broadcast(STILL_DONE_BIT);
+}
+
+static void take_stream_frame(const camera_profile_t * preview){
+  if (!wait_for_buffer()) {
+    return;
+  }
+  camera_fb_t * fb = esp_camera_fb_get();
+  if (!fb) {
+    Serial.println("Camera capture failed");
+    vTaskDelay(pdMS_TO_TICKS(100));
+    return;
+  }
+  // the frames queued while the sensor went back from a still
+  if (fb->width != resolution[preview->framesize].width) {
+    esp_camera_fb_return(fb);
+    portENTER_CRITICAL(&arbiter_mux);
+    stats.resync_dropped++;
+    portEXIT_CRITICAL(&arbiter_mux);
+    return;
+  }
+  portENTER_CRITICAL(&arbiter_mux);
+  int old = newest;
+  newest = slot_put(fb, ++newest_seq);
+  stats.frames++;
+  portEXIT_CRITICAL(&arbiter_mux);
+  if (newest < 0) {
+    esp_camera_fb_return(fb);  // cannot happen while the slots outnumber the buffers
+  }
+  if (old >= 0) {
+    slot_unref(old);
+  }
+  broadcast(FRAME_BIT);
+}
+
+static void arbiter_loop(void * arg){
+  sensor_t * s = esp_camera_sensor_get();
+  camera_profile_t preview;
+
+  camera_profile_preview(&preview);
+  camera_profile_apply(s, &preview);
+  while (running) {
+    if (preview_dirty) {
+      preview_dirty = false;
+      camera_profile_preview(&preview);
+      camera_profile_apply(s, &preview);
+    }
+    int r = next_still();
+    if (r >= 0) {
+      take_still(s, r, &preview);
+      continue;
+    }
+    if (xTaskGetTickCount() - wanted > pdMS_TO_TICKS(ARBITER_WANT_MS)) {
+      // nobody is watching, the buffer goes back to the driver and the task waits for work
+      retire_newest();
+      xEventGroupWaitBits(events, STILL_BIT | WANT_BIT, pdTRUE, pdFALSE, pdMS_TO_TICKS(ARBITER_WANT_MS));
+      continue;
+    }
+    take_stream_frame(&preview);
+  }
+
+  retire_newest();
+  portENTER_CRITICAL(&arbiter_mux);
+  for (int i = 0; i < ARBITER_STILLS; i++) {
+    stills[i].state = stills[i].state == STILL_QUEUED ? STILL_DONE : stills[i].state;
+  }
+  portEXIT_CRITICAL(&arbiter_mux);
+  broadcast(STILL_DONE_BIT);
+  /*
+   * Every frame has to be back before the driver goes: the next session's
+   * driver hands out the same camera_fb_t addresses, and a frame released
+   * after it started would match one of its slots. Takers give their
+   * frames back within their own send timeouts.
+   */
+  TickType_t start = xTaskGetTickCount();
+  bool warned = false;
+  while (true) {
+    xEventGroupClearBits(events, RELEASED_BIT);
+    portENTER_CRITICAL(&arbiter_mux);
+    int n = held();
+    portEXIT_CRITICAL(&arbiter_mux);
+    if (!n) {
+      break;
+    }
+    if (!warned && xTaskGetTickCount() - start > pdMS_TO_TICKS(ARBITER_BUFFER_WAIT_MS)) {
+      Serial.printf("arbiter: stopping, waiting for %d frames to come back\n", n);
+      warned = true;
+    }
+    xEventGroupWaitBits(events, RELEASED_BIT, pdTRUE, pdTRUE, pdMS_TO_TICKS(100));
+  }
+  arbiter_task = NULL;
+  xEventGroupSetBits(events, STOPPED_BIT);
+  vTaskDelete(NULL);
+}
+
+// the task exits once a still in progress is done and every taker has released its frame
+static void wait_stopped(void){
+  while (arbiter_task) {
+    xEventGroupWaitBits(events, STOPPED_BIT, pdTRUE, pdTRUE, pdMS_TO_TICKS(100));
+  }
+}
+
+bool frame_arbiter_start(int fb_count){
+  if (arbiter_task && running) {
+    frame_arbiter_preview_changed();
+    return true;
+  }
+  if (fb_count < 1 || !esp_camera_sensor_get()) {
+    return false;
+  }
+  if (!events) {
+    events = xEventGroupCreate();
+  }
+  // a task still on its way out would take the new driver's frames with it
+  wait_stopped();
+  xEventGroupClearBits(events, FRAME_BIT | STILL_BIT | STILL_DONE_BIT | RELEASED_BIT | WANT_BIT | STOPPED_BIT);
+  portENTER_CRITICAL(&arbiter_mux);
+  memset(slots, 0, sizeof(slots));
+  portEXIT_CRITICAL(&arbiter_mux);
+  buffers = fb_count < ARBITER_SLOTS ? fb_count : ARBITER_SLOTS;
+  newest = -1;
+  wanted = xTaskGetTickCount() - pdMS_TO_TICKS(ARBITER_WANT_MS) - 1;
+  preview_dirty = false;
+  running = true;
+  if (xTaskCreatePinnedToCore(arbiter_loop, "frame_arbiter", ARBITER_STACK, NULL, 6, &arbiter_task, tskNO_AFFINITY) != pdPASS) {
+    running = false;
+    arbiter_task = NULL;
+    return false;
+  }
+  return true;
+}
+
+void frame_arbiter_stop(void){
+  if (!arbiter_task) {
+    return;
+  }
+  running = false;
+  xEventGroupSetBits(events, STILL_BIT);
+  wait_stopped();
+}
+
+bool frame_arbiter_running(void){
+  return running;
+}
+
+void frame_arbiter_preview_changed(void){
+  preview_dirty = true;
+}
+
+camera_fb_t * frame_arbiter_frame(uint32_t * seq, uint32_t timeout_ms){
+  TickType_t start = xTaskGetTickCount();
+  TickType_t limit = pdMS_TO_TICKS(timeout_ms);
+
+  if (!running) {
+    return NULL;
+  }
+  while (running) {
+    camera_fb_t * fb = NULL;
+    wanted = xTaskGetTickCount();
+    xEventGroupSetBits(events, WANT_BIT);
+    portENTER_CRITICAL(&arbiter_mux);
+    if (newest >= 0 && slots[newest].seq > *seq) {
+      slots[newest].refs++;
+      *seq = slots[newest].seq;
+      fb = slots[newest].fb;
+    }
+    portEXIT_CRITICAL(&arbiter_mux);
+    if (fb) {
+      return fb;
+    }
+    TickType_t elapsed = xTaskGetTickCount() - start;
+    if (elapsed >= limit) {
+      break;
+    }
+    xEventGroupWaitBits(events, FRAME_BIT, pdFALSE, pdTRUE, limit - elapsed);
+  }
+  return NULL;
+}
+
+camera_fb_t * frame_arbiter_still(uint32_t timeout_ms){
+  TickType_t start = xTaskGetTickCount();
+  TickType_t limit = pdMS_TO_TICKS(timeout_ms);
+  camera_fb_t * fb = NULL;
+  int r = -1;
+
+  if (!running) {
+    portENTER_CRITICAL(&arbiter_mux);
+    stats.still_failed++;
+    portEXIT_CRITICAL(&arbiter_mux);
+    return NULL;
+  }
+  portENTER_CRITICAL(&arbiter_mux);
+  for (int i = 0; i < ARBITER_STILLS && r < 0; i++) {
+    if (stills[i].state == STILL_FREE) {
+      r = i;
+      stills[i].state = STILL_QUEUED;
+      stills[i].fb = NULL;
+      stills[i].asked = esp_timer_get_time();
+    }
+  }
+  if (r < 0) {
+    stats.still_failed++;
+  }
+  portEXIT_CRITICAL(&arbiter_mux);
+  if (r < 0) {
+    return NULL;
+  }
+  xEventGroupSetBits(events, STILL_BIT);
+
+  while (true) {
+    portENTER_CRITICAL(&arbiter_mux);
+    bool done = stills[r].state == STILL_DONE;
+    portEXIT_CRITICAL(&arbiter_mux);
+    TickType_t elapsed = xTaskGetTickCount() - start;
+    if (done || elapsed >= limit) {
+      break;
+    }
+    xEventGroupWaitBits(events, STILL_DONE_BIT, pdFALSE, pdTRUE, limit - elapsed);
+  }
+  portENTER_CRITICAL(&arbiter_mux);
+  if (stills[r].state == STILL_DONE) {
+    fb = stills[r].fb;
+    stills[r].state = STILL_FREE;
+  } else if (stills[r].state == STILL_TAKING) {
+    stills[r].state = STILL_ABANDONED;  // the arbiter frees it once it is done with it
+  } else {
+    stills[r].state = STILL_FREE;
+  }
+  if (!fb) {
+    stats.still_failed++;
+  }
+  portEXIT_CRITICAL(&arbiter_mux);
+  return fb;
+}
+
+void frame_arbiter_release(camera_fb_t * fb){
+  int i = -1;
+
+  portENTER_CRITICAL(&arbiter_mux);
+  for (int k = 0; k < ARBITER_SLOTS; k++) {
+    if (slots[k].fb == fb) {
+      i = k;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&arbiter_mux);
+  if (i < 0) {
+    // not one of the arbiter's, stop waits for every frame it handed out
+    Serial.println("arbiter: unknown frame dropped");
+    return;
+  }
+  slot_unref(i);
+}
+
+void frame_arbiter_get_stats(frame_arbiter_stats_t * s){
+  portENTER_CRITICAL(&arbiter_mux);
+  *s = stats;
+  portEXIT_CRITICAL(&arbiter_mux);
+}
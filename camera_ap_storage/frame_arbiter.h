@@ -0,0 +1,58 @@
+/*
+ * Frame arbiter. While the access point is up one task owns the camera
+ * driver. Streams take the newest preview frame from it, one frame
+ * shared by however many are watching; stills are queued to it and
+ * taken at the capture profile between two stream frames. Every wait is
+ * bounded: a still or a stream that gets nothing in time gives up
+ * instead of holding the other back. Trail camera wakes and the camera
+ * benchmarks use the driver directly; without the arbiter running,
+ * streams and stills get no frame rather than one from a driver that may
+ * be in the middle of a restart.
+ */
+#ifndef _FRAME_ARBITER_H_
+#define _FRAME_ARBITER_H_
+
+#include <stdint.h>
+#include "esp_camera.h"
+
+#define ARBITER_STACK 4096
+#define ARBITER_STILLS 2                // stills waiting at once, more are refused
+#define ARBITER_WANT_MS 1000            // stream frames are taken while a stream asked this recently
+#define ARBITER_BUFFER_WAIT_MS 1000     // for a frame buffer to come back, then the request fails
+#define ARBITER_STILL_TIMEOUT_MS 3000
+#define ARBITER_STREAM_TIMEOUT_MS 1000
+
+typedef struct {
+  uint32_t frames;          // preview frames taken for the streams
+  uint32_t stills;          // stills handed out
+  uint32_t still_failed;    // refused, timed out, or no frame buffer came back
+  uint32_t buffer_waits;    // times the arbiter waited for a frame to be returned
+  uint32_t resync_dropped;  // frames still at the capture size after a still
+  uint16_t still_ms;        // last still, from the request to the frame
+} frame_arbiter_stats_t;
+
+// with the camera started with fb_count buffers; again while running rereads the preview profile
+bool frame_arbiter_start(int fb_count);
+/*
+ * Before the camera is deinitialized, returns once the task has exited,
+ * which it does only after every frame handed out has been released.
+ * So a caller must not hold a frame itself while stopping the arbiter.
+ */
+void frame_arbiter_stop(void);
+bool frame_arbiter_running(void);
+// the preview profile preferences were written
+void frame_arbiter_preview_changed(void);
+
+/*
+ * A preview frame newer than *seq, which is updated, or NULL after
+ * timeout_ms. Every frame, still or not, goes back with
+ * frame_arbiter_release().
+ */
+camera_fb_t * frame_arbiter_frame(uint32_t * seq, uint32_t timeout_ms);
+// a frame at the capture profile, or NULL when it could not be had within timeout_ms
+camera_fb_t * frame_arbiter_still(uint32_t timeout_ms);
+void frame_arbiter_release(camera_fb_t * fb);
+
+void frame_arbiter_get_stats(frame_arbiter_stats_t * stats);
+
+#endif
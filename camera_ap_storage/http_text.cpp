@@ -0,0 +1,197 @@
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "http_text.h"
+
+void text_out_init(text_out_t *out, char *buf, size_t size){
+  out->p = buf;
+  out->end = buf + size;
+  out->full = false;
+  *buf = 0;
+}
+
+bool text_printf(text_out_t *out, const char *fmt, ...){
+  size_t room = out->end - out->p;
+  va_list args;
+
+  if (out->full) {
+    return false;  // a shorter one would leave a gap
+  }
+  va_start(args, fmt);
+  int n = vsnprintf(out->p, room, fmt, args);
+  va_end(args);
+  if (n < 0 || (size_t)n >= room) {
+    *out->p = 0;
+    out->full = true;
+    return false;
+  }
+  out->p += n;
+  return true;
+}
+
+void url_decode(char *str){
+  char *out = str;
+  while (*str) {
+    if (*str == '%' && isxdigit((unsigned char)str[1]) && isxdigit((unsigned char)str[2])) {
+      char hex[3] = {str[1], str[2], 0};
+      *out++ = (char)strtol(hex, NULL, 16);
+      str += 3;
+    } else if (*str == '+') {
+      *out++ = ' ';
+      str++;
+    } else {
+      *out++ = *str++;
+    }
+  }
+  *out = 0;
+}
+
+int parse_int_list(const char *text, int *out, int max){
+  int count = 0;
+  char *end;
+
+  while (*text && count < max) {
+    long v = strtol(text, &end, 10);
+    if (end == text) {
+      break;
+    }
+    out[count++] = (int)v;
+    text = *end == ',' ? end + 1 : end;
+  }
+  return count;
+}
+
+bool json_member(const char *json, const char *key, char *out, size_t len){
+  char pattern[24];
+  size_t n = 0;
+
+  snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+  const char *v = strstr(json, pattern);
+  if (!v) {
+    return false;
+  }
+  v += strlen(pattern);
+  while (*v == ' ') {
+    v++;
+  }
+  if (*v == '"') {
+    for (v++; *v && *v != '"' && n + 1 < len; v++) {
+      if (*v == '\\' && v[1]) {
+        v++;
+      }
+      out[n++] = *v;
+    }
+  } else {
+    while (*v && *v != ',' && *v != '}' && *v != ' ' && n + 1 < len) {
+      out[n++] = *v++;
+    }
+  }
+  out[n] = 0;
+  return true;
+}
+
+const char *json_next(const char *p, const char **key, size_t *key_len, const char **val, size_t *val_len){
+  int depth = 0;
+  bool quoted = false;
+
+  p = strchr(p, '"');
+  if (!p) {
+    return NULL;
+  }
+  *key = ++p;
+  p = strchr(p, '"');
+  if (!p || p[1] != ':') {
+    return NULL;
+  }
+  *key_len = p - *key;
+  p += 2;
+  *val = p;
+  for (; *p; p++) {
+    if (quoted) {
+      if (*p == '\\' && p[1]) {
+        p++;
+      } else if (*p == '"') {
+        quoted = false;
+      }
+    } else if (*p == '"') {
+      quoted = true;
+    } else if (!depth && (*p == ',' || *p == '}')) {
+      break;
+    } else if (*p == '[' || *p == '{') {
+      depth++;
+    } else if (*p == ']' || *p == '}') {
+      depth--;
+    }
+  }
+  *val_len = p - *val;
+  return p;
+}
+
+/*
+ * Both objects come from status_json(), so the members are nearly always
+ * in the same order: each key is looked for in prev from just after the
+ * last one found, wrapping round once, instead of from the start.
+ */
+size_t status_diff(const char *prev, const char *next, char *out){
+  const char *key, *val, *prev_key, *prev_val;
+  size_t key_len, val_len, prev_key_len, prev_val_len;
+  const char *resume = prev;
+  char *o = out + sprintf(out, "{\"status\":{");
+  char *members = o;
+
+  for (const char *p = next; (p = json_next(p, &key, &key_len, &val, &val_len)); ) {
+    bool same = false;
+    const char *q = resume;
+    bool wrapped = false;
+    while (prev) {
+      const char *end = json_next(q, &prev_key, &prev_key_len, &prev_val, &prev_val_len);
+      if (!end || (wrapped && prev_key > resume)) {
+        if (wrapped || resume == prev) {
+          break;
+        }
+        wrapped = true;
+        q = prev;
+        continue;
+      }
+      if (prev_key_len == key_len && !memcmp(prev_key, key, key_len)) {
+        same = prev_val_len == val_len && !memcmp(prev_val, val, val_len);
+        resume = end;
+        break;
+      }
+      q = end;
+    }
+    if (!same) {
+      if (o != members) {
+        *o++ = ',';
+      }
+      memcpy(o, key - 1, val + val_len - (key - 1)); // "key":value
+      o += val + val_len - (key - 1);
+    }
+  }
+  if (o == members) {
+    return 0;
+  }
+  o += sprintf(o, "}}");
+  return o - out;
+}
+
+// by hand rather than snprintf(), it is done for every frame of every stream
+size_t stream_part_header(char *out, size_t jpg_len){
+  static const char head[] = "Content-Type: image/jpeg\r\nContent-Length: ";
+  char digits[20];
+  int n = 0;
+  char *p = out + sizeof(head) - 1;
+
+  memcpy(out, head, sizeof(head) - 1);
+  do {
+    digits[n++] = '0' + jpg_len % 10;
+    jpg_len /= 10;
+  } while (jpg_len);
+  while (n) {
+    *p++ = digits[--n];
+  }
+  memcpy(p, "\r\n\r\n", 5);
+  return p + 4 - out;
+}
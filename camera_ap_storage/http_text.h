@@ -0,0 +1,52 @@
+/*
+ * Text handling for the web server that does not need the server itself:
+ * query values, the flat JSON spoken over the WebSocket, the /status
+ * text, the diffs of it pushed over the WebSocket, the /metrics text and
+ * the part headers of the MJPEG stream. It runs
+ * for every setting, every telemetry push and every streamed frame, and
+ * the host benchmarks time it from here.
+ */
+#ifndef _HTTP_TEXT_H_
+#define _HTTP_TEXT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define STREAM_PART_MAX 64           // a part header, terminator included
+
+// a buffer filled by text_printf(), always terminated
+typedef struct {
+  char *p;
+  char *end;
+  bool full;            // something did not fit and was left out
+} text_out_t;
+
+void text_out_init(text_out_t *out, char *buf, size_t size);
+// append like printf; the first piece that does not fit is left out whole and so is all after it
+bool text_printf(text_out_t *out, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+// decode %XX escapes and '+' in place, httpd_query_key_value() leaves them
+void url_decode(char *str);
+
+// "10,20,30" into out, at most max values; returns how many were read
+int parse_int_list(const char *text, int *out, int max);
+
+// copy a string or number member of a flat JSON message, without the quotes
+bool json_member(const char *json, const char *key, char *out, size_t len);
+
+/*
+ * The next "key":value of a flat object after p, the value may be a
+ * string or an array. Returns where the value ends, or NULL at the end.
+ */
+const char *json_next(const char *p, const char **key, size_t *key_len, const char **val, size_t *val_len);
+
+/*
+ * {"status":{...}} with the members of next that are not the same in
+ * prev, or all of them without prev. Returns 0 when nothing changed.
+ */
+size_t status_diff(const char *prev, const char *next, char *out);
+
+// the headers of one JPEG part of the stream into out, STREAM_PART_MAX bytes; returns their length
+size_t stream_part_header(char *out, size_t jpg_len);
+
+#endif
@@ -0,0 +1,107 @@
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "http_workers.h"
+
+typedef struct {
+  httpd_req_t *req;
+  http_handler_t handler;
+} http_work_t;
+
+static http_worker_stats_t stats;
+static portMUX_TYPE stats_mux = portMUX_INITIALIZER_UNLOCKED;
+
+#if HTTP_ASYNC_WORKERS
+
+static QueueHandle_t work_queue;
+static SemaphoreHandle_t idle_workers;   // counts workers waiting for a request
+static TaskHandle_t workers[HTTP_WORKER_COUNT];
+
+static bool on_worker_task(void){
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+
+  for (int i = 0; i < HTTP_WORKER_COUNT; i++) {
+    if (workers[i] == self) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static void http_worker(void *arg){
+  http_work_t work;
+
+  while (true) {
+    xSemaphoreGive(idle_workers);
+    if (xQueueReceive(work_queue, &work, portMAX_DELAY) != pdTRUE) {
+      continue;
+    }
+    portENTER_CRITICAL(&stats_mux);
+    stats.busy++;
+    portEXIT_CRITICAL(&stats_mux);
+    work.handler(work.req);
+    httpd_req_async_handler_complete(work.req);
+    portENTER_CRITICAL(&stats_mux);
+    stats.busy--;
+    stats.served++;
+    portEXIT_CRITICAL(&stats_mux);
+  }
+}
+
+void http_workers_start(void){
+  if (work_queue) {
+    return;
+  }
+  work_queue = xQueueCreate(1, sizeof(http_work_t));
+  idle_workers = xSemaphoreCreateCounting(HTTP_WORKER_COUNT, 0);
+  for (int i = 0; i < HTTP_WORKER_COUNT; i++) {
+    xTaskCreatePinnedToCore(http_worker, "http_worker", HTTP_WORKER_STACK, NULL, 5, &workers[i], tskNO_AFFINITY);
+  }
+}
+
+bool http_on_worker(httpd_req_t *req, http_handler_t handler, esp_err_t *result){
+  http_work_t work;
+
+  if (!work_queue || on_worker_task()) {
+    return true;
+  }
+  *result = ESP_OK;
+  // a worker is only promised once it is idle, the server task never waits on one
+  if (xSemaphoreTake(idle_workers, 0) != pdTRUE) {
+    portENTER_CRITICAL(&stats_mux);
+    stats.rejected++;
+    portEXIT_CRITICAL(&stats_mux);
+    httpd_resp_set_status(req, "503 Busy");
+    httpd_resp_set_hdr(req, "Retry-After", "1");
+    httpd_resp_sendstr(req, "every worker is busy");
+    return false;
+  }
+  if (httpd_req_async_handler_begin(req, &work.req) != ESP_OK) {
+    xSemaphoreGive(idle_workers);
+    *result = ESP_FAIL;
+    httpd_resp_send_500(req);
+    return false;
+  }
+  work.handler = handler;
+  xQueueSend(work_queue, &work, portMAX_DELAY);
+  return false;
+}
+
+#else
+
+void http_workers_start(void){
+}
+
+bool http_on_worker(httpd_req_t *req, http_handler_t handler, esp_err_t *result){
+  return true;
+}
+
+#endif
+
+void http_worker_get_stats(http_worker_stats_t *s){
+  portENTER_CRITICAL(&stats_mux);
+  *s = stats;
+  portEXIT_CRITICAL(&stats_mux);
+}
@@ -0,0 +1,46 @@
+/*
+ * Worker pool for the web servers. Handlers that hold a connection for a
+ * long time (/stream, /capture, the benchmarks) hand their request to a
+ * worker task, so the server task is free for /control and /status at
+ * once. Async request handoff needs ESP-IDF 5.1 or later; with an older
+ * core the handlers run on the server task as before.
+ */
+#ifndef _HTTP_WORKERS_H_
+#define _HTTP_WORKERS_H_
+
+#include <stdint.h>
+#include "esp_http_server.h"
+#include "esp_idf_version.h"
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+#define HTTP_ASYNC_WORKERS 1
+#else
+#define HTTP_ASYNC_WORKERS 0
+#endif
+
+#define HTTP_WORKER_COUNT 3             // long requests served at once, across both ports
+#define HTTP_WORKER_STACK 6144
+#define HTTP_DEFAULT_MAX_SOCKETS 7      // port 80 connections, preference "http_socks"
+#define HTTP_STREAM_SOCKETS (HTTP_WORKER_COUNT + 1)
+#define HTTP_MAX_SOCKETS 12             // both servers together, lwIP has 16 and each server keeps two
+
+typedef esp_err_t (*http_handler_t)(httpd_req_t *req);
+
+typedef struct {
+  uint32_t served;        // requests run on a worker
+  uint32_t rejected;      // turned away with 503, every worker was busy
+  uint8_t busy;           // workers running a request now
+} http_worker_stats_t;
+
+void http_workers_start(void);
+
+/*
+ * Call first thing in a long handler. Returns true when the handler
+ * should carry on on this task; otherwise the request has been handed
+ * to a worker (or refused with 503) and the handler returns *result.
+ */
+bool http_on_worker(httpd_req_t *req, http_handler_t handler, esp_err_t *result);
+
+void http_worker_get_stats(http_worker_stats_t *stats);
+
+#endif
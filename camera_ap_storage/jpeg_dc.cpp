@@ -0,0 +1,433 @@
+#include <string.h>
+#include "jpeg_dc.h"
+
+#define MAX_COMPONENTS 4
+#define FAST_BITS 9                   // codes this long or shorter are found with one lookup
+
+typedef struct {
+  uint16_t fast[1 << FAST_BITS];      // length << 8 | symbol, 0 when the code is longer
+  uint16_t skip[1 << FAST_BITS];      // AC only: bits << 8 | coefficients stepped over, code and value together
+  uint32_t maxcode[18];               // past the last code of each length, left aligned to 16 bits
+  int32_t delta[17];                  // symbol index = code - delta
+  uint8_t symbols[256];
+  bool defined;
+} huffman_t;
+
+typedef struct {
+  uint8_t id;
+  uint8_t h, v;                       // sampling factors
+  uint8_t tq;                         // quantization table
+  uint8_t td, ta;                     // DC and AC Huffman tables of the current scan
+  int pred;                           // DC predictor
+} component_t;
+
+typedef struct {
+  const uint8_t *p, *end;
+  uint64_t bits;                      // left aligned
+  int count;
+  bool marker;                        // hit a marker, zeros are fed from here on
+  int pad;                            // bits of those zeros
+} bits_t;
+
+typedef struct {
+  huffman_t dc[4], ac[4];
+  uint16_t q0[4];                     // DC entry of each quantization table
+  component_t comp[MAX_COMPONENTS];
+  int ncomp;
+  int hmax, vmax;
+  int width, height;
+  int restart;
+  bool frame;
+} decoder_t;
+
+static bool build_huffman(huffman_t *h, const uint8_t *counts, const uint8_t *symbols, int total){
+  int code = 0, k = 0;
+
+  memset(h->fast, 0, sizeof(h->fast));
+  memset(h->skip, 0, sizeof(h->skip));
+  memcpy(h->symbols, symbols, total);
+  for (int len = 1; len <= 16; len++) {
+    h->delta[len] = code - k;
+    for (int i = 0; i < counts[len - 1]; i++, k++, code++) {
+      if (len <= FAST_BITS) {
+        int shift = FAST_BITS - len;
+        int rs = symbols[k];
+        int bits = len + (rs & 15);
+        int step = rs == 0 ? 64 : rs == 0xf0 ? 16 : (rs >> 4) + 1;  // end of block steps past the last
+        for (int j = 0; j < (1 << shift); j++) {
+          h->fast[(code << shift) | j] = (uint16_t)(len << 8 | rs);
+          if (bits <= FAST_BITS) {
+            h->skip[(code << shift) | j] = (uint16_t)(bits << 8 | step);
+          }
+        }
+      }
+    }
+    if (code > (1 << len)) {
+      return false;                   // more codes than fit in this length
+    }
+    h->maxcode[len] = (uint32_t)code << (16 - len);
+    code <<= 1;
+  }
+  h->maxcode[17] = UINT32_MAX;
+  h->defined = true;
+  return true;
+}
+
+static inline void fill(bits_t *b){
+  while (b->count <= 56) {
+    uint64_t byte = 0;
+    if (b->marker || b->p >= b->end) {
+      b->pad += 8;
+    } else {
+      byte = *b->p++;
+      if (byte == 0xff) {
+        if (b->p < b->end && *b->p == 0) {
+          b->p++;                     // stuffed zero
+        } else {
+          b->marker = true;
+          b->p--;
+          byte = 0;
+        }
+      }
+    }
+    b->bits |= byte << (56 - b->count);
+    b->count += 8;
+  }
+}
+
+/*
+ * A symbol, or -1 for a code that is not in the table. Filled up to 57
+ * bits, so the value bits after it are there without another fill.
+ */
+static inline int decode(bits_t *b, const huffman_t *h){
+  fill(b);
+  uint16_t f = h->fast[b->bits >> (64 - FAST_BITS)];
+  if (f) {
+    int len = f >> 8;
+    b->bits <<= len;
+    b->count -= len;
+    return f & 0xff;
+  }
+  uint32_t c = b->bits >> 48;
+  int len = FAST_BITS + 1;
+  while (c >= h->maxcode[len]) {
+    len++;
+  }
+  if (len > 16) {
+    return -1;
+  }
+  b->bits <<= len;
+  b->count -= len;
+  return h->symbols[(int)(c >> (16 - len)) - h->delta[len]];
+}
+
+// the next n bits as a signed coefficient, F.2.2.1 of the spec
+static inline int receive_extend(bits_t *b, int n){
+  if (n == 0) {
+    return 0;
+  }
+  int v = b->bits >> (64 - n);
+  b->bits <<= n;
+  b->count -= n;
+  return v < (1 << (n - 1)) ? v - (1 << n) + 1 : v;
+}
+
+static inline void skip(bits_t *b, int n){
+  b->bits <<= n;
+  b->count -= n;
+}
+
+static inline uint16_t be16(const uint8_t *p){
+  return p[0] << 8 | p[1];
+}
+
+static int read_dqt(decoder_t *d, const uint8_t *p, int len){
+  while (len > 0) {
+    int pq = p[0] >> 4, tq = p[0] & 15;
+    int size = 1 + (pq ? 128 : 64);
+    if (tq > 3 || len < size) {
+      return JPEG_DC_CORRUPT;
+    }
+    // the first entry is the DC one in zigzag order too
+    d->q0[tq] = pq ? be16(p + 1) : p[1];
+    p += size;
+    len -= size;
+  }
+  return JPEG_DC_OK;
+}
+
+static int read_dht(decoder_t *d, const uint8_t *p, int len){
+  while (len > 17) {
+    int tc = p[0] >> 4, th = p[0] & 15;
+    int total = 0;
+    for (int i = 0; i < 16; i++) {
+      total += p[1 + i];
+    }
+    if (tc > 1 || th > 3 || total > 256 || len < 17 + total) {
+      return JPEG_DC_CORRUPT;
+    }
+    if (!build_huffman(tc ? &d->ac[th] : &d->dc[th], p + 1, p + 17, total)) {
+      return JPEG_DC_CORRUPT;
+    }
+    p += 17 + total;
+    len -= 17 + total;
+  }
+  return JPEG_DC_OK;
+}
+
+static int read_sof(decoder_t *d, const uint8_t *p, int len){
+  if (len < 6 || p[0] != 8) {
+    return len < 6 ? JPEG_DC_CORRUPT : JPEG_DC_UNSUPPORTED;
+  }
+  d->height = be16(p + 1);
+  d->width = be16(p + 3);
+  d->ncomp = p[5];
+  if (d->width == 0 || d->height == 0 || d->ncomp < 1 || d->ncomp > MAX_COMPONENTS || len < 6 + 3 * d->ncomp) {
+    return JPEG_DC_CORRUPT;
+  }
+  d->hmax = d->vmax = 1;
+  for (int i = 0; i < d->ncomp; i++) {
+    component_t *c = &d->comp[i];
+    c->id = p[6 + 3 * i];
+    c->h = p[7 + 3 * i] >> 4;
+    c->v = p[7 + 3 * i] & 15;
+    c->tq = p[8 + 3 * i] & 3;
+    if (c->h < 1 || c->h > 4 || c->v < 1 || c->v > 4) {
+      return JPEG_DC_CORRUPT;
+    }
+    d->hmax = c->h > d->hmax ? c->h : d->hmax;
+    d->vmax = c->v > d->vmax ? c->v : d->vmax;
+  }
+  d->frame = true;
+  return JPEG_DC_OK;
+}
+
+/*
+ * Past a restart marker the decoder starts again on a byte boundary with
+ * the predictors cleared. A missing marker is not an error, the data
+ * after it would only be garbage and is bounded by the plane anyway.
+ */
+static void restart(decoder_t *d, bits_t *b){
+  b->bits = 0;
+  b->count = 0;
+  b->pad = 0;
+  if (b->marker && b->p + 1 < b->end && b->p[1] >= 0xd0 && b->p[1] <= 0xd7) {
+    b->p += 2;
+    b->marker = false;
+  }
+  for (int i = 0; i < d->ncomp; i++) {
+    d->comp[i].pred = 0;
+  }
+}
+
+/*
+ * Decode one scan that holds the first (luma) component. Returns the
+ * position just past its entropy coded data.
+ */
+static int decode_scan(decoder_t *d, component_t **scan, int ns, const uint8_t *p, const uint8_t *end,
+                       uint8_t *plane, int pw, int ph, const uint8_t **next){
+  component_t *luma = &d->comp[0];
+  int q0 = d->q0[luma->tq];
+  bits_t b = { p, end, 0, 0, false, 0 };
+  int mcux, mcuy;
+
+  for (int i = 0; i < ns; i++) {
+    if (!d->dc[scan[i]->td].defined || !d->ac[scan[i]->ta].defined) {
+      return JPEG_DC_CORRUPT;
+    }
+    scan[i]->pred = 0;
+  }
+  if (ns == 1) {
+    // non-interleaved, one block per MCU over the component's own size
+    mcux = pw;
+    mcuy = ph;
+  } else {
+    mcux = (d->width + 8 * d->hmax - 1) / (8 * d->hmax);
+    mcuy = (d->height + 8 * d->vmax - 1) / (8 * d->vmax);
+  }
+  int todo = d->restart;
+  for (int my = 0; my < mcuy; my++) {
+    for (int mx = 0; mx < mcux; mx++) {
+      if (d->restart && todo-- == 0) {
+        restart(d, &b);
+        todo = d->restart - 1;
+      }
+      for (int i = 0; i < ns; i++) {
+        component_t *c = scan[i];
+        const huffman_t *dc = &d->dc[c->td];
+        const huffman_t *ac = &d->ac[c->ta];
+        int bh = ns == 1 ? 1 : c->h;
+        int bv = ns == 1 ? 1 : c->v;
+        for (int y = 0; y < bv; y++) {
+          for (int x = 0; x < bh; x++) {
+            int s = decode(&b, dc);
+            if (s < 0 || s > 11) {
+              return JPEG_DC_CORRUPT;
+            }
+            c->pred += receive_extend(&b, s);
+            // the AC terms are only stepped over, short ones with one lookup
+            for (int k = 1; k < 64; ) {
+              fill(&b);
+              uint16_t f = ac->skip[b.bits >> (64 - FAST_BITS)];
+              if (f) {
+                skip(&b, f >> 8);
+                k += f & 0xff;
+                continue;
+              }
+              int rs = decode(&b, ac);
+              if (rs < 0) {
+                return JPEG_DC_CORRUPT;
+              }
+              if ((rs & 15) == 0) {
+                if (rs != 0xf0) {
+                  break;              // end of block
+                }
+                k += 16;
+              } else {
+                k += (rs >> 4) + 1;
+                skip(&b, rs & 15);
+              }
+            }
+            if (c == luma) {
+              int px = mx * bh + x, py = my * bv + y;
+              if (px < pw && py < ph) {
+                // a block's mean is DC * Q / 8, level shifted by 128 and rounded as libjpeg does
+                int v = 128 + ((c->pred * q0 + 4) >> 3);
+                plane[py * pw + px] = v < 0 ? 0 : v > 255 ? 255 : v;
+              }
+            }
+          }
+        }
+      }
+      if (b.count < b.pad) {
+        return JPEG_DC_CORRUPT;       // took bits from past the end of the data
+      }
+    }
+  }
+  *next = b.p;
+  return JPEG_DC_OK;
+}
+
+// past the entropy coded data of a scan that is not wanted
+static const uint8_t *skip_scan(const uint8_t *p, const uint8_t *end){
+  while (p + 1 < end && !(p[0] == 0xff && p[1] != 0 && (p[1] < 0xd0 || p[1] > 0xd7))) {
+    p++;
+  }
+  return p;
+}
+
+int jpeg_dc_luma(const uint8_t *jpg, size_t len, uint8_t *plane, size_t plane_size, jpeg_dc_t *info){
+  decoder_t d;
+  const uint8_t *p = jpg, *end = jpg + len;
+  int pw = 0, ph = 0;
+
+  memset(&d, 0, sizeof(d));
+  if (len < 4 || p[0] != 0xff || p[1] != 0xd8) {
+    return JPEG_DC_CORRUPT;
+  }
+  p += 2;
+  for (;;) {
+    // fill bytes may come before a marker
+    while (p < end && *p == 0xff && p + 1 < end && p[1] == 0xff) {
+      p++;
+    }
+    if (p + 4 > end || p[0] != 0xff) {
+      return JPEG_DC_CORRUPT;
+    }
+    int marker = p[1];
+    if (marker == 0xd9) {
+      return JPEG_DC_CORRUPT;         // end of image before a luma scan
+    }
+    int seglen = be16(p + 2);
+    if (seglen < 2 || p + 2 + seglen > end) {
+      return JPEG_DC_CORRUPT;
+    }
+    const uint8_t *seg = p + 4;
+    int err = JPEG_DC_OK;
+    p += 2 + seglen;
+
+    switch (marker) {
+      case 0xc0:                      // baseline
+      case 0xc1:                      // extended, Huffman
+        err = read_sof(&d, seg, seglen - 2);
+        if (err == JPEG_DC_OK) {
+          pw = ((d.width * d.comp[0].h + d.hmax - 1) / d.hmax + 7) / 8;
+          ph = ((d.height * d.comp[0].v + d.vmax - 1) / d.vmax + 7) / 8;
+          if ((size_t)pw * ph > plane_size) {
+            return JPEG_DC_TOO_LARGE;
+          }
+        }
+        break;
+      case 0xc2: case 0xc3: case 0xc5: case 0xc6: case 0xc7:
+      case 0xc9: case 0xca: case 0xcb: case 0xcd: case 0xce: case 0xcf:
+        return JPEG_DC_UNSUPPORTED;
+      case 0xc4:
+        err = read_dht(&d, seg, seglen - 2);
+        break;
+      case 0xdb:
+        err = read_dqt(&d, seg, seglen - 2);
+        break;
+      case 0xdd:
+        d.restart = seglen >= 4 ? be16(seg) : 0;
+        break;
+      case 0xda: {
+        component_t *scan[MAX_COMPONENTS];
+        int ns = seg[0];
+        bool has_luma = false;
+        if (!d.frame || ns < 1 || ns > d.ncomp || seglen < 6 + 2 * ns) {
+          return JPEG_DC_CORRUPT;
+        }
+        for (int i = 0; i < ns; i++) {
+          scan[i] = NULL;
+          for (int j = 0; j < d.ncomp; j++) {
+            if (d.comp[j].id == seg[1 + 2 * i]) {
+              scan[i] = &d.comp[j];
+            }
+          }
+          if (!scan[i]) {
+            return JPEG_DC_CORRUPT;
+          }
+          scan[i]->td = seg[2 + 2 * i] >> 4 & 3;
+          scan[i]->ta = seg[2 + 2 * i] & 3;
+          has_luma |= scan[i] == &d.comp[0];
+        }
+        if (!has_luma) {
+          p = skip_scan(p, end);
+          break;
+        }
+        err = decode_scan(&d, scan, ns, p, end, plane, pw, ph, &p);
+        if (err != JPEG_DC_OK) {
+          return err;
+        }
+        // the plane is done, the rest of the file is not needed
+        memset(info, 0, sizeof(*info));
+        info->image_width = d.width;
+        info->image_height = d.height;
+        info->width = pw;
+        info->height = ph;
+        uint32_t sum = 0;
+        for (int i = 0; i < pw * ph; i++) {
+          sum += plane[i];
+          info->histogram[plane[i] >> 4]++;
+        }
+        info->mean = sum / (pw * ph);
+        return JPEG_DC_OK;
+      }
+      default:                        // APPn, COM and the like
+        break;
+    }
+    if (err != JPEG_DC_OK) {
+      return err;
+    }
+  }
+}
+
+const char *jpeg_dc_error(int err){
+  switch (err) {
+    case JPEG_DC_OK:          return "ok";
+    case JPEG_DC_CORRUPT:     return "corrupt";
+    case JPEG_DC_UNSUPPORTED: return "unsupported";
+    case JPEG_DC_TOO_LARGE:   return "too large";
+    default:                  return "unknown";
+  }
+}
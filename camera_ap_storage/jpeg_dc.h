@@ -0,0 +1,44 @@
+/*
+ * Scene statistics straight from a JPEG's DC coefficients. The entropy
+ * coded data is Huffman decoded, but no IDCT, upsampling or colour
+ * conversion is done: each 8x8 luma block's DC term is its mean, so the
+ * result is a 1/8 scale luma plane plus its mean and histogram. It reads
+ * the camera's frame buffer in place and writes into a plane the caller
+ * owns, so nothing is allocated. Baseline and extended Huffman JPEGs
+ * only, which is all the sensors produce.
+ */
+#ifndef _JPEG_DC_H_
+#define _JPEG_DC_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define JPEG_DC_MAX_WIDTH  2048       // QXGA, the largest frame any of the sensors gives
+#define JPEG_DC_MAX_HEIGHT 1536
+#define JPEG_DC_PLANE_MAX  ((JPEG_DC_MAX_WIDTH / 8) * (JPEG_DC_MAX_HEIGHT / 8))
+#define JPEG_DC_BINS       16         // histogram bins of 16 luma levels each
+
+#define JPEG_DC_OK          0
+#define JPEG_DC_CORRUPT     1         // not a JPEG, or its data ran out or did not decode
+#define JPEG_DC_UNSUPPORTED 2         // progressive, arithmetic coded or 12 bit
+#define JPEG_DC_TOO_LARGE   3         // the plane would not fit in plane_size
+
+typedef struct {
+  uint16_t image_width;
+  uint16_t image_height;
+  uint16_t width;                     // of the plane, the image size / 8 rounded up
+  uint16_t height;
+  uint8_t mean;                       // of the plane
+  uint32_t histogram[JPEG_DC_BINS];   // plane pixels per bin
+} jpeg_dc_t;
+
+/*
+ * Decode the luma DC plane of jpg into plane, width * height bytes with
+ * a stride of width. Returns JPEG_DC_OK or one of the errors above;
+ * *info is only complete on success.
+ */
+int jpeg_dc_luma(const uint8_t *jpg, size_t len, uint8_t *plane, size_t plane_size, jpeg_dc_t *info);
+
+const char *jpeg_dc_error(int err);
+
+#endif
@@ -0,0 +1,147 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include "esp_wifi.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "http_text.h"
+#include "metrics.h"
+
+typedef struct {
+  const char * name;
+  const char * help;
+} metric_info_t;
+
+static const metric_info_t counter_info[MET_COUNTERS] = {
+  { "trailcam_stream_frames_total", "Frames sent to stream clients." },
+  { "trailcam_stream_bytes_total", "Bytes sent to stream clients." },
+  { "trailcam_stream_dropped_total", "Preview frames a stream client was too slow to take." },
+  { "trailcam_control_requests_total", "Settings changes requested." },
+  { "trailcam_control_errors_total", "Settings changes refused." },
+  { "trailcam_captures_total", "Stills and photos taken." },
+  { "trailcam_capture_failures_total", "Stills and photos the camera did not deliver." },
+  { "trailcam_sd_writes_total", "write() calls to the SD card." },
+  { "trailcam_sd_write_bytes_total", "Bytes written to the SD card." },
+  { "trailcam_sd_write_errors_total", "Failed or short writes to the SD card." },
+};
+
+static const metric_info_t gauge_info[MET_GAUGES] = {
+  { "trailcam_streams", "MJPEG streams open." },
+  { "trailcam_heap_free_bytes", "Free internal heap." },
+  { "trailcam_heap_min_free_bytes", "Lowest free internal heap since boot." },
+  { "trailcam_psram_free_bytes", "Free PSRAM." },
+  { "trailcam_wifi_stations", "Stations connected to the access point." },
+  { "trailcam_uptime_seconds", "Time since boot." },
+};
+
+static const metric_info_t histogram_info[MET_HISTOGRAMS] = {
+  { "trailcam_capture_seconds", "Time from asking for a still or photo until the frame is there." },
+  { "trailcam_sd_write_seconds", "Time of one write() to the SD card." },
+  { "trailcam_stream_send_seconds", "Time to send one frame to one stream client." },
+};
+
+// upper bounds, the last bucket is open
+static const uint32_t bucket_us[METRICS_BUCKETS - 1] = { 1000, 2000, 5000, 10000, 20000, 50000,
+                                                        100000, 200000, 500000, 1000000 };
+static const char * const bucket_le[METRICS_BUCKETS] = { "0.001", "0.002", "0.005", "0.01", "0.02", "0.05",
+                                                         "0.1", "0.2", "0.5", "1", "+Inf" };
+
+// the sum is 64 bits, 32 bits of microseconds would wrap after 71 minutes of SD writes
+typedef struct {
+  uint32_t buckets[METRICS_BUCKETS];
+  uint64_t sum_us;
+} metric_histogram_data_t;
+
+static uint32_t counters[MET_COUNTERS];
+static int32_t gauges[MET_GAUGES];
+static metric_histogram_data_t histograms[MET_HISTOGRAMS];
+
+void metrics_add(metric_counter_t id, uint32_t n){
+  __atomic_fetch_add(&counters[id], n, __ATOMIC_RELAXED);
+}
+
+void metrics_inc(metric_counter_t id){
+  __atomic_fetch_add(&counters[id], 1, __ATOMIC_RELAXED);
+}
+
+void metrics_gauge_set(metric_gauge_t id, int32_t value){
+  __atomic_store_n(&gauges[id], value, __ATOMIC_RELAXED);
+}
+
+void metrics_gauge_add(metric_gauge_t id, int32_t delta){
+  __atomic_fetch_add(&gauges[id], delta, __ATOMIC_RELAXED);
+}
+
+void metrics_observe_us(metric_histogram_t id, int64_t us){
+  int bucket = 0;
+
+  if (us < 0) {
+    us = 0;
+  }
+  while (bucket < METRICS_BUCKETS - 1 && us > bucket_us[bucket]) {
+    bucket++;
+  }
+  __atomic_fetch_add(&histograms[id].buckets[bucket], 1, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&histograms[id].sum_us, (uint64_t)us, __ATOMIC_RELAXED);
+}
+
+static void out_header(text_out_t * out, const metric_info_t * info, const char * type){
+  text_printf(out, "# HELP %s %s\n# TYPE %s %s\n", info->name, info->help, info->name, type);
+}
+
+// RSSI of each station on the access point, or of the access point the uplink joined
+static void render_rssi(text_out_t * out){
+  text_printf(out, "# HELP trailcam_wifi_rssi_dbm Signal strength of each Wi-Fi peer.\n"
+                  "# TYPE trailcam_wifi_rssi_dbm gauge\n");
+  wifi_mode_t mode = WiFi.getMode();
+  if (mode & WIFI_MODE_AP) {
+    wifi_sta_list_t stations;
+    if (esp_wifi_ap_get_sta_list(&stations) == ESP_OK) {
+      for (int i = 0; i < stations.num; i++) {
+        const uint8_t * mac = stations.sta[i].mac;
+        text_printf(out, "trailcam_wifi_rssi_dbm{peer=\"%02x:%02x:%02x:%02x:%02x:%02x\"} %d\n",
+                   mac[0], mac[1], mac[2], mac[3], mac[4], mac[5], stations.sta[i].rssi);
+      }
+      metrics_gauge_set(MET_WIFI_STATIONS, stations.num);
+    }
+  }
+  if ((mode & WIFI_MODE_STA) && WiFi.isConnected()) {
+    text_printf(out, "trailcam_wifi_rssi_dbm{peer=\"ap\"} %d\n", WiFi.RSSI());
+  }
+}
+
+size_t metrics_render(char * text, size_t len){
+  text_out_t out;
+
+  if (!len) {
+    return 0;
+  }
+  text_out_init(&out, text, len);
+  metrics_gauge_set(MET_HEAP_FREE, heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+  metrics_gauge_set(MET_HEAP_MIN_FREE, heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL));
+  metrics_gauge_set(MET_PSRAM_FREE, heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+  metrics_gauge_set(MET_UPTIME, esp_timer_get_time() / 1000000);
+  render_rssi(&out);
+
+  for (int i = 0; i < MET_COUNTERS; i++) {
+    out_header(&out, &counter_info[i], "counter");
+    text_printf(&out, "%s %u\n", counter_info[i].name, __atomic_load_n(&counters[i], __ATOMIC_RELAXED));
+  }
+  for (int i = 0; i < MET_GAUGES; i++) {
+    out_header(&out, &gauge_info[i], "gauge");
+    text_printf(&out, "%s %d\n", gauge_info[i].name, __atomic_load_n(&gauges[i], __ATOMIC_RELAXED));
+  }
+  for (int i = 0; i < MET_HISTOGRAMS; i++) {
+    const char * name = histogram_info[i].name;
+    uint32_t count = 0;
+    out_header(&out, &histogram_info[i], "histogram");
+    // the count is the last cumulative bucket, so the two always agree
+    for (int b = 0; b < METRICS_BUCKETS; b++) {
+      count += __atomic_load_n(&histograms[i].buckets[b], __ATOMIC_RELAXED);
+      text_printf(&out, "%s_bucket{le=\"%s\"} %u\n", name, bucket_le[b], count);
+    }
+    uint64_t sum_us = __atomic_load_n(&histograms[i].sum_us, __ATOMIC_RELAXED);
+    text_printf(&out, "%s_sum %llu.%06u\n%s_count %u\n", name, (unsigned long long)(sum_us / 1000000),
+                (unsigned)(sum_us % 1000000), name, count);
+  }
+  return out.p - text;
+}
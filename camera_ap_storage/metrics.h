@@ -0,0 +1,62 @@
+/*
+ * Metrics registry, served by /metrics in the Prometheus text format so
+ * a laptop can scrape the station during field setup instead of reading
+ * its serial output. Counters, gauges and fixed-bucket latency histograms
+ * are plain 32-bit words updated with atomic adds. The histogram sums are
+ * 64-bit microseconds, which the ESP32 adds in a short critical section
+ * inside the atomic builtin. The stream loops, the control handler, the
+ * capture path and the SD writer update them from whichever task or core
+ * they run on, without taking a lock of their own. Everything
+ * starts from zero on each boot; a counter that wraps at 2^32 looks like
+ * a restart to Prometheus.
+ */
+#ifndef _METRICS_H_
+#define _METRICS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define METRICS_BUCKETS 11          // latency buckets, the last one is +Inf
+#define METRICS_TEXT_MAX 8192       // the rendered text, with a few Wi-Fi stations
+
+typedef enum {
+  MET_STREAM_FRAMES,                // sent to MJPEG and WebSocket streams
+  MET_STREAM_BYTES,
+  MET_STREAM_DROPPED,               // preview frames a stream was too slow to take
+  MET_CONTROL_REQUESTS,             // settings changes, from /control or the WebSocket
+  MET_CONTROL_ERRORS,
+  MET_CAPTURES,                     // stills and trail camera photos
+  MET_CAPTURE_FAILURES,
+  MET_SD_WRITES,
+  MET_SD_WRITE_BYTES,
+  MET_SD_WRITE_ERRORS,
+  MET_COUNTERS
+} metric_counter_t;
+
+typedef enum {
+  MET_STREAMS,                      // MJPEG streams open
+  MET_HEAP_FREE,                    // the rest are sampled when rendered
+  MET_HEAP_MIN_FREE,
+  MET_PSRAM_FREE,
+  MET_WIFI_STATIONS,
+  MET_UPTIME,
+  MET_GAUGES
+} metric_gauge_t;
+
+typedef enum {
+  MET_CAPTURE_LATENCY,              // from asking for a still or photo until the frame is there
+  MET_SD_WRITE_LATENCY,             // one write() to the card
+  MET_STREAM_SEND_LATENCY,          // one frame to one stream client
+  MET_HISTOGRAMS
+} metric_histogram_t;
+
+void metrics_add(metric_counter_t id, uint32_t n);
+void metrics_inc(metric_counter_t id);
+void metrics_gauge_set(metric_gauge_t id, int32_t value);
+void metrics_gauge_add(metric_gauge_t id, int32_t delta);
+void metrics_observe_us(metric_histogram_t id, int64_t us);
+
+// the whole registry as Prometheus text into out; returns its length
+size_t metrics_render(char * out, size_t len);
+
+#endif
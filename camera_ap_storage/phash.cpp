@@ -0,0 +1,83 @@
+#include <string.h>
+#include "phash.h"
+
+#define PHASH_MAGIC 0x50484153  // "PHAS"
+#define PHASH_W 9
+#define PHASH_H 8
+
+uint64_t phash_compute(const uint8_t *luma, int width, int height, int stride){
+  uint32_t cells[PHASH_H][PHASH_W];
+  uint64_t hash = 0;
+  int x, y;
+
+  if (width < PHASH_W || height < PHASH_H) {
+    return 0;
+  }
+
+  // box filter the plane down to 9x8 cells
+  for (y = 0; y < PHASH_H; y++) {
+    int y0 = y * height / PHASH_H;
+    int y1 = (y + 1) * height / PHASH_H;
+    for (x = 0; x < PHASH_W; x++) {
+      int x0 = x * width / PHASH_W;
+      int x1 = (x + 1) * width / PHASH_W;
+      uint32_t sum = 0;
+      for (int yy = y0; yy < y1; yy++) {
+        const uint8_t *row = luma + yy * stride;
+        for (int xx = x0; xx < x1; xx++) {
+          sum += row[xx];
+        }
+      }
+      cells[y][x] = sum / ((y1 - y0) * (x1 - x0));
+    }
+  }
+
+  for (y = 0; y < PHASH_H; y++) {
+    for (x = 0; x < PHASH_W - 1; x++) {
+      hash <<= 1;
+      if (cells[y][x] > cells[y][x + 1]) {
+        hash |= 1;
+      }
+    }
+  }
+  return hash;
+}
+
+int phash_distance(uint64_t a, uint64_t b){
+  return __builtin_popcountll(a ^ b);
+}
+
+void phash_history_reset(phash_history_t *history){
+  memset(history, 0, sizeof(phash_history_t));
+  history->magic = PHASH_MAGIC;
+}
+
+bool phash_history_valid(const phash_history_t *history){
+  return history->magic == PHASH_MAGIC && history->count <= PHASH_HISTORY && history->head < PHASH_HISTORY;
+}
+
+void phash_history_push(phash_history_t *history, const phash_entry_t *entry){
+  history->entries[history->head] = *entry;
+  history->head = (history->head + 1) % PHASH_HISTORY;
+  if (history->count < PHASH_HISTORY) {
+    history->count++;
+  }
+}
+
+const phash_entry_t *phash_history_match(const phash_history_t *history, uint64_t hash,
+                                         int max_distance, int *distance){
+  const phash_entry_t *best = NULL;
+  int best_distance = max_distance + 1;
+
+  for (int i = 0; i < history->count; i++) {
+    int d = phash_distance(history->entries[i].hash, hash);
+    if (d < best_distance) {
+      best_distance = d;
+      best = &history->entries[i];
+    }
+  }
+  if (best && distance) {
+    *distance = best_distance;
+  }
+  return best;
+}
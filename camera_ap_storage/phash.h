@@ -0,0 +1,62 @@
+/*
+ * Perceptual hash (difference hash) of a capture, used to suppress
+ * near-duplicate images across wakes. The hash is computed from a
+ * downscaled luma plane, so it does not care how that plane was produced.
+ */
+#ifndef _PHASH_H_
+#define _PHASH_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define PHASH_HISTORY 8              // hashes kept in RTC memory
+#define PHASH_INDEX_FILE "/phash.idx" // on-card index of every hashed capture
+
+#define PHASH_STORED    0            // capture was written as a full JPEG
+#define PHASH_REFERENCE 1            // capture was written as a reference to an earlier one
+#define PHASH_DROPPED   2            // capture was dropped
+
+// dedup modes, stored in the "dedup" preference
+#define DEDUP_OFF       0
+#define DEDUP_DROP      1
+#define DEDUP_REFERENCE 2
+
+#define DEDUP_DEFAULT_DISTANCE 4      // captures this many bits (of 64) apart or closer are duplicates
+
+// one record of the on-card index, also used for the RTC history
+typedef struct {
+  uint64_t hash;
+  uint32_t time;      // capture time, seconds since epoch
+  uint32_t size;      // JPEG size in bytes
+  uint8_t flags;      // PHASH_STORED, PHASH_REFERENCE or PHASH_DROPPED
+  char name[31];      // file the image was stored as (or refers to)
+} phash_entry_t;
+
+typedef struct {
+  uint32_t magic;
+  uint8_t count;
+  uint8_t head;
+  phash_entry_t entries[PHASH_HISTORY];
+} phash_history_t;
+
+/*
+ * Compute a 64 bit difference hash from an 8 bit luma plane.
+ * The plane is box-filtered down to 9x8 and each bit is set when a cell
+ * is brighter than its right neighbour.
+ */
+uint64_t phash_compute(const uint8_t *luma, int width, int height, int stride);
+
+int phash_distance(uint64_t a, uint64_t b);
+
+void phash_history_reset(phash_history_t *history);
+bool phash_history_valid(const phash_history_t *history);
+void phash_history_push(phash_history_t *history, const phash_entry_t *entry);
+
+/*
+ * Return the closest stored entry within max_distance bits of hash,
+ * or NULL when there is none. The distance found is written to *distance.
+ */
+const phash_entry_t *phash_history_match(const phash_history_t *history, uint64_t hash,
+                                         int max_distance, int *distance);
+
+#endif
@@ -0,0 +1,260 @@
+#include <Arduino.h>
+#include <Preferences.h>
+#include <SD_MMC.h>
+#include "retention.h"
+#include "catalog.h"
+#include "phash.h"
+#include "rtc_state.h"
+#include "sd_writer.h"
+#include "boot_cache.h"
+
+#define RETENTION_MAGIC 0x4e544552  // "RETN"
+#define MB (1024LL * 1024)
+
+extern Preferences preferences;
+
+typedef struct {
+  uint32_t magic;
+  uint32_t charged;          // catalog records already taken off the free space
+  uint32_t reclaim_cursor;   // oldest record not yet deleted or kept for good
+  int32_t reclaim_day;       // local day of the last capture the reclaim cursor passed
+  uint32_t thin_cursor;
+  int32_t thin_hour;         // local hour of the last capture the thin cursor passed
+  int64_t free_bytes;
+  uint32_t wakes;            // since free_bytes was measured
+  uint32_t deleted;
+  uint64_t reclaimed;
+  bool stalled;
+} retention_state_t;
+
+RTC_DATA_ATTR static retention_state_t retention;
+
+static retention_policy_t policy;
+static bool policy_loaded;
+
+void retention_policy_load(retention_policy_t * p){
+  p->free_mb = preferences.getUShort("ret_free_mb", RETENTION_DEFAULT_FREE_MB);
+  p->keep_gb = preferences.getUShort("ret_gb", 0);
+  p->daily = preferences.getUChar("ret_daily", 1);
+  p->thin_days = preferences.getUShort("ret_thin_days", 0);
+}
+
+const retention_policy_t * retention_policy(void){
+  if (boot_cache_valid()) {
+    return &boot_cache.retention;
+  }
+  if (!policy_loaded) {
+    retention_policy_load(&policy);
+    policy_loaded = true;
+  }
+  return &policy;
+}
+
+void retention_policy_changed(void){
+  policy_loaded = false;
+}
+
+static void retention_cursors_reset(void){
+  retention.reclaim_cursor = 0;
+  retention.reclaim_day = -1;
+  retention.thin_cursor = 0;
+  retention.thin_hour = -1;
+}
+
+static void retention_load(void){
+  if (!rtc_state_restore("retention", &retention, sizeof(retention), RETENTION_MAGIC)) {
+    retention_cursors_reset();
+  }
+  retention.free_bytes = -1; // the card may have been changed or written elsewhere
+}
+
+// hours since the year 0 in local time, day boundaries follow the time zone
+static int32_t local_hour(uint32_t t){
+  time_t tt = t;
+  struct tm tm;
+
+  localtime_r(&tt, &tm);
+  return (tm.tm_year * 366 + tm.tm_yday) * 24 + tm.tm_hour;
+}
+
+static int64_t on_card(uint32_t size){
+  int64_t cluster = sd_cluster_size();
+  return (size + cluster - 1) / cluster * cluster;
+}
+
+static bool has_file(const catalog_record_t * record){
+  return !(record->flags & CATALOG_DELETED) &&
+         (record->flags & CATALOG_OUTCOME_MASK) != PHASH_DROPPED;
+}
+
+static bool is_stored(const catalog_record_t * record){
+  return (record->flags & CATALOG_OUTCOME_MASK) == PHASH_STORED;
+}
+
+static int release_original(const char * name);
+
+// returns the files deleted, a reference can take the original it was the last to name with it
+static int retention_delete(uint32_t index, const catalog_record_t * record){
+  char target[sizeof(record->name)];
+  bool reference = (record->flags & CATALOG_OUTCOME_MASK) == PHASH_REFERENCE &&
+                   catalog_ref_target(record->name, target, sizeof(target));
+
+  if (!SD_MMC.remove(record->name) && SD_MMC.exists(record->name)) {
+    return 0;
+  }
+  // a file already gone, by hand or by an interrupted wake, is only recorded
+  if (!catalog_mark_deleted(index)) {
+    return 0;
+  }
+  retention.free_bytes += on_card(record->size);
+  retention.deleted++;
+  retention.reclaimed += record->size;
+  return reference ? 1 + release_original(target) : 1;
+}
+
+/*
+ * An original is kept while references name it. Once the last one is
+ * gone, an original a cursor already passed over for them goes too,
+ * unless it was kept as the first of its day or hour.
+ */
+static int release_original(const char * name){
+  catalog_record_t original;
+  uint32_t index = catalog_find_name(name);
+
+  if (catalog_add_ref(index, -1) != 0 || !catalog_read(index, &original) || !has_file(&original) ||
+      (original.flags & CATALOG_KEPT)) {
+    return 0;
+  }
+  if (index < retention.reclaim_cursor || index < retention.thin_cursor) {
+    return retention_delete(index, &original);
+  }
+  return 0;
+}
+
+// the free space only goes down by what the captures since the last wake took
+static void retention_track_free(const catalog_summary_t * summary){
+  catalog_record_t record;
+
+  if (retention.free_bytes < 0 || ++retention.wakes >= RETENTION_MEASURE_WAKES) {
+    int64_t measured = sd_free_bytes();
+    if (measured >= 0) {
+      retention.free_bytes = measured;
+      retention.charged = summary->count;
+      retention.wakes = 0;
+      return;
+    }
+  }
+  for (uint32_t i = retention.charged; i < summary->count; i++) {
+    if (catalog_read(i, &record) && has_file(&record)) {
+      retention.free_bytes -= on_card(record.size);
+    }
+  }
+  retention.charged = summary->count;
+}
+
+static bool within_budget(int deletes, int reads, unsigned long start, uint32_t budget_ms){
+  return deletes < RETENTION_MAX_DELETES && reads < RETENTION_MAX_READS && millis() - start < budget_ms;
+}
+
+int retention_run(uint32_t budget_ms){
+  const retention_policy_t * p = retention_policy();
+  const catalog_summary_t * summary;
+  catalog_record_t record;
+  unsigned long start = millis();
+  int reads = 0;
+  int deletes = 0;
+
+  if (!catalog_begin()) {
+    return 0;
+  }
+  summary = catalog_summary();
+  if (retention.magic != RETENTION_MAGIC) {
+    retention_load();
+  }
+  // a rebuilt or replaced catalog starts over
+  if (retention.reclaim_cursor > summary->count || retention.thin_cursor > summary->count ||
+      retention.charged > summary->count) {
+    retention_cursors_reset();
+    retention.free_bytes = -1;
+  }
+  retention_track_free(summary);
+
+  // oldest first, until there is space again
+  int64_t reserve = p->free_mb * MB;
+  uint64_t limit = p->keep_gb ? p->keep_gb * 1024 * MB : UINT64_MAX;
+  retention.stalled = false;
+  while ((retention.free_bytes >= 0 && retention.free_bytes < reserve) || summary->bytes > limit) {
+    if (retention.reclaim_cursor >= summary->count) {
+      retention.stalled = true;
+      break;
+    }
+    if (!within_budget(deletes, reads, start, budget_ms)) {
+      break;
+    }
+    uint32_t i = retention.reclaim_cursor++;
+    reads++;
+    if (!catalog_read(i, &record) || !has_file(&record)) {
+      continue;
+    }
+    // a reference is never the day's kept capture, it only names one
+    if (is_stored(&record)) {
+      int32_t day = local_hour(record.time) / 24;
+      bool first = day != retention.reclaim_day;
+      retention.reclaim_day = day;
+      if (first && p->daily) {
+        catalog_mark_kept(i);
+        continue;
+      }
+      if (record.refs) {
+        continue; // goes with the last reference to it
+      }
+    }
+    deletes += retention_delete(i, &record);
+  }
+
+  // then captures past the age limit down to one an hour, the first of a day is the first of its hour
+  if (p->thin_days) {
+    uint32_t cutoff = time(NULL) - p->thin_days * 86400UL;
+    while (retention.thin_cursor < summary->count && within_budget(deletes, reads, start, budget_ms)) {
+      reads++;
+      if (!catalog_read(retention.thin_cursor, &record)) {
+        retention.thin_cursor++;
+        continue;
+      }
+      if (record.time >= cutoff) {
+        break;
+      }
+      if (has_file(&record) && is_stored(&record)) {
+        int32_t hour = local_hour(record.time);
+        bool first = hour != retention.thin_hour;
+        retention.thin_hour = hour;
+        if (first) {
+          catalog_mark_kept(retention.thin_cursor);
+        } else if (!record.refs) {
+          deletes += retention_delete(retention.thin_cursor, &record);
+        }
+      } else if (has_file(&record)) {
+        deletes += retention_delete(retention.thin_cursor, &record);
+      }
+      retention.thin_cursor++;
+    }
+  }
+
+  if (deletes) {
+    catalog_checkpoint();
+  }
+  if (retention.stalled) {
+    Serial.println("retention: card full and nothing the policy allows deleting");
+  }
+  Serial.printf("retention: %d deleted in %lu ms, %lld MB free\n", deletes, millis() - start,
+                (long long)(retention.free_bytes / MB));
+  rtc_state_save_every("retention", &retention, sizeof(retention), retention.wakes, RETENTION_SAVE_INTERVAL);
+  return deletes;
+}
+
+void retention_get_stats(retention_stats_t * stats){
+  stats->free_bytes = retention.magic == RETENTION_MAGIC ? retention.free_bytes : -1;
+  stats->deleted = retention.deleted;
+  stats->reclaimed = retention.reclaimed;
+  stats->stalled = retention.stalled;
+}
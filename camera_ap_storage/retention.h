@@ -0,0 +1,49 @@
+/*
+ * Retention. Once the card runs short of space, or the captures on it
+ * pass a size limit, the oldest captures are deleted to make room, and
+ * captures past a given age can be thinned to one an hour. The work is
+ * done a little each wake, walking the capture catalog from the oldest
+ * record, with free space tracked from the catalog in between
+ * measurements of the card.
+ */
+#ifndef _RETENTION_H_
+#define _RETENTION_H_
+
+#include <stdint.h>
+
+#define RETENTION_DEFAULT_FREE_MB 64  // space kept free for the next captures
+#define RETENTION_MAX_DELETES 16      // files deleted per wake at most
+#define RETENTION_MAX_READS 256       // catalog records looked at per wake at most
+#define RETENTION_MEASURE_WAKES 32    // wakes between measurements of the card's free space
+#define RETENTION_SAVE_INTERVAL 16    // wakes between copies of the cursors to NVS
+#define RETENTION_BUDGET_MS 800       // taken out of the second between the first two photos
+
+// preferences "ret_free_mb", "ret_gb", "ret_daily", "ret_thin_days"
+typedef struct {
+  uint16_t free_mb;       // keep this much of the card free
+  uint16_t keep_gb;       // keep only the newest this many GB of captures, 0 for no limit
+  uint8_t daily;          // never delete the first capture of a day
+  uint16_t thin_days;     // thin captures older than this to the first of each hour, 0 for never
+} retention_policy_t;
+
+typedef struct {
+  int64_t free_bytes;     // tracked, -1 before the card was first measured
+  uint32_t deleted;       // files deleted
+  uint64_t reclaimed;     // bytes they took
+  bool stalled;           // short of space with nothing left the policy allows deleting
+} retention_stats_t;
+
+void retention_policy_load(retention_policy_t * policy);
+const retention_policy_t * retention_policy(void);
+// a policy preference was written
+void retention_policy_changed(void);
+
+/*
+ * With the card mounted, delete what the policy asks for, within the
+ * limits above and budget_ms. Returns the number of files deleted.
+ */
+int retention_run(uint32_t budget_ms);
+
+void retention_get_stats(retention_stats_t * stats);
+
+#endif
@@ -0,0 +1,25 @@
+#include <Arduino.h>
+#include <Preferences.h>
+#include "rtc_state.h"
+
+extern Preferences preferences;
+
+bool rtc_state_restore(const char * key, void * state, size_t size, uint32_t magic){
+  if (preferences.getBytesLength(key) != size || preferences.getBytes(key, state, size) != size ||
+      *(const uint32_t *)state != magic) {
+    memset(state, 0, size);
+    *(uint32_t *)state = magic;
+    return false;
+  }
+  return true;
+}
+
+void rtc_state_save(const char * key, const void * state, size_t size){
+  preferences.putBytes(key, state, size);
+}
+
+void rtc_state_save_every(const char * key, const void * state, size_t size, uint32_t count, uint32_t every){
+  if (count % every == 0) {
+    rtc_state_save(key, state, size);
+  }
+}
@@ -0,0 +1,23 @@
+/*
+ * State a module keeps in RTC_DATA_ATTR memory across deep sleep, with a
+ * copy in NVS. RTC memory is lost on power up and reset, and the module
+ * carries on from the last copy, written every so many wakes or captures
+ * to spare the flash. Each state struct starts with a uint32_t magic that
+ * tells whether the RTC copy is there.
+ */
+#ifndef _RTC_STATE_H_
+#define _RTC_STATE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Read the NVS copy under key into state. Without a whole copy that has
+ * the magic, state is zeroed with only the magic set and false returned.
+ */
+bool rtc_state_restore(const char * key, void * state, size_t size, uint32_t magic);
+void rtc_state_save(const char * key, const void * state, size_t size);
+// save when count is a multiple of every
+void rtc_state_save_every(const char * key, const void * state, size_t size, uint32_t count, uint32_t every);
+
+#endif
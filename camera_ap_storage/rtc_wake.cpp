@@ -0,0 +1,206 @@
+#include <Arduino.h>
+#include <Preferences.h>
+#include <Wire.h>
+#include "esp_sleep.h"
+#include "driver/rtc_io.h"
+#include "rtc_wake.h"
+#include "boot_cache.h"
+
+#define DRIFT_MAGIC 0x44524654             // "DRFT"
+#define DRIFT_MAX_PPM 100000               // larger samples mean the clock was set meanwhile
+#define EDGE_TIMEOUT_MS 1500
+#define ALARM_MAX_AHEAD (60*60*24*27)      // alarm 1 matches the day of month, keep it unambiguous
+
+extern RTC_DS3231 rtc;
+extern Preferences preferences;
+
+typedef struct {
+  uint32_t magic;
+  bool pending;           // a calibration sleep is in progress
+  int64_t start_rtc;      // DS3231 second the calibration sleep started on
+  uint64_t requested_us;  // raw timer value the sleep was programmed with
+  uint32_t wakes;         // timer wakes since the last calibration
+} drift_state_t;
+
+RTC_DATA_ATTR static drift_state_t drift;
+
+static int64_t days_from_civil(int y, unsigned m, unsigned d){
+  y -= m <= 2;
+  const int era = (y >= 0 ? y : y - 399) / 400;
+  const unsigned yoe = (unsigned)(y - era * 400);
+  const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return (int64_t)era * 146097 + doe - 719468;
+}
+
+time_t rtc_to_epoch(const DateTime &dt){
+  return days_from_civil(dt.year(), dt.month(), dt.day()) * 86400 +
+         dt.hour() * 3600 + dt.minute() * 60 + dt.second();
+}
+
+DateTime epoch_to_rtc(time_t t){
+  struct tm utc;
+
+  gmtime_r(&t, &utc);
+  return DateTime(utc.tm_year + 1900, utc.tm_mon + 1, utc.tm_mday, utc.tm_hour, utc.tm_min, utc.tm_sec);
+}
+
+char wake_source(void){
+  if (boot_cache_valid()) {
+    return boot_cache.wake;
+  }
+  return preferences.getChar("wake", WAKE_TIMER) == WAKE_ALARM ? WAKE_ALARM : WAKE_TIMER;
+}
+
+// the SD card shares GPIO 14/15 with I2C, so take the pins back before talking to the DS3231
+void rtc_bus_begin(void){
+  Wire.end();
+  Wire.begin(I2C_SDA, I2C_SCL);
+  rtc.begin();
+}
+
+/*
+ * Wait for the DS3231 seconds to tick over, so the returned second
+ * started within an I2C transaction of this function returning.
+ */
+static bool rtc_wait_edge(int64_t * second){
+  int64_t first = rtc_to_epoch(rtc.now());
+  unsigned long t = millis();
+
+  while (millis() - t < EDGE_TIMEOUT_MS) {
+    int64_t s = rtc_to_epoch(rtc.now());
+    if (s != first) {
+      *second = s;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool rtc_alarm_fired(void){
+  if (!rtc.alarmFired(1)) {
+    return false;
+  }
+  rtc.clearAlarm(1); // releases INT/SQW, it also doubles as SD D3
+  return true;
+}
+
+float rtc_drift_ppm(void){
+  if (boot_cache_valid()) {
+    return boot_cache.drift_ppm;
+  }
+  return preferences.getFloat("drift_ppm", 0);
+}
+
+uint32_t rtc_drift_samples(void){
+  if (boot_cache_valid()) {
+    return boot_cache.drift_samples;
+  }
+  return preferences.getULong("drift_n", 0);
+}
+
+bool rtc_drift_pending(void){
+  return drift.magic == DRIFT_MAGIC && drift.pending;
+}
+
+/*
+ * The calibration sleep started on a DS3231 second edge. Find the next
+ * edge after waking, the true sleep length is the DS3231 seconds elapsed
+ * minus the time since boot. ROM boot time is not counted, which biases
+ * the estimate by a few ppm on a one hour sleep.
+ */
+void rtc_drift_measure(void){
+  int64_t second;
+
+  if (drift.magic != DRIFT_MAGIC || !drift.pending) {
+    return;
+  }
+  drift.pending = false;
+  if (!rtc_wait_edge(&second)) {
+    Serial.println("drift calibration: DS3231 not ticking");
+    return;
+  }
+
+  int64_t elapsed_us = (second - drift.start_rtc) * 1000000LL - esp_timer_get_time();
+  float sample = ((double)elapsed_us / drift.requested_us - 1.0) * 1e6;
+  if (fabsf(sample) > DRIFT_MAX_PPM) {
+    Serial.printf("drift calibration: %.0f ppm rejected\n", sample);
+    return;
+  }
+
+  uint32_t samples = rtc_drift_samples();
+  float ppm = samples ? rtc_drift_ppm() + (sample - rtc_drift_ppm()) / 4 : sample;
+  preferences.putFloat("drift_ppm", ppm);
+  preferences.putULong("drift_n", samples + 1);
+  boot_cache_invalidate();
+  Serial.printf("timer drift %.0f ppm, estimate %.0f ppm after %u samples\n", sample, ppm, samples + 1);
+}
+
+int64_t rtc_wake_arm(int64_t wake_us){
+  struct timeval now;
+  int64_t wake_time = wake_us / 1000000LL;
+
+  if (drift.magic != DRIFT_MAGIC) {
+    memset(&drift, 0, sizeof(drift));
+    drift.magic = DRIFT_MAGIC;
+  }
+  gettimeofday(&now, NULL);
+
+  if (wake_source() == WAKE_ALARM) {
+    rtc_bus_begin();
+    if (wake_time <= now.tv_sec + 1) {
+      wake_time = now.tv_sec + 2;
+    }
+    if (wake_time - now.tv_sec > ALARM_MAX_AHEAD) {
+      wake_time = now.tv_sec + ALARM_MAX_AHEAD;
+    }
+    rtc.clearAlarm(1);
+    rtc.disableAlarm(2);
+    rtc.writeSqwPinMode(DS3231_OFF); // INT/SQW as alarm interrupt output
+    if (rtc.setAlarm1(epoch_to_rtc(wake_time), DS3231_A1_Date)) {
+      rtc_gpio_pullup_en(RTC_INT_PIN);
+      rtc_gpio_pulldown_dis(RTC_INT_PIN);
+      esp_sleep_enable_ext0_wakeup(RTC_INT_PIN, 0);
+      Serial.printf("DS3231 alarm set for %lld\n", (long long)wake_time);
+      return wake_time * 1000000LL;
+    }
+    Serial.println("DS3231 alarm failed, using the timer");
+  }
+  // a valid warm boot cache means an earlier wake in timer mode already disabled the alarm
+  if (!boot_cache_valid() || wake_source() == WAKE_ALARM) {
+    rtc_bus_begin();
+    rtc.disableAlarm(1);
+    rtc.clearAlarm(1);
+  }
+
+  int64_t sleep_us = wake_us - ((int64_t)now.tv_sec * 1000000LL + now.tv_usec);
+  uint32_t samples = rtc_drift_samples();
+  int64_t second;
+
+  // every so often start a long sleep on a DS3231 edge to measure the timer against it
+  bool calibrate = sleep_us >= DRIFT_MIN_SLEEP_S * 1000000LL &&
+                   (samples == 0 || drift.wakes >= DRIFT_CAL_INTERVAL);
+  if (calibrate) {
+    rtc_bus_begin();
+  }
+  if (calibrate && rtc_wait_edge(&second)) {
+    // the edge is also the exact time, the clock was only set to the whole second at boot
+    now.tv_sec = second;
+    now.tv_usec = 0;
+    settimeofday(&now, NULL);
+    sleep_us = wake_us - second * 1000000LL;
+    drift.pending = true;
+    drift.start_rtc = second;
+    drift.wakes = 0;
+  } else {
+    drift.wakes++;
+  }
+  if (sleep_us < 1000000LL) {
+    sleep_us = 1000000LL;
+  }
+
+  // with a positive drift the timer sleeps (1 + ppm) times longer than asked
+  drift.requested_us = (uint64_t)(sleep_us / (1.0 + rtc_drift_ppm() / 1e6));
+  esp_sleep_enable_timer_wakeup(drift.requested_us);
+  return (int64_t)now.tv_sec * 1000000LL + now.tv_usec + sleep_us;
+}
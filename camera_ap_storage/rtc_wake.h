@@ -0,0 +1,51 @@
+/*
+ * Wakeup source for the trail camera: either the ESP32 RTC timer, whose
+ * RC oscillator drift is measured against the DS3231 and corrected, or the
+ * DS3231 alarm pulling its INT/SQW line low on RTC_INT_PIN (EXT0).
+ */
+#ifndef _RTC_WAKE_H_
+#define _RTC_WAKE_H_
+
+#include <stdint.h>
+#include <time.h>
+#include "RTClib.h"
+
+#define WAKE_TIMER 't'   // ESP32 RTC timer, drift corrected
+#define WAKE_ALARM 'a'   // DS3231 alarm 1 on RTC_INT_PIN
+
+#define I2C_SDA 14
+#define I2C_SCL 15
+
+// DS3231 INT/SQW, open drain. GPIO 13 is also SD D3, so the card runs 1-bit in alarm mode
+#define RTC_INT_PIN GPIO_NUM_13
+
+#define DRIFT_MIN_SLEEP_S  (60*60) // shorter sleeps are too coarse to calibrate on
+#define DRIFT_CAL_INTERVAL 24      // timer wakes between calibrations once an estimate exists
+
+// the DS3231 holds UTC, months 1-12
+time_t rtc_to_epoch(const DateTime &dt);
+DateTime epoch_to_rtc(time_t t);
+
+char wake_source(void);
+
+// take GPIO 14/15 back from the SD card for I2C
+void rtc_bus_begin(void);
+
+// on an EXT0 wake, check the DS3231 alarm caused it and release INT
+bool rtc_alarm_fired(void);
+
+// on a timer wake, finish a pending drift measurement
+void rtc_drift_measure(void);
+float rtc_drift_ppm(void);
+uint32_t rtc_drift_samples(void);
+// the coming timer wake ends a calibration sleep, the clock must be read from the DS3231
+bool rtc_drift_pending(void);
+
+/*
+ * Program the next wakeup for the given epoch time in microseconds, call
+ * just before esp_deep_sleep_start(). Returns the wake time actually armed,
+ * the DS3231 alarm rounds down to the second.
+ */
+int64_t rtc_wake_arm(int64_t wake_us);
+
+#endif
@@ -0,0 +1,393 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "schedule.h"
+
+#define MINUTES_PER_DAY (24*60)
+
+/*
+ * Convert seconds after local midnight of the given day to epoch time,
+ * reading the wall time with the given tm_isdst (-1 lets mktime pick).
+ */
+static int64_t wall_to_epoch(const struct tm *day, int64_t seconds, int isdst){
+  struct tm tm = *day;
+
+  // spell out the fields, mktime would apply midnight's UTC offset to an overflowed tm_sec
+  tm.tm_hour = seconds / 3600;
+  tm.tm_min = (seconds / 60) % 60;
+  tm.tm_sec = seconds % 60;
+  tm.tm_isdst = isdst;
+  return (int64_t)mktime(&tm);
+}
+
+static bool shows_wall_time(int64_t t, int64_t seconds){
+  time_t tt = (time_t)t;
+  struct tm tm;
+
+  localtime_r(&tt, &tm);
+  return tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec == seconds;
+}
+
+// does t read as the wall time seconds on day, or later?
+static bool at_or_after_wall_time(int64_t t, const struct tm *day, int64_t seconds){
+  time_t tt = (time_t)t;
+  struct tm tm;
+
+  localtime_r(&tt, &tm);
+  if (tm.tm_year != day->tm_year || tm.tm_mon != day->tm_mon || tm.tm_mday != day->tm_mday) {
+    return tm.tm_year > day->tm_year || (tm.tm_year == day->tm_year && (tm.tm_mon > day->tm_mon ||
+           (tm.tm_mon == day->tm_mon && tm.tm_mday > day->tm_mday)));
+  }
+  return tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec >= seconds;
+}
+
+/*
+ * Earliest instant after `after` showing the given wall time. When clocks
+ * go back an hour a wall time happens twice, so the readings an hour either
+ * side are checked too. When they go forward it does not exist, and the
+ * capture is taken as the clocks change; mktime's normalized time can be
+ * an hour past captures that do exist, so the change is searched for.
+ */
+static int64_t wall_time(const struct tm *day, int64_t seconds, int64_t after){
+  int64_t t = wall_to_epoch(day, seconds, -1);
+
+  for (int64_t candidate = t - 3600; candidate <= t + 3600; candidate += 3600) {
+    if (candidate > after && shows_wall_time(candidate, seconds)) {
+      return candidate;
+    }
+  }
+  // mktime may have put it either side of the change
+  int64_t lo = t - 3600;
+  int64_t hi = t + 3600;
+  while (lo < hi) {
+    int64_t mid = lo + (hi - lo) / 2;
+    if (at_or_after_wall_time(mid, day, seconds)) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+
+static int days_in_month(int year, int mon){
+  static const uint8_t days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+  year += 1900;
+  if (mon == 1 && ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0)) {
+    return 29;
+  }
+  return days[mon];
+}
+
+static int64_t periodic_next(const sched_rule_t *rule, int64_t from){
+  int64_t start = rule->start_min * 60;
+  int64_t end = rule->end_min * 60;
+  struct tm day;
+  time_t t = (time_t)from;
+  int64_t sec;
+
+  if (rule->period == 0 || start >= end || !(rule->days & SCHED_ALL_DAYS)) {
+    return SCHED_NONE;
+  }
+  localtime_r(&t, &day);
+  sec = day.tm_hour * 3600 + day.tm_min * 60 + day.tm_sec;
+
+  // today, then at most a week of days until the mask matches
+  for (int d = 0; d <= 7; d++) {
+    if (d > 0) {
+      day.tm_mday += 1;
+      day.tm_hour = 12;
+      day.tm_min = 0;
+      day.tm_sec = 0;
+      day.tm_isdst = -1;
+      mktime(&day);
+      sec = -1;
+    }
+    if (!(rule->days & (1 << day.tm_wday))) {
+      continue;
+    }
+    int64_t offset = start;
+    if (sec >= start) {
+      offset = start + ((sec - start) / rule->period + 1) * rule->period;
+    }
+    if (offset < end) {
+      int64_t fire = wall_time(&day, offset, from);
+      if (fire > from) {
+        return fire;
+      }
+    }
+  }
+  return SCHED_NONE;
+}
+
+static int64_t monthly_next(const sched_rule_t *rule, int64_t from){
+  struct tm month;
+  time_t t = (time_t)from;
+
+  if (rule->mday == 0) {
+    return SCHED_NONE;
+  }
+  localtime_r(&t, &month);
+
+  // this month, otherwise next month always fires later
+  for (int i = 0; i < 2; i++) {
+    struct tm day = month;
+    int last = days_in_month(month.tm_year, month.tm_mon);
+    day.tm_mday = rule->mday < last ? rule->mday : last;
+    int64_t fire = wall_time(&day, rule->start_min * 60, from);
+    if (fire > from) {
+      return fire;
+    }
+    month.tm_mday = 1;
+    if (++month.tm_mon == 12) {
+      month.tm_mon = 0;
+      month.tm_year++;
+    }
+  }
+  return SCHED_NONE;
+}
+
+int64_t sched_rule_next(const sched_rule_t *rule, int64_t now){
+  // rules never fire before their not-before time
+  int64_t from = (rule->at > now) ? rule->at - 1 : now;
+
+  switch (rule->kind) {
+    case SCHED_PERIODIC:
+      return periodic_next(rule, from);
+    case SCHED_MONTHLY:
+      return monthly_next(rule, from);
+    case SCHED_ONESHOT:
+      return (rule->at > now) ? rule->at : SCHED_NONE;
+    default:
+      return SCHED_NONE;
+  }
+}
+
+int64_t schedule_next(const schedule_t *schedule, int64_t now){
+  int64_t next = SCHED_NONE;
+
+  for (int i = 0; i < schedule->count; i++) {
+    int64_t t = sched_rule_next(&schedule->rules[i], now);
+    if (t < next) {
+      next = t;
+    }
+  }
+  return next;
+}
+
+int schedule_count(const schedule_t *schedule, int64_t from, int64_t to, int limit){
+  int count = 0;
+
+  for (int64_t t = schedule_next(schedule, from - 1); t < to && count < limit; t = schedule_next(schedule, t)) {
+    count++;
+  }
+  return count;
+}
+
+float schedule_per_day(const schedule_t *schedule, int64_t now){
+  float per_day = 0;
+
+  for (int i = 0; i < schedule->count; i++) {
+    const sched_rule_t *r = &schedule->rules[i];
+    if (r->at > now + 7*24*3600) {
+      continue;
+    }
+    switch (r->kind) {
+      case SCHED_PERIODIC: {
+        int64_t window = (r->end_min - r->start_min) * 60;
+        if (r->period && window > 0) {
+          per_day += (float)((window + r->period - 1) / r->period) * __builtin_popcount(r->days & SCHED_ALL_DAYS) / 7;
+        }
+        break;
+      }
+      case SCHED_MONTHLY:
+        per_day += r->mday ? 12.0f / 365 : 0;
+        break;
+      case SCHED_ONESHOT:
+        per_day += r->at > now ? 1.0f / 7 : 0;
+        break;
+    }
+  }
+  return per_day;
+}
+
+/*
+ * Parsing helpers, each consumes one field and the separator after it.
+ */
+static bool parse_number(const char **p, int64_t *value, int64_t min, int64_t max){
+  char *end;
+
+  *value = strtoll(*p, &end, 10);
+  if (end == *p || *value < min || *value > max) {
+    return false;
+  }
+  *p = end;
+  return true;
+}
+
+static bool parse_clock(const char **p, uint16_t *minutes){
+  int64_t h, m;
+
+  if (!parse_number(p, &h, 0, 24) || **p != ':') {
+    return false;
+  }
+  (*p)++;
+  if (!parse_number(p, &m, 0, 59) || h * 60 + m > MINUTES_PER_DAY) {
+    return false;
+  }
+  *minutes = h * 60 + m;
+  return true;
+}
+
+static bool parse_separator(const char **p){
+  if (**p != ',') {
+    return false;
+  }
+  (*p)++;
+  return true;
+}
+
+static bool at_rule_end(const char *p){
+  return *p == ';' || *p == 0;
+}
+
+static bool parse_rule(const char **p, sched_rule_t *rule){
+  int64_t v;
+
+  memset(rule, 0, sizeof(sched_rule_t));
+  rule->kind = **p;
+  (*p)++;
+  if (!parse_separator(p)) {
+    return false;
+  }
+  switch (rule->kind) {
+    case SCHED_PERIODIC:
+      if (!parse_number(p, &v, 1, SCHED_ALL_DAYS) || !parse_separator(p)) {
+        return false;
+      }
+      rule->days = v;
+      if (!parse_clock(p, &rule->start_min) || !parse_separator(p) ||
+          !parse_clock(p, &rule->end_min) || !parse_separator(p) ||
+          !parse_number(p, &v, 1, 60*60*24) || rule->start_min >= rule->end_min) {
+        return false;
+      }
+      rule->period = v;
+      break;
+    case SCHED_MONTHLY:
+      if (!parse_number(p, &v, 1, 31) || !parse_separator(p) ||
+          !parse_clock(p, &rule->start_min) || rule->start_min >= MINUTES_PER_DAY) {
+        return false;
+      }
+      rule->mday = v;
+      break;
+    case SCHED_ONESHOT:
+      return parse_number(p, &rule->at, 0, INT64_MAX) && at_rule_end(*p);
+    default:
+      return false;
+  }
+  // optional not-before time
+  if (**p == ',') {
+    (*p)++;
+    if (!parse_number(p, &rule->at, 0, INT64_MAX)) {
+      return false;
+    }
+  }
+  return at_rule_end(*p);
+}
+
+int schedule_parse(schedule_t *schedule, const char *text){
+  const char *p = text;
+
+  schedule->count = 0;
+  while (*p) {
+    if (schedule->count == SCHED_MAX_RULES ||
+        !parse_rule(&p, &schedule->rules[schedule->count])) {
+      schedule->count = 0;
+      return -1;
+    }
+    schedule->count++;
+    if (*p == ';') {
+      p++;
+    }
+  }
+  return 0;
+}
+
+int schedule_format(const schedule_t *schedule, char *text, size_t size){
+  size_t len = 0;
+
+  text[0] = 0;
+  for (int i = 0; i < schedule->count; i++) {
+    const sched_rule_t *r = &schedule->rules[i];
+    int n = 0;
+
+    switch (r->kind) {
+      case SCHED_PERIODIC:
+        n = snprintf(text + len, size - len, "%sp,%u,%02u:%02u,%02u:%02u,%lu", i ? ";" : "",
+                     r->days, r->start_min / 60, r->start_min % 60,
+                     r->end_min / 60, r->end_min % 60, (unsigned long)r->period);
+        break;
+      case SCHED_MONTHLY:
+        n = snprintf(text + len, size - len, "%sm,%u,%02u:%02u", i ? ";" : "",
+                     r->mday, r->start_min / 60, r->start_min % 60);
+        break;
+      case SCHED_ONESHOT:
+        n = snprintf(text + len, size - len, "%so,%lld", i ? ";" : "", (long long)r->at);
+        break;
+    }
+    if (n < 0 || (size_t)n >= size - len) {
+      return -1;
+    }
+    len += n;
+    if (r->kind != SCHED_ONESHOT && r->at) {
+      n = snprintf(text + len, size - len, ",%lld", (long long)r->at);
+      if (n < 0 || (size_t)n >= size - len) {
+        return -1;
+      }
+      len += n;
+    }
+  }
+  return len;
+}
+
+void schedule_from_legacy(schedule_t *schedule, char frequency, int64_t start_time){
+  sched_rule_t *rule = &schedule->rules[0];
+  time_t t = (time_t)start_time;
+  struct tm tm;
+
+  localtime_r(&t, &tm);
+  memset(rule, 0, sizeof(sched_rule_t));
+  rule->kind = SCHED_PERIODIC;
+  rule->days = SCHED_ALL_DAYS;
+  rule->start_min = tm.tm_hour * 60 + tm.tm_min;
+  rule->end_min = MINUTES_PER_DAY;
+  rule->at = start_time;
+  schedule->count = 1;
+
+  switch (frequency) {
+    case 'M': // minute
+      rule->start_min = 0;
+      rule->period = 60;
+      break;
+    case 'H': // hour
+      rule->start_min = tm.tm_min;
+      rule->period = 60*60;
+      break;
+    case 'd': // day
+      rule->period = 60*60*24;
+      break;
+    case 'w': // week
+      rule->days = 1 << tm.tm_wday;
+      rule->period = 60*60*24;
+      break;
+    case 'm': // month, on the same day of every calendar month
+      rule->kind = SCHED_MONTHLY;
+      rule->mday = tm.tm_mday;
+      break;
+    default:
+      schedule->count = 0;
+      break;
+  }
+}
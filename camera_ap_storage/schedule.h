@@ -0,0 +1,73 @@
+/*
+ * Capture schedule made of independent rules. Every rule works in local
+ * wall-clock time (set TZ before calling), so windows like "06:00-20:00"
+ * keep their meaning across daylight savings changes.
+ *
+ * Text form, rules separated by ';':
+ *   p,<days>,<HH:MM>,<HH:MM>,<period s>[,<not before>]  every period inside a daily window
+ *   m,<day of month>,<HH:MM>[,<not before>]              once a month
+ *   o,<time>                                            once
+ * <days> is a weekday mask with bit 0 = Sunday, times are seconds since epoch.
+ * Example: "p,62,06:00,20:00,600" is every 10 minutes from 06:00 to 20:00 on weekdays.
+ */
+#ifndef _SCHEDULE_H_
+#define _SCHEDULE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SCHED_MAX_RULES 8
+#define SCHED_TEXT_MAX  384
+#define SCHED_NONE      INT64_MAX  // no rule fires again
+#define SCHED_DEFAULT_TZ "UTC0"    // POSIX TZ, with it the RTC simply holds local time
+
+#define SCHED_PERIODIC 'p'
+#define SCHED_MONTHLY  'm'
+#define SCHED_ONESHOT  'o'
+
+#define SCHED_ALL_DAYS 0x7f
+#define SCHED_WEEKDAYS 0x3e
+
+typedef struct {
+  char kind;           // SCHED_PERIODIC, SCHED_MONTHLY or SCHED_ONESHOT
+  uint8_t days;        // weekday mask, bit 0 = Sunday (periodic)
+  uint8_t mday;        // day of month, clamped to the month length (monthly)
+  uint16_t start_min;  // window start / time of day, minutes after local midnight
+  uint16_t end_min;    // window end, exclusive, 1440 = midnight (periodic)
+  uint32_t period;     // seconds between captures inside the window (periodic)
+  int64_t at;          // not-before time (periodic, monthly) or capture time (one-shot)
+} sched_rule_t;
+
+typedef struct {
+  uint8_t count;
+  sched_rule_t rules[SCHED_MAX_RULES];
+} schedule_t;
+
+/*
+ * Earliest capture time strictly after now, or SCHED_NONE. Each rule is
+ * solved directly, so the cost is O(rules) whatever the period.
+ */
+int64_t schedule_next(const schedule_t *schedule, int64_t now);
+int64_t sched_rule_next(const sched_rule_t *rule, int64_t now);
+
+// captures in [from, to), stopping at limit
+int schedule_count(const schedule_t *schedule, int64_t from, int64_t to, int limit);
+
+/*
+ * Average captures a day from now on, solved per rule instead of by
+ * walking the captures: the window over the period on the selected
+ * weekdays, 12 a year for a monthly rule and a one-shot in the coming
+ * week as 1/7. Rules not due to start within a week are left out, and
+ * captures two rules share are counted for each.
+ */
+float schedule_per_day(const schedule_t *schedule, int64_t now);
+
+// returns 0 on success, -1 when the text is malformed
+int schedule_parse(schedule_t *schedule, const char *text);
+// returns the text length, or -1 when it does not fit
+int schedule_format(const schedule_t *schedule, char *text, size_t size);
+
+// single rule equivalent to the old start_time + frequency settings
+void schedule_from_legacy(schedule_t *schedule, char frequency, int64_t start_time);
+
+#endif
@@ -0,0 +1,194 @@
+#include <Arduino.h>
+#include <Preferences.h>
+#include <SD_MMC.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "esp_heap_caps.h"
+#include "esp_idf_version.h"
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+#include "esp_memory_utils.h"
+#else
+#include "soc/soc_memory_layout.h"
+#endif
+#include "ff.h"
+#include "sd_writer.h"
+#include "metrics.h"
+#include "boot_cache.h"
+#include "rtc_wake.h"
+
+extern Preferences preferences;
+
+const uint16_t sd_hist_bounds_ms[SD_HIST_BUCKETS - 1] = { 1, 2, 5, 10, 20, 50, 100 };
+
+static uint8_t * dma_buf;      // allocated on first use and kept, internal RAM
+RTC_DATA_ATTR static uint32_t cluster_size;
+
+bool sd_mount_with(int bus, int khz){
+  if (wake_source() == WAKE_ALARM) {
+    bus = SD_BUS_1BIT; // GPIO 13 is the DS3231 INT line, not D3
+  }
+  return SD_MMC.begin(SD_MOUNT_POINT, bus == SD_BUS_1BIT, false, khz);
+}
+
+bool sd_mount(void){
+  if (boot_cache_valid()) {
+    return sd_mount_with(boot_cache.sd_bus, boot_cache.sd_khz);
+  }
+  return sd_mount_with(preferences.getUChar("sd_bus", SD_BUS_4BIT), preferences.getUShort("sd_khz", BOARD_MAX_SDMMC_FREQ));
+}
+
+/*
+ * The card is the first FatFs drive. f_getfree() is quick once FSINFO is
+ * read, and the answer is kept in RTC memory across deep sleep.
+ */
+size_t sd_cluster_size(void){
+  FATFS * fs;
+  DWORD free_clusters;
+
+  if (!cluster_size) {
+    if (f_getfree("0:", &free_clusters, &fs) == FR_OK) {
+      cluster_size = fs->csize * 512; // SD cards always have 512 byte sectors
+    } else {
+      return SD_DEFAULT_CLUSTER;
+    }
+  }
+  return cluster_size;
+}
+
+int64_t sd_free_bytes(void){
+  FATFS * fs;
+  DWORD free_clusters;
+
+  if (f_getfree("0:", &free_clusters, &fs) != FR_OK) {
+    return -1;
+  }
+  cluster_size = fs->csize * 512;
+  return (int64_t)free_clusters * cluster_size;
+}
+
+static void sd_record_latency(sd_writer_t * w, int64_t us){
+  int bucket = 0;
+
+  if (!w->histogram) {
+    return;
+  }
+  while (bucket < SD_HIST_BUCKETS - 1 && us >= sd_hist_bounds_ms[bucket] * 1000LL) {
+    bucket++;
+  }
+  w->histogram[bucket]++;
+}
+
+static esp_err_t sd_write_raw(sd_writer_t * w, const void * data, size_t len){
+  int64_t start = esp_timer_get_time();
+  ssize_t n = write(w->fd, data, len);
+  int64_t us = esp_timer_get_time() - start;
+
+  sd_record_latency(w, us);
+  metrics_observe_us(MET_SD_WRITE_LATENCY, us);
+  metrics_inc(MET_SD_WRITES);
+  if (n != (ssize_t)len) {
+    metrics_inc(MET_SD_WRITE_ERRORS);
+    w->failed = true;
+    return ESP_FAIL;
+  }
+  metrics_add(MET_SD_WRITE_BYTES, len);
+  w->written += len;
+  return ESP_OK;
+}
+
+static esp_err_t sd_flush(sd_writer_t * w){
+  esp_err_t err = ESP_OK;
+
+  if (w->fill) {
+    err = sd_write_raw(w, dma_buf, w->fill);
+    w->fill = 0;
+  }
+  return err;
+}
+
+esp_err_t sd_writer_open(sd_writer_t * w, const char * path, size_t expected){
+  char full[64];
+
+  memset(w, 0, sizeof(*w));
+  w->fd = -1;
+  if (!dma_buf) {
+    dma_buf = (uint8_t *)heap_caps_malloc(SD_WRITER_BLOCK, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if (!dma_buf) {
+      return ESP_ERR_NO_MEM;
+    }
+  }
+  snprintf(full, sizeof(full), "%s%s", SD_MOUNT_POINT, path);
+  w->fd = open(full, O_WRONLY | O_CREAT | O_TRUNC);
+  if (w->fd < 0) {
+    return ESP_FAIL;
+  }
+
+  // seeking past the end of a file open for writing makes FatFs allocate the clusters
+  if (expected) {
+    size_t cluster = sd_cluster_size();
+    size_t reserve = (expected + cluster - 1) / cluster * cluster;
+    if (lseek(w->fd, reserve, SEEK_SET) == (off_t)reserve) {
+      w->reserved = reserve;
+    }
+    lseek(w->fd, 0, SEEK_SET);
+  }
+  return ESP_OK;
+}
+
+esp_err_t sd_writer_write(sd_writer_t * w, const void * data, size_t len){
+  const uint8_t * src = (const uint8_t *)data;
+
+  if (w->failed) {
+    return ESP_FAIL;
+  }
+  while (len) {
+    // whole blocks from memory the SDMMC DMA can read go down without a copy
+    if (!w->fill && len >= SD_WRITER_BLOCK && esp_ptr_dma_capable(src) && ((uintptr_t)src & 3) == 0) {
+      size_t span = len / SD_WRITER_BLOCK * SD_WRITER_BLOCK;
+      if (sd_write_raw(w, src, span) != ESP_OK) {
+        return ESP_FAIL;
+      }
+      src += span;
+      len -= span;
+      continue;
+    }
+    size_t n = min(len, (size_t)SD_WRITER_BLOCK - w->fill);
+    memcpy(dma_buf + w->fill, src, n);
+    w->fill += n;
+    src += n;
+    len -= n;
+    if (w->fill == SD_WRITER_BLOCK && sd_flush(w) != ESP_OK) {
+      return ESP_FAIL;
+    }
+  }
+  return ESP_OK;
+}
+
+esp_err_t sd_writer_writev(sd_writer_t * w, const sd_chunk_t * chunks, int count){
+  for (int i = 0; i < count; i++) {
+    if (sd_writer_write(w, chunks[i].data, chunks[i].len) != ESP_OK) {
+      return ESP_FAIL;
+    }
+  }
+  return ESP_OK;
+}
+
+esp_err_t sd_writer_close(sd_writer_t * w){
+  esp_err_t err = ESP_OK;
+
+  if (w->fd < 0) {
+    return ESP_FAIL;
+  }
+  if (!w->failed) {
+    err = sd_flush(w);
+  }
+  // give back what the preallocation took beyond the data
+  if (w->reserved > w->written && ftruncate(w->fd, w->written) != 0) {
+    err = ESP_FAIL;
+  }
+  if (close(w->fd) != 0 || w->failed) {
+    err = ESP_FAIL;
+  }
+  w->fd = -1;
+  return err;
+}
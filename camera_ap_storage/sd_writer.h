@@ -0,0 +1,65 @@
+/*
+ * Captures are written with POSIX calls straight into FatFs rather than
+ * through fs::File. The file is preallocated to its expected size, so the
+ * cluster chain is built once, and data goes down in cluster aligned
+ * blocks from an internal DMA capable buffer. The SDMMC driver would
+ * otherwise bounce PSRAM frame buffers through its own buffer one 512
+ * byte sector at a time.
+ */
+#ifndef _SD_WRITER_H_
+#define _SD_WRITER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#define SD_MOUNT_POINT "/sdcard"
+#define SD_WRITER_BLOCK (16*1024)    // divides or is a multiple of every FAT cluster size
+#define SD_DEFAULT_CLUSTER (32*1024) // when the card cannot be asked
+
+// bus width and clock, preferences "sd_bus" (1 or 4) and "sd_khz"
+#define SD_BUS_1BIT 1
+#define SD_BUS_4BIT 4
+
+// write latency histogram buckets, upper bounds in ms, the last bucket is open
+#define SD_HIST_BUCKETS 8
+extern const uint16_t sd_hist_bounds_ms[SD_HIST_BUCKETS - 1];
+
+typedef struct {
+  int fd;
+  size_t written;
+  size_t reserved;        // preallocated size, truncated back to written on close
+  size_t fill;            // bytes waiting in the DMA buffer
+  uint32_t * histogram;   // optional SD_HIST_BUCKETS counters of write() latency
+  bool failed;
+} sd_writer_t;
+
+/*
+ * Mount at SD_MOUNT_POINT with the stored bus width and clock. The
+ * DS3231 alarm needs GPIO 13, so in alarm mode the card runs 1-bit.
+ */
+bool sd_mount(void);
+bool sd_mount_with(int bus, int khz);
+
+// cluster size of the mounted card
+size_t sd_cluster_size(void);
+// free space on the mounted card, -1 when it cannot be read
+int64_t sd_free_bytes(void);
+
+/*
+ * Only one writer can be open at a time, they share the DMA buffer.
+ * path is relative to the mount point.
+ */
+esp_err_t sd_writer_open(sd_writer_t * w, const char * path, size_t expected);
+esp_err_t sd_writer_write(sd_writer_t * w, const void * data, size_t len);
+
+typedef struct {
+  const void * data;
+  size_t len;
+} sd_chunk_t;
+
+// the chunks back to back, as one write, e.g. a header built in place and a frame buffer
+esp_err_t sd_writer_writev(sd_writer_t * w, const sd_chunk_t * chunks, int count);
+esp_err_t sd_writer_close(sd_writer_t * w);
+
+#endif
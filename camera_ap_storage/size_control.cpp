@@ -0,0 +1,144 @@
+#include <Arduino.h>
+#include <Preferences.h>
+#include <math.h>
+#include "size_control.h"
+#include "boot_cache.h"
+#include "rtc_state.h"
+
+#define SIZE_MAGIC 0x4c544353  // "SCTL"
+#define SIZE_MIN_STEP 0.05f    // ln quality apart for two captures to say anything about the slope
+
+extern Preferences preferences;
+
+typedef struct {
+  uint32_t magic;
+  uint32_t target;
+  uint8_t framesize;
+  uint8_t quality;             // the sensor is set to it for the next capture
+  float detail;                // ln bytes the scene would take at quality 1
+  float slope;
+  uint32_t samples;
+  uint32_t within;
+  float error_sum;             // percent of the target
+  float error_sq_sum;
+  float abs_error_sum;
+  float last_error;
+  uint32_t last_bytes;
+} size_state_t;
+
+RTC_DATA_ATTR static size_state_t size_state;
+
+// the last capture of this wake, when there was one, for the slope
+static bool prev_valid;
+static float prev_log_q;
+static float prev_log_bytes;
+
+uint32_t size_control_target(void){
+  if (boot_cache_valid()) {
+    return boot_cache.size_kb * 1024UL;
+  }
+  return preferences.getUShort("size_kb", 0) * 1024UL;
+}
+
+static void size_control_reset(int framesize){
+  size_state.framesize = framesize;
+  size_state.slope = SIZE_DEFAULT_SLOPE;
+  size_state.samples = 0;
+  size_state.within = 0;
+  size_state.error_sum = 0;
+  size_state.error_sq_sum = 0;
+  size_state.abs_error_sum = 0;
+  size_state.last_error = 0;
+  size_state.last_bytes = 0;
+  prev_valid = false;
+}
+
+static void size_control_begin(uint32_t target, int stored){
+  if (size_state.magic != SIZE_MAGIC) {
+    rtc_state_restore("size_ctl", &size_state, sizeof(size_state), SIZE_MAGIC);
+  }
+  if (size_state.target != target) {
+    size_state.target = target;
+    size_state.quality = constrain(stored, SIZE_QUALITY_MIN, SIZE_QUALITY_MAX);
+    size_control_reset(-1);
+  }
+}
+
+int size_control_quality(int stored){
+  uint32_t target = size_control_target();
+  if (!target) {
+    return stored;
+  }
+  size_control_begin(target, stored);
+  return size_state.quality;
+}
+
+int size_control_record(int framesize, size_t len){
+  uint32_t target = size_control_target();
+  if (!target || !len) {
+    return -1;
+  }
+  size_control_begin(target, size_state.quality);
+  if (size_state.framesize != framesize) {
+    size_control_reset(framesize); // the detail is per framesize
+  }
+
+  int taken = size_state.quality;
+  float log_q = logf(taken);
+  float log_bytes = logf(len);
+  // two captures of one wake show the same scene, the slope is what differs
+  if (prev_valid && fabsf(log_q - prev_log_q) > SIZE_MIN_STEP) {
+    float slope = (log_bytes - prev_log_bytes) / (log_q - prev_log_q);
+    slope = constrain(slope, -2.5f, -0.3f);
+    size_state.slope += SIZE_SLOPE_GAIN * (slope - size_state.slope);
+  }
+  prev_valid = true;
+  prev_log_q = log_q;
+  prev_log_bytes = log_bytes;
+
+  float detail = log_bytes - size_state.slope * log_q;
+  if (size_state.samples) {
+    size_state.detail += SIZE_DETAIL_GAIN * (detail - size_state.detail);
+  } else {
+    size_state.detail = detail;
+  }
+
+  float error = 100.0f * ((float)len - target) / target;
+  size_state.samples++;
+  size_state.within += fabsf(error) <= SIZE_WITHIN_PCT;
+  size_state.error_sum += error;
+  size_state.error_sq_sum += error * error;
+  size_state.abs_error_sum += fabsf(error);
+  size_state.last_error = error;
+  size_state.last_bytes = len;
+
+  float quality = expf((logf(target) - size_state.detail) / size_state.slope);
+  size_state.quality = constrain((int)lroundf(quality), SIZE_QUALITY_MIN, SIZE_QUALITY_MAX);
+  Serial.printf("size control: %u B at quality %d (%+.0f%%), next %u\n", (unsigned)len, taken, error,
+                size_state.quality);
+
+  rtc_state_save_every("size_ctl", &size_state, sizeof(size_state), size_state.samples, SIZE_SAVE_INTERVAL);
+  return size_state.quality;
+}
+
+void size_control_get_stats(size_control_stats_t * stats){
+  uint32_t n = size_state.magic == SIZE_MAGIC ? size_state.samples : 0;
+
+  memset(stats, 0, sizeof(*stats));
+  stats->target = size_control_target();
+  if (!n || size_state.target != stats->target) {
+    stats->quality = size_state.magic == SIZE_MAGIC ? size_state.quality : 0;
+    stats->slope = SIZE_DEFAULT_SLOPE;
+    return;
+  }
+  float mean = size_state.error_sum / n;
+  stats->quality = size_state.quality;
+  stats->slope = size_state.slope;
+  stats->samples = n;
+  stats->last_bytes = size_state.last_bytes;
+  stats->last_error_pct = size_state.last_error;
+  stats->mean_error_pct = mean;
+  stats->mean_abs_error_pct = size_state.abs_error_sum / n;
+  stats->std_error_pct = sqrtf(fmaxf(size_state.error_sq_sum / n - mean * mean, 0));
+  stats->within_pct = 100.0f * size_state.within / n;
+}
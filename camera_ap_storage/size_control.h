@@ -0,0 +1,58 @@
+/*
+ * JPEG size control. At a fixed quality a photo of foliage can be
+ * several times the size of one of sky or of the night, so how long a
+ * card lasts is hard to tell. With a target set ("size_kb") the quality
+ * is chosen for each capture instead, from a model of how the size
+ * follows the quality for the current scene:
+ *
+ *   ln(bytes) = detail + slope * ln(quality)
+ *
+ * Every capture updates the scene's detail from its size and the quality
+ * it was taken at, two captures of the same wake at different qualities
+ * update the slope, and the quality for the next capture is solved from
+ * the model for the target. The model and the error against the target
+ * live in RTC memory with a copy in NVS.
+ */
+#ifndef _SIZE_CONTROL_H_
+#define _SIZE_CONTROL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SIZE_QUALITY_MIN 8          // finer risks overflowing the frame buffer on a busy scene
+#define SIZE_QUALITY_MAX 63
+#define SIZE_DETAIL_GAIN 0.5f       // weight of the newest capture in the scene's detail
+#define SIZE_SLOPE_GAIN 0.2f
+#define SIZE_DEFAULT_SLOPE -1.0f    // size about inversely proportional to quality
+#define SIZE_WITHIN_PCT 10          // captures this close to the target count as on target
+#define SIZE_SAVE_INTERVAL 32       // captures between copies of the state to NVS
+
+typedef struct {
+  uint32_t target;                  // bytes, 0 when size control is off
+  uint8_t quality;                  // for the next capture
+  float slope;
+  uint32_t samples;                 // captures since the target or framesize last changed
+  uint32_t last_bytes;
+  float last_error_pct;             // (size - target) / target
+  float mean_error_pct;
+  float mean_abs_error_pct;
+  float std_error_pct;
+  float within_pct;                 // of captures within SIZE_WITHIN_PCT of the target
+} size_control_stats_t;
+
+// preferences "size_kb", 0 for off; from the boot cache when it is valid
+uint32_t size_control_target(void);
+
+// the quality to start the camera at, stored when size control is off
+int size_control_quality(int stored);
+
+/*
+ * A capture of len bytes was taken at framesize with the quality from
+ * size_control_quality(). Returns the quality the sensor should be set
+ * to for the next one, or -1 when size control is off.
+ */
+int size_control_record(int framesize, size_t len);
+
+void size_control_get_stats(size_control_stats_t * stats);
+
+#endif
@@ -0,0 +1,116 @@
+#include <Arduino.h>
+#include <Preferences.h>
+#include "esp_camera.h"
+#include "tuner.h"
+#include "boot_cache.h"
+#include "capture_timing.h"
+
+#define TUNE_MAGIC 0x454e5554  // "TUNE"
+#define TUNE_DAYS_MAX 9999     // shown for a schedule that writes next to nothing
+
+extern Preferences preferences;
+
+static const uint8_t tune_sizes[] = { FRAMESIZE_UXGA, FRAMESIZE_SXGA, FRAMESIZE_HD, FRAMESIZE_XGA,
+                                      FRAMESIZE_SVGA, FRAMESIZE_VGA, FRAMESIZE_CIF, FRAMESIZE_QVGA };
+static const uint8_t tune_qualities[] = { 8, 10, 12, 15, 20, 25, 30, 40 };  // finest first
+
+#define TUNE_QUALITY_COUNT (sizeof(tune_qualities) / sizeof(tune_qualities[0]))
+
+void tune_project(const tune_sample_t * sample, const tune_model_t * model, tune_result_t * result){
+  // every photo of the burst is followed by the wait before the next
+  uint32_t photo_ms = sample->capture_ms + sample->write_ms + WAKE_PHOTO_SPACING_MS;
+  float bytes_day = model->wakes_per_day * WAKE_PHOTOS * sample->bytes;
+
+  result->wake_ms = model->boot_ms + sample->init_ms + WAKE_PHOTOS * photo_ms;
+  result->mb_day = bytes_day / (1024 * 1024);
+  result->bytes = sample->bytes;
+  if (model->free_bytes < 0) {
+    result->days = -1;
+  } else if (bytes_day * TUNE_DAYS_MAX <= model->free_bytes) {
+    result->days = TUNE_DAYS_MAX;
+  } else {
+    result->days = model->free_bytes / bytes_day;
+  }
+}
+
+static bool tune_within(const tune_result_t * result){
+  switch (result->target) {
+    case TUNE_WAKE_MS:
+      return result->wake_ms <= result->limit;
+    case TUNE_MB_DAY:
+      return result->mb_day <= result->limit;
+    default:
+      return result->days >= result->limit;
+  }
+}
+
+// measure one candidate into result, true when it keeps within the budget
+static bool tune_try(int size, int quality, const tune_model_t * model, tune_measure_t measure, tune_result_t * result){
+  tune_sample_t sample;
+
+  result->measured++;
+  if (!measure(size, quality, &sample)) {
+    Serial.printf("tune: framesize %d quality %d failed\n", size, quality);
+    return false;
+  }
+  result->framesize = size;
+  result->quality = quality;
+  tune_project(&sample, model, result);
+  bool within = tune_within(result);
+  Serial.printf("tune: framesize %d quality %d, %u B, %u ms a wake, %.1f MB a day, %.0f days%s\n", size, quality,
+                sample.bytes, result->wake_ms, result->mb_day, result->days, within ? "" : ", over budget");
+  return within;
+}
+
+bool tune_run(char target, float limit, const tune_model_t * model, int max_framesize,
+              tune_measure_t measure, tune_result_t * result){
+  memset(result, 0, sizeof(*result));
+  result->magic = TUNE_MAGIC;
+  result->target = target;
+  result->limit = limit;
+  result->days = -1;
+
+  for (size_t i = 0; i < sizeof(tune_sizes) && !result->met; i++) {
+    int size = tune_sizes[i];
+    if (size > max_framesize) {
+      continue;
+    }
+    // over budget at its coarsest quality, the others only take more
+    int lo = 0;
+    int hi = TUNE_QUALITY_COUNT - 1;
+    if (!tune_try(size, tune_qualities[hi], model, measure, result)) {
+      continue;
+    }
+    tune_result_t best = *result;
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (tune_try(size, tune_qualities[mid], model, measure, result)) {
+        hi = mid;
+        best = *result;
+      } else {
+        lo = mid + 1;
+      }
+    }
+    best.measured = result->measured;
+    *result = best;
+    result->met = true;
+  }
+  if (!result->quality) {
+    return false; // nothing could be measured
+  }
+
+  result->time = time(NULL);
+  if (result->met) {
+    preferences.putUInt("framesize", result->framesize);
+    preferences.putUInt("quality", result->quality);
+    boot_cache_invalidate();
+  }
+  preferences.putBytes("tune", result, sizeof(*result));
+  return true;
+}
+
+bool tune_last(tune_result_t * result){
+  return preferences.getBytesLength("tune") == sizeof(*result) &&
+         preferences.getBytes("tune", result, sizeof(*result)) == sizeof(*result) &&
+         result->magic == TUNE_MAGIC;
+}
@@ -0,0 +1,70 @@
+/*
+ * Capture settings tuner. Given a budget, either the time a capture wake
+ * may stay awake, the megabytes written a day or the days until the card
+ * is full, it measures capture time, card write time and JPEG size on
+ * the current scene. It picks the best framesize and quality that keep
+ * within the budget: the largest framesize first, then the finest
+ * quality. Size and time only grow with either, so each framesize is
+ * tried at its coarsest quality first and the rest are bisected; a
+ * handful of measurements cover the whole table. The pick and its
+ * projection are kept in NVS ("tune") for /tune and the settings page.
+ */
+#ifndef _TUNER_H_
+#define _TUNER_H_
+
+#include <stdint.h>
+
+#define TUNE_WAKE_MS 'w'          // awake ms per capture wake, at most
+#define TUNE_MB_DAY  'm'          // MB written a day, at most
+#define TUNE_DAYS    'd'          // days until the card is full, at least
+
+#define TUNE_FRAMES 3             // frames each candidate is averaged over
+#define TUNE_DEFAULT_BOOT_MS 300  // reset until the camera starts, before a wake has measured it
+
+// one candidate, as measured
+typedef struct {
+  uint16_t init_ms;               // camera start
+  uint16_t capture_ms;
+  uint16_t write_ms;              // one photo through the SD writer
+  uint32_t bytes;                 // JPEG size
+} tune_sample_t;
+
+// what turns a sample into a projection
+typedef struct {
+  uint32_t boot_ms;
+  float wakes_per_day;            // capture wakes for the current schedule
+  int64_t free_bytes;             // on the card, -1 when unknown
+} tune_model_t;
+
+typedef struct {
+  uint32_t magic;
+  char target;                    // TUNE_WAKE_MS, TUNE_MB_DAY or TUNE_DAYS
+  bool met;                       // false when even the smallest setting is over budget
+  uint8_t framesize;              // the pick, or the closest when not met
+  uint8_t quality;
+  float limit;
+  uint32_t wake_ms;               // projected for the pick
+  float mb_day;
+  float days;                     // -1 when the free space is unknown or nothing is written
+  uint32_t bytes;
+  uint16_t measured;              // candidates measured
+  uint32_t time;                  // when, epoch seconds
+} tune_result_t;
+
+// take TUNE_FRAMES photos at framesize and quality, false when the camera failed
+typedef bool (*tune_measure_t)(int framesize, int quality, tune_sample_t * sample);
+
+void tune_project(const tune_sample_t * sample, const tune_model_t * model, tune_result_t * result);
+
+/*
+ * Search the framesizes up to max_framesize for the best one in budget,
+ * fill result and, when one was met, store it as the capture profile.
+ * Returns false when the camera could not be measured at all.
+ */
+bool tune_run(char target, float limit, const tune_model_t * model, int max_framesize,
+              tune_measure_t measure, tune_result_t * result);
+
+// the last result, false when the tuner has not run
+bool tune_last(tune_result_t * result);
+
+#endif
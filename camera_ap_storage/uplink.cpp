@@ -0,0 +1,385 @@
+#include <Arduino.h>
+#include <Preferences.h>
+#include <SD_MMC.h>
+#include <WiFi.h>
+#include "uplink.h"
+#include "boot_cache.h"
+#include "catalog.h"
+#include "energy.h"
+#include "exif.h"
+#include "phash.h"
+#include "rtc_state.h"
+#include "sd_writer.h"
+
+#define UPLINK_MAGIC 0x4b4e4c55  // "ULNK"
+
+extern Preferences preferences;
+extern void station_id(char * out, size_t size);
+
+typedef struct {
+  uint32_t magic;
+  uint32_t cursor;           // first catalog record not uploaded yet
+  uint32_t offset;           // bytes of it the collector acknowledged
+  int64_t next;              // next session, 0 when not worked out yet
+  uint32_t sessions;
+  uint32_t files;            // last session, as in uplink_stats_t
+  uint32_t bytes;
+  float join_s;
+  float transfer_s;
+  float mah;
+  char error[24];
+  uint64_t total_bytes;
+  float total_mah;
+} uplink_state_t;
+
+RTC_DATA_ATTR static uplink_state_t uplink;
+
+static uplink_config_t config;
+static bool config_loaded;
+static WiFiClient client;
+
+void uplink_config_load(uplink_config_t * c){
+  char text[SCHED_TEXT_MAX];
+
+  memset(c, 0, sizeof(*c));
+  preferences.getString("up_ssid", c->ssid, sizeof(c->ssid));
+  preferences.getString("up_pass", c->pass, sizeof(c->pass));
+  preferences.getString("up_host", c->host, sizeof(c->host));
+  c->port = preferences.getUShort("up_port", UPLINK_DEFAULT_PORT);
+  c->batch = preferences.getUShort("up_batch", UPLINK_DEFAULT_BATCH);
+  if (!preferences.isKey("up_sched") || preferences.getString("up_sched", text, sizeof(text)) == 0 ||
+      schedule_parse(&c->schedule, text) != 0) {
+    c->schedule.count = 0;
+  }
+}
+
+const uplink_config_t * uplink_config(void){
+  if (boot_cache_valid()) {
+    return &boot_cache.uplink;
+  }
+  if (!config_loaded) {
+    uplink_config_load(&config);
+    config_loaded = true;
+  }
+  return &config;
+}
+
+void uplink_config_changed(void){
+  config_loaded = false;
+  uplink.next = 0;
+}
+
+static void uplink_load(void){
+  if (uplink.magic == UPLINK_MAGIC) {
+    return;
+  }
+  rtc_state_restore("uplink", &uplink, sizeof(uplink), UPLINK_MAGIC);
+  uplink.next = 0;
+}
+
+int64_t uplink_next(int64_t now){
+  const uplink_config_t * c = uplink_config();
+
+  uplink_load();
+  if (!c->ssid[0] || !c->host[0] || c->schedule.count == 0) {
+    uplink.next = 0;
+    return SCHED_NONE;
+  }
+  int64_t next = schedule_next(&c->schedule, now);
+  uplink.next = next == SCHED_NONE ? 0 : next;
+  return next;
+}
+
+bool uplink_due(void){
+  uplink_load();
+  return uplink.next && time(NULL) >= uplink.next - UPLINK_EARLY_S;
+}
+
+// percent encoding for a path segment
+static void url_encode(char * out, size_t size, const char * in){
+  static const char hex[] = "0123456789ABCDEF";
+  size_t n = 0;
+
+  for (; *in && n + 4 < size; in++) {
+    unsigned char c = *in;
+    if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
+      out[n++] = c;
+    } else {
+      out[n++] = '%';
+      out[n++] = hex[c >> 4];
+      out[n++] = hex[c & 15];
+    }
+  }
+  out[n] = 0;
+}
+
+// a header line, without its CRLF; false on a timeout or a closed connection
+static bool read_line(char * line, size_t size){
+  unsigned long start = millis();
+  size_t n = 0;
+
+  while (millis() - start < UPLINK_IO_MS) {
+    if (!client.available()) {
+      if (!client.connected()) {
+        return false;
+      }
+      delay(1);
+      continue;
+    }
+    char c = client.read();
+    if (c == '\n') {
+      line[n > 0 && line[n - 1] == '\r' ? n - 1 : n] = 0;
+      return true;
+    }
+    if (n + 1 < size) {
+      line[n++] = c;
+    }
+  }
+  return false;
+}
+
+/*
+ * One PUT of len bytes at offset. Returns the HTTP status, -1 when the
+ * connection failed, with the collector's Upload-Offset in *acked.
+ */
+static int put_chunk(const char * path, const uint8_t * data, size_t len, uint32_t offset, uint32_t size,
+                     uint32_t * acked){
+  const uplink_config_t * c = uplink_config();
+  char line[160];
+  char head[320];
+  long body = 0;
+  bool keep = true;
+
+  if (!client.connected()) {
+    client.stop();
+    if (!client.connect(c->host, c->port, UPLINK_IO_MS)) {
+      return -1;
+    }
+    client.setNoDelay(true);
+  }
+  int n = snprintf(head, sizeof(head),
+                   "PUT %s HTTP/1.1\r\nHost: %s\r\nContent-Range: bytes %u-%u/%u\r\nContent-Length: %u\r\n\r\n",
+                   path, c->host, offset, (unsigned)(offset + len - 1), size, (unsigned)len);
+  if (client.write((const uint8_t *)head, n) != (size_t)n || client.write(data, len) != len) {
+    client.stop();
+    return -1;
+  }
+  if (!read_line(line, sizeof(line)) || strncmp(line, "HTTP/1.", 7) != 0 || strlen(line) < 12) {
+    client.stop();
+    return -1;
+  }
+  int status = atoi(line + 9);
+  *acked = UINT32_MAX;
+  while (read_line(line, sizeof(line)) && line[0]) {
+    if (!strncasecmp(line, "Upload-Offset:", 14)) {
+      *acked = strtoul(line + 14, NULL, 10);
+    } else if (!strncasecmp(line, "Content-Length:", 15)) {
+      body = atol(line + 15);
+    } else if (!strncasecmp(line, "Connection:", 11)) {
+      keep = strncasecmp(line + 11 + strspn(line + 11, " "), "close", 5) != 0;
+    }
+  }
+  // nothing is expected in the body, it only has to be read past
+  unsigned long start = millis();
+  while (body > 0 && millis() - start < UPLINK_IO_MS) {
+    if (client.available()) {
+      client.read();
+      body--;
+    } else if (!client.connected()) {
+      break;
+    } else {
+      delay(1);
+    }
+  }
+  if (!keep || body > 0) {
+    client.stop();
+  }
+  return *acked == UINT32_MAX ? -1 : status;
+}
+
+typedef enum { UPLOAD_DONE, UPLOAD_SKIPPED, UPLOAD_FAILED, UPLOAD_OUT_OF_TIME } upload_result_t;
+
+// the catalog's cursor record, from uplink.offset on
+static upload_result_t upload_file(const catalog_record_t * record, const char * station, uint8_t * buf,
+                                   size_t chunk, unsigned long until_ms){
+  char name[96];
+  char path[160];
+
+  File file = SD_MMC.open(record->name, FILE_READ);
+  if (!file) {
+    return UPLOAD_SKIPPED;  // removed by hand since it was recorded
+  }
+  uint32_t size = file.size();
+  if (size == 0) {
+    file.close();
+    return UPLOAD_SKIPPED;
+  }
+  url_encode(name, sizeof(name), record->name[0] == '/' ? record->name + 1 : record->name);
+  int n = snprintf(path, sizeof(path), "/upload/");
+  url_encode(path + n, sizeof(path) - n - 1, station);
+  strlcat(path, "/", sizeof(path));
+  strlcat(path, name, sizeof(path));
+  if (uplink.offset > size) {
+    uplink.offset = 0;
+  }
+
+  unsigned long transfer_start = millis();
+  upload_result_t result = UPLOAD_FAILED;
+  while (true) {
+    if ((long)(millis() - until_ms) >= 0) {
+      result = UPLOAD_OUT_OF_TIME;
+      break;
+    }
+    size_t len = min((size_t)(size - uplink.offset), chunk);
+    if (!file.seek(uplink.offset) || file.read(buf, len) != len) {
+      // the card, not the collector: retrying would stop every upload behind this one
+      Serial.printf("uplink: %s unreadable, skipped\n", record->name);
+      result = UPLOAD_SKIPPED;
+      break;
+    }
+    uint32_t acked;
+    int status = put_chunk(path, buf, len, uplink.offset, size, &acked);
+    if (status != 200 && status != 201 && status != 409) {
+      break;
+    }
+    if (status != 409) {
+      uplink.bytes += len;
+    }
+    // a 409 says where the collector's copy ends, which is where to go on from
+    uplink.offset = min(acked, size);
+    if (status == 201 || uplink.offset == size) {
+      result = UPLOAD_DONE;
+      break;
+    }
+  }
+  uplink.transfer_s += (millis() - transfer_start) / 1000.0f;
+  file.close();
+  return result;
+}
+
+static bool uploadable(const catalog_record_t * record){
+  uint8_t outcome = record->flags & CATALOG_OUTCOME_MASK;
+  return !(record->flags & (CATALOG_DELETED | CATALOG_UPLOADED)) &&
+         (outcome == PHASH_STORED || outcome == PHASH_REFERENCE);
+}
+
+static void upload_pending(unsigned long until_ms){
+  const uplink_config_t * c = uplink_config();
+  const catalog_summary_t * summary = catalog_summary();
+  char station[EXIF_STATION_MAX];
+  catalog_record_t record;
+  int failures = 0;
+
+  if (!summary) {
+    strlcpy(uplink.error, "catalog", sizeof(uplink.error));
+    return;
+  }
+  if (uplink.cursor > summary->count) {
+    // the catalog was rebuilt, the CATALOG_UPLOADED flags went with it
+    uplink.cursor = 0;
+    uplink.offset = 0;
+  }
+  size_t chunk = psramFound() ? UPLINK_CHUNK : UPLINK_CHUNK / 4;
+  uint8_t * buf = (uint8_t *)(psramFound() ? ps_malloc(chunk) : malloc(chunk));
+  if (!buf) {
+    strlcpy(uplink.error, "memory", sizeof(uplink.error));
+    return;
+  }
+  station_id(station, sizeof(station));
+
+  while (uplink.cursor < summary->count && uplink.files < c->batch) {
+    if (!catalog_read(uplink.cursor, &record) || !uploadable(&record)) {
+      uplink.cursor++;
+      uplink.offset = 0;
+      continue;
+    }
+    upload_result_t result = upload_file(&record, station, buf, chunk, until_ms);
+    if (result == UPLOAD_OUT_OF_TIME) {
+      strlcpy(uplink.error, "time", sizeof(uplink.error));
+      break;
+    }
+    if (result == UPLOAD_FAILED) {
+      if (++failures > UPLINK_RETRIES) {
+        strlcpy(uplink.error, "collector", sizeof(uplink.error));
+        break;
+      }
+      continue;  // reconnect, the collector says where to carry on
+    }
+    if (result == UPLOAD_DONE) {
+      catalog_mark_uploaded(uplink.cursor);
+      uplink.files++;
+    }
+    uplink.cursor++;
+    uplink.offset = 0;
+  }
+  free(buf);
+}
+
+int uplink_run(int64_t deadline){
+  const uplink_config_t * c = uplink_config();
+  energy_report_t before, after;
+  unsigned long start = millis();
+  unsigned long until_ms = start + UPLINK_BUDGET_MS;
+
+  uplink_load();
+  if (deadline != SCHED_NONE) {
+    int64_t left_ms = (deadline - (int64_t)time(NULL)) * 1000;
+    until_ms = start + constrain(left_ms, (int64_t)UPLINK_MIN_MS, (int64_t)UPLINK_BUDGET_MS);
+  }
+  energy_phase(PHASE_WIFI);
+  energy_get_report(&before);
+  uplink.sessions++;
+  uplink.files = 0;
+  uplink.bytes = 0;
+  uplink.transfer_s = 0;
+  uplink.error[0] = 0;
+
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(c->ssid, c->pass);
+  while (WiFi.status() != WL_CONNECTED && millis() - start < UPLINK_JOIN_MS) {
+    delay(50);
+  }
+  uplink.join_s = (millis() - start) / 1000.0f;
+  if (WiFi.status() != WL_CONNECTED) {
+    strlcpy(uplink.error, "join", sizeof(uplink.error));
+  } else if (!sd_mount() || !catalog_begin()) {
+    strlcpy(uplink.error, "card", sizeof(uplink.error));
+  } else {
+    Serial.printf("uplink: joined %s in %.1f s, uploading to %s:%u\n", c->ssid, uplink.join_s, c->host, c->port);
+    upload_pending(until_ms);
+    catalog_end();
+    SD_MMC.end();
+  }
+  client.stop();
+  WiFi.disconnect(true);
+  WiFi.mode(WIFI_OFF);
+
+  energy_phase(PHASE_BOOT);
+  energy_get_report(&after);
+  uplink.mah = after.used_mah - before.used_mah;
+  uplink.total_bytes += uplink.bytes;
+  uplink.total_mah += uplink.mah;
+  rtc_state_save("uplink", &uplink, sizeof(uplink));
+  Serial.printf("uplink: %u files, %u bytes in %.1f s, %.2f mAh%s%s\n", uplink.files, uplink.bytes,
+                (millis() - start) / 1000.0f, uplink.mah, uplink.error[0] ? ", stopped: " : "", uplink.error);
+  return uplink.files;
+}
+
+void uplink_get_stats(uplink_stats_t * stats){
+  const catalog_summary_t * summary = catalog_summary();
+
+  uplink_load();
+  stats->sessions = uplink.sessions;
+  stats->pending = summary && summary->count > uplink.cursor ? summary->count - uplink.cursor : 0;
+  stats->next = uplink.next ? uplink.next : uplink_next(time(NULL));
+  stats->files = uplink.files;
+  stats->bytes = uplink.bytes;
+  stats->join_s = uplink.join_s;
+  stats->transfer_s = uplink.transfer_s;
+  stats->kb_per_s = uplink.transfer_s > 0 ? uplink.bytes / 1024.0f / uplink.transfer_s : 0;
+  stats->mah = uplink.mah;
+  stats->mah_per_mb = uplink.bytes ? uplink.mah / (uplink.bytes / 1048576.0f) : 0;
+  strlcpy(stats->error, uplink.error, sizeof(stats->error));
+  stats->total_bytes = uplink.total_bytes;
+  stats->total_mah = uplink.total_mah;
+}
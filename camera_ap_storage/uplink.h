@@ -0,0 +1,82 @@
+/*
+ * Uplink. On its own schedule the station joins a known Wi-Fi network
+ * as a client, uploads the captures added to the catalog since the last
+ * session to a collector (tools/collector), and goes back to sleep. Each
+ * file goes up in chunks, one PUT per chunk over a kept alive connection:
+ *
+ *   PUT /upload/<station>/<file>
+ *   Content-Range: bytes <first>-<last>/<size>
+ *
+ * The collector answers 200 while it wants more, 201 once the file is
+ * complete, or 409 when the chunk does not start where its copy ends,
+ * always with "Upload-Offset: <bytes it holds>". A session cut short by
+ * a weak signal or the time budget carries on from there next time.
+ * Uploaded records are marked in the catalog, and a cursor past them is
+ * kept in RTC memory with a copy in NVS after every session.
+ */
+#ifndef _UPLINK_H_
+#define _UPLINK_H_
+
+#include <stdint.h>
+#include "schedule.h"
+
+#define UPLINK_DEFAULT_PORT  8080
+#define UPLINK_DEFAULT_BATCH 200          // files per session at most
+#define UPLINK_CHUNK         (32*1024)    // bytes per PUT, a quarter of it without PSRAM
+#define UPLINK_JOIN_MS       15000        // give up on the network after this long
+#define UPLINK_IO_MS         10000        // on a collector that stops answering
+#define UPLINK_BUDGET_MS     (5*60*1000)  // a session ends after this long
+#define UPLINK_MIN_MS        30000        // even when a capture is due sooner
+#define UPLINK_RETRIES       3            // reconnects per session
+#define UPLINK_EARLY_S       5            // a wake this close to a session runs it
+
+// preferences "up_ssid", "up_pass", "up_host", "up_port", "up_batch", "up_sched"
+typedef struct {
+  char ssid[33];
+  char pass[64];
+  char host[64];              // collector name or address
+  uint16_t port;
+  uint16_t batch;
+  schedule_t schedule;        // no rules when uplink is off
+} uplink_config_t;
+
+typedef struct {
+  uint32_t sessions;
+  uint32_t pending;           // catalog records past the cursor
+  int64_t next;               // next session, epoch seconds, SCHED_NONE when off
+  // last session
+  uint32_t files;
+  uint32_t bytes;
+  float join_s;
+  float transfer_s;
+  float kb_per_s;             // while transferring
+  float mah;                  // the whole session, joining included
+  float mah_per_mb;
+  char error[24];             // what ended it early, "" when it finished
+  // every session since the counters were reset
+  uint64_t total_bytes;
+  float total_mah;
+} uplink_stats_t;
+
+void uplink_config_load(uplink_config_t * config);
+const uplink_config_t * uplink_config(void);
+// an uplink preference was written
+void uplink_config_changed(void);
+
+// the next session after now, remembered for uplink_due(); SCHED_NONE when off
+int64_t uplink_next(int64_t now);
+// a session is due on this wake
+bool uplink_due(void);
+
+/*
+ * Join the network, upload pending captures until they run out, the
+ * batch is full, UPLINK_BUDGET_MS passes or deadline (epoch seconds,
+ * SCHED_NONE for none) does, then leave it again. A session always gets
+ * UPLINK_MIN_MS, so dense schedules still upload at the cost of a late
+ * capture. Mounts the card itself. Returns the number of files completed.
+ */
+int uplink_run(int64_t deadline);
+
+void uplink_get_stats(uplink_stats_t * stats);
+
+#endif
@@ -0,0 +1,274 @@
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "frame_arbiter.h"
+#include "buf_pool.h"
+#include "ws_stream.h"
+#include "metrics.h"
+
+static ws_stream_stats_t stats;
+static portMUX_TYPE clients_mux = portMUX_INITIALIZER_UNLOCKED;
+
+#if CONFIG_HTTPD_WS_SUPPORT
+
+extern httpd_handle_t stream_httpd;
+
+typedef struct {
+  int fd;                               // -1 for a free slot
+  uint32_t sent;                        // sequence of the last frame sent
+  uint32_t acked;
+  int64_t sent_at[WS_STREAM_WINDOW];    // by sequence modulo the window
+  uint16_t rtt_ms;
+  uint16_t skipped;
+} ws_client_t;
+
+static ws_client_t clients[WS_STREAM_CLIENTS] = { { -1 }, { -1 }, { -1 }, { -1 } };
+static bool running;
+
+static esp_err_t send_frame(int fd, ws_stream_header_t *header, const uint8_t *jpg, size_t len){
+  httpd_ws_frame_t frame;
+
+  // two fragments of one message, the JPEG is sent from the frame buffer as it is
+  memset(&frame, 0, sizeof(frame));
+  frame.type = HTTPD_WS_TYPE_BINARY;
+  frame.fragmented = true;
+  frame.final = false;
+  frame.payload = (uint8_t *)header;
+  frame.len = sizeof(*header);
+  esp_err_t err = httpd_ws_send_frame_async(stream_httpd, fd, &frame);
+  if (err == ESP_OK) {
+    frame.type = HTTPD_WS_TYPE_CONTINUE;
+    frame.final = true;
+    frame.payload = (uint8_t *)jpg;
+    frame.len = len;
+    err = httpd_ws_send_frame_async(stream_httpd, fd, &frame);
+  }
+  return err;
+}
+
+static void drop_client(int i){
+  int fd = clients[i].fd;
+
+  portENTER_CRITICAL(&clients_mux);
+  clients[i].fd = -1;
+  stats.clients--;
+  portEXIT_CRITICAL(&clients_mux);
+  httpd_sess_trigger_close(stream_httpd, fd);
+}
+
+// which clients have room for a frame, false once there are none left at all
+static bool ready_clients(bool *ready, bool *any_ready){
+  int64_t now = esp_timer_get_time();
+  bool any = false;
+
+  *any_ready = false;
+  for (int i = 0; i < WS_STREAM_CLIENTS; i++) {
+    ready[i] = false;
+    if (clients[i].fd < 0) {
+      continue;
+    }
+    if (httpd_ws_get_fd_info(stream_httpd, clients[i].fd) != HTTPD_WS_CLIENT_WEBSOCKET) {
+      drop_client(i);
+      continue;
+    }
+    portENTER_CRITICAL(&clients_mux);
+    uint32_t unacked = clients[i].sent - clients[i].acked;
+    int64_t oldest = clients[i].sent_at[(clients[i].acked + 1) % WS_STREAM_WINDOW];
+    portEXIT_CRITICAL(&clients_mux);
+    if (unacked >= WS_STREAM_WINDOW && now - oldest > WS_STREAM_TIMEOUT_MS * 1000LL) {
+      Serial.printf("ws stream: no ack from %d, closing\n", clients[i].fd);
+      drop_client(i);
+      continue;
+    }
+    any = true;
+    ready[i] = unacked < WS_STREAM_WINDOW;
+    *any_ready |= ready[i];
+  }
+  return any;
+}
+
+// one task for every client, each frame is captured once however many are watching
+static void ws_stream_task(void *arg){
+  bool ready[WS_STREAM_CLIENTS];
+  bool any_ready;
+  ws_stream_header_t header;
+  size_t jpg_len = 0;
+  uint8_t *jpg = NULL;
+  uint32_t frame_seq = 0;
+
+  memset(&header, 0, sizeof(header));
+  while (true) {
+    if (!ready_clients(ready, &any_ready)) {
+      portENTER_CRITICAL(&clients_mux);
+      bool idle = stats.clients == 0;
+      if (idle) {
+        running = false;
+      }
+      portEXIT_CRITICAL(&clients_mux);
+      if (idle) {
+        vTaskDelete(NULL);
+      }
+      continue;
+    }
+    // nobody can take a frame, leave the camera alone until an ack comes
+    if (!any_ready) {
+      vTaskDelay(pdMS_TO_TICKS(5));
+      continue;
+    }
+    camera_fb_t *fb = frame_arbiter_frame(&frame_seq, ARBITER_STREAM_TIMEOUT_MS);
+    if (!fb) {
+      if (!frame_arbiter_running()) {
+        Serial.println("Camera capture failed");
+        vTaskDelay(pdMS_TO_TICKS(100));
+      }
+      continue;
+    }
+    int64_t captured = fb->timestamp.tv_sec * 1000000LL + fb->timestamp.tv_usec;
+    if (fb->format != PIXFORMAT_JPEG) {
+      bool converted = pool_frame2jpg(fb, 80, &jpg, &jpg_len);
+      frame_arbiter_release(fb);
+      fb = NULL;
+      if (!converted) {
+        Serial.println("JPEG compression failed");
+        continue;
+      }
+    } else {
+      jpg = fb->buf;
+      jpg_len = fb->len;
+    }
+
+    header.time_ms = captured / 1000;
+    for (int i = 0; i < WS_STREAM_CLIENTS; i++) {
+      if (clients[i].fd < 0) {
+        continue;
+      }
+      if (!ready[i]) {
+        portENTER_CRITICAL(&clients_mux);
+        if (clients[i].skipped < UINT16_MAX) {
+          clients[i].skipped++;
+        }
+        stats.skipped++;
+        portEXIT_CRITICAL(&clients_mux);
+        metrics_inc(MET_STREAM_DROPPED);
+        continue;
+      }
+      int64_t now = esp_timer_get_time();
+      header.age_ms = (now - captured) / 1000;
+      portENTER_CRITICAL(&clients_mux);
+      // each client numbers its own frames, the ones it skipped leave no gap
+      uint32_t seq = clients[i].sent + 1;
+      clients[i].sent = seq;
+      clients[i].sent_at[seq % WS_STREAM_WINDOW] = now;
+      header.rtt_ms = clients[i].rtt_ms;
+      header.skipped = clients[i].skipped;
+      portEXIT_CRITICAL(&clients_mux);
+      header.seq = seq;
+      esp_err_t err = send_frame(clients[i].fd, &header, jpg, jpg_len);
+      if (err != ESP_OK) {
+        drop_client(i);
+        continue;
+      }
+      metrics_observe_us(MET_STREAM_SEND_LATENCY, esp_timer_get_time() - now);
+      metrics_inc(MET_STREAM_FRAMES);
+      metrics_add(MET_STREAM_BYTES, sizeof(header) + jpg_len);
+      portENTER_CRITICAL(&clients_mux);
+      stats.sent++;
+      stats.age_ms = header.age_ms;
+      portEXIT_CRITICAL(&clients_mux);
+    }
+
+    if (fb) {
+      frame_arbiter_release(fb);
+    } else {
+      pool_free(jpg);
+    }
+    jpg = NULL;
+  }
+}
+
+static esp_err_t ws_stream_open(httpd_req_t *req){
+  int fd = httpd_req_to_sockfd(req);
+  int slot = -1;
+  bool start = false;
+
+  portENTER_CRITICAL(&clients_mux);
+  for (int i = 0; i < WS_STREAM_CLIENTS; i++) {
+    if (clients[i].fd == fd) {
+      slot = i;      // a closed client's socket, reused
+      break;
+    }
+    if (slot < 0 && clients[i].fd < 0) {
+      slot = i;
+    }
+  }
+  if (slot >= 0) {
+    if (clients[slot].fd != fd) {
+      stats.clients++;
+    }
+    memset(&clients[slot], 0, sizeof(clients[slot]));
+    clients[slot].fd = fd;
+    start = !running;
+    running = true;
+  }
+  portEXIT_CRITICAL(&clients_mux);
+  if (slot < 0) {
+    return ESP_FAIL;
+  }
+  if (start) {
+    xTaskCreatePinnedToCore(ws_stream_task, "ws_stream", WS_STREAM_STACK, NULL, 5, NULL, tskNO_AFFINITY);
+  }
+  return ESP_OK;
+}
+
+esp_err_t ws_stream_handler(httpd_req_t *req){
+  char message[32];
+  httpd_ws_frame_t frame;
+
+  if (req->method == HTTP_GET) {
+    return ws_stream_open(req);
+  }
+  memset(&frame, 0, sizeof(frame));
+  frame.payload = (uint8_t *)message;
+  esp_err_t err = httpd_ws_recv_frame(req, &frame, sizeof(message) - 1);
+  if (err != ESP_OK) {
+    return err;
+  }
+  message[frame.len] = 0;
+  const char *ack = strstr(message, "\"ack\":");
+  if (frame.type != HTTPD_WS_TYPE_TEXT || !ack) {
+    return ESP_OK;
+  }
+  uint32_t seq = strtoul(ack + 6, NULL, 10);
+  int fd = httpd_req_to_sockfd(req);
+  int64_t now = esp_timer_get_time();
+
+  portENTER_CRITICAL(&clients_mux);
+  for (int i = 0; i < WS_STREAM_CLIENTS; i++) {
+    ws_client_t *c = &clients[i];
+    // only frames in flight, a late or repeated ack changes nothing
+    if (c->fd == fd && seq - c->acked - 1 < c->sent - c->acked) {
+      c->acked = seq;
+      c->rtt_ms = (now - c->sent_at[seq % WS_STREAM_WINDOW]) / 1000;
+      stats.rtt_ms = c->rtt_ms;
+    }
+  }
+  portEXIT_CRITICAL(&clients_mux);
+  return ESP_OK;
+}
+
+#else
+
+esp_err_t ws_stream_handler(httpd_req_t *req){
+  httpd_resp_send_404(req);
+  return ESP_FAIL;
+}
+
+#endif
+
+void ws_stream_get_stats(ws_stream_stats_t *s){
+  portENTER_CRITICAL(&clients_mux);
+  *s = stats;
+  portEXIT_CRITICAL(&clients_mux);
+}
@@ -0,0 +1,42 @@
+/*
+ * Stream over a WebSocket on port 81 (/ws/stream). Each frame is one
+ * binary message: the header below and then the JPEG. The client
+ * answers each frame with {"ack":seq}; a client with WS_STREAM_WINDOW
+ * frames unanswered gets no more until it catches up, so a slow link
+ * drops frames instead of queueing them.
+ */
+#ifndef _WS_STREAM_H_
+#define _WS_STREAM_H_
+
+#include <stdint.h>
+#include "esp_http_server.h"
+
+#define WS_STREAM_CLIENTS 4           // the stream server's sockets
+#define WS_STREAM_WINDOW 2            // frames sent but not acknowledged
+#define WS_STREAM_TIMEOUT_MS 5000     // a client this long without an ack is closed
+#define WS_STREAM_STACK 4096
+
+// little endian, as the ESP32 stores it
+typedef struct __attribute__((packed)) {
+  uint32_t seq;
+  uint32_t time_ms;      // uptime when the frame was captured
+  uint16_t age_ms;       // from capture to sending
+  uint16_t rtt_ms;       // last frame's send to ack, for this client
+  uint16_t skipped;      // frames this client has missed while behind
+  uint16_t reserved;
+} ws_stream_header_t;
+
+typedef struct {
+  uint8_t clients;
+  uint32_t sent;         // frames, all clients together
+  uint32_t skipped;
+  uint16_t rtt_ms;       // of the last ack
+  uint16_t age_ms;       // of the last frame sent
+} ws_stream_stats_t;
+
+// registered on the stream server with .is_websocket
+esp_err_t ws_stream_handler(httpd_req_t *req);
+
+void ws_stream_get_stats(ws_stream_stats_t *stats);
+
+#endif
@@ -0,0 +1,303 @@
+// Benchmark of the web server's text handling from http_text.cpp:
+// formatting /status with text_printf(), the diffs of it pushed over the
+// WebSocket, parsing a setting sent over it, and the part headers of the
+// MJPEG stream. status_json() itself reads the sensor, the preferences
+// and every module's statistics, so it stays in the firmware; its
+// formatting half, one text_printf() per member, is timed here with the
+// same mix of members. status_diff() is first checked against the plain
+// search from the start of the previous status it replaced, formatting
+// against a buffer too small for it, and the part headers against
+// snprintf().
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "http_text.h"
+
+#define STATUS_MAX 8192
+
+static const char *names[] = {"framesize", "quality", "heap_free", "heap_largest", "arbiter_frames",
+                              "jitter_mean_ms", "battery_v", "energy_used_mah", "catalog_records",
+                              "ws_stream_sent", "http_worker_served", "uplink_kb_per_s"};
+
+// about the size and shape of status_json() with a few schedule rules
+static std::string make_status(std::mt19937 &rng, int members){
+  std::string s = "{";
+  char member[160];
+
+  for (int i = 0; i < members; i++) {
+    const char *name = names[i % 12];
+    switch (i % 9) {
+      case 0:
+        snprintf(member, sizeof(member), "\"%s_%d\":[%u,%u,%u]", name, i,
+                 (unsigned)(rng() % 100), (unsigned)(rng() % 100), (unsigned)(rng() % 100));
+        break;
+      case 4:
+        snprintf(member, sizeof(member), "\"%s_%d\":\"p,127,06:00,20:00,%u\"", name, i, (unsigned)(60 + rng() % 600));
+        break;
+      case 7:
+        snprintf(member, sizeof(member), "\"%s_%d\":%.2f", name, i, (rng() % 100000) / 100.0);
+        break;
+      default:
+        snprintf(member, sizeof(member), "\"%s_%d\":%u", name, i, (unsigned)(rng() % 1000000));
+        break;
+    }
+    s += i ? "," : "";
+    s += member;
+  }
+  return s + "}";
+}
+
+// status_json() once the values are gathered, into size bytes, members that do not fit left out
+static size_t format_status(char *buf, size_t size, const unsigned *values, int members){
+  text_out_t out;
+
+  text_out_init(&out, buf, size - 1);
+  text_printf(&out, "{");
+  for (int i = 0; i < members; i++) {
+    const char *name = names[i % 12];
+    const char *comma = i + 1 < members ? "," : "";
+    unsigned v = values[i];
+    switch (i % 9) {
+      case 0:
+        text_printf(&out, "\"%s_%d\":[%u,%u,%u]%s", name, i, v % 100, v / 100 % 100, v / 10000 % 100, comma);
+        break;
+      case 4:
+        text_printf(&out, "\"%s_%d\":\"p,127,06:00,20:00,%u\"%s", name, i, 60 + v % 600, comma);
+        break;
+      case 7:
+        text_printf(&out, "\"%s_%d\":%.2f%s", name, i, v % 100000 / 100.0, comma);
+        break;
+      default:
+        text_printf(&out, "\"%s_%d\":%u%s", name, i, v % 1000000, comma);
+        break;
+    }
+  }
+  if (out.full && out.p[-1] == ',') {
+    out.p--;
+  }
+  *out.p++ = '}';
+  *out.p = 0;
+  return out.p - buf;
+}
+
+// the same with sprintf() as status_json() used to, unbounded
+static size_t format_status_sprintf(char *buf, const unsigned *values, int members){
+  char *p = buf;
+
+  *p++ = '{';
+  for (int i = 0; i < members; i++) {
+    const char *name = names[i % 12];
+    const char *comma = i + 1 < members ? "," : "";
+    unsigned v = values[i];
+    switch (i % 9) {
+      case 0:
+        p += sprintf(p, "\"%s_%d\":[%u,%u,%u]%s", name, i, v % 100, v / 100 % 100, v / 10000 % 100, comma);
+        break;
+      case 4:
+        p += sprintf(p, "\"%s_%d\":\"p,127,06:00,20:00,%u\"%s", name, i, 60 + v % 600, comma);
+        break;
+      case 7:
+        p += sprintf(p, "\"%s_%d\":%.2f%s", name, i, v % 100000 / 100.0, comma);
+        break;
+      default:
+        p += sprintf(p, "\"%s_%d\":%u%s", name, i, v % 1000000, comma);
+        break;
+    }
+  }
+  *p++ = '}';
+  *p = 0;
+  return p - buf;
+}
+
+static int count_members(const char *json){
+  const char *key, *val;
+  size_t key_len, val_len;
+  int n = 0;
+
+  for (const char *p = json; (p = json_next(p, &key, &key_len, &val, &val_len)); ) {
+    n++;
+  }
+  return n;
+}
+
+// a few values changed, as between two pushes a second apart
+static std::string change(std::mt19937 &rng, const std::string &status, int changes){
+  std::string s = status;
+  for (int c = 0; c < changes; c++) {
+    size_t at = s.find(':', rng() % s.size());
+    if (at == std::string::npos || !isdigit((unsigned char)s[at + 1])) {
+      continue;
+    }
+    s[at + 1] = s[at + 1] == '9' ? '1' : s[at + 1] + 1;
+  }
+  return s;
+}
+
+// status_diff() as it was, every key looked for from the start of prev
+static size_t reference_diff(const char *prev, const char *next, char *out){
+  const char *key, *val, *prev_key, *prev_val;
+  size_t key_len, val_len, prev_key_len, prev_val_len;
+  char *o = out + sprintf(out, "{\"status\":{");
+  char *members = o;
+
+  for (const char *p = next; (p = json_next(p, &key, &key_len, &val, &val_len)); ) {
+    bool same = false;
+    for (const char *q = prev; q && (q = json_next(q, &prev_key, &prev_key_len, &prev_val, &prev_val_len)); ) {
+      if (prev_key_len == key_len && !memcmp(prev_key, key, key_len)) {
+        same = prev_val_len == val_len && !memcmp(prev_val, val, val_len);
+        break;
+      }
+    }
+    if (!same) {
+      if (o != members) {
+        *o++ = ',';
+      }
+      memcpy(o, key - 1, val + val_len - (key - 1));
+      o += val + val_len - (key - 1);
+    }
+  }
+  if (o == members) {
+    return 0;
+  }
+  o += sprintf(o, "}}");
+  return o - out;
+}
+
+// move one member elsewhere, or drop one, as when the catalog appears or goes
+static std::string shuffle(std::mt19937 &rng, const std::string &status){
+  std::vector<std::string> members;
+  const char *key, *val;
+  size_t key_len, val_len;
+  for (const char *p = status.c_str(); (p = json_next(p, &key, &key_len, &val, &val_len)); ) {
+    members.emplace_back(key - 1, val + val_len);
+  }
+  size_t from = rng() % members.size();
+  std::string moved = members[from];
+  members.erase(members.begin() + from);
+  if (rng() % 2) {
+    members.insert(members.begin() + rng() % members.size(), moved);
+  }
+  std::string s = "{";
+  for (size_t i = 0; i < members.size(); i++) {
+    s += (i ? "," : "") + members[i];
+  }
+  return s + "}";
+}
+
+static int verify(std::mt19937 &rng, int samples){
+  static char a[STATUS_MAX], b[STATUS_MAX], cut[STATUS_MAX];
+  int bad = 0;
+
+  for (int i = 0; i < samples; i++) {
+    std::string prev = make_status(rng, 20 + rng() % 120);
+    std::string next = i % 3 == 2 ? shuffle(rng, change(rng, prev, rng() % 4)) : change(rng, prev, rng() % 8);
+    const char *p = i % 17 ? prev.c_str() : nullptr;
+    size_t la = status_diff(p, next.c_str(), a);
+    size_t lb = reference_diff(p, next.c_str(), b);
+    if (la != lb || memcmp(a, b, la)) {
+      if (bad++ < 5) {
+        printf("status_diff mismatch:\n  prev %s\n  next %s\n  got  %.*s\n  want %.*s\n",
+               prev.c_str(), next.c_str(), (int)la, a, (int)lb, b);
+      }
+    }
+  }
+  for (size_t len : {(size_t)0, (size_t)7, (size_t)10, (size_t)12345, (size_t)999999, (size_t)4294967295u}) {
+    char got[STREAM_PART_MAX], want[STREAM_PART_MAX];
+    size_t n = stream_part_header(got, len);
+    int m = snprintf(want, sizeof(want), "Content-Type: image/jpeg\r\nContent-Length: %zu\r\n\r\n", len);
+    if (n != (size_t)m || strcmp(got, want)) {
+      printf("part header mismatch for %zu: \"%s\"\n", len, got);
+      bad++;
+    }
+  }
+  // whole, and cut short to the members that fit and still closed
+  for (int i = 0; i < samples / 10; i++) {
+    unsigned values[130];
+    for (unsigned &v : values) {
+      v = rng();
+    }
+    int members = 1 + rng() % 130;
+    size_t size = 64 + rng() % 4000;
+    size_t la = format_status(a, sizeof(a), values, members);
+    size_t lb = format_status_sprintf(b, values, members);
+    size_t lc = format_status(cut, size, values, members);
+    int kept = count_members(cut);
+    if (la != lb || memcmp(a, b, la) || count_members(a) != members || lc >= size ||
+        cut[lc - 1] != '}' || (lc < lb && (kept >= members || strncmp(cut, b, lc - 1))) ||
+        (lc == lb && strcmp(cut, b))) {
+      if (bad++ < 5) {
+        printf("format_status wrong for %d members into %zu bytes:\n  got  %s\n  want %s\n", members, size, cut, b);
+      }
+    }
+  }
+  int list[8];
+  if (parse_int_list("5,8,10", list, 8) != 3 || list[2] != 10 || parse_int_list("1,2,3", list, 2) != 2 ||
+      parse_int_list("", list, 8) != 0) {
+    printf("parse_int_list wrong\n");
+    bad++;
+  }
+  printf("verify: %d status diffs, %d wrong\n", samples, bad);
+  return bad;
+}
+
+template <typename F>
+static void bench(const char *name, int iterations, F f){
+  long long sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    sink += f(i);
+  }
+  auto end = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+  printf("%-36s %9.0f ns/call  %10.0f calls/s  (sink %lld)\n", name, ns, 1e9 / ns, sink & 1);
+}
+
+int main(int argc, char **argv){
+  int samples = argc > 1 ? atoi(argv[1]) : 2000;
+  int iterations = argc > 2 ? atoi(argv[2]) : 20000;
+  std::mt19937 rng(12345);
+  static char out[STATUS_MAX];
+
+  int bad = verify(rng, samples);
+
+  std::string prev = make_status(rng, 130);
+  std::string next = change(rng, prev, 3);
+  printf("status: %zu bytes, 130 members\n", prev.size());
+  unsigned values[130];
+  for (unsigned &v : values) {
+    v = rng();
+  }
+  bench("status format", iterations, [&](int i){ values[i % 130]++; return format_status(out, sizeof(out), values, 130); });
+  bench("status format, unbounded sprintf", iterations,
+        [&](int i){ values[i % 130]++; return format_status_sprintf(out, values, 130); });
+  bench("status_diff full", iterations, [&](int){ return status_diff(nullptr, next.c_str(), out); });
+  bench("status_diff 3 changed", iterations, [&](int){ return status_diff(prev.c_str(), next.c_str(), out); });
+  bench("status_diff 3 changed, from start", iterations / 10,
+        [&](int){ return reference_diff(prev.c_str(), next.c_str(), out); });
+
+  static const char *messages[] = {"{\"id\":17,\"var\":\"quality\",\"val\":\"10\"}",
+                                   "{\"id\":18,\"var\":\"station\",\"val\":\"North%20Ridge+2\"}",
+                                   "{\"id\":19}"};
+  bench("ws setting parse", iterations * 10, [&](int i){
+    char id[12], variable[32], value[32];
+    const char *m = messages[i % 3];
+    int n = json_member(m, "id", id, sizeof(id));
+    if (json_member(m, "var", variable, sizeof(variable)) && json_member(m, "val", value, sizeof(value))) {
+      url_decode(value);
+      n += value[0];
+    }
+    return n;
+  });
+
+  char part[STREAM_PART_MAX];
+  bench("stream part header", iterations * 50, [&](int i){ return stream_part_header(part, 20000 + i % 90000); });
+  bench("stream part header, snprintf", iterations * 50, [&](int i){
+    return snprintf(part, sizeof(part), "Content-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n", 20000 + i % 90000);
+  });
+  return bad ? 1 : 0;
+}
@@ -0,0 +1,196 @@
+// Benchmark of ingest_card() across thread counts, on a synthetic card
+// of firmware-shaped photos: three stations with EXIF written by the
+// firmware's exif_build(), some older ones with only a time in their
+// name, and a few duplicates. Every run is checked against what was put
+// on the card. The card sits in the page cache after the first run, so
+// this measures hashing, parsing and copying rather than the card reader.
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "exif.h"
+#include "library.h"
+
+namespace fs = std::filesystem;
+
+static const char *stations[] = {"ridge-north", "creek-03", "TrailCam-A1B2C3"};
+#define CARD_STATION "unlabelled"        // for the photos without EXIF
+
+struct Card {
+  fs::path dir;
+  size_t unique = 0;
+  std::unordered_map<uint64_t, int64_t> time_ms;  // by content hash
+  std::unordered_map<std::string, size_t> per_station;
+};
+
+static void write_file(const fs::path &path, const std::vector<uint8_t> &data){
+  FILE *f = fopen(path.c_str(), "wb");
+  if (!f || fwrite(data.data(), 1, data.size(), f) != data.size() || fclose(f) != 0) {
+    fprintf(stderr, "cannot write %s\n", path.c_str());
+    exit(1);
+  }
+}
+
+static void make_card(Card *card, int images, int kb, std::mt19937 &rng){
+  std::vector<uint8_t> last;
+  std::string last_name;
+  time_t t = 1750000000;                // mid June 2025
+
+  for (int i = 0; i < images; i++) {
+    fs::path dir = card->dir / ("DCIM" + std::to_string(100 + i / 1000));
+    if (i % 1000 == 0) {
+      fs::create_directories(dir);
+    }
+    // about 2% are the previous photo again, copied into another folder
+    if (!last_name.empty() && rng() % 50 == 0) {
+      fs::create_directories(card->dir / "BACKUP");
+      write_file(card->dir / "BACKUP" / last_name, last);
+      last_name.clear();
+      continue;
+    }
+    t += 1 + rng() % 120;
+    uint16_t millis = rng() % 1000;
+    const char *station = stations[rng() % 3];
+    bool exif = rng() % 10 != 0;
+    std::vector<uint8_t> data = {0xff, 0xd8};
+    char name[64];
+    if (exif) {
+      char comment[64];
+      uint8_t seg[EXIF_MAX];
+      snprintf(comment, sizeof(comment), "battery_v=%.2f settings=%08x", 3.5 + (rng() % 70) / 100.0, (unsigned)rng());
+      exif_info_t info = { t, millis, (int16_t)exif_utc_offset(t), 1600, 1200, "OV2640", station, comment };
+      size_t len = exif_build(seg, sizeof(seg), &info);
+      data.insert(data.end(), seg, seg + len);
+      snprintf(name, sizeof(name), "pic_%06d.jpg", i);
+    } else {
+      struct tm tm;
+      localtime_r(&t, &tm);
+      strftime(name, sizeof(name), "img_%d-%m-%Y_%H-%M-%S.jpg", &tm);
+      millis = 0;
+      station = CARD_STATION;
+    }
+    // the scan data only has to differ between photos
+    size_t size = kb * 1024 - 256 + rng() % 512;
+    uint32_t x = rng();
+    while (data.size() < size) {
+      x ^= x << 13, x ^= x >> 17, x ^= x << 5;
+      data.push_back(x & 0xff);
+    }
+    data.push_back(0xff);
+    data.push_back(0xd9);
+    write_file(dir / name, data);
+
+    int64_t ms = (int64_t)t * 1000 + millis;
+    if (!exif) {
+      ms += exif_utc_offset(t) * 60000LL;  // local wall clock
+    }
+    card->time_ms[content_hash(data.data(), data.size())] = ms;
+    card->per_station[station]++;
+    card->unique++;
+    last.swap(data);
+    last_name = name;
+  }
+}
+
+// every station's index holds its photos in time order with the right times
+static int check_library(const Card &card, const fs::path &library, bool copied){
+  int bad = 0;
+  size_t total = 0;
+
+  for (auto &[station, count] : card.per_station) {
+    std::vector<LibraryRecord> records;
+    if (!read_index((library / station / LIBRARY_INDEX).string(), &records) || records.size() != count) {
+      printf("  %s: %zu records, expected %zu\n", station.c_str(), records.size(), count);
+      bad++;
+      continue;
+    }
+    for (size_t i = 0; i < records.size(); i++) {
+      const LibraryRecord &r = records[i];
+      auto it = card.time_ms.find(r.hash);
+      bool ok = it != card.time_ms.end() && it->second == r.time_ms && (i == 0 || records[i - 1].time_ms <= r.time_ms) &&
+                (copied ? fs::file_size(library / station / r.path) == r.size : (r.flags & REC_IN_PLACE) != 0);
+      if (!ok && bad++ < 10) {
+        printf("  %s: bad record %zu %s\n", station.c_str(), i, r.path);
+      }
+    }
+    total += records.size();
+  }
+  return bad + (total != card.unique);
+}
+
+static int run(const Card &card, const fs::path &library, int threads, bool copy){
+  IngestOptions options;
+  IngestStats stats;
+  std::string error;
+
+  fs::remove_all(library);
+  options.card = card.dir.string();
+  options.library = library.string();
+  options.station = CARD_STATION;
+  options.threads = threads;
+  options.copy = copy;
+  if (!ingest_card(options, &stats, &error)) {
+    printf("ingest failed: %s\n", error.c_str());
+    return 1;
+  }
+  int bad = check_library(card, library, copy) + (stats.ingested != card.unique) + (stats.failed != 0);
+  printf("%-6s threads=%-3d %7.3f s  %8.1f MB/s  %9.0f files/s  ingested=%zu known=%zu failed=%zu%s\n",
+         copy ? "copy" : "index", threads, stats.seconds, stats.bytes / 1e6 / stats.seconds,
+         stats.files / stats.seconds, stats.ingested, stats.known, stats.failed, bad ? "  WRONG" : "");
+
+  return bad;
+}
+
+int main(int argc, char **argv){
+  int images = argc > 1 ? atoi(argv[1]) : 100000;
+  int kb = argc > 2 ? atoi(argv[2]) : 4;
+  int cores = std::max(1u, std::thread::hardware_concurrency());
+  std::mt19937 rng(12345);
+  char tmp[] = "/tmp/bench_ingest.XXXXXX";
+  Card card;
+  int bad = 0;
+
+  setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
+  tzset();
+  if (!mkdtemp(tmp)) {
+    perror("mkdtemp");
+    return 1;
+  }
+  card.dir = fs::path(tmp) / "card";
+  fs::path library = fs::path(tmp) / "library";
+  make_card(&card, images, kb, rng);
+  printf("card: %d files, %zu unique, %d KB each\n", images, card.unique, kb);
+
+  for (bool copy : {false, true}) {
+    for (int threads = 1; ; threads = std::min(threads * 2, cores)) {
+      bad += run(card, library, threads, copy);
+      if (threads == cores) {
+        break;
+      }
+    }
+  }
+
+  // a second pass over the same card finds everything already there
+  IngestOptions options;
+  IngestStats stats;
+  std::string error;
+  options.card = card.dir.string();
+  options.library = library.string();
+  options.station = CARD_STATION;
+  bool ok = ingest_card(options, &stats, &error) && stats.ingested == 0 && stats.known == (size_t)images;
+  printf("again  threads=%-3d %7.3f s  ingested=%zu known=%zu%s\n", cores, stats.seconds,
+         stats.ingested, stats.known, ok ? "" : "  WRONG");
+  bad += !ok;
+
+  fs::remove_all(tmp);
+  return bad ? 1 : 0;
+}
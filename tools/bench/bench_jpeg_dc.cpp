@@ -0,0 +1,220 @@
+// Benchmark of jpeg_dc_luma() in MB/s of JPEG data. Before timing,
+// every image is cross-checked against libjpeg decoding it at 1/8 scale
+// to grayscale, which also works from the DC terms alone and must agree
+// exactly. Without files a corpus is made with libjpeg in the sizes and
+// subsamplings the sensors produce, with and without restart markers.
+//
+//   bench_jpeg_dc [iterations] [file.jpg ...]
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <jpeglib.h>
+
+#include "jpeg_dc.h"
+
+struct Image {
+  std::string name;
+  std::vector<uint8_t> jpg;
+};
+
+// a scene with gradients, edges and noise, so the AC terms are not all zero
+static Image make_image(int w, int h, int hs, int vs, bool gray, int quality, int restart, std::mt19937 &rng){
+  std::vector<uint8_t> rgb(w * h * 3);
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      uint8_t *p = &rgb[(y * w + x) * 3];
+      int v = x * 255 / w;
+      if ((x / 37 + y / 23) % 3 == 0) {
+        v = 255 - v;
+      }
+      v += (int)(rng() % 32) - 16;
+      p[0] = v < 0 ? 0 : v > 255 ? 255 : v;
+      p[1] = (y * 255 / h + (rng() % 16)) & 0xff;
+      p[2] = (x + y) & 0xff;
+    }
+  }
+
+  struct jpeg_compress_struct c;
+  struct jpeg_error_mgr err;
+  unsigned char *out = NULL;
+  unsigned long len = 0;
+  c.err = jpeg_std_error(&err);
+  jpeg_create_compress(&c);
+  jpeg_mem_dest(&c, &out, &len);
+  c.image_width = w;
+  c.image_height = h;
+  c.input_components = 3;
+  c.in_color_space = JCS_RGB;
+  jpeg_set_defaults(&c);
+  jpeg_set_quality(&c, quality, TRUE);
+  if (gray) {
+    jpeg_set_colorspace(&c, JCS_GRAYSCALE);
+  } else {
+    c.comp_info[0].h_samp_factor = hs;
+    c.comp_info[0].v_samp_factor = vs;
+  }
+  c.restart_interval = restart;
+  jpeg_start_compress(&c, TRUE);
+  while (c.next_scanline < c.image_height) {
+    JSAMPROW row = &rgb[c.next_scanline * w * 3];
+    jpeg_write_scanlines(&c, &row, 1);
+  }
+  jpeg_finish_compress(&c);
+  jpeg_destroy_compress(&c);
+
+  char name[64];
+  snprintf(name, sizeof(name), "%dx%d %s q%d rst%d", w, h,
+           gray ? "gray" : hs == 2 && vs == 2 ? "4:2:0" : hs == 2 ? "4:2:2" : "4:4:4", quality, restart);
+  Image img = { name, std::vector<uint8_t>(out, out + len) };
+  free(out);
+  return img;
+}
+
+static std::vector<Image> make_corpus(){
+  static const int sizes[][2] = {{320, 240}, {640, 480}, {800, 600}, {1600, 1200}, {333, 217}};
+  static const int sampling[][3] = {{2, 1, 0}, {2, 2, 0}, {1, 1, 0}, {1, 1, 1}};  // h, v, gray
+  std::mt19937 rng(12345);
+  std::vector<Image> corpus;
+
+  for (auto &s : sizes) {
+    for (auto &m : sampling) {
+      for (int quality : {50, 90}) {
+        for (int restart : {0, 5}) {
+          corpus.push_back(make_image(s[0], s[1], m[0], m[1], m[2], quality, restart, rng));
+        }
+      }
+    }
+  }
+  return corpus;
+}
+
+static bool read_file(const char *path, Image *img){
+  FILE *f = fopen(path, "rb");
+  if (!f) {
+    return false;
+  }
+  img->name = path;
+  uint8_t buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+    img->jpg.insert(img->jpg.end(), buf, buf + n);
+  }
+  fclose(f);
+  return true;
+}
+
+// libjpeg's own 1/8 scale grayscale decode, empty when it fails
+static std::vector<uint8_t> reference(const Image &img, int *w, int *h){
+  struct jpeg_decompress_struct d;
+  struct jpeg_error_mgr err;
+  std::vector<uint8_t> plane;
+
+  d.err = jpeg_std_error(&err);
+  jpeg_create_decompress(&d);
+  jpeg_mem_src(&d, img.jpg.data(), img.jpg.size());
+  if (jpeg_read_header(&d, TRUE) == JPEG_HEADER_OK) {
+    d.scale_num = 1;
+    d.scale_denom = 8;
+    d.out_color_space = JCS_GRAYSCALE;
+    jpeg_start_decompress(&d);
+    *w = d.output_width;
+    *h = d.output_height;
+    plane.resize(*w * *h);
+    while (d.output_scanline < d.output_height) {
+      JSAMPROW row = &plane[d.output_scanline * *w];
+      jpeg_read_scanlines(&d, &row, 1);
+    }
+    jpeg_finish_decompress(&d);
+  }
+  jpeg_destroy_decompress(&d);
+  return plane;
+}
+
+static int verify(const std::vector<Image> &corpus){
+  static uint8_t plane[JPEG_DC_PLANE_MAX];
+  int bad = 0;
+
+  for (auto &img : corpus) {
+    jpeg_dc_t info;
+    int w = 0, h = 0;
+    int err = jpeg_dc_luma(img.jpg.data(), img.jpg.size(), plane, sizeof(plane), &info);
+    std::vector<uint8_t> ref = reference(img, &w, &h);
+    if (err != JPEG_DC_OK) {
+      printf("%-32s %s\n", img.name.c_str(), jpeg_dc_error(err));
+      bad += err != JPEG_DC_UNSUPPORTED && !ref.empty();  // only wrong when libjpeg could decode it
+      continue;
+    }
+    if (info.width != w || info.height != h) {
+      printf("%-32s plane %dx%d, libjpeg %dx%d\n", img.name.c_str(), info.width, info.height, w, h);
+      bad++;
+      continue;
+    }
+    int diff = 0;
+    for (int i = 0; i < w * h; i++) {
+      diff = std::max(diff, abs(plane[i] - ref[i]));
+    }
+    if (diff) {
+      printf("%-32s differs from libjpeg by up to %d\n", img.name.c_str(), diff);
+      bad++;
+    }
+    // cut short, it has to fail cleanly rather than read past the end
+    jpeg_dc_luma(img.jpg.data(), img.jpg.size() / 2, plane, sizeof(plane), &info);
+  }
+  printf("verify: %zu images, %d wrong\n", corpus.size(), bad);
+  return bad;
+}
+
+static double seconds_since(std::chrono::steady_clock::time_point start){
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void bench(const Image &img, int iterations){
+  static uint8_t plane[JPEG_DC_PLANE_MAX];
+  jpeg_dc_t info = {};
+  int w, h;
+
+  if (jpeg_dc_luma(img.jpg.data(), img.jpg.size(), plane, sizeof(plane), &info) != JPEG_DC_OK) {
+    return;
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    jpeg_dc_luma(img.jpg.data(), img.jpg.size(), plane, sizeof(plane), &info);
+  }
+  double dc = seconds_since(start) / iterations;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    reference(img, &w, &h);
+  }
+  double ref = seconds_since(start) / iterations;
+  printf("%-32s %7zu B  %8.1f MB/s  %7.0f us  (libjpeg 1/8 %6.0f us)  mean %3d\n",
+         img.name.c_str(), img.jpg.size(), img.jpg.size() / dc / 1e6, dc * 1e6, ref * 1e6, info.mean);
+}
+
+int main(int argc, char **argv){
+  int iterations = argc > 1 ? atoi(argv[1]) : 50;
+  std::vector<Image> corpus;
+
+  for (int i = 2; i < argc; i++) {
+    Image img;
+    if (!read_file(argv[i], &img)) {
+      fprintf(stderr, "%s: cannot read %s\n", argv[0], argv[i]);
+      return 2;
+    }
+    corpus.push_back(img);
+  }
+  if (corpus.empty()) {
+    corpus = make_corpus();
+  }
+
+  int bad = verify(corpus);
+  for (auto &img : corpus) {
+    bench(img, iterations);
+  }
+  return bad ? 1 : 0;
+}
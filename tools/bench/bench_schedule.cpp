@@ -0,0 +1,390 @@
+// Benchmark of schedule_next() across rule counts and time zones.
+// Before timing, fixed cases check one-shot and not-before rules,
+// parsing and formatting, the legacy settings and what happens in the
+// hours daylight saving time skips or repeats. Every zone is then
+// cross-checked against a brute force search that walks forward minute
+// by minute, also in the days around each DST change, and
+// schedule_per_day() against counting four weeks of captures.
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <random>
+#include <vector>
+
+#include "schedule.h"
+
+static const char *zones[] = {"UTC0", "CET-1CEST,M3.5.0,M10.5.0/3", "PST8PDT,M3.2.0,M11.1.0"};
+static const int64_t base = 1735689600;  // 2025-01-01
+
+static void set_zone(const char *tz){
+  setenv("TZ", tz, 1);
+  tzset();
+}
+
+// a quarter of the rules wait for a not-before time, some of them weeks ahead
+static sched_rule_t random_rule(std::mt19937 &rng){
+  static const uint32_t periods[] = {60, 300, 600, 900, 3600, 7200, 86400};
+  sched_rule_t r;
+
+  memset(&r, 0, sizeof(r));
+  switch (rng() % 5) {
+    case 0:
+      r.kind = SCHED_MONTHLY;
+      r.mday = 1 + rng() % 31;
+      r.start_min = rng() % 1440;
+      break;
+    case 1:
+      r.kind = SCHED_ONESHOT;
+      r.at = base + (int64_t)(rng() % (400u * 24 * 60)) * 60;
+      return r;
+    default:
+      r.kind = SCHED_PERIODIC;
+      r.days = 1 + rng() % SCHED_ALL_DAYS;
+      r.start_min = rng() % 1380;
+      r.end_min = r.start_min + 1 + rng() % (1440 - r.start_min);
+      r.period = periods[rng() % 7];
+      break;
+  }
+  if (rng() % 4 == 0) {
+    r.at = base + (int64_t)(rng() % (400u * 24 * 3600));
+  }
+  return r;
+}
+
+// does the rule fire at the wall time sec on the local day tm?
+static bool fires_on_wall(const sched_rule_t &r, const struct tm &tm, int64_t sec){
+  if (r.kind == SCHED_PERIODIC) {
+    return (r.days & (1 << tm.tm_wday)) && sec >= r.start_min * 60 && sec < r.end_min * 60 &&
+           (sec - r.start_min * 60) % r.period == 0;
+  }
+  static const int mdays[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  int y = tm.tm_year + 1900;
+  int last = mdays[tm.tm_mon] + (tm.tm_mon == 1 && ((y % 4 == 0 && y % 100 != 0) || y % 400 == 0));
+  int mday = r.mday < last ? r.mday : last;
+  return tm.tm_mday == mday && sec == r.start_min * 60;
+}
+
+static int64_t brute_next(const sched_rule_t &r, int64_t now){
+  if (r.kind == SCHED_ONESHOT) {
+    return r.at > now ? r.at : SCHED_NONE;
+  }
+  int64_t from = r.at > now ? r.at - 1 : now;
+  time_t tt = (time_t)from;
+  struct tm tm;
+
+  localtime_r(&tt, &tm);
+  int yday = tm.tm_yday;
+  int64_t passed = tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;  // latest wall time seen today
+  int64_t t = (from / 60 + 1) * 60;
+  for (int64_t limit = t + 62LL * 24 * 3600; t < limit; t += 60) {
+    tt = (time_t)t;
+    localtime_r(&tt, &tm);
+    int64_t sec = tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;
+    if (tm.tm_yday != yday) {
+      yday = tm.tm_yday;
+      passed = -1;
+    }
+    // the minutes the clock jumped over since the last one
+    for (int64_t w = passed < 0 ? 0 : (passed / 60 + 1) * 60; w <= sec; w += 60) {
+      if (fires_on_wall(r, tm, w)) {
+        return t;
+      }
+    }
+    passed = sec > passed ? sec : passed;
+  }
+  return SCHED_NONE;
+}
+
+static int check(const char *what, int64_t got, int64_t expect){
+  if (got == expect) {
+    return 0;
+  }
+  printf("case failed: %s: got %lld, expected %lld\n", what, (long long)got, (long long)expect);
+  return 1;
+}
+
+static int64_t next_of(const char *text, int64_t now){
+  schedule_t s;
+
+  if (schedule_parse(&s, text) != 0) {
+    printf("case failed: \"%s\" did not parse\n", text);
+    return -1;
+  }
+  return schedule_next(&s, now);
+}
+
+static int check_oneshot_and_not_before(void){
+  const int64_t monday = 1748822400;  // 2025-06-02 00:00 UTC
+  char text[SCHED_TEXT_MAX];
+  int bad = 0;
+
+  set_zone("UTC0");
+  snprintf(text, sizeof(text), "o,%lld", (long long)(monday + 1234));
+  bad += check("one-shot ahead", next_of(text, monday), monday + 1234);
+  bad += check("one-shot at now", next_of(text, monday + 1234), SCHED_NONE);
+  bad += check("one-shot passed", next_of(text, monday + 5000), SCHED_NONE);
+  // the first capture on the window's grid at or after the not-before time
+  snprintf(text, sizeof(text), "p,127,06:00,20:00,600,%lld", (long long)(monday + 6 * 3600 + 1));
+  bad += check("periodic not before", next_of(text, monday), monday + 6 * 3600 + 600);
+  snprintf(text, sizeof(text), "p,127,06:00,20:00,600,%lld", (long long)(monday + 6 * 3600));
+  bad += check("periodic not before, on the grid", next_of(text, monday), monday + 6 * 3600);
+  bad += check("periodic past not before", next_of(text, monday + 7 * 3600), monday + 7 * 3600 + 600);
+  snprintf(text, sizeof(text), "m,2,12:00,%lld", (long long)(monday + 13 * 3600));
+  bad += check("monthly not before", next_of(text, monday), 1751457600);  // 2025-07-02 12:00
+  snprintf(text, sizeof(text), "p,127,06:00,20:00,600;o,%lld", (long long)(monday + 3600));
+  bad += check("one-shot first of two", next_of(text, monday), monday + 3600);
+  return bad;
+}
+
+static int check_text(void){
+  static const char *texts[] = {
+    "",
+    "p,62,06:00,20:00,600",
+    "p,127,00:00,24:00,60,1735689600",
+    "m,31,23:59",
+    "m,1,00:00,1748822400",
+    "o,1748822400",
+    "p,1,05:30,05:31,1;m,15,12:00;o,0;p,64,12:00,13:00,86400,42",
+  };
+  static const char *malformed[] = {
+    "x,1", "p", "p,", "p,0,06:00,20:00,600", "p,128,06:00,20:00,600", "p,127,20:00,06:00,600",
+    "p,127,06:00,06:00,600", "p,127,06:00,25:00,600", "p,127,06:60,20:00,600", "p,127,24:01,24:00,60",
+    "p,127,06:00,20:00,0", "p,127,06:00,20:00,86401", "p,127,06:00,20:00,600,", "p,127,06:00,20:00,600,x",
+    "p,127,6,20:00,600", "p,127,06:00;20:00,600", "m,0,12:00", "m,32,12:00", "m,1,24:00", "m,1,12:00,",
+    "o,", "o,-5", "o,12x", "o,1,2", "p,1,06:00,20:00,600;;", "p,1,06:00,20:00,600 ",
+    "o,1;o,2;o,3;o,4;o,5;o,6;o,7;o,8;o,9",
+  };
+  schedule_t s, again;
+  char text[SCHED_TEXT_MAX];
+  int bad = 0;
+
+  for (const char *t : texts) {
+    if (schedule_parse(&s, t) != 0 || schedule_format(&s, text, sizeof(text)) < 0 || strcmp(text, t)) {
+      printf("case failed: \"%s\" does not come back as it was\n", t);
+      bad++;
+    }
+  }
+  for (const char *t : malformed) {
+    s.count = 1;
+    if (schedule_parse(&s, t) != -1 || s.count != 0) {
+      printf("case failed: \"%s\" was accepted\n", t);
+      bad++;
+    }
+  }
+  // every rule the verification uses survives formatting and parsing
+  std::mt19937 rng(777);
+  for (int i = 0; i < 1000; i++) {
+    s.count = 1 + rng() % SCHED_MAX_RULES;
+    for (int k = 0; k < s.count; k++) {
+      s.rules[k] = random_rule(rng);
+    }
+    if (schedule_format(&s, text, sizeof(text)) < 0 || schedule_parse(&again, text) != 0 ||
+        again.count != s.count || memcmp(again.rules, s.rules, s.count * sizeof(sched_rule_t))) {
+      printf("case failed: \"%s\" does not parse back to the same rules\n", text);
+      bad++;
+      break;
+    }
+  }
+  s.count = 1;
+  schedule_parse(&s, "p,62,06:00,20:00,600");
+  bad += check("format into a short buffer", schedule_format(&s, text, 10), -1);
+  return bad;
+}
+
+static int check_legacy(void){
+  const int64_t start = 1748871000;  // Monday 2025-06-02 13:30 UTC
+  schedule_t s;
+  char text[SCHED_TEXT_MAX];
+  int bad = 0;
+
+  set_zone("UTC0");
+  static const struct { char frequency; const char *text; int64_t next; } legacy[] = {
+    {'M', "p,127,00:00,24:00,60,1748871000", start + 60},
+    {'H', "p,127,00:30,24:00,3600,1748871000", start + 3600},
+    {'d', "p,127,13:30,24:00,86400,1748871000", start + 86400},
+    {'w', "p,2,13:30,24:00,86400,1748871000", start + 7 * 86400},
+    {'m', "m,2,13:30,1748871000", 1751463000},  // 2025-07-02 13:30
+  };
+  for (const auto &l : legacy) {
+    schedule_from_legacy(&s, l.frequency, start);
+    schedule_format(&s, text, sizeof(text));
+    if (strcmp(text, l.text)) {
+      printf("case failed: legacy '%c' is \"%s\", expected \"%s\"\n", l.frequency, text, l.text);
+      bad++;
+    }
+    bad += check("legacy first capture", schedule_next(&s, start - 60), start);
+    bad += check("legacy second capture", schedule_next(&s, start), l.next);
+  }
+  schedule_from_legacy(&s, 'x', start);
+  bad += check("legacy unknown frequency", s.count, 0);
+  return bad;
+}
+
+static int check_dst(void){
+  const int64_t spring = 1743292800;  // 2025-03-30 00:00 UTC, 01:00 CET; at 01:00 UTC clocks go to 03:00
+  const int64_t autumn = 1761436800;  // 2025-10-26 00:00 UTC, 02:00 CEST; at 01:00 UTC clocks go to 02:00
+  int bad = 0;
+
+  set_zone(zones[1]);
+  // skipped: 02:30 does not happen, the capture is taken as the clocks go to 03:00
+  bad += check("skipped daily", next_of("p,127,02:30,24:00,86400", spring), spring + 3600);
+  bad += check("skipped monthly", next_of("m,30,02:30", spring), spring + 3600);
+  bad += check("skipped window", next_of("p,127,02:00,03:00,900", spring), spring + 3600);
+  bad += check("skipped window, once", next_of("p,127,02:00,03:00,900", spring + 3600), spring + 24 * 3600);
+  bad += check("window starting in the skipped hour", next_of("p,127,02:39,04:00,60", spring + 3600), spring + 3660);
+  bad += check("after the skipped hour", next_of("p,127,02:00,04:00,900", spring + 3600), spring + 3600 + 900);
+  // repeated: 02:30 fires in the first pass only
+  bad += check("repeated, first pass", next_of("p,127,02:30,24:00,86400", autumn), autumn + 1800);
+  bad += check("repeated, not again", next_of("p,127,02:30,24:00,86400", autumn + 1800), autumn + 1800 + 25 * 3600);
+  bad += check("repeated window ends", next_of("p,127,02:00,03:00,1800", autumn + 1800), autumn + 1800 + 24 * 3600 + 1800);
+  // started in the second pass, the wall times still ahead in it fire
+  bad += check("repeated, second pass", next_of("p,127,02:00,03:00,1800", autumn + 3600 + 60), autumn + 3600 + 1800);
+  bad += check("repeated monthly, second pass", next_of("m,26,02:30", autumn + 3600 + 60), autumn + 3600 + 1800);
+  return bad;
+}
+
+// instants where the zone's UTC offset changes during 2025
+static std::vector<int64_t> dst_changes(void){
+  std::vector<int64_t> changes;
+  time_t t = (time_t)base;
+  struct tm tm;
+
+  localtime_r(&t, &tm);
+  int isdst = tm.tm_isdst;
+  for (int64_t h = base; h < base + 366LL * 24 * 3600; h += 3600) {
+    t = (time_t)h;
+    localtime_r(&t, &tm);
+    if (tm.tm_isdst != isdst) {
+      changes.push_back(h);
+      isdst = tm.tm_isdst;
+    }
+  }
+  return changes;
+}
+
+// now anywhere in the year, then as many again within two days of a DST change
+static int verify(std::mt19937 &rng, int samples){
+  int mismatches = 0, near_dst = 0;
+
+  for (const char *tz : zones) {
+    set_zone(tz);
+    std::vector<int64_t> changes = dst_changes();
+    for (int i = 0; i < 2 * samples; i++) {
+      sched_rule_t r = random_rule(rng);
+      int64_t now = base + (int64_t)(rng() % (366u * 24 * 3600));
+      if (i >= samples) {
+        if (changes.empty()) {
+          break;
+        }
+        now = changes[rng() % changes.size()] - 2 * 86400 + (int64_t)(rng() % (4u * 86400));
+        near_dst++;
+      }
+      int64_t expect = brute_next(r, now);
+      int64_t got = sched_rule_next(&r, now);
+      if (expect == got || (expect == SCHED_NONE && got - now > 62LL * 24 * 3600)) {
+        continue;
+      }
+      if (mismatches++ < 10) {
+        printf("mismatch tz=%s kind=%c days=%u %u-%u period=%u mday=%u at=%lld now=%lld expect=%lld got=%lld\n",
+               tz, r.kind, r.days, r.start_min, r.end_min, (unsigned)r.period, r.mday, (long long)r.at,
+               (long long)now, (long long)expect, (long long)got);
+      }
+    }
+  }
+  printf("verify: %d samples per zone and %d near DST changes, %d mismatches\n", samples, near_dst, mismatches);
+  return mismatches;
+}
+
+// four weeks from any instant hold each weekday's window exactly four times, without DST
+static int verify_per_day(std::mt19937 &rng, int samples){
+  int mismatches = 0;
+  schedule_t s;
+
+  set_zone("UTC0");
+  s.count = 1;
+  for (int i = 0; i < samples; i++) {
+    do {
+      s.rules[0] = random_rule(rng);
+    } while (s.rules[0].kind != SCHED_PERIODIC);
+    s.rules[0].at = 0;
+    int64_t now = base + (int64_t)(rng() % (366u * 24 * 3600));
+    float got = schedule_per_day(&s, now) * 28;
+    int expect = schedule_count(&s, now, now + 28LL * 24 * 3600, INT_MAX);
+    if (fabsf(got - expect) > 0.5f && mismatches++ < 10) {
+      const sched_rule_t &r = s.rules[0];
+      printf("per_day mismatch days=%u %u-%u period=%u: %.1f vs %d in four weeks\n",
+             r.days, r.start_min, r.end_min, (unsigned)r.period, got, expect);
+    }
+  }
+  printf("verify per_day: %d samples, %d mismatches\n", samples, mismatches);
+  return mismatches;
+}
+
+// what /status used to do for the capture rate against schedule_per_day(), on a capture a minute
+static void bench_per_day(int iterations){
+  schedule_t s;
+  int64_t now = base;
+  float sink = 0;
+
+  set_zone("CET-1CEST,M3.5.0,M10.5.0/3");
+  schedule_parse(&s, "p,127,00:00,24:00,60");
+  auto start = std::chrono::steady_clock::now();
+  sink += schedule_count(&s, now, now + 7 * 86400, 10000);
+  sink += schedule_count(&s, now, now + 86400, 10000);
+  auto mid = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    sink += schedule_per_day(&s, now + i);
+  }
+  auto end = std::chrono::steady_clock::now();
+  printf("captures a day: counting %10.0f ns, per rule %6.0f ns  (sink %d)\n",
+         std::chrono::duration<double, std::nano>(mid - start).count(),
+         std::chrono::duration<double, std::nano>(end - mid).count() / iterations, (int)sink & 1);
+}
+
+static void bench(std::mt19937 &rng, int rules, int iterations){
+  schedule_t s;
+  std::vector<int64_t> nows(1024);
+  int64_t sink = 0;
+
+  s.count = rules;
+  for (int i = 0; i < rules; i++) {
+    do {
+      s.rules[i] = random_rule(rng);
+    } while (s.rules[i].kind == SCHED_ONESHOT);
+    s.rules[i].at = 0;
+  }
+  for (auto &n : nows) {
+    n = base + (int64_t)(rng() % (366u * 24 * 3600));
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    sink += schedule_next(&s, nows[i & 1023]);
+  }
+  auto end = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+  printf("%-28s rules=%d  %8.0f ns/call  %10.0f calls/s  (sink %lld)\n",
+         getenv("TZ"), rules, ns, 1e9 / ns, (long long)(sink & 1));
+}
+
+int main(int argc, char **argv){
+  int samples = argc > 1 ? atoi(argv[1]) : 2000;
+  int iterations = argc > 2 ? atoi(argv[2]) : 200000;
+  std::mt19937 rng(12345);
+
+  int bad = check_oneshot_and_not_before() + check_text() + check_legacy() + check_dst();
+  printf("cases: %d failed\n", bad);
+  bad += verify(rng, samples);
+  bad += verify_per_day(rng, samples / 4);
+  for (const char *tz : zones) {
+    set_zone(tz);
+    for (int rules : {1, 4, SCHED_MAX_RULES}) {
+      bench(rng, rules, iterations);
+    }
+  }
+  bench_per_day(iterations);
+  return bad ? 1 : 0;
+}
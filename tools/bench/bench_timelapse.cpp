@@ -0,0 +1,134 @@
+// Benchmark of render_timelapse() in frames per second across thread
+// counts. The frames are a synthetic scene whose exposure drifts slowly
+// and flickers from frame to frame as AEC does between wakes. Each run
+// must write every frame, at least halve the flicker and, for Y4M, give
+// the same bytes whatever the thread count.
+//
+//   bench_timelapse [frames] [width] [height]
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <jpeglib.h>
+
+#include "render.h"
+
+namespace fs = std::filesystem;
+
+static void write_frame(const fs::path &path, int w, int h, int t, float exposure){
+  std::vector<uint8_t> rgb((size_t)w * 3);
+  struct jpeg_compress_struct c;
+  struct jpeg_error_mgr err;
+  FILE *f = fopen(path.c_str(), "wb");
+
+  if (!f) {
+    perror(path.c_str());
+    exit(1);
+  }
+  c.err = jpeg_std_error(&err);
+  jpeg_create_compress(&c);
+  jpeg_stdio_dest(&c, f);
+  c.image_width = w;
+  c.image_height = h;
+  c.input_components = 3;
+  c.in_color_space = JCS_RGB;
+  jpeg_set_defaults(&c);
+  jpeg_set_quality(&c, 85, TRUE);
+  jpeg_start_compress(&c, TRUE);
+  // sky, ground and a shape crossing the frame
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      float r = y < h / 2 ? 90 : 70, g = y < h / 2 ? 120 : 100, b = y < h / 2 ? 170 : 60;
+      float dx = x - (t * 7 % w), dy = y - h * 0.6f;
+      if (dx * dx + dy * dy < h * h / 64) {
+        r = 160, g = 60, b = 40;
+      }
+      float shade = 0.8f + 0.4f * x / w;
+      rgb[x * 3] = std::min(255.0f, r * shade * exposure);
+      rgb[x * 3 + 1] = std::min(255.0f, g * shade * exposure);
+      rgb[x * 3 + 2] = std::min(255.0f, b * shade * exposure);
+    }
+    JSAMPROW row = rgb.data();
+    jpeg_write_scanlines(&c, &row, 1);
+  }
+  jpeg_finish_compress(&c);
+  jpeg_destroy_compress(&c);
+  fclose(f);
+}
+
+static uint64_t file_hash(const fs::path &path){
+  uint64_t h = 1469598103934665603ULL;
+  FILE *f = fopen(path.c_str(), "rb");
+  for (int ch; f && (ch = getc(f)) != EOF; ) {
+    h = (h ^ ch) * 1099511628211ULL;
+  }
+  if (f) {
+    fclose(f);
+  }
+  return h;
+}
+
+int main(int argc, char **argv){
+  int count = argc > 1 ? atoi(argv[1]) : 300;
+  int w = argc > 2 ? atoi(argv[2]) : 800;
+  int h = argc > 3 ? atoi(argv[3]) : 600;
+  int cores = std::max(1u, std::thread::hardware_concurrency());
+  std::mt19937 rng(12345);
+  std::normal_distribution<float> flicker(0, 0.08f);
+  std::vector<std::string> frames;
+  char tmp[] = "/tmp/bench_timelapse.XXXXXX";
+  int bad = 0;
+
+  if (!mkdtemp(tmp)) {
+    perror("mkdtemp");
+    return 1;
+  }
+  for (int t = 0; t < count; t++) {
+    char name[32];
+    snprintf(name, sizeof(name), "frame_%05d.jpg", t);
+    float dusk = 1.0f - 0.4f * t / count;
+    write_frame(fs::path(tmp) / name, w, h, t, dusk * (1 + flicker(rng)));
+    frames.push_back((fs::path(tmp) / name).string());
+  }
+  printf("%d frames %dx%d\n", count, w, h);
+
+  for (RenderFormat format : {RENDER_Y4M, RENDER_MJPEG}) {
+    uint64_t first = 0;
+    for (int threads = 1; ; threads = std::min(threads * 2, cores)) {
+      RenderOptions options;
+      RenderStats stats;
+      std::string error;
+      fs::path out = fs::path(tmp) / "out";
+      options.format = format;
+      options.threads = threads;
+      FILE *f = fopen(out.c_str(), "wb");
+      bool ok = f && render_timelapse(options, frames, f, &stats, &error);
+      if (f) {
+        fclose(f);
+      }
+      uint64_t hash = format == RENDER_Y4M ? file_hash(out) : 0;
+      first = first ? first : hash;
+      ok = ok && stats.frames == (size_t)count && stats.skipped == 0 &&
+           stats.flicker_out < stats.flicker_in / 2 && hash == first;
+      printf("%-5s threads=%-3d %7.1f fps  %5.2f s  slots=%d (%.1f MB)  flicker %.2f -> %.2f%s %s\n",
+             format == RENDER_Y4M ? "y4m" : "mjpeg", threads, stats.frames / stats.seconds, stats.seconds,
+             stats.slots, stats.slot_bytes / 1e6, stats.flicker_in, stats.flicker_out,
+             ok ? "" : "  WRONG", error.c_str());
+      bad += !ok;
+      if (threads == cores) {
+        break;
+      }
+    }
+  }
+
+  fs::remove_all(tmp);
+  return bad ? 1 : 0;
+}
@@ -0,0 +1,296 @@
+// Reference collector for the station uplink (camera_ap_storage/uplink.h).
+// Stations PUT their captures in chunks:
+//
+//   PUT /upload/<station>/<file>
+//   Content-Range: bytes <first>-<last>/<size>
+//
+// A chunk is appended to <dir>/<station>/<file>.part when it starts where
+// that ends, and the file is renamed into place once it has all <size>
+// bytes. The answer is 200 while more is wanted, 201 once complete and
+// 409 for a chunk at any other offset, always with "Upload-Offset: <n>",
+// the bytes held, so an interrupted upload resumes where it stopped.
+// GET /stats returns what was received since the collector started.
+//
+//   collector [-p port] <dir>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define MAX_CHUNK (16 * 1024 * 1024)
+#define IDLE_TIMEOUT_S 60
+
+static std::string root;
+static std::mutex files_mutex;          // offset check and append are one step
+static std::atomic<uint64_t> chunks{0}, bytes{0}, completed{0}, conflicts{0};
+
+// a connection's receive side, buffered
+struct Reader {
+  int fd;
+  char buf[16384];
+  size_t pos = 0, len = 0;
+
+  explicit Reader(int fd) : fd(fd) {}
+
+  bool fill(){
+    if (pos < len) {
+      return true;
+    }
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    pos = 0;
+    len = n > 0 ? n : 0;
+    return n > 0;
+  }
+  bool line(std::string *out){
+    out->clear();
+    while (fill()) {
+      char c = buf[pos++];
+      if (c == '\n') {
+        if (!out->empty() && out->back() == '\r') {
+          out->pop_back();
+        }
+        return true;
+      }
+      if (out->size() > 8192) {
+        return false;
+      }
+      *out += c;
+    }
+    return false;
+  }
+  bool read(char *out, size_t n){
+    while (n > 0 && fill()) {
+      size_t take = std::min(n, len - pos);
+      memcpy(out, buf + pos, take);
+      pos += take;
+      out += take;
+      n -= take;
+    }
+    return n == 0;
+  }
+};
+
+static bool send_all(int fd, const std::string &s){
+  size_t done = 0;
+  while (done < s.size()) {
+    ssize_t n = send(fd, s.data() + done, s.size() - done, MSG_NOSIGNAL);
+    if (n <= 0) {
+      return false;
+    }
+    done += n;
+  }
+  return true;
+}
+
+static bool respond(int fd, int status, const char *reason, int64_t offset, const std::string &body = ""){
+  char head[256];
+  int n = snprintf(head, sizeof(head), "HTTP/1.1 %d %s\r\n", status, reason);
+  if (offset >= 0) {
+    n += snprintf(head + n, sizeof(head) - n, "Upload-Offset: %lld\r\n", (long long)offset);
+  }
+  snprintf(head + n, sizeof(head) - n, "Content-Length: %zu\r\n%s\r\n", body.size(),
+           body.empty() ? "" : "Content-Type: application/json\r\n");
+  return send_all(fd, head + body);
+}
+
+// one percent-decoded path segment, empty when it could escape the directory
+static std::string segment(const std::string &s){
+  std::string out;
+  for (size_t i = 0; i < s.size(); i++) {
+    if (s[i] == '%' && i + 2 < s.size() && isxdigit((unsigned char)s[i + 1]) && isxdigit((unsigned char)s[i + 2])) {
+      out += (char)strtol(s.substr(i + 1, 2).c_str(), nullptr, 16);
+      i += 2;
+    } else {
+      out += s[i];
+    }
+  }
+  if (out.empty() || out == "." || out == ".." || out.find_first_of(std::string("/\\\0", 3)) != std::string::npos) {
+    return "";
+  }
+  return out;
+}
+
+static int64_t file_size(const std::string &path){
+  struct stat st;
+  return stat(path.c_str(), &st) == 0 ? st.st_size : -1;
+}
+
+// the answer to a chunk; offset is set to the bytes held afterwards
+static int store_chunk(const std::string &station, const std::string &name, int64_t first, int64_t total,
+                       const std::vector<char> &body, int64_t *offset){
+  std::string dir = root + "/" + station, path = dir + "/" + name, part = path + ".part";
+  std::lock_guard<std::mutex> lock(files_mutex);
+
+  int64_t complete = file_size(path);
+  if (complete == total) {
+    *offset = total;
+    return 409;
+  }
+  int64_t held = std::max<int64_t>(0, file_size(part));
+  if (first != held || held + (int64_t)body.size() > total) {
+    *offset = held;
+    conflicts++;
+    return 409;
+  }
+  mkdir(dir.c_str(), 0755);
+  int fd = open(part.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  if (fd < 0) {
+    *offset = held;
+    return 500;
+  }
+  size_t done = 0;
+  while (done < body.size()) {
+    ssize_t n = write(fd, body.data() + done, body.size() - done);
+    if (n <= 0) {
+      break;
+    }
+    done += n;
+  }
+  bool ok = close(fd) == 0 && done == body.size();
+  if (!ok) {
+    // drop a partial append so the offset stays a chunk boundary
+    truncate(part.c_str(), held);
+    *offset = held;
+    return 500;
+  }
+  *offset = held + body.size();
+  chunks++;
+  bytes += body.size();
+  if (*offset < total) {
+    return 200;
+  }
+  if (rename(part.c_str(), path.c_str()) != 0) {
+    return 500;
+  }
+  completed++;
+  printf("%s/%s %lld bytes\n", station.c_str(), name.c_str(), (long long)total);
+  fflush(stdout);
+  return 201;
+}
+
+static const char *reason(int status){
+  switch (status) {
+    case 200: return "OK";
+    case 201: return "Created";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 409: return "Conflict";
+    case 413: return "Payload Too Large";
+    default: return "Internal Server Error";
+  }
+}
+
+static void serve(int fd){
+  Reader in{fd};
+  std::string line;
+
+  while (in.line(&line)) {
+    char method[16], target[1024];
+    if (sscanf(line.c_str(), "%15s %1023s", method, target) != 2) {
+      break;
+    }
+    long long length = 0, first = -1, last = -1, total = -1;
+    bool close_after = false;
+    while (in.line(&line) && !line.empty()) {
+      if (!strncasecmp(line.c_str(), "Content-Length:", 15)) {
+        length = atoll(line.c_str() + 15);
+      } else if (!strncasecmp(line.c_str(), "Content-Range:", 14)) {
+        sscanf(line.c_str() + 14, " bytes %lld-%lld/%lld", &first, &last, &total);
+      } else if (!strncasecmp(line.c_str(), "Connection:", 11) && strcasestr(line.c_str(), "close")) {
+        close_after = true;
+      }
+    }
+    if (length < 0 || length > MAX_CHUNK) {
+      respond(fd, 413, reason(413), -1);
+      break;
+    }
+    std::vector<char> body(length);
+    if (!in.read(body.data(), length)) {
+      break;                            // the station went away mid chunk, nothing is kept
+    }
+
+    std::string path = target;
+    if (!strcmp(method, "GET") && path == "/stats") {
+      char json[160];
+      snprintf(json, sizeof(json), "{\"chunks\":%llu,\"bytes\":%llu,\"files\":%llu,\"conflicts\":%llu}",
+               (unsigned long long)chunks, (unsigned long long)bytes, (unsigned long long)completed,
+               (unsigned long long)conflicts);
+      respond(fd, 200, reason(200), -1, json);
+    } else if (!strcmp(method, "PUT") && path.compare(0, 8, "/upload/") == 0) {
+      size_t slash = path.find('/', 8);
+      std::string station = slash == std::string::npos ? "" : segment(path.substr(8, slash - 8));
+      std::string name = slash == std::string::npos ? "" : segment(path.substr(slash + 1));
+      int64_t offset = -1;
+      int status = 400;
+      if (!station.empty() && !name.empty() && first >= 0 && last - first + 1 == length && total > last) {
+        status = store_chunk(station, name, first, total, body, &offset);
+      }
+      if (!respond(fd, status, reason(status), offset)) {
+        break;
+      }
+    } else {
+      respond(fd, 404, reason(404), -1);
+    }
+    if (close_after) {
+      break;
+    }
+  }
+  close(fd);
+}
+
+int main(int argc, char **argv){
+  int port = 8080;
+  int i = 1;
+
+  if (i + 1 < argc && !strcmp(argv[i], "-p")) {
+    port = atoi(argv[i + 1]);
+    i += 2;
+  }
+  if (argc - i != 1) {
+    fprintf(stderr, "usage: %s [-p port] <dir>\n", argv[0]);
+    return 2;
+  }
+  root = argv[i];
+  mkdir(root.c_str(), 0755);
+
+  int listener = socket(AF_INET, SOCK_STREAM, 0);
+  int one = 1;
+  setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(port);
+  if (bind(listener, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(listener, 16) != 0) {
+    perror("listen");
+    return 1;
+  }
+  signal(SIGPIPE, SIG_IGN);
+  printf("collecting into %s on port %d\n", root.c_str(), port);
+  fflush(stdout);
+
+  // a thread per station connection, there are only ever a few
+  while (true) {
+    int fd = accept(listener, nullptr, nullptr);
+    if (fd < 0) {
+      continue;
+    }
+    struct timeval tv = {IDLE_TIMEOUT_S, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    std::thread(serve, fd).detach();
+  }
+}
@@ -0,0 +1,52 @@
+// Copy the photos off a TrailCam card into a library, one directory and
+// index per station, skipping any already there. See library.h.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "library.h"
+
+static int usage(const char *name){
+  fprintf(stderr, "usage: %s [-j threads] [-s station] [-n] <card> <library>\n"
+                  "  -j  worker threads, one per core by default\n"
+                  "  -s  station for photos without one in their EXIF\n"
+                  "  -n  index the photos on the card instead of copying them\n", name);
+  return 2;
+}
+
+int main(int argc, char **argv){
+  IngestOptions options;
+  IngestStats stats;
+  std::string error;
+  int i = 1;
+
+  for (; i < argc && argv[i][0] == '-'; i++) {
+    if (!strcmp(argv[i], "-j") && i + 1 < argc) {
+      options.threads = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+      options.station = argv[++i];
+    } else if (!strcmp(argv[i], "-n")) {
+      options.copy = false;
+    } else {
+      return usage(argv[0]);
+    }
+  }
+  if (argc - i != 2) {
+    return usage(argv[0]);
+  }
+  options.card = argv[i];
+  options.library = argv[i + 1];
+
+  if (!ingest_card(options, &stats, &error)) {
+    fprintf(stderr, "%s\n", error.c_str());
+    return 1;
+  }
+  printf("%zu files, %.1f MB: %zu ingested, %zu known, %zu failed, %zu station indexes\n",
+         stats.files, stats.bytes / 1e6, stats.ingested, stats.known, stats.failed, stats.stations);
+  if (stats.seconds > 0) {
+    printf("%.2f s, %.1f MB/s, %.0f files/s\n", stats.seconds, stats.bytes / 1e6 / stats.seconds,
+           stats.files / stats.seconds);
+  }
+  return stats.failed ? 1 : 0;
+}
@@ -0,0 +1,490 @@
+#include "library.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace fs = std::filesystem;
+
+static inline uint64_t rotl(uint64_t v, int r){
+  return (v << r) | (v >> (64 - r));
+}
+
+static inline uint64_t load64(const uint8_t *p){
+  uint64_t v;
+  memcpy(&v, p, 8);
+  return v;
+}
+
+// four independent lanes over 32 byte stripes, so the multiplies overlap
+uint64_t content_hash(const uint8_t *data, size_t len){
+  const uint64_t p1 = 0x9e3779b185ebca87ULL, p2 = 0xc2b2ae3d27d4eb4fULL;
+  uint64_t lane[4] = {p1 + p2, p2, 0, 0 - p1};
+  size_t i = 0;
+
+  for (; i + 32 <= len; i += 32) {
+    for (int k = 0; k < 4; k++) {
+      lane[k] = rotl(lane[k] + load64(data + i + 8 * k) * p2, 31) * p1;
+    }
+  }
+  uint64_t h = rotl(lane[0], 1) + rotl(lane[1], 7) + rotl(lane[2], 12) + rotl(lane[3], 18) + len;
+  for (; i + 8 <= len; i += 8) {
+    h = rotl(h ^ (rotl(load64(data + i) * p2, 31) * p1), 27) * p1 + p2;
+  }
+  for (; i < len; i++) {
+    h = rotl(h ^ (data[i] * p1), 11) * p2;
+  }
+  h ^= h >> 33;
+  h *= p2;
+  h ^= h >> 29;
+  return h;
+}
+
+// TIFF data of an EXIF segment, in either byte order
+struct Tiff {
+  const uint8_t *p;
+  size_t len;
+  bool big;
+
+  uint16_t u16(size_t at) const {
+    return at + 2 > len ? 0 : big ? p[at] << 8 | p[at + 1] : p[at + 1] << 8 | p[at];
+  }
+  uint32_t u32(size_t at) const {
+    return big ? (uint32_t)u16(at) << 16 | u16(at + 2) : (uint32_t)u16(at + 2) << 16 | u16(at);
+  }
+};
+
+struct Field {
+  uint16_t type = 0;
+  uint32_t count = 0;
+  size_t at = 0;                        // of the value, inline or not
+};
+
+static bool find_tag(const Tiff &t, uint32_t ifd, uint16_t tag, Field *f){
+  int n = t.u16(ifd);
+  for (int i = 0; i < n; i++) {
+    size_t e = ifd + 2 + 12 * i;
+    if (e + 12 > t.len) {
+      return false;
+    }
+    if (t.u16(e) != tag) {
+      continue;
+    }
+    f->type = t.u16(e + 2);
+    f->count = t.u32(e + 4);
+    size_t unit = f->type == 3 ? 2 : f->type == 4 ? 4 : 1;
+    f->at = (uint64_t)unit * f->count <= 4 ? e + 8 : t.u32(e + 8);
+    return f->at + (uint64_t)unit * f->count <= t.len;
+  }
+  return false;
+}
+
+static std::string ascii(const Tiff &t, const Field &f){
+  std::string s((const char *)t.p + f.at, f.count);
+  size_t end = s.find('\0');
+  return end == std::string::npos ? s : s.substr(0, end);
+}
+
+static uint32_t number(const Tiff &t, const Field &f){
+  return f.type == 3 ? t.u16(f.at) : t.u32(f.at);
+}
+
+// the key=value pairs the firmware writes into UserComment
+static void parse_comment(const std::string &text, PhotoMeta *meta){
+  size_t pos = 0;
+  while (pos < text.size()) {
+    size_t end = text.find(' ', pos);
+    std::string kv = text.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+    size_t eq = kv.find('=');
+    if (eq != std::string::npos) {
+      std::string key = kv.substr(0, eq), val = kv.substr(eq + 1);
+      if (key == "battery_v") {
+        meta->battery_v = strtof(val.c_str(), nullptr);
+      } else if (key == "settings") {
+        meta->settings = strtoul(val.c_str(), nullptr, 16);
+      }
+    }
+    if (end == std::string::npos) {
+      break;
+    }
+    pos = end + 1;
+  }
+}
+
+bool parse_exif(const uint8_t *jpg, size_t len, PhotoMeta *meta){
+  size_t pos = 2;
+
+  if (len < 4 || jpg[0] != 0xff || jpg[1] != 0xd8) {
+    return false;
+  }
+  // the segments before the image data, EXIF is one of the first
+  while (pos + 4 <= len && jpg[pos] == 0xff && jpg[pos + 1] != 0xda) {
+    size_t seglen = jpg[pos + 2] << 8 | jpg[pos + 3];
+    const uint8_t *seg = jpg + pos + 4;
+    if (seglen < 2 || pos + 2 + seglen > len) {
+      return false;
+    }
+    if (jpg[pos + 1] == 0xe1 && seglen >= 16 && memcmp(seg, "Exif\0\0", 6) == 0) {
+      Tiff t = { seg + 6, seglen - 8, seg[6] == 'M' };
+      Field f;
+      uint32_t ifd0 = t.u32(4);
+      std::string when;
+      if (find_tag(t, ifd0, 0x0132, &f)) {                 // DateTime
+        when = ascii(t, f);
+      }
+      if (find_tag(t, ifd0, 0x8769, &f)) {                 // ExifIFDPointer
+        uint32_t exif = number(t, f);
+        if (find_tag(t, exif, 0x9003, &f)) {               // DateTimeOriginal
+          when = ascii(t, f);
+        }
+        if (find_tag(t, exif, 0x9011, &f)) {               // OffsetTimeOriginal
+          int hh, mm;
+          char sign;
+          if (sscanf(ascii(t, f).c_str(), "%c%d:%d", &sign, &hh, &mm) == 3 && (sign == '+' || sign == '-')) {
+            meta->utc_offset_min = (sign == '-' ? -1 : 1) * (hh * 60 + mm);
+            meta->has_offset = true;
+          }
+        }
+        if (find_tag(t, exif, 0x9291, &f)) {               // SubSecTimeOriginal
+          std::string sub = ascii(t, f) + "000";
+          meta->millis = atoi(sub.substr(0, 3).c_str());
+        }
+        if (find_tag(t, exif, 0x9286, &f) && f.count > 8) { // UserComment
+          parse_comment(std::string((const char *)t.p + f.at + 8, f.count - 8), meta);
+        }
+        if (find_tag(t, exif, 0xa002, &f)) {               // PixelXDimension
+          meta->width = number(t, f);
+        }
+        if (find_tag(t, exif, 0xa003, &f)) {               // PixelYDimension
+          meta->height = number(t, f);
+        }
+        if (find_tag(t, exif, 0xa431, &f)) {               // BodySerialNumber
+          meta->station = ascii(t, f);
+        }
+      }
+      meta->has_time = sscanf(when.c_str(), "%d:%d:%d %d:%d:%d", &meta->year, &meta->month, &meta->day,
+                              &meta->hour, &meta->minute, &meta->second) == 6;
+      meta->from_exif = true;
+      return true;
+    }
+    pos += 2 + seglen;
+  }
+  return false;
+}
+
+bool parse_name(const char *name, PhotoMeta *meta){
+  const char *base = strrchr(name, '/');
+  base = base ? base + 1 : name;
+  if (sscanf(base, "img_%d-%d-%d_%d-%d-%d", &meta->day, &meta->month, &meta->year,
+             &meta->hour, &meta->minute, &meta->second) != 6) {
+    return false;
+  }
+  meta->millis = 0;
+  meta->has_time = true;
+  return true;
+}
+
+static int64_t days_from_civil(int y, unsigned m, unsigned d){
+  y -= m <= 2;
+  const int era = (y >= 0 ? y : y - 399) / 400;
+  const unsigned yoe = (unsigned)(y - era * 400);
+  const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return (int64_t)era * 146097 + doe - 719468;
+}
+
+bool read_index(const std::string &path, std::vector<LibraryRecord> *records){
+  LibraryHeader h;
+  FILE *f = fopen(path.c_str(), "rb");
+
+  records->clear();
+  if (!f) {
+    return errno == ENOENT;             // no index yet is an empty one
+  }
+  bool ok = fread(&h, sizeof(h), 1, f) == 1 && h.magic == LIBRARY_MAGIC &&
+            h.version == LIBRARY_VERSION && h.record_size == sizeof(LibraryRecord);
+  if (ok) {
+    records->resize(h.count);
+    ok = fread(records->data(), sizeof(LibraryRecord), h.count, f) == h.count;
+  }
+  fclose(f);
+  if (!ok) {
+    records->clear();
+  }
+  return ok;
+}
+
+bool write_index(const std::string &path, std::vector<LibraryRecord> *records){
+  std::string tmp = path + ".tmp";
+  LibraryHeader h = { LIBRARY_MAGIC, LIBRARY_VERSION, sizeof(LibraryRecord), (uint32_t)records->size(), 0 };
+
+  std::sort(records->begin(), records->end(), [](const LibraryRecord &a, const LibraryRecord &b) {
+    return a.time_ms != b.time_ms ? a.time_ms < b.time_ms : strcmp(a.path, b.path) < 0;
+  });
+  FILE *f = fopen(tmp.c_str(), "wb");
+  if (!f) {
+    return false;
+  }
+  bool ok = fwrite(&h, sizeof(h), 1, f) == 1 &&
+            fwrite(records->data(), sizeof(LibraryRecord), records->size(), f) == records->size();
+  ok = fclose(f) == 0 && ok;
+  return ok && rename(tmp.c_str(), path.c_str()) == 0;
+}
+
+// a station ID as a directory name
+static std::string directory_name(const std::string &station){
+  std::string out;
+  for (char c : station) {
+    out += isalnum((unsigned char)c) || c == '-' || c == '_' || c == '.' ? c : '_';
+  }
+  return out.empty() || out[0] == '.' ? "_" + out : out;
+}
+
+struct Job {
+  fs::path path;
+  std::string relative;                 // to the card
+};
+
+struct Result {
+  LibraryRecord record;
+  std::string station;
+  enum { NEW, KNOWN, FAILED } status = FAILED;
+};
+
+class Ingester {
+public:
+  Ingester(const IngestOptions &o) : options(o) {}
+
+  bool load_known(std::string *error){
+    std::error_code ec;
+    if (!fs::exists(options.library, ec)) {
+      return true;
+    }
+    for (auto &entry : fs::directory_iterator(options.library, ec)) {
+      std::vector<LibraryRecord> records;
+      fs::path index = entry.path() / LIBRARY_INDEX;
+      if (!entry.is_directory() || !fs::exists(index)) {
+        continue;
+      }
+      if (!read_index(index.string(), &records)) {
+        *error = "unreadable index " + index.string();
+        return false;
+      }
+      for (auto &r : records) {
+        known.insert(r.hash);
+      }
+    }
+    return true;
+  }
+
+  void process(const Job &job, Result *result){
+    int fd = open(job.path.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || st.st_size == 0) {
+      if (fd >= 0) {
+        close(fd);
+      }
+      return;
+    }
+    size_t size = st.st_size;
+    void *map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+      return;
+    }
+    const uint8_t *data = (const uint8_t *)map;
+    madvise(map, size, MADV_SEQUENTIAL);
+    uint64_t hash = content_hash(data, size);
+    bool fresh;
+    {
+      std::lock_guard<std::mutex> lock(known_mutex);
+      fresh = known.insert(hash).second;
+    }
+    if (!fresh) {
+      result->status = Result::KNOWN;
+      munmap(map, size);
+      return;
+    }
+
+    PhotoMeta meta = {};
+    if (!parse_exif(data, size, &meta) || !meta.has_time) {
+      parse_name(job.path.filename().c_str(), &meta);
+    }
+    LibraryRecord &r = result->record;
+    memset(&r, 0, sizeof(r));
+    r.hash = hash;
+    r.size = size;
+    r.settings = meta.settings;
+    r.battery_v = meta.battery_v;
+    r.width = meta.width;
+    r.height = meta.height;
+    r.utc_offset_min = meta.utc_offset_min;
+    r.flags = (meta.from_exif ? REC_EXIF : 0) | (meta.has_time && !meta.from_exif ? REC_NAME_TIME : 0) |
+              (meta.has_offset ? 0 : REC_LOCAL_TIME);
+    if (meta.has_time) {
+      int64_t s = days_from_civil(meta.year, meta.month, meta.day) * 86400 +
+                  meta.hour * 3600 + meta.minute * 60 + meta.second;
+      r.time_ms = s * 1000 + meta.millis - (meta.has_offset ? meta.utc_offset_min * 60000LL : 0);
+    }
+    result->station = directory_name(!meta.station.empty() ? meta.station :
+                                      !options.station.empty() ? options.station : "unknown");
+
+    bool ok;
+    if (options.copy) {
+      ok = copy(data, size, meta, result);
+    } else {
+      r.flags |= REC_IN_PLACE;
+      ok = job.relative.size() < sizeof(r.path);
+      strncpy(r.path, job.relative.c_str(), sizeof(r.path) - 1);
+    }
+    munmap(map, size);
+    result->status = ok ? Result::NEW : Result::FAILED;
+  }
+
+  // into <station>/YYYY/MM/DD, a suffix when two photos share a second
+  bool copy(const uint8_t *data, size_t size, const PhotoMeta &m, Result *result){
+    char dir[32], name[64];
+    std::error_code ec;
+
+    if (m.has_time) {
+      snprintf(dir, sizeof(dir), "%04d/%02d/%02d", m.year, m.month, m.day);
+    } else {
+      strcpy(dir, "undated");
+    }
+    fs::path station_dir = fs::path(options.library) / result->station;
+    fs::create_directories(station_dir / dir, ec);
+    for (int n = 0; n < 1000; n++) {
+      int len = m.has_time ? snprintf(name, sizeof(name), "%04d%02d%02d_%02d%02d%02d", m.year, m.month, m.day,
+                                      m.hour, m.minute, m.second) :
+                             snprintf(name, sizeof(name), "%016llx", (unsigned long long)result->record.hash);
+      if (n) {
+        snprintf(name + len, sizeof(name) - len, "-%d", n);
+      }
+      std::string relative = std::string(dir) + "/" + result->station + "_" + name + ".jpg";
+      if (relative.size() >= sizeof(result->record.path)) {
+        return false;
+      }
+      int fd = open((station_dir / relative).c_str(), O_WRONLY | O_CREAT | O_EXCL, 0644);
+      if (fd < 0 && errno == EEXIST) {
+        continue;
+      }
+      if (fd < 0) {
+        return false;
+      }
+      size_t done = 0;
+      while (done < size) {
+        ssize_t w = write(fd, data + done, size - done);
+        if (w <= 0) {
+          break;
+        }
+        done += w;
+      }
+      bool ok = close(fd) == 0 && done == size;
+      if (!ok) {
+        unlink((station_dir / relative).c_str());
+        return false;
+      }
+      strcpy(result->record.path, relative.c_str());
+      return true;
+    }
+    return false;
+  }
+
+private:
+  const IngestOptions &options;
+  std::unordered_set<uint64_t> known;
+  std::mutex known_mutex;
+};
+
+static bool is_jpeg(const fs::path &p){
+  std::string ext = p.extension().string();
+  std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+  return ext == ".jpg" || ext == ".jpeg";
+}
+
+bool ingest_card(const IngestOptions &options, IngestStats *stats, std::string *error){
+  auto start = std::chrono::steady_clock::now();
+  Ingester ingester(options);
+  std::vector<Job> jobs;
+  std::error_code ec;
+
+  *stats = IngestStats();
+  if (!ingester.load_known(error)) {
+    return false;
+  }
+  for (auto it = fs::recursive_directory_iterator(options.card, fs::directory_options::skip_permission_denied, ec);
+       it != fs::recursive_directory_iterator(); it.increment(ec)) {
+    if (ec) {
+      break;
+    }
+    if (it->is_regular_file(ec) && is_jpeg(it->path())) {
+      jobs.push_back({ it->path(), fs::relative(it->path(), options.card, ec).string() });
+      stats->bytes += it->file_size(ec);
+    }
+  }
+  if (ec) {
+    *error = "cannot read " + options.card + ": " + ec.message();
+    return false;
+  }
+  stats->files = jobs.size();
+
+  // every worker takes the next file, so slow ones do not hold the rest up
+  std::vector<Result> results(jobs.size());
+  std::atomic<size_t> next{0};
+  int threads = options.threads > 0 ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; t++) {
+    pool.emplace_back([&]() {
+      for (size_t i; (i = next++) < jobs.size(); ) {
+        ingester.process(jobs[i], &results[i]);
+      }
+    });
+  }
+  for (auto &t : pool) {
+    t.join();
+  }
+
+  std::map<std::string, std::vector<LibraryRecord>> added;
+  for (auto &r : results) {
+    if (r.status == Result::NEW) {
+      added[r.station].push_back(r.record);
+      stats->ingested++;
+    } else if (r.status == Result::KNOWN) {
+      stats->known++;
+    } else {
+      stats->failed++;
+    }
+  }
+  for (auto &[station, records] : added) {
+    fs::path dir = fs::path(options.library) / station;
+    std::string index = (dir / LIBRARY_INDEX).string();
+    std::vector<LibraryRecord> all;
+    fs::create_directories(dir, ec);
+    if (!read_index(index, &all)) {
+      *error = "unreadable index " + index;
+      return false;
+    }
+    all.insert(all.end(), records.begin(), records.end());
+    if (!write_index(index, &all)) {
+      *error = "cannot write " + index;
+      return false;
+    }
+    stats->stations++;
+  }
+  stats->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return true;
+}
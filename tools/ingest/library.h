@@ -0,0 +1,93 @@
+// Photo library the ingester fills from TrailCam cards. Each station has
+// a directory with its photos sorted into YYYY/MM/DD and an index.bin of
+// fixed size records in time order, so other tools can find a station's
+// photos for a time range without listing directories or opening a JPEG.
+//
+//   <library>/<station>/index.bin
+//   <library>/<station>/2025/06/15/<station>_20250615_170640.jpg
+#ifndef INGEST_LIBRARY_H
+#define INGEST_LIBRARY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#define LIBRARY_INDEX "index.bin"
+#define LIBRARY_MAGIC 0x58494354        // "TCIX"
+#define LIBRARY_VERSION 1
+
+// record flags
+#define REC_EXIF       0x01             // metadata came from the EXIF segment
+#define REC_NAME_TIME  0x02             // time came from the file name
+#define REC_LOCAL_TIME 0x04             // no UTC offset known, time_ms is local wall clock
+#define REC_IN_PLACE   0x08             // not copied, path is relative to the card
+
+struct LibraryHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t record_size;
+  uint32_t count;
+  uint32_t reserved;
+};
+
+struct LibraryRecord {
+  int64_t time_ms;                      // capture time, UTC unless REC_LOCAL_TIME
+  uint64_t hash;                        // content_hash() of the whole file
+  uint32_t size;
+  uint32_t settings;                    // firmware settings hash, 0 when unknown
+  float battery_v;                      // 0 when unknown
+  int16_t utc_offset_min;
+  uint16_t flags;
+  uint16_t width;
+  uint16_t height;
+  char path[92];                        // relative to the station directory
+};
+static_assert(sizeof(LibraryRecord) == 128, "index records are 128 bytes");
+
+// what a file says about itself, from its EXIF segment or its name
+struct PhotoMeta {
+  int year, month, day, hour, minute, second, millis;  // local wall clock
+  int utc_offset_min;
+  bool has_offset;
+  bool from_exif;
+  bool has_time;
+  std::string station;
+  uint32_t settings;
+  float battery_v;
+  uint16_t width, height;
+};
+
+// a fast 64 bit hash, good enough to tell photos apart; not cryptographic
+uint64_t content_hash(const uint8_t *data, size_t len);
+
+// from the EXIF segment of a JPEG the firmware wrote, false when it has none
+bool parse_exif(const uint8_t *jpg, size_t len, PhotoMeta *meta);
+// the firmware's img_dd-mm-YYYY_HH-MM-SS.jpg names
+bool parse_name(const char *name, PhotoMeta *meta);
+
+bool read_index(const std::string &path, std::vector<LibraryRecord> *records);
+// sorted by time, written to a temporary file and renamed over the old one
+bool write_index(const std::string &path, std::vector<LibraryRecord> *records);
+
+struct IngestOptions {
+  std::string card;
+  std::string library;
+  std::string station;                  // for photos without one in their EXIF
+  int threads = 0;                      // 0 for one per core
+  bool copy = true;                     // false indexes the photos where they are
+};
+
+struct IngestStats {
+  size_t files = 0;                     // JPEGs found on the card
+  size_t bytes = 0;
+  size_t ingested = 0;
+  size_t known = 0;                     // already in the library, or twice on the card
+  size_t failed = 0;
+  size_t stations = 0;                  // indexes written
+  double seconds = 0;
+};
+
+bool ingest_card(const IngestOptions &options, IngestStats *stats, std::string *error);
+
+#endif
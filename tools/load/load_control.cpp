@@ -0,0 +1,162 @@
+// Load test of the TrailCam web servers. Measures how long /control
+// takes to answer, first with no stream open and then while N clients
+// hold /stream on port 81, and how many frames each stream received.
+//
+//   load_control <host> [streams] [requests] [path]
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "net.h"
+
+using Clock = std::chrono::steady_clock;
+
+static const char *boundary = "--123456789000000000000987654321";
+
+struct Stream {
+  std::thread thread;
+  std::atomic<long> frames{0};
+  std::atomic<long> bytes{0};
+  bool refused = false;
+};
+
+// count boundaries as they go past, one may straddle two reads
+static void run_stream(Stream *s, const char *host, std::atomic<bool> *stop){
+  char buf[4096];
+  std::string tail;
+  size_t blen = strlen(boundary);
+
+  int fd = connect_to(host, 81);
+  if (fd < 0 || !send_get(fd, host, "/stream")) {
+    s->refused = true;
+    if (fd >= 0) {
+      close(fd);
+    }
+    return;
+  }
+  while (!*stop) {
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n <= 0) {
+      break;
+    }
+    if (s->bytes == 0 && strncmp(buf, "HTTP/1.1 200", 12) != 0) {
+      s->refused = true;
+      break;
+    }
+    s->bytes += n;
+    tail.append(buf, n);
+    size_t pos = 0;
+    while ((pos = tail.find(boundary, pos)) != std::string::npos) {
+      s->frames++;
+      pos += blen;
+    }
+    tail.erase(0, tail.size() > blen ? tail.size() - blen : 0);
+  }
+  close(fd);
+}
+
+// milliseconds for the whole response, negative when it failed or was not a 200
+static double timed_request(const char *host, const char *path){
+  char buf[2048];
+  auto start = Clock::now();
+  int fd = connect_to(host, 80);
+  if (fd < 0) {
+    return -1;
+  }
+  bool ok = send_get(fd, host, path);
+  bool status = false;
+  bool first = true;
+  ssize_t n;
+  while (ok && (n = recv(fd, buf, sizeof(buf), 0)) > 0) {
+    if (first) {
+      status = n >= 12 && strncmp(buf, "HTTP/1.1 200", 12) == 0;
+      first = false;
+    }
+  }
+  close(fd);
+  double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  return ok && status ? ms : -ms;
+}
+
+static void report(const char *label, std::vector<double> &ms, int failed){
+  if (ms.empty()) {
+    printf("%-12s no successful requests, %d failed\n", label, failed);
+    return;
+  }
+  std::sort(ms.begin(), ms.end());
+  auto pct = [&](double p) { return ms[std::min(ms.size() - 1, (size_t)(p * ms.size()))]; };
+  printf("%-12s n=%zu failed=%d  min %.1f  p50 %.1f  p90 %.1f  p99 %.1f  max %.1f ms\n",
+         label, ms.size(), failed, ms.front(), pct(0.5), pct(0.9), pct(0.99), ms.back());
+}
+
+static void measure(const char *label, const char *host, const char *path, int requests){
+  std::vector<double> ms;
+  int failed = 0;
+
+  for (int i = 0; i < requests; i++) {
+    double t = timed_request(host, path);
+    if (t < 0) {
+      failed++;
+    } else {
+      ms.push_back(t);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }
+  report(label, ms, failed);
+}
+
+int main(int argc, char **argv){
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s <host> [streams] [requests] [path]\n", argv[0]);
+    return 2;
+  }
+  const char *host = argv[1];
+  int streams = argc > 2 ? atoi(argv[2]) : 2;
+  int requests = argc > 3 ? atoi(argv[3]) : 100;
+  // writes the default value, so the station is left as it was
+  const char *path = argc > 4 ? argv[4] : "/control?var=dedup_dist&val=4";
+
+  measure("idle", host, path, requests);
+
+  std::atomic<bool> stop{false};
+  std::vector<Stream> active(streams);
+  for (auto &s : active) {
+    s.thread = std::thread(run_stream, &s, host, &stop);
+  }
+  std::this_thread::sleep_for(std::chrono::seconds(2)); // let the streams get going
+  std::vector<long> at_start, at_end;
+  for (auto &s : active) {
+    at_start.push_back(s.frames);
+  }
+  auto start = Clock::now();
+  char label[32];
+  snprintf(label, sizeof(label), "%d streams", streams);
+  measure(label, host, path, requests);
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  for (auto &s : active) {
+    at_end.push_back(s.frames);
+  }
+  stop = true;
+  for (auto &s : active) {
+    s.thread.join();
+  }
+
+  for (int i = 0; i < streams; i++) {
+    if (active[i].refused) {
+      printf("stream %d refused or dropped after %ld frames\n", i, (long)active[i].frames);
+    } else {
+      printf("stream %d %.1f fps while measuring, %.1f MB in all\n", i,
+             (at_end[i] - at_start[i]) / seconds, active[i].bytes / 1e6);
+    }
+  }
+  return 0;
+}
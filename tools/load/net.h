@@ -0,0 +1,72 @@
+// Socket helpers shared by the load tools.
+#ifndef LOAD_NET_H
+#define LOAD_NET_H
+
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// with a 5 s receive timeout, -1 when it could not connect
+static inline int connect_to(const char *host, int port){
+  struct addrinfo hints, *res;
+  char service[8];
+
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  snprintf(service, sizeof(service), "%d", port);
+  if (getaddrinfo(host, service, &hints, &res) != 0) {
+    return -1;
+  }
+  int fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+  if (fd >= 0) {
+    struct timeval tv = {5, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    if (connect(fd, res->ai_addr, res->ai_addrlen) != 0) {
+      close(fd);
+      fd = -1;
+    }
+  }
+  freeaddrinfo(res);
+  return fd;
+}
+
+static inline bool send_get(int fd, const char *host, const char *path){
+  char request[512];
+  int n = snprintf(request, sizeof(request), "GET %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n", path, host);
+  return send(fd, request, n, 0) == n;
+}
+
+// a GET on port 80, the body in *body; returns the status code, -1 when there was no answer
+static inline int http_get(const char *host, const char *path, std::string *body){
+  char buf[2048];
+  std::string response;
+  ssize_t n;
+
+  int fd = connect_to(host, 80);
+  if (fd < 0) {
+    return -1;
+  }
+  if (send_get(fd, host, path)) {
+    while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) {
+      response.append(buf, n);
+    }
+  }
+  close(fd);
+  size_t end = response.find("\r\n\r\n");
+  if (response.compare(0, 7, "HTTP/1.") != 0 || response.size() < 9 || end == std::string::npos) {
+    return -1;
+  }
+  if (body) {
+    *body = response.substr(end + 4);
+  }
+  return atoi(response.c_str() + 9);
+}
+
+#endif
@@ -0,0 +1,139 @@
+// Heap soak test. Holds a /stream open on port 81 and keeps /control,
+// /capture and /status busy for a number of minutes, sampling the heap
+// and buffer pool figures /status reports. Fragmentation is how much of
+// the free heap is not in its largest block; a run that leaks or
+// fragments shows it climbing from the first sample to the last.
+//
+//   soak_heap <host> [minutes] [sample_seconds]
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "net.h"
+
+using Clock = std::chrono::steady_clock;
+
+struct Sample {
+  double minutes;
+  double heap_free, heap_largest, heap_min_free;
+  double psram_free, psram_largest;
+  std::string pool_peak, pool_failed;
+};
+
+// a number field of the /status JSON, -1 when it is missing
+static double field(const std::string &json, const char *key){
+  std::string k = std::string("\"") + key + "\":";
+  size_t pos = json.find(k);
+  return pos == std::string::npos ? -1 : strtod(json.c_str() + pos + k.size(), nullptr);
+}
+
+// an array field as it stands, "-" when it is missing
+static std::string array(const std::string &json, const char *key){
+  std::string k = std::string("\"") + key + "\":[";
+  size_t pos = json.find(k);
+  size_t end = pos == std::string::npos ? pos : json.find(']', pos);
+  return end == std::string::npos ? "-" : json.substr(pos + k.size() - 1, end - pos - k.size() + 2);
+}
+
+static double fragmentation(double free, double largest){
+  return free > 0 ? 100.0 * (1.0 - largest / free) : 0;
+}
+
+// reopens the stream whenever it drops, the frames are thrown away
+static void run_stream(const char *host, std::atomic<bool> *stop, std::atomic<long> *drops){
+  char buf[4096];
+
+  while (!*stop) {
+    int fd = connect_to(host, 81);
+    if (fd >= 0 && send_get(fd, host, "/stream")) {
+      while (!*stop && recv(fd, buf, sizeof(buf), 0) > 0) {
+      }
+    }
+    if (fd >= 0) {
+      close(fd);
+    }
+    if (!*stop) {
+      (*drops)++;
+      std::this_thread::sleep_for(std::chrono::seconds(1));
+    }
+  }
+}
+
+// the mix a user at the page produces, the setting written is the default
+static void run_requests(const char *host, std::atomic<bool> *stop, std::atomic<long> *done, std::atomic<long> *failed){
+  static const char *paths[] = { "/control?var=dedup_dist&val=4", "/capture", "/status" };
+
+  for (int i = 0; !*stop; i++) {
+    if (http_get(host, paths[i % 3], nullptr) == 200) {
+      (*done)++;
+    } else {
+      (*failed)++;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  }
+}
+
+int main(int argc, char **argv){
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s <host> [minutes] [sample_seconds]\n", argv[0]);
+    return 2;
+  }
+  const char *host = argv[1];
+  double minutes = argc > 2 ? atof(argv[2]) : 60;
+  int every = argc > 3 ? atoi(argv[3]) : 30;
+  std::atomic<bool> stop{false};
+  std::atomic<long> drops{0}, done{0}, failed{0};
+  std::vector<Sample> samples;
+
+  std::thread stream(run_stream, host, &stop, &drops);
+  std::thread requests(run_requests, host, &stop, &done, &failed);
+  printf("%7s %9s %9s %6s %9s %6s %12s %12s\n",
+         "min", "heap", "largest", "frag%", "psram", "frag%", "pool_peak", "pool_failed");
+  auto start = Clock::now();
+  for (;;) {
+    std::string json;
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count() / 60;
+    if (http_get(host, "/status", &json) == 200 && field(json, "heap_free") >= 0) {
+      Sample s = { elapsed, field(json, "heap_free"), field(json, "heap_largest"), field(json, "heap_min_free"),
+                   field(json, "psram_free"), field(json, "psram_largest"),
+                   array(json, "pool_peak"), array(json, "pool_failed") };
+      printf("%7.1f %9.0f %9.0f %6.1f %9.0f %6.1f %12s %12s\n", s.minutes, s.heap_free, s.heap_largest,
+             fragmentation(s.heap_free, s.heap_largest), s.psram_free,
+             fragmentation(s.psram_free, s.psram_largest), s.pool_peak.c_str(), s.pool_failed.c_str());
+      fflush(stdout);
+      samples.push_back(s);
+    } else {
+      printf("%7.1f no /status\n", elapsed);
+    }
+    if (elapsed >= minutes) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::seconds(every));
+  }
+  stop = true;
+  // the stream thread may sit in recv until its timeout
+  stream.join();
+  requests.join();
+
+  printf("\n%ld requests, %ld failed, the stream dropped %ld times\n", (long)done, (long)failed, (long)drops);
+  if (samples.size() < 2) {
+    printf("not enough samples to compare\n");
+    return 1;
+  }
+  const Sample &a = samples.front(), &b = samples.back();
+  printf("heap free     %.0f -> %.0f bytes (%+.0f), lowest ever %.0f\n",
+         a.heap_free, b.heap_free, b.heap_free - a.heap_free, b.heap_min_free);
+  printf("heap frag     %.1f%% -> %.1f%%\n",
+         fragmentation(a.heap_free, a.heap_largest), fragmentation(b.heap_free, b.heap_largest));
+  printf("psram frag    %.1f%% -> %.1f%%\n",
+         fragmentation(a.psram_free, a.psram_largest), fragmentation(b.psram_free, b.psram_largest));
+  return 0;
+}
@@ -0,0 +1,162 @@
+// Plays a station's uplink session against a collector: every JPEG in a
+// folder goes up in Content-Range chunks over one kept alive connection,
+// as camera_ap_storage/uplink.cpp sends them. Every drop_every chunks the
+// connection is cut half way through a body and the station carries on
+// as after a power loss, from offset 0, so the collector has to send it
+// on with a 409. With the collector's folder given, every file it holds
+// is compared with the original.
+//
+//   upload_sim <host> <port> <station> <dir> [chunk_kb] [drop_every] [collector_dir]
+#include <dirent.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "net.h"
+
+static bool read_file(const std::string &path, std::string *data){
+  FILE *f = fopen(path.c_str(), "rb");
+  char buf[65536];
+  size_t n;
+
+  data->clear();
+  if (!f) {
+    return false;
+  }
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+    data->append(buf, n);
+  }
+  fclose(f);
+  return true;
+}
+
+// status and Upload-Offset of one response, -1 when there was none
+static int read_response(int fd, long long *offset){
+  std::string head;
+  char c;
+
+  while (head.size() < 4096 && head.find("\r\n\r\n") == std::string::npos) {
+    if (recv(fd, &c, 1, 0) != 1) {
+      return -1;
+    }
+    head += c;
+  }
+  const char *at = strcasestr(head.c_str(), "\r\nUpload-Offset:");
+  *offset = at ? atoll(at + 16) : -1;
+  const char *length = strcasestr(head.c_str(), "\r\nContent-Length:");
+  for (long n = length ? atol(length + 17) : 0; n > 0; n--) {
+    recv(fd, &c, 1, 0);
+  }
+  return head.compare(0, 7, "HTTP/1.") == 0 && head.size() > 12 ? atoi(head.c_str() + 9) : -1;
+}
+
+int main(int argc, char **argv){
+  if (argc < 5) {
+    fprintf(stderr, "usage: %s <host> <port> <station> <dir> [chunk_kb] [drop_every] [collector_dir]\n", argv[0]);
+    return 2;
+  }
+  const char *host = argv[1];
+  int port = atoi(argv[2]);
+  std::string station = argv[3], dir = argv[4];
+  size_t chunk = (argc > 5 ? atoi(argv[5]) : 32) * 1024;
+  int drop_every = argc > 6 ? atoi(argv[6]) : 0;
+  const char *collected = argc > 7 ? argv[7] : nullptr;
+
+  std::vector<std::string> names;
+  DIR *d = opendir(dir.c_str());
+  for (struct dirent *e; d && (e = readdir(d)); ) {
+    std::string name = e->d_name;
+    if (name.size() > 4 && (name.compare(name.size() - 4, 4, ".jpg") == 0 || name.compare(name.size() - 4, 4, ".ref") == 0)) {
+      names.push_back(name);
+    }
+  }
+  if (d) {
+    closedir(d);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  long long sent = 0, puts = 0, drops = 0, conflicts = 0, failed = 0;
+  int fd = -1;
+  std::string data;
+  for (auto &name : names) {
+    if (!read_file(dir + "/" + name, &data) || data.empty()) {
+      continue;
+    }
+    long long offset = 0;
+    int errors = 0;
+    while (errors < 3) {
+      if (fd < 0) {
+        if ((fd = connect_to(host, port)) < 0) {
+          errors++;
+          continue;
+        }
+        int one = 1;                      // the head and the body go out as two writes
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+      }
+      size_t len = std::min(chunk, (size_t)(data.size() - offset));
+      char head[512];
+      int n = snprintf(head, sizeof(head),
+                       "PUT /upload/%s/%s HTTP/1.1\r\nHost: %s\r\nContent-Range: bytes %lld-%lld/%zu\r\nContent-Length: %zu\r\n\r\n",
+                       station.c_str(), name.c_str(), host, offset, offset + (long long)len - 1, data.size(), len);
+      puts++;
+      if (drop_every && puts % drop_every == 0) {
+        send(fd, head, n, MSG_NOSIGNAL);
+        send(fd, data.data() + offset, len / 2, MSG_NOSIGNAL);
+        close(fd);
+        fd = -1;
+        offset = 0;                       // as if the station lost its place
+        drops++;
+        continue;
+      }
+      long long acked = 0;
+      int status = -1;
+      if (send(fd, head, n, MSG_NOSIGNAL) == n &&
+          send(fd, data.data() + offset, len, MSG_NOSIGNAL) == (ssize_t)len) {
+        status = read_response(fd, &acked);
+      }
+      if (status != 200 && status != 201 && status != 409) {
+        close(fd);
+        fd = -1;
+        errors++;
+        continue;
+      }
+      if (status == 409) {
+        conflicts++;
+      } else {
+        sent += len;
+      }
+      offset = acked;
+      if (status == 201 || offset == (long long)data.size()) {
+        break;
+      }
+    }
+    failed += errors >= 3;
+  }
+  if (fd >= 0) {
+    close(fd);
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  printf("%zu files, %.1f MB sent in %lld PUTs, %lld dropped, %lld resumed by 409, %lld failed\n",
+         names.size(), sent / 1e6, puts, drops, conflicts, failed);
+  printf("%.2f s, %.1f MB/s\n", seconds, sent / 1e6 / seconds);
+
+  int wrong = 0;
+  if (collected) {
+    std::string copy;
+    for (auto &name : names) {
+      read_file(dir + "/" + name, &data);
+      if (!read_file(std::string(collected) + "/" + station + "/" + name, &copy) || copy != data) {
+        if (wrong++ < 10) {
+          printf("  %s differs\n", name.c_str());
+        }
+      }
+    }
+    printf("checked against %s: %d wrong\n", collected, wrong);
+  }
+  return failed || wrong ? 1 : 0;
+}
@@ -0,0 +1,201 @@
+// Round trip of a setting over the /ws WebSocket, from sending the
+// message to its ack, against the same setting as a /control request.
+//
+//   ws_latency <host> [requests] [var] [val]
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "net.h"
+
+using Clock = std::chrono::steady_clock;
+
+static bool recv_all(int fd, void *buf, size_t len){
+  char *p = (char *)buf;
+  while (len) {
+    ssize_t n = recv(fd, p, len, 0);
+    if (n <= 0) {
+      return false;
+    }
+    p += n;
+    len -= n;
+  }
+  return true;
+}
+
+// the key is fixed, the accept header is not checked
+static int ws_open(const char *host){
+  char request[512], buf[1024];
+  size_t got = 0;
+
+  int fd = connect_to(host, 80);
+  if (fd < 0) {
+    return -1;
+  }
+  int n = snprintf(request, sizeof(request),
+                   "GET /ws HTTP/1.1\r\nHost: %s\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                   "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n", host);
+  if (send(fd, request, n, 0) != n) {
+    close(fd);
+    return -1;
+  }
+  // byte at a time, so nothing past the headers is taken
+  while (got < sizeof(buf) - 1 && recv(fd, buf + got, 1, 0) == 1) {
+    got++;
+    if (got >= 4 && memcmp(buf + got - 4, "\r\n\r\n", 4) == 0) {
+      break;
+    }
+  }
+  buf[got] = 0;
+  if (strncmp(buf, "HTTP/1.1 101", 12) != 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+// a client frame has to be masked, a zero mask leaves the payload as it is
+static bool ws_send(int fd, const std::string &text){
+  std::string frame;
+  frame += (char)0x81;
+  if (text.size() < 126) {
+    frame += (char)(0x80 | text.size());
+  } else {
+    frame += (char)(0x80 | 126);
+    frame += (char)(text.size() >> 8);
+    frame += (char)(text.size() & 0xff);
+  }
+  frame.append(4, '\0');
+  frame += text;
+  return send(fd, frame.data(), frame.size(), 0) == (ssize_t)frame.size();
+}
+
+static bool ws_recv(int fd, std::string *text){
+  unsigned char head[2], ext[8];
+  uint64_t len;
+
+  if (!recv_all(fd, head, 2)) {
+    return false;
+  }
+  len = head[1] & 0x7f;
+  if (len == 126 || len == 127) {
+    int bytes = len == 126 ? 2 : 8;
+    if (!recv_all(fd, ext, bytes)) {
+      return false;
+    }
+    len = 0;
+    for (int i = 0; i < bytes; i++) {
+      len = len << 8 | ext[i];
+    }
+  }
+  text->resize(len);
+  return len == 0 || recv_all(fd, &(*text)[0], len);
+}
+
+// milliseconds to the ack, negative when it failed or was refused
+static double ws_request(int fd, int id, const char *var, const char *val){
+  char message[256];
+  std::string reply;
+  char ack[32];
+
+  snprintf(message, sizeof(message), "{\"id\":%d,\"var\":\"%s\",\"val\":\"%s\"}", id, var, val);
+  snprintf(ack, sizeof(ack), "{\"ack\":%d,", id);
+  auto start = Clock::now();
+  if (!ws_send(fd, message)) {
+    return -1;
+  }
+  // status pushes may arrive before the ack
+  while (ws_recv(fd, &reply)) {
+    if (reply.compare(0, strlen(ack), ack) == 0) {
+      double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+      return reply.find("\"ok\":true") != std::string::npos ? ms : -ms;
+    }
+  }
+  return -1;
+}
+
+static double http_request(const char *host, const char *var, const char *val){
+  char request[512], buf[2048];
+  auto start = Clock::now();
+  int fd = connect_to(host, 80);
+  if (fd < 0) {
+    return -1;
+  }
+  int n = snprintf(request, sizeof(request),
+                   "GET /control?var=%s&val=%s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n", var, val, host);
+  bool ok = send(fd, request, n, 0) == n;
+  bool status = false;
+  bool first = true;
+  ssize_t got;
+  while (ok && (got = recv(fd, buf, sizeof(buf), 0)) > 0) {
+    if (first) {
+      status = got >= 12 && strncmp(buf, "HTTP/1.1 200", 12) == 0;
+      first = false;
+    }
+  }
+  close(fd);
+  double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  return ok && status ? ms : -ms;
+}
+
+static void report(const char *label, std::vector<double> &ms, int failed){
+  if (ms.empty()) {
+    printf("%-6s no successful requests, %d failed\n", label, failed);
+    return;
+  }
+  std::sort(ms.begin(), ms.end());
+  auto pct = [&](double p) { return ms[std::min(ms.size() - 1, (size_t)(p * ms.size()))]; };
+  printf("%-6s n=%zu failed=%d  min %.1f  p50 %.1f  p90 %.1f  p99 %.1f  max %.1f ms\n",
+         label, ms.size(), failed, ms.front(), pct(0.5), pct(0.9), pct(0.99), ms.back());
+}
+
+int main(int argc, char **argv){
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s <host> [requests] [var] [val]\n", argv[0]);
+    return 2;
+  }
+  const char *host = argv[1];
+  int requests = argc > 2 ? atoi(argv[2]) : 100;
+  // writes the default value, so the station is left as it was
+  const char *var = argc > 3 ? argv[3] : "dedup_dist";
+  const char *val = argc > 4 ? argv[4] : "4";
+  std::vector<double> ws_ms, http_ms;
+  int ws_failed = 0, http_failed = 0;
+
+  int fd = ws_open(host);
+  if (fd < 0) {
+    fprintf(stderr, "%s: no WebSocket at ws://%s/ws\n", argv[0], host);
+  }
+  // interleaved, so both see the same radio conditions
+  for (int i = 0; i < requests; i++) {
+    if (fd >= 0) {
+      double t = ws_request(fd, i + 1, var, val);
+      if (t < 0) {
+        ws_failed++;
+      } else {
+        ws_ms.push_back(t);
+      }
+    }
+    double t = http_request(host, var, val);
+    if (t < 0) {
+      http_failed++;
+    } else {
+      http_ms.push_back(t);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }
+  if (fd >= 0) {
+    close(fd);
+    report("ws", ws_ms, ws_failed);
+  }
+  report("http", http_ms, http_failed);
+  return 0;
+}
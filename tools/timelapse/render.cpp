@@ -0,0 +1,407 @@
+#include "render.h"
+
+#include <jpeglib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <csetjmp>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+// libjpeg reports errors by calling error_exit, which must not return
+struct JpegError {
+  struct jpeg_error_mgr mgr;
+  jmp_buf jump;
+};
+
+static void error_exit(j_common_ptr cinfo){
+  longjmp(((JpegError *)cinfo->err)->jump, 1);
+}
+
+static void no_message(j_common_ptr){}
+
+static void set_errors(JpegError *err){
+  jpeg_std_error(&err->mgr);
+  err->mgr.error_exit = error_exit;
+  err->mgr.output_message = no_message;
+}
+
+static bool read_file(const std::string &path, std::vector<uint8_t> *data){
+  FILE *f = fopen(path.c_str(), "rb");
+  if (!f) {
+    return false;
+  }
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  data->resize(size > 0 ? size : 0);
+  bool ok = size > 0 && fread(data->data(), 1, size, f) == (size_t)size;
+  fclose(f);
+  return ok;
+}
+
+// 4:2:0 planes, rows padded to whole MCUs and columns by repeating the edge,
+// as jpeg_write_raw_data() reads them
+struct Planes {
+  int width, height;
+  int y_stride, c_stride, c_width, c_height;
+
+  Planes(int w, int h) : width(w), height(h){
+    y_stride = (w + 15) & ~15;
+    c_stride = y_stride / 2;
+    c_width = (w + 1) / 2;
+    c_height = (h + 1) / 2;
+  }
+  size_t y_size() const { return (size_t)y_stride * height; }
+  size_t c_size() const { return (size_t)c_stride * c_height; }
+  size_t size() const { return y_size() + 2 * c_size(); }
+};
+
+struct Slot {
+  enum State { FREE, DECODING, DECODED, FAILED, GRADED, PROCESSING, DONE } state = FREE;
+  size_t frame = 0;
+  std::vector<uint8_t> file;
+  std::vector<uint8_t> pixels;          // Y, U, V
+  std::vector<uint8_t> rows;            // two decoded YCbCr rows
+  double mean = 0;
+  double mean_out = 0;
+  float gain = 1;
+  unsigned char *jpg = nullptr;         // MJPEG output, from jpeg_mem_dest()
+  unsigned long jpg_len = 0;
+};
+
+// the first readable frame sets the output size
+static bool probe(const std::vector<std::string> &frames, int reduce, int *width, int *height){
+  std::vector<uint8_t> data;
+
+  for (auto &path : frames) {
+    struct jpeg_decompress_struct d;
+    JpegError err;
+    if (!read_file(path, &data)) {
+      continue;
+    }
+    d.err = &err.mgr;
+    set_errors(&err);
+    jpeg_create_decompress(&d);
+    if (setjmp(err.jump) == 0) {
+      jpeg_mem_src(&d, data.data(), data.size());
+      jpeg_read_header(&d, TRUE);
+      d.scale_num = 1;
+      d.scale_denom = reduce;
+      jpeg_calc_output_dimensions(&d);
+      *width = d.output_width;
+      *height = d.output_height;
+      jpeg_destroy_decompress(&d);
+      return true;
+    }
+    jpeg_destroy_decompress(&d);
+  }
+  return false;
+}
+
+static bool decode(Slot *s, const std::string &path, const Planes &p, int reduce){
+  struct jpeg_decompress_struct d;
+  JpegError err;
+
+  if (!read_file(path, &s->file)) {
+    return false;
+  }
+  uint8_t *Y = s->pixels.data(), *U = Y + p.y_size(), *V = U + p.c_size();
+  d.err = &err.mgr;
+  set_errors(&err);
+  jpeg_create_decompress(&d);
+  if (setjmp(err.jump)) {
+    jpeg_destroy_decompress(&d);
+    return false;
+  }
+  jpeg_mem_src(&d, s->file.data(), s->file.size());
+  jpeg_read_header(&d, TRUE);
+  bool gray = d.jpeg_color_space == JCS_GRAYSCALE;
+  d.out_color_space = gray ? JCS_GRAYSCALE : JCS_YCbCr;
+  d.scale_num = 1;
+  d.scale_denom = reduce;
+  jpeg_start_decompress(&d);
+  if ((int)d.output_width != p.width || (int)d.output_height != p.height) {
+    jpeg_destroy_decompress(&d);
+    return false;
+  }
+  const int w = p.width, n = d.output_components;
+  uint64_t sum = 0;
+  s->rows.resize(2 * (size_t)w * 3);
+  if (gray) {
+    memset(U, 128, 2 * p.c_size());
+  }
+  while (d.output_scanline < d.output_height) {
+    int y = d.output_scanline;
+    JSAMPROW row = s->rows.data() + (y & 1) * w * 3;
+    jpeg_read_scanlines(&d, &row, 1);
+    uint8_t *out = Y + (size_t)y * p.y_stride;
+    for (int x = 0; x < w; x++) {
+      out[x] = row[x * n];
+      sum += row[x * n];
+    }
+    memset(out + w, out[w - 1], p.y_stride - w);
+    // average each 2x2 block of chroma, the last row or column paired with itself
+    if (gray || (!(y & 1) && y + 1 < p.height)) {
+      continue;
+    }
+    const uint8_t *a = y & 1 ? s->rows.data() : row, *b = row;
+    uint8_t *u = U + (size_t)(y / 2) * p.c_stride, *v = V + (size_t)(y / 2) * p.c_stride;
+    for (int cx = 0; cx < p.c_width; cx++) {
+      int x0 = 2 * cx * 3, x1 = std::min(2 * cx + 1, w - 1) * 3;
+      u[cx] = (a[x0 + 1] + a[x1 + 1] + b[x0 + 1] + b[x1 + 1] + 2) >> 2;
+      v[cx] = (a[x0 + 2] + a[x1 + 2] + b[x0 + 2] + b[x1 + 2] + 2) >> 2;
+    }
+    memset(u + p.c_width, u[p.c_width - 1], p.c_stride - p.c_width);
+    memset(v + p.c_width, v[p.c_width - 1], p.c_stride - p.c_width);
+  }
+  jpeg_finish_decompress(&d);
+  jpeg_destroy_decompress(&d);
+  s->mean = (double)sum / ((double)w * p.height);
+  return true;
+}
+
+static bool encode(Slot *s, const Planes &p, int quality){
+  struct jpeg_compress_struct c;
+  JpegError err;
+  JSAMPROW y_rows[16], u_rows[8], v_rows[8];
+  JSAMPARRAY planes[3] = {y_rows, u_rows, v_rows};
+  uint8_t *Y = s->pixels.data(), *U = Y + p.y_size(), *V = U + p.c_size();
+
+  free(s->jpg);
+  s->jpg = nullptr;
+  s->jpg_len = 0;
+  c.err = &err.mgr;
+  set_errors(&err);
+  jpeg_create_compress(&c);
+  if (setjmp(err.jump)) {
+    jpeg_destroy_compress(&c);
+    return false;
+  }
+  jpeg_mem_dest(&c, &s->jpg, &s->jpg_len);
+  c.image_width = p.width;
+  c.image_height = p.height;
+  c.input_components = 3;
+  c.in_color_space = JCS_YCbCr;
+  jpeg_set_defaults(&c);
+  jpeg_set_quality(&c, quality, TRUE);
+  c.raw_data_in = TRUE;
+  c.comp_info[0].h_samp_factor = c.comp_info[0].v_samp_factor = 2;
+  c.comp_info[1].h_samp_factor = c.comp_info[1].v_samp_factor = 1;
+  c.comp_info[2].h_samp_factor = c.comp_info[2].v_samp_factor = 1;
+  jpeg_start_compress(&c, TRUE);
+  while (c.next_scanline < c.image_height) {
+    int y0 = c.next_scanline;
+    for (int i = 0; i < 16; i++) {
+      y_rows[i] = Y + (size_t)std::min(y0 + i, p.height - 1) * p.y_stride;
+    }
+    for (int i = 0; i < 8; i++) {
+      size_t row = std::min(y0 / 2 + i, p.c_height - 1) * (size_t)p.c_stride;
+      u_rows[i] = U + row;
+      v_rows[i] = V + row;
+    }
+    jpeg_write_raw_data(&c, planes, 16);
+  }
+  jpeg_finish_compress(&c);
+  jpeg_destroy_compress(&c);
+  return true;
+}
+
+static void apply_gain(Slot *s, const Planes &p){
+  uint8_t lut[256];
+  uint64_t sum = 0;
+
+  for (int i = 0; i < 256; i++) {
+    lut[i] = (uint8_t)std::min(255.0f, i * s->gain + 0.5f);
+  }
+  for (int y = 0; y < p.height; y++) {
+    uint8_t *row = s->pixels.data() + (size_t)y * p.y_stride;
+    for (int x = 0; x < p.y_stride; x++) {
+      row[x] = lut[row[x]];
+    }
+    for (int x = 0; x < p.width; x++) {
+      sum += row[x];
+    }
+  }
+  s->mean_out = (double)sum / ((double)p.width * p.height);
+}
+
+static bool write_frame(FILE *out, const Slot &s, const Planes &p, RenderFormat format){
+  if (format == RENDER_MJPEG) {
+    return fwrite(s.jpg, 1, s.jpg_len, out) == s.jpg_len;
+  }
+  const uint8_t *Y = s.pixels.data(), *U = Y + p.y_size(), *V = U + p.c_size();
+  bool ok = fputs("FRAME\n", out) >= 0;
+  for (int y = 0; ok && y < p.height; y++) {
+    ok = fwrite(Y + (size_t)y * p.y_stride, 1, p.width, out) == (size_t)p.width;
+  }
+  for (const uint8_t *plane : {U, V}) {
+    for (int y = 0; ok && y < p.c_height; y++) {
+      ok = fwrite(plane + (size_t)y * p.c_stride, 1, p.c_width, out) == (size_t)p.c_width;
+    }
+  }
+  return ok;
+}
+
+bool render_timelapse(const RenderOptions &options, const std::vector<std::string> &frames, FILE *out,
+                      RenderStats *stats, std::string *error){
+  auto start = std::chrono::steady_clock::now();
+  int width, height;
+
+  *stats = RenderStats();
+  if (!probe(frames, options.reduce, &width, &height)) {
+    *error = "no readable frames";
+    return false;
+  }
+  const Planes planes(width, height);
+  const size_t n = frames.size();
+  const int radius = std::max(0, options.radius);
+  const int threads = options.threads > 0 ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+
+  // frames waiting for the writer, the deflicker lookahead, and two per worker
+  std::vector<Slot> slots(radius + 1 + 2 * threads);
+  for (auto &s : slots) {
+    s.pixels.resize(planes.size());
+  }
+  stats->width = width;
+  stats->height = height;
+  stats->slots = slots.size();
+  stats->slot_bytes = slots.size() * planes.size();
+
+  if (options.format == RENDER_Y4M) {
+    fprintf(out, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", width, height, options.fps);
+  }
+
+  std::mutex mutex;
+  std::condition_variable changed;
+  size_t next = 0;                      // to decode
+  size_t graded = 0;
+  size_t written = 0;
+  bool failed = false;
+  auto slot = [&](size_t frame) -> Slot & { return slots[frame % slots.size()]; };
+  auto finished = [&]() { return written == n || failed; };
+
+  // a worker grades, encodes or decodes, in that order, so frames leave as soon as they can
+  auto worker = [&]() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      Slot *job = nullptr;
+      changed.wait(lock, [&]() {
+        for (size_t k = written; k < next && !job; k++) {
+          job = slot(k).state == Slot::GRADED ? &slot(k) : nullptr;
+        }
+        return job || finished() || (next < n && slot(next).state == Slot::FREE);
+      });
+      if (job) {
+        job->state = Slot::PROCESSING;
+        lock.unlock();
+        apply_gain(job, planes);
+        bool ok = options.format != RENDER_MJPEG || encode(job, planes, options.quality);
+        lock.lock();
+        job->state = ok ? Slot::DONE : Slot::FAILED;
+      } else if (finished()) {
+        return;
+      } else {
+        size_t frame = next++;
+        job = &slot(frame);
+        job->frame = frame;
+        job->state = Slot::DECODING;
+        lock.unlock();
+        bool ok = decode(job, frames[frame], planes, options.reduce);
+        lock.lock();
+        job->state = ok ? Slot::DECODED : Slot::FAILED;
+      }
+      changed.notify_all();
+    }
+  };
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; t++) {
+    pool.emplace_back(worker);
+  }
+
+  // the writer: grade frames once their lookahead is decoded, write them in order
+  std::vector<double> window(2 * radius + 1, NAN);
+  double last_in = NAN, last_out = NAN;
+  size_t steps = 0;
+  auto lookahead_ready = [&](size_t g) {
+    for (size_t k = g; k <= std::min(n - 1, g + radius); k++) {
+      if (k >= next || slot(k).state == Slot::DECODING) {
+        return false;
+      }
+    }
+    return true;
+  };
+  std::unique_lock<std::mutex> lock(mutex);
+  while (!finished()) {
+    bool progress = false;
+    while (graded < n && lookahead_ready(graded)) {
+      for (size_t k = graded; k <= std::min(n - 1, graded + radius); k++) {
+        window[k % window.size()] = slot(k).state == Slot::FAILED ? NAN : slot(k).mean;
+      }
+      Slot &s = slot(graded);
+      if (s.state == Slot::DECODED) {
+        double total = 0;
+        int count = 0;
+        for (size_t k = graded >= (size_t)radius ? graded - radius : 0; k <= std::min(n - 1, graded + radius); k++) {
+          if (!std::isnan(window[k % window.size()])) {
+            total += window[k % window.size()];
+            count++;
+          }
+        }
+        double gain = s.mean >= 1 ? total / count / s.mean : 1;
+        s.gain = std::clamp((float)gain, 1 / options.max_gain, options.max_gain);
+        s.state = Slot::GRADED;
+      }
+      graded++;
+      progress = true;
+    }
+    while (written < graded && (slot(written).state == Slot::DONE || slot(written).state == Slot::FAILED)) {
+      Slot &s = slot(written);
+      if (s.state == Slot::DONE) {
+        lock.unlock();
+        bool ok = write_frame(out, s, planes, options.format);
+        lock.lock();
+        if (!ok) {
+          *error = "write failed";
+          failed = true;
+          break;
+        }
+        if (!std::isnan(last_in)) {
+          stats->flicker_in += fabs(s.mean - last_in);
+          stats->flicker_out += fabs(s.mean_out - last_out);
+          steps++;
+        }
+        last_in = s.mean;
+        last_out = s.mean_out;
+        stats->frames++;
+      } else {
+        stats->skipped++;
+      }
+      s.state = Slot::FREE;
+      written++;
+      progress = true;
+    }
+    if (progress) {
+      changed.notify_all();
+    } else {
+      changed.wait(lock);
+    }
+  }
+  lock.unlock();
+  changed.notify_all();
+  for (auto &t : pool) {
+    t.join();
+  }
+  for (auto &s : slots) {
+    free(s.jpg);
+  }
+  if (steps) {
+    stats->flicker_in /= steps;
+    stats->flicker_out /= steps;
+  }
+  stats->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return !failed && fflush(out) == 0;
+}
@@ -0,0 +1,46 @@
+// Timelapse renderer. Frames are decoded on a pool of workers into a
+// fixed ring of slots, graded in order by the caller's thread and written
+// as Y4M or MJPEG, so memory depends on the frame size, the thread count
+// and the deflicker window but not on how many frames there are.
+//
+// Deflicker: AEC/AGC settle a little differently on every wake, so each
+// frame's mean luma is pulled towards the average over its neighbours,
+// radius frames either side, with a gain on Y. Slow changes such as
+// dusk pass through; frame to frame jumps are removed.
+#ifndef TIMELAPSE_RENDER_H
+#define TIMELAPSE_RENDER_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+enum RenderFormat { RENDER_Y4M, RENDER_MJPEG };
+
+struct RenderOptions {
+  RenderFormat format = RENDER_Y4M;
+  int threads = 0;                      // 0 for one per core
+  int radius = 7;                       // deflicker window either side, 0 for none
+  int fps = 30;
+  int quality = 90;                     // MJPEG only
+  int reduce = 1;                       // decode at 1/1, 1/2, 1/4 or 1/8 size
+  float max_gain = 2.0f;                // a frame is never brightened or darkened by more
+};
+
+struct RenderStats {
+  size_t frames = 0;                    // written
+  size_t skipped = 0;                   // unreadable, or not the size of the first frame
+  int width = 0;
+  int height = 0;
+  int slots = 0;
+  size_t slot_bytes = 0;                // all frame memory, fixed for the whole run
+  double flicker_in = 0;                // mean |luma change| between frames, before
+  double flicker_out = 0;               // and after deflicker
+  double seconds = 0;
+};
+
+// frames in the order they are to appear; all are sized as the first readable one
+bool render_timelapse(const RenderOptions &options, const std::vector<std::string> &frames, FILE *out,
+                      RenderStats *stats, std::string *error);
+
+#endif
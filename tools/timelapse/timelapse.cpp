@@ -0,0 +1,129 @@
+// Render a station's photos, or a list of JPEGs, into a deflickered
+// timelapse. See render.h.
+#include <sys/stat.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "library.h"
+#include "render.h"
+
+static int usage(const char *name){
+  fprintf(stderr, "usage: %s [options] -o <out.y4m|out.mjpeg|-> <station dir | file.jpg ...>\n"
+                  "  -j threads   decode and encode threads, one per core by default\n"
+                  "  -d radius    deflicker over this many frames either side, 0 for none (7)\n"
+                  "  -f fps       frame rate written to the Y4M header (30)\n"
+                  "  -q quality   MJPEG quality (90)\n"
+                  "  -r 1|2|4|8   decode at a fraction of the full size\n"
+                  "  -c card      where photos indexed in place (ingest -n) are\n"
+                  "  -a time      from, UTC, YYYY-MM-DD[THH:MM[:SS]]\n"
+                  "  -b time      until, the same\n", name);
+  return 2;
+}
+
+// UTC milliseconds, -1 when it does not parse
+static int64_t parse_time(const char *s){
+  struct tm tm = {};
+  int n = sscanf(s, "%d-%d-%dT%d:%d:%d", &tm.tm_year, &tm.tm_mon, &tm.tm_mday, &tm.tm_hour, &tm.tm_min, &tm.tm_sec);
+  if (n != 3 && n < 5) {
+    return -1;
+  }
+  tm.tm_year -= 1900;
+  tm.tm_mon -= 1;
+  return (int64_t)timegm(&tm) * 1000;
+}
+
+static bool is_dir(const char *path){
+  struct stat st;
+  return stat(path, &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+int main(int argc, char **argv){
+  RenderOptions options;
+  RenderStats stats;
+  std::string error, card;
+  const char *output = nullptr;
+  int64_t from = INT64_MIN, until = INT64_MAX;
+  int i = 1;
+
+  for (; i < argc && argv[i][0] == '-' && argv[i][1]; i++) {
+    const char *arg = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (!arg || strlen(argv[i]) != 2) {
+      return usage(argv[0]);
+    }
+    switch (argv[i++][1]) {
+      case 'j': options.threads = atoi(arg); break;
+      case 'd': options.radius = atoi(arg); break;
+      case 'f': options.fps = atoi(arg); break;
+      case 'q': options.quality = atoi(arg); break;
+      case 'r': options.reduce = atoi(arg); break;
+      case 'c': card = arg; break;
+      case 'o': output = arg; break;
+      case 'a': from = parse_time(arg); break;
+      case 'b': until = parse_time(arg); break;
+      default: return usage(argv[0]);
+    }
+    if (from == -1 || until == -1 || options.fps < 1 || options.quality < 1 || options.quality > 100 ||
+        (options.reduce != 1 && options.reduce != 2 && options.reduce != 4 && options.reduce != 8)) {
+      return usage(argv[0]);
+    }
+  }
+  if (!output || i == argc) {
+    return usage(argv[0]);
+  }
+  size_t len = strlen(output);
+  options.format = len > 5 && !strcmp(output + len - 5, ".mjpg") ? RENDER_MJPEG :
+                   len > 6 && !strcmp(output + len - 6, ".mjpeg") ? RENDER_MJPEG : RENDER_Y4M;
+
+  // a station directory is read through its index, which is already in time order
+  std::vector<std::string> frames;
+  if (argc - i == 1 && is_dir(argv[i])) {
+    std::string station = argv[i];
+    std::vector<LibraryRecord> records;
+    if (!read_index(station + "/" LIBRARY_INDEX, &records) || records.empty()) {
+      fprintf(stderr, "no index in %s\n", station.c_str());
+      return 1;
+    }
+    size_t in_place = 0;
+    for (auto &r : records) {
+      if (r.time_ms < from || r.time_ms > until) {
+        continue;
+      }
+      if (r.flags & REC_IN_PLACE) {
+        in_place += card.empty();
+        frames.push_back(card + "/" + r.path);
+      } else {
+        frames.push_back(station + "/" + r.path);
+      }
+    }
+    if (in_place) {
+      fprintf(stderr, "%zu photos were indexed in place, give their card with -c\n", in_place);
+      return 1;
+    }
+  } else {
+    frames.assign(argv + i, argv + argc);
+  }
+
+  FILE *out = strcmp(output, "-") ? fopen(output, "wb") : stdout;
+  if (!out) {
+    perror(output);
+    return 1;
+  }
+  bool ok = render_timelapse(options, frames, out, &stats, &error);
+  if (out != stdout && fclose(out) != 0) {
+    ok = false;
+    error = "cannot write " + std::string(output);
+  }
+  if (!ok) {
+    fprintf(stderr, "%s\n", error.c_str());
+    return 1;
+  }
+  fprintf(stderr, "%zu frames %dx%d, %zu skipped, %.1f fps, %d slots (%.1f MB), flicker %.2f -> %.2f\n",
+          stats.frames, stats.width, stats.height, stats.skipped, stats.frames / stats.seconds,
+          stats.slots, stats.slot_bytes / 1e6, stats.flicker_in, stats.flicker_out);
+  return 0;
+}